@@ -33,7 +33,6 @@ static value_t fl_nconc(value_t *args, uint32_t nargs)
 {
     value_t lst, first;
     value_t *pcdr;
-    struct cons *c;
     uint32_t i;
 
     if (nargs == 0)
@@ -47,10 +46,9 @@ static value_t fl_nconc(value_t *args, uint32_t nargs)
             break;
         if (iscons(lst)) {
             *pcdr = lst;
-            c = (struct cons *)ptr(lst);
-            while (iscons(c->cdr))
-                c = (struct cons *)ptr(c->cdr);
-            pcdr = &c->cdr;
+            while (iscons(cdr_(lst)))
+                lst = cdr_(lst);
+            pcdr = &cdr_(lst);
         } else if (lst != FL_NIL) {
             type_error("nconc", "cons", lst);
         }
@@ -81,10 +79,9 @@ static value_t fl_memq(value_t *args, uint32_t nargs)
 {
     argcount("memq", nargs, 2);
     while (iscons(args[1])) {
-        struct cons *c = (struct cons *)ptr(args[1]);
-        if (c->car == args[0])
+        if (car_(args[1]) == args[0])
             return args[1];
-        args[1] = c->cdr;
+        args[1] = cdr_(args[1]);
     }
     return FL_F;
 }
@@ -490,6 +487,13 @@ MATH_FUNC_1ARG(asin)
 MATH_FUNC_1ARG(acos)
 MATH_FUNC_1ARG(atan)
 
+static value_t fl_time_now(value_t *args, uint32_t nargs)
+{
+    (void)args;
+    argcount("time.now", nargs, 0);
+    return mk_double(clock_now());
+}
+
 static const char help_text[] =
 ""
 "----------------------------------------------------------------------\n"
@@ -548,6 +552,8 @@ static struct builtinspec builtin_info[] = {
     { "acos", fl_acos },
     { "atan", fl_atan },
 
+    { "time.now", fl_time_now },
+
     { "path.cwd", fl_path_cwd },
 
     { "help*", builtin_help_star },
@@ -0,0 +1,498 @@
+// Heap census and snapshots. Both do a whole collection, so that what
+// is in the heap is what is live, and then walk the objects reachable
+// from the roots, numbering each the first time it is reached. The
+// walk is breadth first with census_nodes as its queue, so that the
+// references each object holds end up together in census_edges.
+//
+// A snapshot adds retained sizes: what a collection would free if an
+// object went away, which is its own size plus the retained sizes of
+// the objects it immediately dominates. Dominators come from the
+// iterative algorithm of Cooper, Harvey and Kennedy, run on the object
+// graph with an extra node 0 that refers to every root.
+//
+// The snapshot format has every number as an unsigned LEB128 varint:
+//
+//   the 8 bytes "UPSHEAP1"
+//   strings: a count, then each as its length in bytes and the bytes
+//   objects: a count, then for each, numbered from 1 in order, its
+//     type and label as string numbers, bytes, retained bytes and
+//     number of references, followed by the number of each object
+//     it refers to
+//   roots: a count, then the number of each root object and a label
+//
+// String 0 is empty and means no label. Types are named as by
+// heap-census. A function's label is its name, and a root's is the
+// global variable bound to it, if any.
+
+struct census_node {
+    value_t v;
+    uintptr_t kind;     // as for the heap profiler
+    value_t label;      // a symbol, or 0
+    value_t rootlabel;  // the same for node 0's reference to it
+    size_t bytes;
+    uint32_t edges;  // where its references start in census_edges
+    int isroot;
+};
+
+static struct census_node *census_nodes;
+static size_t census_n, census_maxn;
+static uint32_t *census_edges;
+static size_t census_nedges, census_maxedges;
+static struct htable census_ids;  // object address -> node number * 2
+static int census_keep_edges;     // only a snapshot needs them
+static int census_rooting;        // while walking the roots
+static value_t census_label;      // of the root being walked
+static int census_failed;         // out of memory
+
+static uintptr_t census_kind(value_t v)
+{
+    switch (tag(v)) {
+    case TAG_CONS:
+        return PROF_CONS;
+    case TAG_VECTOR:
+        return PROF_VECTOR;
+    case TAG_FUNCTION:
+        return PROF_FUNCTION;
+    case TAG_CPRIM:
+        return (uintptr_t)cp_class((struct cprim *)ptr(v));
+    case TAG_CVALUE:
+        return (uintptr_t)cv_class((struct cvalue *)ptr(v));
+    }
+    return PROF_GENSYM;
+}
+
+// Bytes of heap v takes, or its own block for a large vector, plus any
+// data outside the heap that a cvalue owns.
+static size_t census_bytes(value_t v)
+{
+    struct cvalue *cv;
+    size_t n;
+
+    if (islarge(v))
+        return large_of(v)->size;
+    n = ALIGN(gc_nwords(v, ((value_t *)ptr(v))[0]), 2) * sizeof(value_t);
+    if (tag(v) == TAG_CVALUE) {
+        cv = (struct cvalue *)ptr(v);
+        if (!isinlined(cv) && owned(cv))
+            n += cv_len(cv);
+    }
+    return n;
+}
+
+// The node number of the object v is, adding a node if it's new, or 0
+// if v isn't an object.
+static uint32_t census_number(value_t v)
+{
+    struct census_node *n;
+    void **bp;
+
+    v = ungrown(v);
+    if ((tag(v) & 3) == 0 || !(ismanaged(v) || islarge(v)) || census_failed)
+        return 0;
+    bp = ptrhash_bp(&census_ids, ptr(v));
+    if (*bp != HT_NOTFOUND)
+        return (uint32_t)((uintptr_t)*bp >> 1);
+    if (census_n == census_maxn) {
+        n = realloc(census_nodes, 2 * census_maxn * sizeof(*n));
+        if (n == NULL) {
+            census_failed = 1;
+            return 0;
+        }
+        census_nodes = n;
+        census_maxn *= 2;
+    }
+    *bp = (void *)((uintptr_t)census_n << 1);
+    n = &census_nodes[census_n];
+    n->v = v;
+    n->kind = census_kind(v);
+    n->label = 0;
+    if (tag(v) == TAG_FUNCTION && fn_name(v) != LAMBDA)
+        n->label = fn_name(v);
+    n->rootlabel = 0;
+    n->bytes = census_bytes(v);
+    n->isroot = 0;
+    return (uint32_t)census_n++;
+}
+
+static value_t census_visit(value_t v)
+{
+    uint32_t id, *e;
+
+    if (!(id = census_number(v)) || !census_keep_edges)
+        return v;
+    if (census_rooting) {
+        if (census_nodes[id].isroot)
+            return v;
+        census_nodes[id].isroot = 1;
+        census_nodes[id].rootlabel = census_label;
+    }
+    if (census_nedges == census_maxedges) {
+        e = realloc(census_edges, 2 * census_maxedges * sizeof(*e));
+        if (e == NULL) {
+            census_failed = 1;
+            return v;
+        }
+        census_edges = e;
+        census_maxedges *= 2;
+    }
+    census_edges[census_nedges++] = id;
+    return v;
+}
+
+// Global variables first, so that the roots they hold get their names.
+static void census_globals(struct symbol *root)
+{
+    while (root != NULL) {
+        if (root->binding != UNBOUND) {
+            census_label = tagptr(root, TAG_SYM);
+            census_visit(root->binding);
+        }
+        census_globals(root->left);
+        root = root->right;
+    }
+}
+
+static void census_free(void)
+{
+    free(census_nodes);
+    free(census_edges);
+    census_nodes = NULL;
+    census_edges = NULL;
+    htable_free(&census_ids);
+}
+
+// Collect, then number everything reachable. Raises memory-error if
+// we run out of memory for that.
+static void census_walk(int keep_edges, const char *fname)
+{
+    size_t i;
+
+    full_gc();
+    census_maxn = census_maxedges = 4096;
+    census_nodes = malloc(census_maxn * sizeof(*census_nodes));
+    census_edges = malloc(census_maxedges * sizeof(*census_edges));
+    htable_new(&census_ids, census_maxn);
+    census_failed = !census_nodes || !census_edges;
+    census_keep_edges = keep_edges;
+    census_n = 1;  // node 0 stands for the roots
+    census_nedges = 0;
+    gc_visit = census_visit;
+    if (!census_failed) {
+        memset(&census_nodes[0], 0, sizeof(census_nodes[0]));
+        census_rooting = 1;
+        census_globals(symtab);
+        census_label = 0;
+        trace_roots();
+        census_rooting = 0;
+    }
+    for (i = 1; i < census_n && !census_failed; i++) {
+        census_nodes[i].edges = (uint32_t)census_nedges;
+        compact_scan(census_nodes[i].v);
+    }
+    gc_visit = relocate;
+    if (census_failed) {
+        census_free();
+        lerrorf(MemoryError, "%s: out of memory", fname);
+    }
+}
+
+#define census_first(i) (census_nodes[i].edges)
+#define census_end(i) \
+    ((i) + 1 < census_n ? census_nodes[(i) + 1].edges : census_nedges)
+
+// The retained bytes of each node, in a malloc'd array, or NULL if out
+// of memory.
+static uint64_t *census_retained(void)
+{
+    uint32_t *pstart, *preds, *post, *order, *idom, *stack, *next;
+    uint32_t v, w, a, b, k, sp, e, nidom;
+    uint64_t *retained;
+    size_t n, i;
+    int changed;
+
+    n = census_n;
+    pstart = calloc(n + 1, sizeof(uint32_t));
+    preds = malloc((census_nedges + 1) * sizeof(uint32_t));
+    post = malloc(n * sizeof(uint32_t));
+    order = malloc(n * sizeof(uint32_t));
+    idom = malloc(n * sizeof(uint32_t));
+    stack = malloc(n * sizeof(uint32_t));
+    next = malloc(n * sizeof(uint32_t));
+    retained = malloc(n * sizeof(uint64_t));
+    if (!pstart || !preds || !post || !order || !idom || !stack || !next ||
+        !retained) {
+        free(retained);
+        retained = NULL;
+        goto done;
+    }
+
+    // who refers to each node
+    for (e = 0; e < census_nedges; e++)
+        pstart[census_edges[e] + 1]++;
+    for (i = 0; i < n; i++)
+        pstart[i + 1] += pstart[i];
+    memcpy(next, pstart, n * sizeof(uint32_t));
+    for (i = 0; i < n; i++) {
+        for (e = census_first(i); e < census_end(i); e++)
+            preds[next[census_edges[e]]++] = (uint32_t)i;
+    }
+
+    // number the nodes in depth-first postorder
+    memset(post, 0xff, n * sizeof(uint32_t));
+    for (i = 0; i < n; i++)
+        next[i] = census_first(i);
+    k = sp = 0;
+    stack[sp++] = 0;
+    post[0] = 0;  // seen
+    while (sp) {
+        v = stack[sp - 1];
+        if (next[v] < census_end(v)) {
+            w = census_edges[next[v]++];
+            if (post[w] == UINT32_MAX) {
+                post[w] = 0;
+                stack[sp++] = w;
+            }
+        } else {
+            sp--;
+            post[v] = k;
+            order[k++] = v;
+        }
+    }
+
+    // find immediate dominators, taking the nodes in reverse postorder
+    memset(idom, 0xff, n * sizeof(uint32_t));
+    idom[0] = 0;
+    do {
+        changed = 0;
+        for (k = (uint32_t)n - 1; k-- > 0;) {
+            v = order[k];
+            nidom = UINT32_MAX;
+            for (e = pstart[v]; e < pstart[v + 1]; e++) {
+                a = preds[e];
+                if (idom[a] == UINT32_MAX)
+                    continue;
+                if (nidom == UINT32_MAX) {
+                    nidom = a;
+                    continue;
+                }
+                b = nidom;
+                while (a != b) {
+                    while (post[a] < post[b])
+                        a = idom[a];
+                    while (post[b] < post[a])
+                        b = idom[b];
+                }
+                nidom = a;
+            }
+            if (idom[v] != nidom) {
+                idom[v] = nidom;
+                changed = 1;
+            }
+        }
+    } while (changed);
+
+    // a node comes before its dominators in postorder
+    for (i = 0; i < n; i++)
+        retained[i] = census_nodes[i].bytes;
+    for (k = 0; k + 1 < n; k++)
+        retained[idom[order[k]]] += retained[order[k]];
+
+done:
+    free(pstart);
+    free(preds);
+    free(post);
+    free(order);
+    free(idom);
+    free(stack);
+    free(next);
+    return retained;
+}
+
+struct census_type {
+    uintptr_t kind;
+    uint64_t count, bytes;
+};
+
+static int census_type_cmp(const void *a, const void *b)
+{
+    const struct census_type *x = a, *y = b;
+
+    if (x->bytes != y->bytes)
+        return x->bytes < y->bytes ? 1 : -1;
+    return x->count < y->count ? 1 : x->count > y->count ? -1 : 0;
+}
+
+// (heap-census) => a list of (type count bytes) for each type of object
+// live after a whole collection, the most bytes first. The types are
+// pair, vector, function and gensym, and the type of each kind of cprim
+// and cvalue. Bytes include data that a cvalue keeps outside the heap.
+static value_t fl_heap_census(value_t *args, uint32_t nargs)
+{
+    struct census_type *types, *t;
+    size_t ntypes, i, j;
+    value_t v;
+
+    (void)args;
+    argcount("heap-census", nargs, 0);
+    census_walk(0, "heap-census");
+    types = NULL;
+    ntypes = j = 0;
+    for (i = 1; i < census_n; i++) {
+        if (j >= ntypes || types[j].kind != census_nodes[i].kind) {
+            for (j = 0; j < ntypes; j++) {
+                if (types[j].kind == census_nodes[i].kind)
+                    break;
+            }
+            if (j == ntypes) {
+                t = realloc(types, (ntypes + 1) * sizeof(*t));
+                if (t == NULL) {
+                    free(types);
+                    census_free();
+                    lerror(MemoryError, "heap-census: out of memory");
+                }
+                types = t;
+                types[ntypes].kind = census_nodes[i].kind;
+                types[ntypes].count = types[ntypes].bytes = 0;
+                ntypes++;
+            }
+        }
+        types[j].count++;
+        types[j].bytes += census_nodes[i].bytes;
+    }
+    census_free();
+    if (ntypes)
+        qsort(types, ntypes, sizeof(*types), census_type_cmp);
+    PUSH(FL_NIL);
+    for (i = ntypes; i-- > 0;) {
+        v = return_from_uint64(types[i].bytes);
+        PUSH(fl_cons(v, FL_NIL));
+        v = return_from_uint64(types[i].count);
+        Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+        Stack[SP - 1] = fl_cons(prof_kind_name(types[i].kind),
+                                Stack[SP - 1]);
+        v = POP();
+        Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+    }
+    free(types);
+    return POP();
+}
+
+static void census_put(struct ios *f, uint64_t n)
+{
+    char buf[10];
+    int i;
+
+    for (i = 0; n >= 0x80; n >>= 7)
+        buf[i++] = (char)(n | 0x80);
+    buf[i++] = (char)n;
+    ios_write(f, buf, i);
+}
+
+// The number of string s in the snapshot, adding it to strs if new.
+static uint64_t census_string(struct htable *strs, value_t **list,
+                              size_t *n, value_t s)
+{
+    value_t *l;
+    void **bp;
+
+    if (s == 0)
+        return 0;
+    bp = ptrhash_bp(strs, (void *)s);
+    if (*bp != HT_NOTFOUND)
+        return (uintptr_t)*bp >> 1;
+    if (!(l = realloc(*list, (*n + 1) * sizeof(value_t))))
+        return 0;
+    *list = l;
+    l[*n] = s;
+    *bp = (void *)((uintptr_t)*n << 1);
+    return (*n)++;
+}
+
+static void census_write(struct ios *f, uint64_t *retained)
+{
+    struct htable strs;
+    struct ios m;
+    value_t *list;
+    uint64_t *type, *label;
+    size_t nstrs, i;
+    uint32_t e;
+
+    type = malloc(census_n * sizeof(uint64_t));
+    label = malloc(census_n * sizeof(uint64_t));
+    list = malloc(sizeof(value_t));
+    if (!type || !label || !list) {
+        free(type);
+        free(label);
+        free(list);
+        free(retained);
+        census_free();
+        lerror(MemoryError, "heap-snapshot: out of memory");
+    }
+    htable_new(&strs, 64);
+    list[0] = 0;
+    nstrs = 1;
+    for (i = 1; i < census_n; i++) {
+        type[i] = census_string(&strs, &list, &nstrs,
+                                prof_kind_name(census_nodes[i].kind));
+        label[i] =
+        census_string(&strs, &list, &nstrs, census_nodes[i].label);
+        if (census_nodes[i].isroot)
+            census_string(&strs, &list, &nstrs, census_nodes[i].rootlabel);
+    }
+
+    ios_write(f, "UPSHEAP1", 8);
+    census_put(f, nstrs);
+    ios_mem(&m, 0);
+    for (i = 0; i < nstrs; i++) {
+        ios_trunc(&m, 0);
+        ios_seek(&m, 0);
+        if (issymbol(list[i]))
+            ios_puts(symbol_name(list[i]), &m);
+        else if (list[i] != 0)
+            fl_print(&m, list[i]);
+        census_put(f, m.size);
+        ios_write(f, m.buf, m.size);
+    }
+    ios_close(&m);
+    census_put(f, census_n - 1);
+    for (i = 1; i < census_n; i++) {
+        census_put(f, type[i]);
+        census_put(f, label[i]);
+        census_put(f, census_nodes[i].bytes);
+        census_put(f, retained[i]);
+        census_put(f, census_end(i) - census_first(i));
+        for (e = census_first(i); e < census_end(i); e++)
+            census_put(f, census_edges[e]);
+    }
+    census_put(f, census_end(0));
+    for (e = 0; e < census_end(0); e++) {
+        census_put(f, census_edges[e]);
+        census_put(f, census_string(&strs, &list, &nstrs,
+                                    census_nodes[census_edges[e]].rootlabel));
+    }
+    htable_free(&strs);
+    free(list);
+    free(type);
+    free(label);
+}
+
+// (heap-snapshot port) writes a snapshot of the live heap to port, in
+// the format described above.
+static value_t fl_heap_snapshot(value_t *args, uint32_t nargs)
+{
+    uint64_t *retained;
+    struct ios *f;
+
+    argcount("heap-snapshot", nargs, 1);
+    fl_toiostream(args[0], "heap-snapshot");
+    census_walk(1, "heap-snapshot");
+    if (!(retained = census_retained())) {
+        census_free();
+        lerror(MemoryError, "heap-snapshot: out of memory");
+    }
+    f = fl_toiostream(args[0], "heap-snapshot");
+    census_write(f, retained);
+    free(retained);
+    census_free();
+    return FL_T;
+}
@@ -0,0 +1,338 @@
+// Sliding mark-compact collection, the alternative to the copying
+// collector for programs that can't afford two semispaces. The heap is
+// a single block. Collection marks live objects, computes where each
+// will land, rewrites every pointer to its new address and then slides
+// the live data down in address order, so no second space is needed.
+//
+// Conses have no header, so the heap can't be parsed by walking it.
+// Marking therefore records the tag of each live object in objmap (one
+// byte per cons-sized granule, nonzero only at object starts) and sets
+// a bit in consflags for every granule an object covers. An object's
+// new address is the heap base plus the number of live granules below
+// it, which livecount[] (one running total per bitmap word) and a
+// popcount make cheap to find.
+//
+// Opaque cvalues take part through their relocate hooks: the hook is
+// called with old and new value equal to mark and to rewrite the Lisp
+// values it holds, and once more after the slide, with relocate a no-op,
+// so it can fix pointers into its own inline data.
+//
+// Vectors in the large object space stay where they are. Marking sets
+// the mark in their headers, and their elements are rewritten along
+// with the heap's.
+
+#define GRANULE sizeof(struct cons)
+
+static unsigned char *objmap;
+static uint32_t *livecount;
+static unsigned char *compact_base;  // where the live data goes
+static value_t *markstack;
+static size_t markstack_n, markstack_cap;
+static int markstack_full;
+
+static uint32_t popcount32(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0f0f0f0f;
+    return (x * 0x01010101) >> 24;
+}
+
+#define granule_of(v) \
+    ((size_t)(((unsigned char *)ptr(v)) - fromspace) / GRANULE)
+
+static size_t object_granules(value_t v)
+{
+    size_t nw;
+
+    switch (tag(v)) {
+    case TAG_CONS:
+        return 1;
+    case TAG_VECTOR:
+        nw = vector_size(v) + 1;
+        break;
+    case TAG_CPRIM:
+        nw = CPRIM_NWORDS - 1 +
+             NWORDS(cp_class((struct cprim *)ptr(v))->size);
+        break;
+    case TAG_CVALUE:
+        nw = cv_nwords((struct cvalue *)ptr(v));
+        break;
+    case TAG_FUNCTION:
+        nw = 4;
+        break;
+    default:
+        nw = sizeof(struct gensym) / sizeof(void *);
+        break;
+    }
+    return ALIGN(nw, 2) / 2;
+}
+
+// A vector that the reader outgrew stands for its replacement.
+static value_t ungrown(value_t v)
+{
+    while (isvector(v) && (vector_elt(v, -1) & 0x1))
+        v = vector_elt(v, 0);
+    return v;
+}
+
+static void compact_push(value_t v)
+{
+    value_t *ms;
+
+    if (markstack_n == markstack_cap) {
+        ms = realloc(markstack, 2 * markstack_cap * sizeof(value_t));
+        if (ms == NULL) {
+            markstack_full = 1;
+            return;
+        }
+        markstack = ms;
+        markstack_cap *= 2;
+    }
+    markstack[markstack_n++] = v;
+}
+
+static value_t compact_mark(value_t v)
+{
+    value_t w;
+    size_t g;
+
+    if ((tag(v) & 3) == 0)
+        return v;
+    w = ungrown(v);
+    if (!ismanaged(w)) {
+        if (islarge(w) && large_mark(w))
+            compact_push(w);
+        return v;
+    }
+    g = granule_of(w);
+    if (objmap[g])
+        return v;
+    objmap[g] = (unsigned char)tag(w);
+    compact_push(w);
+    return v;
+}
+
+static value_t compact_forward(value_t v)
+{
+    size_t g, w, n;
+
+    if ((tag(v) & 3) == 0)
+        return v;
+    v = ungrown(v);
+    if (!ismanaged(v))
+        return v;
+    g = granule_of(v);
+    w = g / 32;
+    n = livecount[w];
+    if (g % 32)
+        n += popcount32(consflags[w] & ((1u << (g % 32)) - 1));
+    return tagptr(compact_base + n * GRANULE, tag(v));
+}
+
+static value_t compact_identity(value_t v) { return v; }
+
+// Rewrite (or, when marking, push) the values inside one object.
+static void compact_scan(value_t v)
+{
+    struct fltype *t;
+    size_t i, n;
+
+    switch (tag(v)) {
+    case TAG_CONS:
+        car_(v) = gc_visit(car_(v));
+        cdr_(v) = gc_visit(cdr_(v));
+        break;
+    case TAG_VECTOR:
+        n = vector_size(v);
+        for (i = 0; i < n; i++)
+            vector_elt(v, i) = gc_visit(vector_elt(v, i));
+        break;
+    case TAG_CVALUE:
+        t = cv_class((struct cvalue *)ptr(v));
+        if (t->vtable != NULL && t->vtable->relocate != NULL)
+            t->vtable->relocate(v, v);
+        break;
+    case TAG_FUNCTION:
+        fn_bcode(v) = gc_visit(fn_bcode(v));
+        fn_vals(v) = gc_visit(fn_vals(v));
+        fn_env(v) = gc_visit(fn_env(v));
+        break;
+    case TAG_SYM:
+        if (((struct gensym *)ptr(v))->binding != UNBOUND)
+            ((struct gensym *)ptr(v))->binding =
+            gc_visit(((struct gensym *)ptr(v))->binding);
+        break;
+    }
+}
+
+static void compact_clear(size_t ngranules)
+{
+    memset(objmap, 0, ngranules);
+    memset(consflags, 0, bitvector_nwords(ngranules) * sizeof(uint32_t));
+}
+
+static struct cvalue *compact_survivor(struct cvalue *cv)
+{
+    value_t v = tagptr(cv, TAG_CVALUE);
+
+    if (!objmap[granule_of(v)])
+        return NULL;
+    return (struct cvalue *)ptr(compact_forward(v));
+}
+
+// Fix up cvalues after the slide: inline data pointers, and pointers
+// into their own data that relocate hooks know about. The hook sees the
+// old header so that it can compare against old addresses.
+static void compact_fix_cvalues(size_t ngranules)
+{
+    value_t oldspace[CVALUE_NWORDS + 1];
+    struct cvalue *old, *cv;
+    struct fltype *t;
+    size_t g;
+
+    old = (struct cvalue *)ALIGN((uintptr_t)oldspace, 8);
+    gc_visit = compact_identity;
+    for (g = 0; g < ngranules; g++) {
+        if (objmap[g] != TAG_CVALUE)
+            continue;
+        cv = (struct cvalue *)ptr(
+        compact_forward(tagptr(fromspace + g * GRANULE, TAG_CVALUE)));
+        *old = *cv;
+        if (cv->data == &((struct cvalue *)(fromspace + g * GRANULE))
+                         ->_space[0])
+            cv->data = &cv->_space[0];
+        t = cv_class(cv);
+        if (t->vtable != NULL && t->vtable->relocate != NULL)
+            t->vtable->relocate(tagptr(old, TAG_CVALUE),
+                                tagptr(cv, TAG_CVALUE));
+    }
+}
+
+static void compact_slide(size_t ngranules)
+{
+    size_t g, start, dest;
+
+    dest = 0;
+    for (g = 0; g < ngranules;) {
+        if (!consflags[g / 32] && !(g % 32)) {
+            g += 32;
+            continue;
+        }
+        if (!bitvector_get(consflags, g)) {
+            g++;
+            continue;
+        }
+        start = g;
+        while (g < ngranules && bitvector_get(consflags, g))
+            g++;
+        memmove(compact_base + dest * GRANULE, fromspace + start * GRANULE,
+                (g - start) * GRANULE);
+        dest += g - start;
+    }
+}
+
+// Make the side tables big enough for a heap of newsize bytes, keeping
+// their contents. Returns 0 if we can't. They never shrink.
+static int compact_grow_tables(size_t newsize)
+{
+    size_t oldn, newn;
+    uint32_t *flags, *counts;
+    unsigned char *map;
+
+    oldn = heapsize / GRANULE;
+    newn = newsize / GRANULE;
+    if (!(flags = bitvector_resize(consflags, oldn, newn, 1)))
+        return 0;
+    consflags = flags;
+    if (!(map = realloc(objmap, newn)))
+        return 0;
+    objmap = map;
+    memset(objmap + oldn, 0, newn - oldn);
+    counts = realloc(livecount, (newn / 32 + 1) * sizeof(uint32_t));
+    if (!counts)
+        return 0;
+    livecount = counts;
+    return 1;
+}
+
+static void compact_gc(int mustgrow)
+{
+    size_t ngranules, nlive, w, nwords, oldsize, newsize;
+    unsigned char *newheap;
+    value_t v;
+
+    ngranules = (size_t)(curheap - fromspace) / GRANULE;
+    nwords = bitvector_nwords(ngranules);
+    compact_clear(ngranules);
+
+    // mark
+    markstack_n = 0;
+    markstack_full = 0;
+    gc_visit = compact_mark;
+    trace_roots();
+    while (markstack_n && !markstack_full) {
+        v = markstack[--markstack_n];
+        if (ismanaged(v)) {
+            w = granule_of(v);
+            bitvector_fill(&consflags[w / 32], w % 32, 1,
+                           (uint32_t)object_granules(v));
+        }
+        compact_scan(v);
+    }
+    if (markstack_full) {
+        compact_clear(ngranules);
+        large_unmark();
+        gc_visit = relocate;
+        fl_raise(memory_exception_value);
+    }
+    large_sweep();
+
+    // plan: running live totals, and a heap of another size if this
+    // one is too full or has been too empty
+    for (nlive = w = 0; w < nwords; w++) {
+        livecount[w] = (uint32_t)nlive;
+        nlive += popcount32(consflags[w]);
+    }
+    gc_copied += nlive * GRANULE;
+    // a bigger heap is the same space grown in place, unless that
+    // can't be done and the live data go to a new one
+    oldsize = heapsize;
+    newsize = heap_target(nlive * GRANULE, mustgrow);
+    newheap = NULL;
+    if (newsize > heapsize && compact_grow_tables(newsize)) {
+        if (space_adjust(fromspace, heapsize, newsize))
+            heapsize = newsize;
+        else
+            newheap = space_new(newsize);
+    }
+    compact_base = newheap ? newheap : fromspace;
+
+    // rewrite pointers, then move
+    gc_visit = compact_forward;
+    trace_roots();
+    for (w = 0; w < ngranules; w++) {
+        if (objmap[w])
+            compact_scan(tagptr(fromspace + w * GRANULE, objmap[w]));
+    }
+    large_scan(compact_scan);
+    sweep_finalizers();
+    prof_sweep();
+    compact_slide(ngranules);
+    compact_fix_cvalues(ngranules);
+    compact_clear(ngranules);
+    gc_visit = relocate;
+
+    if (newheap) {
+        space_free(fromspace);
+        fromspace = newheap;
+        heapsize = newsize;
+    } else if (newsize < heapsize &&
+               space_adjust(fromspace, heapsize, newsize)) {
+        heapsize = newsize;
+    }
+    curheap = fromspace + nlive * GRANULE;
+    lim = fromspace + heapsize - sizeof(struct cons);
+    if (curheap > lim || (mustgrow && heapsize <= oldsize))
+        fl_raise(memory_exception_value);  // we couldn't grow
+}
@@ -39,10 +39,12 @@ value_t cvalue_typeof(value_t *args, uint32_t nargs);
 #define ALLOC_LIMIT_TRIGGER 67108864
 
 static size_t malloc_pressure = 0;
+static uint32_t malloc_pressure_gcs = 0;  // collections it triggered
 
 static struct cvalue **Finalizers = NULL;
 static size_t nfinalizers = 0;
 static size_t maxfinalizers = 0;
+static uint64_t nfinalized = 0;
 
 void add_finalizer(struct cvalue *cv)
 {
@@ -63,15 +65,15 @@ static void sweep_finalizers(void)
 {
     struct cvalue **lst = Finalizers;
     size_t n = 0, ndel = 0, l = nfinalizers;
-    struct cvalue *tmp;
+    struct cvalue *tmp, *live;
 #define SWAP_sf(a, b) (tmp = a, a = b, b = tmp, 1)
     if (l == 0)
         return;
     do {
         tmp = lst[n];
-        if (isforwarded((value_t)tmp)) {
+        if ((live = gc_survivor(tmp))) {
             // object is alive
-            lst[n] = (struct cvalue *)ptr(forwardloc((value_t)tmp));
+            lst[n] = live;
             n++;
         } else {
             struct fltype *t = cv_class(tmp);
@@ -79,6 +81,8 @@ static void sweep_finalizers(void)
                 t->vtable->finalize(tagptr(tmp, TAG_CVALUE));
             }
             if (!isinlined(tmp) && owned(tmp)) {
+                if (cv_isstr(tmp))
+                    string_index_forget(cv_data(tmp));
 #ifndef NDEBUG
                 memset(cv_data(tmp), 0xbb, cv_len(tmp));
 #endif
@@ -89,6 +93,7 @@ static void sweep_finalizers(void)
     } while ((n < l - ndel) && SWAP_sf(lst[n], lst[n + ndel]));
 
     nfinalizers -= ndel;
+    nfinalized += ndel;
 #ifdef VERBOSEGC
     if (ndel > 0)
         printf("GC: finalized %d objects\n", ndel);
@@ -124,6 +129,7 @@ static value_t cprim(struct fltype *type, size_t sz)
     assert(!ismanaged((uintptr_t)type));
     assert(sz == type->size);
     pcp = (struct cprim *)alloc_words(CPRIM_NWORDS - 1 + NWORDS(sz));
+    prof_claim(pcp, type, (CPRIM_NWORDS - 1 + NWORDS(sz)) * sizeof(value_t));
     pcp->type = type;
     return tagptr(pcp, TAG_CPRIM);
 }
@@ -146,14 +152,18 @@ value_t cvalue(struct fltype *type, size_t sz)
     if (sz <= MAX_INL_SIZE) {
         size_t nw = CVALUE_NWORDS - 1 + NWORDS(sz) + (sz == 0 ? 1 : 0);
         pcv = (struct cvalue *)alloc_words(nw);
+        prof_claim(pcv, type, nw * sizeof(value_t));
         pcv->type = type;
         pcv->data = &pcv->_space[0];
         if (type->vtable != NULL && type->vtable->finalize != NULL)
             add_finalizer(pcv);
     } else {
-        if (malloc_pressure > ALLOC_LIMIT_TRIGGER)
+        if (malloc_pressure > ALLOC_LIMIT_TRIGGER) {
+            malloc_pressure_gcs++;
             gc(0);
+        }
         pcv = (struct cvalue *)alloc_words(CVALUE_NWORDS);
+        prof_claim(pcv, type, CVALUE_NWORDS * sizeof(value_t));
         pcv->type = type;
         pcv->data = malloc(sz);
         autorelease(pcv);
@@ -191,6 +201,7 @@ value_t cvalue_from_ref(struct fltype *type, void *ptr, size_t sz,
     value_t cv;
 
     pcv = (struct cvalue *)alloc_words(CVALUE_NWORDS);
+    prof_claim(pcv, type, CVALUE_NWORDS * sizeof(value_t));
     pcv->data = ptr;
     pcv->len = sz;
     pcv->type = type;
@@ -683,8 +694,9 @@ value_t cvalue_typeof(value_t *args, uint32_t nargs)
 
 static value_t cvalue_relocate(value_t v)
 {
+    value_t oldspace[CVALUE_NWORDS + 1];
     struct cvalue *cv = (struct cvalue *)ptr(v);
-    struct cvalue *nv;
+    struct cvalue *nv, *old;
     struct fltype *t;
     value_t ncv;
     size_t nw;
@@ -695,10 +707,15 @@ static value_t cvalue_relocate(value_t v)
     if (isinlined(cv))
         nv->data = &nv->_space[0];
     ncv = tagptr(nv, TAG_CVALUE);
-    t = cv_class(cv);
-    if (t->vtable != NULL && t->vtable->relocate != NULL)
-        t->vtable->relocate(v, ncv);
+    // forward before calling the hook, so that a cvalue that refers to
+    // itself is copied once, and give the hook the old header, for the
+    // old data address, since forwarding overwrites it
+    old = (struct cvalue *)ALIGN((uintptr_t)oldspace, 8);
+    *old = *cv;
     forward(v, ncv);
+    t = cv_class(old);
+    if (t->vtable != NULL && t->vtable->relocate != NULL)
+        t->vtable->relocate(tagptr(old, TAG_CVALUE), ncv);
     return ncv;
 }
 
@@ -715,6 +732,7 @@ value_t cvalue_copy(value_t v)
     ncv = (struct cvalue *)alloc_words(nw);
     v = POP();
     cv = (struct cvalue *)ptr(v);
+    prof_claim(ncv, cv_class(cv), nw * sizeof(value_t));
     memcpy(ncv, cv, nw * sizeof(value_t));
     if (!isinlined(cv)) {
         len = cv_len(cv);
@@ -922,6 +940,8 @@ static value_t cvalue_array_aset(value_t *args)
 
     eltype = cv_class((struct cvalue *)ptr(args[0]))->eltype;
     check_addr_args("aset!", args[0], args[1], &data, &index);
+    if (eltype == bytetype)
+        string_index_forget(data);
     dest = data + index * eltype->size;
     cvalue_init(eltype, args[2], dest);
     return args[2];
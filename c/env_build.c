@@ -0,0 +1,30 @@
+// Generated from scratch at each build.
+const char *env_build_c_compile[] = {
+"gcc",
+"-Wall",
+"-Werror",
+"-Wextra",
+"-O2",
+"-D",
+"NDEBUG",
+"-D",
+"USE_COMPUTED_GOTO",
+"-std=gnu99",
+"-Wno-strict-aliasing",
+"-D",
+"_GNU_SOURCE",
+0
+};
+const char *env_build_c_link[] = {
+"gcc",
+"-lm",
+"-lpthread",
+0
+};
+const char env_build_date[] = "2026-10-18";
+const char env_build_git_branch[] = "master";
+const char env_build_git_commit[] = "861b930";
+const char *env_build_git_modified[] = {
+"c/main.c",
+0
+};
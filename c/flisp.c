@@ -97,6 +97,7 @@ value_t printlevelsym, builtins_table_sym;
 
 static value_t NIL, LAMBDA, IF, TRYCATCH;
 static value_t BACKQUOTE, COMMA, COMMAAT, COMMADOT, FUNCTION;
+static value_t memory_exception_value;
 
 static value_t pairsym, symbolsym, fixnumsym, vectorsym, builtinsym, vu8sym;
 static value_t definesym, defmacrosym, forsym, setqsym;
@@ -109,6 +110,7 @@ static value_t vtabsym, pagesym, returnsym, escsym, spacesym, deletesym;
 static value_t apply_cl(uint32_t nargs);
 static value_t *alloc_words(int n);
 static value_t relocate(value_t v);
+static struct cvalue *gc_survivor(struct cvalue *cv);
 
 static struct fl_readstate *readstate = NULL;
 
@@ -122,9 +124,27 @@ static unsigned char *fromspace;
 static unsigned char *tospace;
 static unsigned char *curheap;
 static unsigned char *lim;
-static uint32_t heapsize;  // bytes
+static size_t heapsize;  // bytes
 static uint32_t *consflags;
 
+// Size of tospace, which differs from heapsize while the heap is being
+// resized: the next collection copies into it and then brings the old
+// fromspace to the same size.
+static size_t tosize;
+
+int fl_gc_mode = GC_COPY;
+int fl_gc_threads;
+int fl_gc_pause = 1000;
+size_t fl_heap_max;
+double fl_heap_growth = 2;
+int fl_heap_occupancy = 80;
+size_t fl_large_object = 8 * 1024;
+struct ios *fl_gc_log;
+uintptr_t fl_oldspace;
+size_t fl_oldsize;
+
+#include "heapprof.h"
+
 // error utilities
 // ------------------------------------------------------------
 
@@ -233,6 +253,21 @@ void DivideByZeroError(void) { lerror(DivideError, "/: division by zero"); }
 // --------------------------------------------------------
 
 #define isstring fl_isstring
+
+// car() and cdr() come through here, so this is also where they get
+// their read barrier.
+struct cons *tocons(value_t v, char *fname)
+{
+    struct cons *c;
+
+    if (!iscons(v))
+        type_error(fname, "cons", v);
+    c = (struct cons *)ptr(v);
+    (void)fl_slot(&c->car);
+    (void)fl_slot(&c->cdr);
+    return c;
+}
+
 // TODO: Remove the spurious return statement.
 #define SAFECAST_OP(type, ctype, cnvt)     \
     ctype to##type(value_t v, char *fname) \
@@ -242,7 +277,6 @@ void DivideByZeroError(void) { lerror(DivideError, "/: division by zero"); }
         type_error(fname, #type, v);       \
         return (ctype)FL_NIL;              \
     }
-SAFECAST_OP(cons, struct cons *, ptr)
 SAFECAST_OP(symbol, struct symbol *, ptr)
 SAFECAST_OP(fixnum, fixnum_t, numval)
 SAFECAST_OP(cvalue, struct cvalue *, ptr)
@@ -320,6 +354,7 @@ value_t fl_gensym(value_t *args, uint32_t nargs)
     (void)args;
     argcount("gensym", nargs, 0);
     gs = (struct gensym *)alloc_words(sizeof(struct gensym) / sizeof(void *));
+    prof_claim(gs, PROF_GENSYM, sizeof(struct gensym));
     gs->id = _gensym_ctr++;
     gs->binding = UNBOUND;
     gs->isconst = 0;
@@ -355,12 +390,28 @@ char *symbol_name(value_t v)
 
 void gc(int mustgrow);
 
+// bytes wanted by the allocation that is calling gc()
+static size_t gc_request = sizeof(struct cons);
+
+// The slow path of allocation. Collects, unless lim was only lowered
+// for the heap profiler and the real one leaves room.
+static void alloc_gc(int mustgrow)
+{
+    if (prof_lim != NULL && prof_due(gc_request)) {
+        gc_request = sizeof(struct cons);
+        return;
+    }
+    gc(mustgrow);
+}
+
 static value_t mk_cons(void)
 {
     struct cons *c;
 
-    if (__unlikely(curheap > lim))
-        gc(0);
+    if (__unlikely(curheap > lim)) {
+        alloc_gc(0);
+        prof_claim(curheap, PROF_CONS, sizeof(struct cons));
+    }
     c = (struct cons *)curheap;
     curheap += sizeof(struct cons);
     return tagptr(c, TAG_CONS);
@@ -373,8 +424,10 @@ static value_t *alloc_words(int n)
     assert(n > 0);
     n = ALIGN(n, 2);  // only allocate multiples of 2 words
     if (__unlikely((value_t *)curheap > ((value_t *)lim) + 2 - n)) {
-        gc(0);
+        gc_request = n * sizeof(value_t);
+        alloc_gc(0);
         while ((value_t *)curheap > ((value_t *)lim) + 2 - n) {
+            gc_request = n * sizeof(value_t);
             gc(1);
         }
     }
@@ -384,12 +437,28 @@ static value_t *alloc_words(int n)
 }
 
 // allocate n consecutive conses
-#define cons_reserve(n) tagptr(alloc_words((n)*2), TAG_CONS)
+static value_t cons_reserve(int n)
+{
+    value_t *first;
 
+    first = alloc_words(n * 2);
+    prof_claim(first, PROF_CONS, n * sizeof(struct cons));
+    return tagptr(first, TAG_CONS);
+}
+
+#include "large.h"
+
+// the printer's marks, for finding shared structure
 #define cons_index(c) (((struct cons *)ptr(c)) - ((struct cons *)fromspace))
-#define ismarked(c) bitvector_get(consflags, cons_index(c))
-#define mark_cons(c) bitvector_set(consflags, cons_index(c), 1)
-#define unmark_cons(c) bitvector_set(consflags, cons_index(c), 0)
+#define ismarked(c)                      \
+    (islarge(c) ? large_of(c)->printmark \
+                : bitvector_get(consflags, cons_index(c)))
+#define mark_cons(c)                                 \
+    (islarge(c) ? (void)(large_of(c)->printmark = 1) \
+                : bitvector_set(consflags, cons_index(c), 1))
+#define unmark_cons(c)                               \
+    (islarge(c) ? (void)(large_of(c)->printmark = 0) \
+                : bitvector_set(consflags, cons_index(c), 0))
 
 static value_t the_empty_vector;
 
@@ -401,7 +470,12 @@ value_t alloc_vector(size_t n, int init)
 
     if (n == 0)
         return the_empty_vector;
-    c = alloc_words(n + 1);
+    if (fl_large_object && (n + 1) * sizeof(value_t) >= fl_large_object) {
+        c = large_alloc(n + 1);
+    } else {
+        c = alloc_words(n + 1);
+        prof_claim(c, PROF_VECTOR, (n + 1) * sizeof(value_t));
+    }
     v = tagptr(c, TAG_VECTOR);
     vector_setsize(v, n);
     if (init) {
@@ -444,14 +518,48 @@ void fl_free_gc_handles(uint32_t n)
     N_GCHND -= n;
 }
 
+// Copying collection keeps the objects it has copied but not yet
+// scanned on a stack of its own instead of recursing into them, so that
+// no nesting of lists, vectors or closures can overflow the C stack. A
+// list's cdrs are copied along with it, in one run, and only cells
+// whose car still needs relocating go on the stack.
+static value_t *graystack;
+static size_t graystack_n, graystack_cap;
+
+static void copy_scan(value_t v);
+
+static void gray_grow(value_t v)
+{
+    value_t *g;
+
+    g = realloc(graystack, 2 * graystack_cap * sizeof(value_t));
+    if (g == NULL) {
+        copy_scan(v);
+        return;
+    }
+    graystack = g;
+    graystack_cap *= 2;
+    graystack[graystack_n++] = v;
+}
+
+#define gray_push(v)                        \
+    do {                                    \
+        if (graystack_n < graystack_cap)    \
+            graystack[graystack_n++] = (v); \
+        else                                \
+            gray_grow(v);                   \
+    } while (0)
+
+// Copy v to tospace, if it isn't there already, and return the copy.
+// What v points to is relocated later, by copy_scan.
 static value_t relocate(value_t v)
 {
     value_t a, d, nc, first, *pcdr;
     uintptr_t t;
+    size_t nw;
 
     t = tag(v);
     if (t == TAG_CONS) {
-        // iterative implementation allows arbitrarily long cons chains
         pcdr = &first;
         do {
             if ((a = car_(v)) == TAG_FWD) {
@@ -463,7 +571,9 @@ static value_t relocate(value_t v)
             d = cdr_(v);
             car_(v) = TAG_FWD;
             cdr_(v) = nc;
-            car_(nc) = relocate(a);
+            car_(nc) = a;
+            if ((a & 3) && (ismanaged(a) || isvector(a)))
+                gray_push(nc);
             pcdr = &cdr_(nc);
             v = d;
         } while (iscons(v));
@@ -473,97 +583,124 @@ static value_t relocate(value_t v)
 
     if ((t & 3) == 0)
         return v;
-    if (!ismanaged(v))
+    if (!ismanaged(v)) {
+        if (!islarge(v))
+            return v;
+        if (vector_elt(v, -1) & 0x1)  // grown vector
+            return relocate(vector_elt(v, 0));
+        if (large_mark(v))
+            gray_push(v);  // to scan in place
         return v;
+    }
     if (isforwarded(v))
         return forwardloc(v);
 
-    if (t == TAG_VECTOR) {
-        // N.B.: 0-length vectors secretly have space for a first element
-        size_t i, sz = vector_size(v);
+    switch (t) {
+    case TAG_VECTOR:
         if (vector_elt(v, -1) & 0x1) {
             // grown vector
             nc = relocate(vector_elt(v, 0));
             forward(v, nc);
-        } else {
-            nc = tagptr(alloc_words(sz + 1), TAG_VECTOR);
-            vector_setsize(nc, sz);
-            a = vector_elt(v, 0);
-            forward(v, nc);
-            if (sz > 0) {
-                vector_elt(nc, 0) = relocate(a);
-                for (i = 1; i < sz; i++)
-                    vector_elt(nc, i) = relocate(vector_elt(v, i));
-            }
+            return nc;
         }
-        return nc;
-    } else if (t == TAG_CPRIM) {
-        struct cprim *pcp = (struct cprim *)ptr(v);
-        size_t nw = CPRIM_NWORDS - 1 + NWORDS(cp_class(pcp)->size);
-        struct cprim *ncp = (struct cprim *)alloc_words(nw);
-        while (nw--)
-            ((value_t *)ncp)[nw] = ((value_t *)pcp)[nw];
-        nc = tagptr(ncp, TAG_CPRIM);
-        forward(v, nc);
-        return nc;
-    } else if (t == TAG_CVALUE) {
+        // N.B.: 0-length vectors secretly have space for a first element
+        nw = vector_size(v) + 1;
+        break;
+    case TAG_CPRIM:
+        nw = CPRIM_NWORDS - 1 +
+             NWORDS(cp_class((struct cprim *)ptr(v))->size);
+        break;
+    case TAG_CVALUE:
         return cvalue_relocate(v);
-    } else if (t == TAG_FUNCTION) {
-        struct function *fn = (struct function *)ptr(v);
-        struct function *nfn = (struct function *)alloc_words(4);
-        nfn->bcode = fn->bcode;
-        nfn->vals = fn->vals;
-        nc = tagptr(nfn, TAG_FUNCTION);
-        forward(v, nc);
-        nfn->env = relocate(fn->env);
-        nfn->vals = relocate(nfn->vals);
-        nfn->bcode = relocate(nfn->bcode);
-        assert(!ismanaged(fn->name));
-        nfn->name = fn->name;
-        return nc;
-    } else if (t == TAG_SYM) {
-        struct gensym *gs = (struct gensym *)ptr(v);
-        struct gensym *ng =
-        (struct gensym *)alloc_words(sizeof(struct gensym) / sizeof(void *));
-        ng->id = gs->id;
-        ng->binding = gs->binding;
-        ng->isconst = 0;
-        nc = tagptr(ng, TAG_SYM);
-        forward(v, nc);
-        if (ng->binding != UNBOUND)
-            ng->binding = relocate(ng->binding);
-        return nc;
+    case TAG_FUNCTION:
+        assert(!ismanaged(fn_name(v)));
+        nw = 4;
+        break;
+    default:
+        nw = sizeof(struct gensym) / sizeof(void *);
+        break;
     }
-    return v;
+    nc = tagptr(alloc_words(nw), t);
+    memcpy(ptr(nc), ptr(v), nw * sizeof(value_t));
+    forward(v, nc);
+    switch (t) {
+    case TAG_VECTOR:
+        if (vector_size(nc) > 0)
+            gray_push(nc);
+        break;
+    case TAG_FUNCTION:
+        gray_push(nc);
+        break;
+    case TAG_SYM:
+        ((struct gensym *)ptr(nc))->isconst = 0;
+        if (((struct gensym *)ptr(nc))->binding != UNBOUND)
+            gray_push(nc);
+        break;
+    }
+    return nc;
 }
 
-value_t relocate_lispvalue(value_t v) { return relocate(v); }
+// Relocate what a copied object points to. For a cons that is only its
+// car, since relocate() has seen to the cdr.
+static void copy_scan(value_t v)
+{
+    size_t i, n;
+
+    switch (tag(v)) {
+    case TAG_CONS:
+        car_(v) = relocate(car_(v));
+        break;
+    case TAG_VECTOR:
+        n = vector_size(v);
+        for (i = 0; i < n; i++)
+            vector_elt(v, i) = relocate(vector_elt(v, i));
+        break;
+    case TAG_FUNCTION:
+        fn_env(v) = relocate(fn_env(v));
+        fn_vals(v) = relocate(fn_vals(v));
+        fn_bcode(v) = relocate(fn_bcode(v));
+        break;
+    case TAG_SYM:
+        ((struct gensym *)ptr(v))->binding =
+        relocate(((struct gensym *)ptr(v))->binding);
+        break;
+    }
+}
+
+static void copy_drain(void)
+{
+    value_t v;
+
+    while (graystack_n > 0) {
+        v = graystack[--graystack_n];
+        if (iscons(v))
+            car_(v) = relocate(car_(v));
+        else
+            copy_scan(v);
+    }
+}
+
+// What the collector does to each value it reaches: relocate() when
+// copying, or one of the phases of compaction.
+static value_t (*gc_visit)(value_t v) = relocate;
+
+value_t relocate_lispvalue(value_t v) { return gc_visit(v); }
 
 static void trace_globals(struct symbol *root)
 {
     while (root != NULL) {
         if (root->binding != UNBOUND)
-            root->binding = relocate(root->binding);
+            root->binding = gc_visit(root->binding);
         trace_globals(root->left);
         root = root->right;
     }
 }
 
-static value_t memory_exception_value;
-
-void gc(int mustgrow)
+static void trace_roots(void)
 {
-    static int grew = 0;
-    void *temp;
     uint32_t i, f, top;
     struct fl_readstate *rs;
 
-    curheap = tospace;
-    if (grew)
-        lim = curheap + heapsize * 2 - sizeof(struct cons);
-    else
-        lim = curheap + heapsize - sizeof(struct cons);
-
     if (fl_throwing_frame > curr_frame) {
         top = fl_throwing_frame - 4;
         f = Stack[fl_throwing_frame - 4];
@@ -573,14 +710,14 @@ void gc(int mustgrow)
     }
     while (1) {
         for (i = f; i < top; i++)
-            Stack[i] = relocate(Stack[i]);
+            Stack[i] = gc_visit(Stack[i]);
         if (f == 0)
             break;
         top = f - 4;
         f = Stack[f - 4];
     }
     for (i = 0; i < N_GCHND; i++)
-        *GCHandleStack[i] = relocate(*GCHandleStack[i]);
+        *GCHandleStack[i] = gc_visit(*GCHandleStack[i]);
     trace_globals(symtab);
     relocate_typetable();
     rs = readstate;
@@ -589,21 +726,170 @@ void gc(int mustgrow)
         for (i = 0; i < rs->backrefs.size; i++) {
             ent = (value_t)rs->backrefs.table[i];
             if (ent != (value_t)HT_NOTFOUND)
-                rs->backrefs.table[i] = (void *)relocate(ent);
+                rs->backrefs.table[i] = (void *)gc_visit(ent);
         }
         for (i = 0; i < rs->gensyms.size; i++) {
             ent = (value_t)rs->gensyms.table[i];
             if (ent != (value_t)HT_NOTFOUND)
-                rs->gensyms.table[i] = (void *)relocate(ent);
+                rs->gensyms.table[i] = (void *)gc_visit(ent);
         }
-        rs->source = relocate(rs->source);
+        rs->source = gc_visit(rs->source);
         rs = rs->prev;
     }
-    fl_lasterror = relocate(fl_lasterror);
-    memory_exception_value = relocate(memory_exception_value);
-    the_empty_vector = relocate(the_empty_vector);
+    fl_lasterror = gc_visit(fl_lasterror);
+    memory_exception_value = gc_visit(memory_exception_value);
+    the_empty_vector = gc_visit(the_empty_vector);
+}
+
+// The size in words of heap object v, given its first word w0 separately
+// since a collector may already have overwritten it.
+static size_t gc_nwords(value_t v, value_t w0)
+{
+    struct cvalue *cv;
+    size_t n;
+
+    switch (tag(v)) {
+    case TAG_CONS:
+        return 2;
+    case TAG_VECTOR:
+        return (w0 >> 2) + 1;
+    case TAG_CPRIM:
+        return CPRIM_NWORDS - 1 + NWORDS(((struct fltype *)w0)->size);
+    case TAG_CVALUE:
+        cv = (struct cvalue *)ptr(v);
+        if (!isinlined(cv))
+            return CVALUE_NWORDS;
+        n = cv_len(cv);
+        if (n == 0 || ((struct fltype *)(w0 & ~3))->eltype == bytetype)
+            n++;
+        return CVALUE_NWORDS - 1 + NWORDS(n);
+    case TAG_FUNCTION:
+        return 4;
+    }
+    return sizeof(struct gensym) / sizeof(void *);
+}
+
+// Running totals for gc-stats, in bytes. Allocation doesn't count the
+// collector's own copies.
+static uint64_t gc_allocated;
+static uint64_t gc_copied;
+static unsigned char *alloc_mark;  // curheap after the last collection
+static uint64_t alloc_mark_copied;  // gc_copied then
+
+#define HEAP_SHRINK_AFTER 8  // collections with little live data
+
+static size_t heap_min;  // the initial size
+static size_t heap_max;  // fl_heap_max, or as big as can be
+
+#define heap_round(n) (((n) + 4095) & ~(size_t)4095)
+
+static size_t heap_grown(size_t size);
+static size_t heap_target(size_t live, int mustgrow);
+
+#include "space.h"
+#include "compact.h"
+
+#ifndef _WIN32
+#include "parallel.h"
+#else
+#define parallel_init()
+#define parallel_reserve(space) 0
+#define parallel_copy(used, room) 0
+#endif
+
+#include "incremental.h"
+
+// Space the mutator leaves free in a semispace of the given size, for
+// the collector's own use.
+static size_t heap_reserve(size_t space)
+{
+    if (fl_gc_mode == GC_PARALLEL)
+        return parallel_reserve(space);
+    if (fl_gc_mode == GC_INCREMENTAL)
+        return space / 2;  // room to copy into during a cycle
+    (void)space;
+    return 0;
+}
+
+// Whether live bytes take up no more than fl_heap_occupancy percent of
+// what the mutator may fill in a heap of the given size. Large vectors
+// count as live too: each collection scans them, and the mutator should
+// get to allocate enough between collections to pay for that.
+static int heap_fits(size_t live, size_t size)
+{
+    size_t reserve;
+
+    reserve = heap_reserve(size);
+    if (reserve >= size)
+        return 0;
+    return live + large_bytes <=
+           (double)(size - reserve) * fl_heap_occupancy / 100;
+}
+
+static size_t heap_grown(size_t size)
+{
+    size_t bigger;
+
+    bigger = heap_round((size_t)(size * fl_heap_growth));
+    if (bigger <= size)
+        bigger = size + heap_round(1);
+    return bigger < heap_max ? bigger : heap_max;
+}
+
+// The size the heap should have after a collection left live bytes in
+// it. Grows at least a step if mustgrow, unless it's at heap_max, so
+// the live data don't always fit.
+static size_t heap_target(size_t live, int mustgrow)
+{
+    static int nlow;  // collections in a row that could have shrunk
+    size_t size, smaller;
+
+    size = heapsize;
+    while ((mustgrow || !heap_fits(live, size)) && size < heap_max) {
+        size = heap_grown(size);
+        mustgrow = 0;
+    }
+    smaller = heap_round((size_t)(size / fl_heap_growth));
+    if (smaller < heap_min)
+        smaller = heap_min;
+    if (size != heapsize || smaller >= size ||
+        !heap_fits(2 * live, smaller)) {
+        nlow = 0;
+    } else if (++nlow == HEAP_SHRINK_AFTER) {
+        nlow = 0;
+        size = smaller;
+    }
+    return size;
+}
 
+static struct cvalue *gc_survivor(struct cvalue *cv)
+{
+    if (fl_gc_mode == GC_COMPACT)
+        return compact_survivor(cv);
+    if (fl_gc_mode == GC_INCREMENTAL)
+        return inc_survivor(cv);
+    if (isforwarded((value_t)cv))
+        return (struct cvalue *)ptr(forwardloc((value_t)cv));
+    return NULL;
+}
+
+static void copy_gc(int mustgrow)
+{
+    void *temp;
+    size_t used, room, want, keep;
+
+    used = (size_t)(curheap - fromspace);
+    room = tosize;
+    curheap = tospace;
+    lim = curheap + room - heap_reserve(room) - sizeof(struct cons);
+    if (fl_gc_mode != GC_PARALLEL || !parallel_copy(used, room)) {
+        trace_roots();
+        copy_drain();
+    }
     sweep_finalizers();
+    prof_sweep();
+    large_sweep();
+    gc_copied += (size_t)(curheap - tospace);
 
 #ifdef VERBOSEGC
     printf("GC: found %d/%d live conses\n",
@@ -614,28 +900,172 @@ void gc(int mustgrow)
     tospace = fromspace;
     fromspace = temp;
 
-    // if we're using > 80% of the space, resize tospace so we have
-    // more space to fill next time. if we grew tospace last time,
-    // grow the other half of the heap this time to catch up.
-    if (grew || ((lim - curheap) < (int)(heapsize / 5)) || mustgrow) {
-        temp = realloc(tospace, heapsize * 2);
-        if (temp == NULL)
+    if (room != heapsize) {
+        if (!(temp = space_resize(tospace, heapsize, room)))
             fl_raise(memory_exception_value);
         tospace = temp;
-        if (grew) {
-            heapsize *= 2;
-            temp =
-            bitvector_resize(consflags, 0, heapsize / sizeof(struct cons), 1);
+        if (room > heapsize) {
+            temp = bitvector_resize(consflags, 0, room / sizeof(struct cons),
+                                    1);
             if (temp == NULL)
                 fl_raise(memory_exception_value);
             consflags = (uint32_t *)temp;
         }
-        grew = !grew;
+        heapsize = room;
     }
-    if (curheap > lim)  // all data was live
+
+    // a new size takes effect over two collections, this one resizing
+    // tospace and the next one the other half. until then the mutator
+    // may not fill more of fromspace than tospace can take.
+    want = heap_target((size_t)(curheap - fromspace), mustgrow);
+    if (want != heapsize) {
+        if (!(temp = space_resize(tospace, heapsize, want)))
+            fl_raise(memory_exception_value);
+        tospace = temp;
+        tosize = want;
+        if (want < heapsize)
+            lim = fromspace + want - heap_reserve(want) - sizeof(struct cons);
+    } else if ((keep = heap_round(2 * (size_t)(curheap - fromspace))) <
+               heapsize) {
+        // the next collection will likely copy no more than twice what
+        // this one did, so the rest of tospace can go back for now
+        space_discard(tospace + keep, heapsize - keep);
+    }
+    if (curheap > lim && tosize > heapsize)  // all data was live
+        copy_gc(0);
+    else if (curheap > lim || (mustgrow && tosize <= heapsize))
+        fl_raise(memory_exception_value);  // at fl_heap_max
+}
+
+// How long gc() took each time, counted in buckets an eighth of an
+// octave wide, starting from one microsecond.
+#define PAUSE_BUCKETS (1 + 8 * 40)
+static uint32_t pause_counts[PAUSE_BUCKETS];
+static uint32_t npauses;
+static double pause_max, pause_total;
+
+static void record_pause(double secs)
+{
+    double usec, m;
+    int e, b;
+
+    usec = secs * 1e6;
+    b = 0;
+    if (usec >= 1) {
+        m = frexp(usec, &e);
+        b = 1 + 8 * (e - 1) + (int)((2 * m - 1) * 8);
+        if (b >= PAUSE_BUCKETS)
+            b = PAUSE_BUCKETS - 1;
+    }
+    pause_counts[b]++;
+    npauses++;
+    pause_total += usec;
+    if (usec > pause_max)
+        pause_max = usec;
+}
+
+// The upper end of bucket b, in microseconds.
+static double pause_bucket_end(int b)
+{
+    if (b == 0)
+        return 1;
+    return ldexp(1 + (double)((b - 1) % 8 + 1) / 8, (b - 1) / 8);
+}
+
+// The upper end of the bucket holding the pause at quantile q.
+static double pause_quantile(double q)
+{
+    uint32_t rank, seen;
+    double usec;
+    int b;
+
+    rank = (uint32_t)ceil(q * npauses);
+    seen = 0;
+    for (b = 0; b < PAUSE_BUCKETS - 1; b++) {
+        if ((seen += pause_counts[b]) >= rank)
+            break;
+    }
+    usec = pause_bucket_end(b);
+    return usec < pause_max ? usec : pause_max;
+}
+
+static uint64_t allocated_since(unsigned char *mark, uint64_t copied)
+{
+    if (mark < fromspace || mark > curheap)
+        return 0;  // the last collection raised an error
+    return (size_t)(curheap - mark) - (gc_copied - copied);
+}
+
+// What gc_end() logs about each collection
+static double gc_began;
+static size_t gc_used_before;
+static uint64_t gc_copied_before, nfinalized_before;
+
+static void gc_begin(void)
+{
+    gc_began = clock_now();
+    gc_used_before = (size_t)(curheap - fromspace);
+    gc_copied_before = gc_copied;
+    nfinalized_before = nfinalized;
+    gc_allocated += allocated_since(alloc_mark, alloc_mark_copied);
+}
+
+static void gc_end(void)
+{
+    static const char *modes[] = { "copy", "compact", "parallel",
+                                   "incremental" };
+    double pause;
+
+    pause = clock_now() - gc_began;
+    record_pause(pause);
+    alloc_mark = curheap;
+    alloc_mark_copied = gc_copied;
+    if (fl_gc_log == NULL)
+        return;
+    ios_printf(fl_gc_log,
+               "gc=%lu mode=%s time=%.6f pause_us=%.1f used=%lu->%lu "
+               "heap=%lu copied=%lu finalized=%lu\n",
+               (unsigned long)npauses, modes[fl_gc_mode], gc_began,
+               pause * 1e6, (unsigned long)gc_used_before,
+               (unsigned long)(curheap - fromspace), (unsigned long)heapsize,
+               (unsigned long)(gc_copied - gc_copied_before),
+               (unsigned long)(nfinalized - nfinalized_before));
+}
+
+void gc(int mustgrow)
+{
+    size_t request;
+
+    gc_begin();
+    request = gc_request;
+    gc_request = sizeof(struct cons);
+    prof_disarm(request);
+    if (fl_gc_mode == GC_COMPACT)
+        compact_gc(mustgrow);
+    else if (fl_gc_mode == GC_INCREMENTAL)
+        incremental_gc(request);
+    else
+        copy_gc(mustgrow);
+    gc_end();
+    prof_arm(request);
+}
+
+// A whole collection, which gc() doesn't always do.
+static void full_gc(void)
+{
+    if (fl_gc_mode != GC_INCREMENTAL) {
         gc(0);
+        return;
+    }
+    gc_begin();
+    prof_disarm(sizeof(struct cons));
+    incremental_full_gc();
+    gc_end();
+    prof_arm(sizeof(struct cons));
 }
 
+#include "census.h"
+
 static void grow_stack(void)
 {
     size_t newsz = N_STACK + (N_STACK >> 1);
@@ -725,6 +1155,7 @@ value_t fl_listn(size_t n, ...)
         PUSH(a);
     }
     c = (struct cons *)alloc_words(n * 2);
+    prof_claim(c, PROF_CONS, n * sizeof(struct cons));
     l = c;
     for (i = 0; i < n; i++) {
         c->car = Stack[si++];
@@ -745,6 +1176,7 @@ value_t fl_list2(value_t a, value_t b)
     PUSH(a);
     PUSH(b);
     c = (struct cons *)alloc_words(4);
+    prof_claim(c, PROF_CONS, 2 * sizeof(struct cons));
     b = POP();
     a = POP();
     c[0].car = a;
@@ -988,6 +1420,9 @@ no_kw:
 #define SWAP_INT32(a) (*(int32_t *)(a) = bswap_32(*(int32_t *)(a)))
 #define SWAP_INT16(a) (*(int16_t *)(a) = bswap_16(*(int16_t *)(a)))
 
+// for the heap profiler, which is otherwise only told the ip on calls
+#define SAVE_IP (Stack[curr_frame - 2] = (uintptr_t)ip)
+
 #ifdef USE_COMPUTED_GOTO
 #define OP(x) L_##x:
 #define NEXT_OP goto *vm_labels[*ip++]
@@ -1074,6 +1509,7 @@ apply_cl_top:
         do_vargc:
             s = (fixnum_t)nargs - (fixnum_t)i;
             if (s > 0) {
+                SAVE_IP;
                 v = list(&Stack[bp + i], s);
                 Stack[bp + i] = v;
                 if (s > 1) {
@@ -1174,6 +1610,7 @@ apply_cl_top:
                     }
                 }
             } else if (iscbuiltin(func)) {
+                SAVE_IP;
                 s = SP;
                 v = ((builtin_t)(((void **)ptr(func))[3]))(&Stack[SP - n], n);
                 SP = s - n;
@@ -1229,6 +1666,7 @@ apply_cl_top:
                     }
                 }
             } else if (iscbuiltin(func)) {
+                SAVE_IP;
                 s = SP;
                 v = ((builtin_t)(((void **)ptr(func))[3]))(&Stack[SP - n], n);
                 SP = s - n;
@@ -1404,8 +1842,11 @@ apply_cl_top:
             NEXT_OP;
 
             OP(OP_CONS)
-            if (curheap > lim)
-                gc(0);
+            if (curheap > lim) {
+                SAVE_IP;
+                alloc_gc(0);
+                prof_claim(curheap, PROF_CONS, sizeof(struct cons));
+            }
             c = (struct cons *)curheap;
             curheap += sizeof(struct cons);
             c->car = Stack[SP - 2];
@@ -1445,6 +1886,7 @@ apply_cl_top:
             OP(OP_LIST)
             n = *ip++;
         apply_list:
+            SAVE_IP;
             if (n > 0) {
                 v = list(&Stack[SP - n], n);
                 POPN(n);
@@ -1644,6 +2086,7 @@ apply_cl_top:
             OP(OP_VECTOR)
             n = *ip++;
         apply_vector:
+            SAVE_IP;
             v = alloc_vector(n, 0);
             if (n) {
                 memcpy(&vector_elt(v, 0), &Stack[SP - n],
@@ -1876,10 +2319,12 @@ apply_cl_top:
 
             OP(OP_CLOSURE)
             // build a closure (lambda args body . env)
+            SAVE_IP;
             if (nargs > 0 && !captured) {
                 // save temporary environment to the heap
                 n = nargs;
                 pv = alloc_words(n + 2);
+                prof_claim(pv, PROF_VECTOR, (n + 2) * sizeof(value_t));
                 PUSH(tagptr(pv, TAG_VECTOR));
                 pv[0] = fixnum(n + 1);
                 pv++;
@@ -1894,8 +2339,11 @@ apply_cl_top:
             } else {
                 PUSH(Stack[bp]);  // env has already been captured; share
             }
-            if (curheap > lim - 2)
-                gc(0);
+            if (curheap > lim - 2) {
+                gc_request = 4 * sizeof(value_t);
+                alloc_gc(0);
+                prof_claim(curheap, PROF_FUNCTION, 4 * sizeof(value_t));
+            }
             pv = (value_t *)curheap;
             curheap += (4 * sizeof(value_t));
             e = Stack[SP - 2];  // closure to copy
@@ -2234,7 +2682,7 @@ static uint32_t compute_maxstack(uint8_t *code, size_t len, int bswap)
 // top = top frame pointer to start at
 static value_t _stacktrace(uint32_t top)
 {
-    uint32_t bp, sz;
+    uint32_t bp, sz, i;
     value_t v, lst = NIL;
     fl_gc_handle(&lst);
     while (top > 0) {
@@ -2243,10 +2691,9 @@ static value_t _stacktrace(uint32_t top)
         v = alloc_vector(sz, 0);
         if (Stack[top - 1] /*captured*/) {
             vector_elt(v, 0) = Stack[bp];
-            memcpy(&vector_elt(v, 1), &vector_elt(Stack[bp + 1], 0),
-                   (sz - 1) * sizeof(value_t));
+            for (i = 1; i < sz; i++)
+                vector_elt(v, i) = vector_elt(Stack[bp + 1], i - 1);
         } else {
-            uint32_t i;
             for (i = 0; i < sz; i++) {
                 value_t si = Stack[bp + i];
                 // if there's an error evaluating argument defaults some slots
@@ -2306,6 +2753,7 @@ static value_t fl_function(value_t *args, uint32_t nargs)
     ms = compute_maxstack((uint8_t *)data, cv_len(arr), swap);
     PUT_INT32(data, ms);
     fn = (struct function *)alloc_words(4);
+    prof_claim(fn, PROF_FUNCTION, sizeof(struct function));
     fv = tagptr(fn, TAG_FUNCTION);
     fn->bcode = args[0];
     fn->vals = args[1];
@@ -2427,6 +2875,83 @@ value_t fl_stacktrace(value_t *args, uint32_t nargs)
     return _stacktrace(fl_throwing_frame ? fl_throwing_frame : curr_frame);
 }
 
+// (gc-pause-percentiles) => #(count p50 p90 p99 p99.9 max), the pause
+// times in microseconds, each percentile rounded up to its bucket.
+static value_t fl_gc_pause_percentiles(value_t *args, uint32_t nargs)
+{
+    static const double q[] = { 0.5, 0.9, 0.99, 0.999 };
+    value_t v;
+    int i;
+
+    (void)args;
+    argcount("gc-pause-percentiles", nargs, 0);
+    v = alloc_vector(6, 0);
+    vector_elt(v, 0) = fixnum(npauses);
+    for (i = 0; i < 4; i++)
+        vector_elt(v, 1 + i) = fixnum((fixnum_t)ceil(pause_quantile(q[i])));
+    vector_elt(v, 5) = fixnum((fixnum_t)ceil(pause_max));
+    return v;
+}
+
+// Push (name . n) onto the list on top of the stack.
+static void push_stat(const char *name, uint64_t n)
+{
+    value_t v;
+
+    v = fl_cons(symbol(name), return_from_uint64(n));
+    Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+}
+
+// (gc-stats) => an alist of totals since startup: collections, bytes
+// allocated and copied, the heap now, large vectors kept outside it,
+// finalizers run, collections that malloc pressure forced, and pause
+// times, with the histogram as (upper bound in usec . count) pairs.
+static value_t fl_gc_stats(value_t *args, uint32_t nargs)
+{
+    uint32_t counts[PAUSE_BUCKETS], collections;
+    uint64_t allocated, copied, finalized;
+    size_t size, used, large;
+    double total, max;
+    value_t v;
+    int b;
+
+    (void)args;
+    argcount("gc-stats", nargs, 0);
+    // take everything down first, since consing the result may collect
+    allocated = gc_allocated + allocated_since(alloc_mark, alloc_mark_copied) +
+                large_allocated;
+    copied = gc_copied;
+    finalized = nfinalized;
+    size = heapsize;
+    used = (size_t)(curheap - fromspace);
+    large = large_bytes;
+    memcpy(counts, pause_counts, sizeof(counts));
+    collections = npauses;
+    total = pause_total;
+    max = pause_max;
+    PUSH(FL_NIL);
+    for (b = PAUSE_BUCKETS - 1; b >= 0; b--) {
+        if (counts[b] == 0)
+            continue;
+        v = fl_cons(mk_double(pause_bucket_end(b)), fixnum(counts[b]));
+        Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+    }
+    v = fl_cons(symbol("pause-histogram"), Stack[SP - 1]);
+    Stack[SP - 1] = fl_cons(v, FL_NIL);
+    push_stat("pause-max-usec", (uint64_t)ceil(max));
+    push_stat("pause-total-usec", (uint64_t)ceil(total));
+    push_stat("malloc-pressure-collections", malloc_pressure_gcs);
+    push_stat("finalizers-run", finalized);
+    push_stat("large-bytes", large);
+    push_stat("heap-used", used);
+    push_stat("heap-max", fl_heap_max);
+    push_stat("heap-size", size);
+    push_stat("bytes-copied", copied);
+    push_stat("bytes-allocated", allocated);
+    push_stat("collections", collections);
+    return POP();
+}
+
 value_t fl_map1(value_t *args, uint32_t nargs)
 {
     value_t first, last, v;
@@ -2512,6 +3037,14 @@ static struct builtinspec core_builtin_info[] = {
     { "function:env", fl_function_env },
     { "function:name", fl_function_name },
     { "stacktrace", fl_stacktrace },
+    { "gc-pause-percentiles", fl_gc_pause_percentiles },
+    { "gc-stats", fl_gc_stats },
+    { "heap-profile-start", fl_heap_profile_start },
+    { "heap-profile-stop", fl_heap_profile_stop },
+    { "heap-profile", fl_heap_profile },
+    { "heap-profile-write", fl_heap_profile_write },
+    { "heap-census", fl_heap_census },
+    { "heap-snapshot", fl_heap_snapshot },
     { "gensym", fl_gensym },
     { "gensym?", fl_gensymp },
     { "hash", fl_hash },
@@ -2537,12 +3070,35 @@ static void lisp_init(size_t initial_heapsize)
     llt_init();
     setlocale(LC_NUMERIC, "C");
 
-    heapsize = initial_heapsize;
-
-    fromspace = malloc(heapsize);
-    tospace = malloc(heapsize);
-    curheap = fromspace;
-    lim = curheap + heapsize - sizeof(struct cons);
+    heap_max = fl_heap_max ? fl_heap_max & ~(size_t)4095 : SIZE_MAX;
+    heapsize = tosize = heap_min = heap_round(initial_heapsize);
+    heap_max = space_init(heap_max, heapsize);
+    if (heapsize > heap_max)
+        heapsize = tosize = heap_min = heap_max;
+
+    fromspace = space_new(heapsize);
+    if (fromspace == NULL)
+        goto nomem;
+    if (fl_gc_mode == GC_COMPACT) {
+        objmap = calloc(heapsize / GRANULE, 1);
+        livecount = malloc((heapsize / GRANULE / 32 + 1) * sizeof(uint32_t));
+        markstack_cap = 4096;
+        markstack = malloc(markstack_cap * sizeof(value_t));
+    } else {
+        tospace = space_new(heapsize);
+        if (tospace == NULL)
+            goto nomem;
+        graystack_cap = 4096;
+        graystack = malloc(graystack_cap * sizeof(value_t));
+    }
+    if (fl_gc_mode == GC_PARALLEL)
+        parallel_init();
+    if (fl_gc_mode == GC_INCREMENTAL) {
+        incremental_init();
+        fl_large_object = 0;  // the read barrier can't see large objects
+    }
+    curheap = alloc_mark = fromspace;
+    lim = curheap + heapsize - heap_reserve(heapsize) - sizeof(struct cons);
     consflags = bitvector_new(heapsize / sizeof(struct cons), 1);
     comparehash_init();
     N_STACK = 262144;
@@ -2635,6 +3191,12 @@ static void lisp_init(size_t initial_heapsize)
     assign_global_builtins(core_builtin_info);
 
     builtins_init();
+    return;
+
+nomem:
+    fprintf(stderr, "cannot allocate a heap of %lu bytes\n",
+            (unsigned long)heapsize);
+    exit(1);
 }
 
 // top level
@@ -0,0 +1,511 @@
+// Sampling heap profiler. While it runs, about once every prof_interval
+// bytes of allocation it records what kind of object was being made and
+// the Scheme call stack at that point: for each frame the function's
+// name and where in its bytecode it was. Samples are added up per
+// allocation site, a site being a kind of object and the innermost
+// PROF_DEPTH frames, and after each collection every site learns how
+// many of its samples are still live.
+//
+// Sampling costs the allocation fast path nothing. The profiler lowers
+// lim to where the next sample is due, so the allocation that gets
+// there takes the slow path into alloc_gc(), which takes the sample
+// and, when the real lim leaves room, returns without collecting. The
+// sampled object is the one made next, at prof_addr. Allocators that
+// know what they are making claim the sample with prof_claim(); one
+// nobody claims is PROF_OTHER.
+//
+// Each sample stands for the bytes allocated since the one before, so
+// its weight is the interval, or its own size if bigger. The gap
+// between samples varies randomly around the interval so that a loop
+// allocating in step with it can't hide. Large vectors count towards
+// the interval as they are made.
+//
+// The VM keeps a frame's instruction pointer up to date only on calls,
+// and the instructions that allocate save it too. A number boxed by
+// arithmetic is charged to the last place that did.
+
+extern value_t outstrsym;
+
+#define PROF_DEPTH 8
+#define PROF_BUCKETS 1024
+#define PROF_INTERVAL (64 * 1024)
+
+// Kinds of object, here and in the heap census. Other kinds are the
+// struct fltype * of a cvalue or cprim, which never look like these.
+enum { PROF_CONS = 1, PROF_VECTOR, PROF_FUNCTION, PROF_GENSYM, PROF_OTHER };
+
+struct prof_frame {
+    const uint8_t *code;  // bytecode, which never moves
+    value_t name;         // of the function
+    int32_t offset;       // into code, or -1 if unknown
+};
+
+struct prof_site {
+    struct prof_site *next;  // in its hash bucket
+    struct prof_site *all;   // the list of every site
+    uintptr_t kind;
+    int depth;
+    struct prof_frame frames[PROF_DEPTH];
+    uint64_t samples, bytes;            // bytes are estimates
+    uint64_t live_samples, live_bytes;  // as of the last collection
+};
+
+// A sample whose object may still be live
+struct prof_sample {
+    void *addr;
+    struct prof_site *site;
+    size_t weight;
+    int large;  // a large vector, which large_sweep() tells us about
+};
+
+static int prof_running;
+static size_t prof_interval;
+static intptr_t prof_left;        // bytes until the next sample
+static unsigned char *prof_mark;  // curheap when prof_left was updated
+static unsigned char *prof_lim;   // the real lim, while lowered
+static uint32_t prof_seed = 2463534242u;
+
+// The sample waiting for its object
+static int prof_pending;
+static unsigned char *prof_addr;  // where the object goes, once known
+static size_t prof_size;
+static struct prof_frame prof_frames[PROF_DEPTH];
+static int prof_depth;
+
+static struct prof_site *prof_table[PROF_BUCKETS];
+static struct prof_site *prof_sites;
+static size_t prof_nsites;
+static struct prof_sample *prof_samples;
+static size_t prof_nsamples, prof_maxsamples;
+
+#define prof_claim(p, kind, size)                                \
+    do {                                                         \
+        if (__unlikely(prof_pending))                            \
+            prof_claim_((p), (uintptr_t)(kind), (size_t)(size)); \
+    } while (0)
+
+// Bytes from one sample to the next, between half and one and a half
+// times the interval.
+static intptr_t prof_gap(void)
+{
+    prof_seed ^= prof_seed << 13;
+    prof_seed ^= prof_seed >> 17;
+    prof_seed ^= prof_seed << 5;
+    return (intptr_t)(prof_interval / 2 + prof_seed % prof_interval);
+}
+
+// Fill in the innermost frames of the VM stack and return how many.
+static int prof_capture(struct prof_frame *frames)
+{
+    struct cvalue *code;
+    const uint8_t *ip, *start;
+    uint32_t f, nargs;
+    value_t func;
+    int depth;
+
+    depth = 0;
+    for (f = curr_frame; f > 0 && depth < PROF_DEPTH; f = Stack[f - 4]) {
+        nargs = Stack[f - 3];
+        func = Stack[f - 6 - nargs];
+        if (!isfunction(func))
+            break;
+        code = (struct cvalue *)ptr(fn_bcode(func));
+        start = (const uint8_t *)cv_data(code);
+        ip = (const uint8_t *)Stack[f - 2];
+        frames[depth].code = start;
+        frames[depth].name = fn_name(func);
+        frames[depth].offset = -1;
+        if (ip >= start && ip <= start + cv_len(code))
+            frames[depth].offset = (int32_t)(ip - start);
+        depth++;
+    }
+    return depth;
+}
+
+static uint32_t prof_hash(uintptr_t kind, struct prof_frame *frames,
+                          int depth)
+{
+    uintptr_t h;
+    int i;
+
+    h = kind;
+    for (i = 0; i < depth; i++) {
+        h = h * 31 + (uintptr_t)frames[i].code;
+        h = h * 31 + (uintptr_t)frames[i].offset;
+    }
+    return inthash(h) % PROF_BUCKETS;
+}
+
+static struct prof_site *prof_site(uintptr_t kind, struct prof_frame *frames,
+                                   int depth)
+{
+    struct prof_site *s;
+    uint32_t b;
+    int i;
+
+    b = prof_hash(kind, frames, depth);
+    for (s = prof_table[b]; s != NULL; s = s->next) {
+        if (s->kind != kind || s->depth != depth)
+            continue;
+        for (i = 0; i < depth; i++) {
+            if (s->frames[i].code != frames[i].code ||
+                s->frames[i].name != frames[i].name ||
+                s->frames[i].offset != frames[i].offset)
+                break;
+        }
+        if (i == depth)
+            return s;
+    }
+    if (!(s = calloc(1, sizeof(*s))))
+        return NULL;
+    s->kind = kind;
+    s->depth = depth;
+    memcpy(s->frames, frames, depth * sizeof(*frames));
+    s->next = prof_table[b];
+    prof_table[b] = s;
+    s->all = prof_sites;
+    prof_sites = s;
+    prof_nsites++;
+    return s;
+}
+
+// Count a sample of an object at addr. Returns whether we can follow
+// it from now on.
+static int prof_record(uintptr_t kind, size_t size, void *addr, int large,
+                       struct prof_frame *frames, int depth)
+{
+    struct prof_sample *ps;
+    struct prof_site *s;
+    size_t weight, n;
+
+    if (!(s = prof_site(kind, frames, depth)))
+        return 0;
+    weight = size > prof_interval ? size : prof_interval;
+    s->samples++;
+    s->bytes += weight;
+    if (prof_nsamples == prof_maxsamples) {
+        n = prof_maxsamples ? 2 * prof_maxsamples : 256;
+        if (!(ps = realloc(prof_samples, n * sizeof(*ps))))
+            return 0;
+        prof_samples = ps;
+        prof_maxsamples = n;
+    }
+    ps = &prof_samples[prof_nsamples++];
+    ps->addr = addr;
+    ps->site = s;
+    ps->weight = weight;
+    ps->large = large;
+    s->live_samples++;
+    s->live_bytes += weight;
+    return 1;
+}
+
+// Once the pending sample has an address, record it as PROF_OTHER if
+// its object was made, and drop it if not.
+static void prof_settle(void)
+{
+    if (!prof_pending || prof_addr == NULL)
+        return;
+    if (curheap > prof_addr)
+        prof_record(PROF_OTHER, prof_size, prof_addr, 0, prof_frames,
+                    prof_depth);
+    prof_pending = 0;
+}
+
+static void prof_claim_(void *p, uintptr_t kind, size_t size)
+{
+    if (prof_addr == NULL)
+        return;  // made during a collection
+    if ((unsigned char *)p != prof_addr) {
+        prof_settle();
+        return;
+    }
+    prof_pending = 0;
+    prof_record(kind, size, p, 0, prof_frames, prof_depth);
+}
+
+// Put lim back, count what was allocated since the last time, and take
+// a sample if one is due by the end of the object of request bytes that
+// gets allocated next.
+static void prof_disarm(size_t request)
+{
+    if (prof_lim != NULL) {
+        lim = prof_lim;
+        prof_lim = NULL;
+    }
+    if (!prof_running)
+        return;
+    prof_settle();
+    if (prof_mark >= fromspace && prof_mark <= curheap)
+        prof_left -= curheap - prof_mark;
+    prof_mark = curheap;
+    if (prof_left <= (intptr_t)request) {
+        prof_depth = prof_capture(prof_frames);
+        prof_pending = 1;
+        prof_addr = NULL;
+        prof_size = request;
+        prof_left = prof_gap() + request;
+    }
+}
+
+// Lower lim to where the next sample is due, though never so far that
+// an allocation of request bytes no longer fits.
+static void prof_arm(size_t request)
+{
+    size_t want;
+
+    if (!prof_running)
+        return;
+    if (prof_pending && prof_addr == NULL)
+        prof_addr = curheap;
+    prof_mark = curheap;
+    prof_lim = lim;
+    want = (size_t)prof_left > request ? (size_t)prof_left : request;
+    if (lim > curheap && (size_t)(lim - curheap) > want)
+        lim = curheap + want;
+}
+
+// Called by alloc_gc() when allocation reaches lim while it is lowered.
+// Returns 1 if the allocation can go ahead without a collection.
+static int prof_due(size_t request)
+{
+    prof_disarm(request);
+    if (curheap > lim || (size_t)(lim - curheap) + sizeof(struct cons) <
+                         request)
+        return 0;
+    prof_arm(request);
+    return 1;
+}
+
+// Count a new large vector towards the next sample. Returns whether it
+// was sampled, in which case large_sweep() calls prof_forget() when it
+// dies.
+static int prof_large(void *addr, size_t size)
+{
+    struct prof_frame frames[PROF_DEPTH];
+
+    prof_left -= size;
+    if (prof_left > 0)
+        return 0;
+    prof_left = prof_gap();
+    return prof_record(PROF_VECTOR, size, addr, 1, frames,
+                       prof_capture(frames));
+}
+
+static void prof_forget(void *addr)
+{
+    struct prof_sample *ps;
+    size_t i;
+
+    for (i = 0; i < prof_nsamples; i++) {
+        ps = &prof_samples[i];
+        if (ps->large && ps->addr == addr) {
+            ps->site->live_samples--;
+            ps->site->live_bytes -= ps->weight;
+            *ps = prof_samples[--prof_nsamples];
+            return;
+        }
+    }
+}
+
+// Called by each collector once it knows what survived: drop the
+// samples that died, follow the rest to where they moved, and count
+// what is live again.
+static void prof_sweep(void)
+{
+    struct prof_sample *ps;
+    struct prof_site *s;
+    struct cvalue *cv;
+    size_t i, n;
+
+    if (prof_nsamples == 0)
+        return;
+    for (s = prof_sites; s != NULL; s = s->all)
+        s->live_samples = s->live_bytes = 0;
+    for (i = n = 0; i < prof_nsamples; i++) {
+        ps = &prof_samples[i];
+        if (!ps->large) {
+            if (!(cv = gc_survivor((struct cvalue *)ps->addr)))
+                continue;
+            ps->addr = cv;
+        }
+        ps->site->live_samples++;
+        ps->site->live_bytes += ps->weight;
+        prof_samples[n++] = *ps;
+    }
+    prof_nsamples = n;
+}
+
+static void prof_reset(void)
+{
+    struct prof_site *s;
+
+    while ((s = prof_sites) != NULL) {
+        prof_sites = s->all;
+        free(s);
+    }
+    memset(prof_table, 0, sizeof(prof_table));
+    prof_nsites = 0;
+    prof_nsamples = 0;
+}
+
+// (heap-profile-start [bytes]) starts sampling afresh, about once every
+// so many bytes allocated, 64k by default.
+static value_t fl_heap_profile_start(value_t *args, uint32_t nargs)
+{
+    size_t interval;
+
+    if (nargs > 1)
+        argcount("heap-profile-start", nargs, 1);
+    interval = PROF_INTERVAL;
+    if (nargs > 0) {
+        interval = toulong(args[0], "heap-profile-start");
+        if (interval == 0)
+            lerror(ArgError, "heap-profile-start: interval must be positive");
+    }
+    prof_disarm(sizeof(struct cons));
+    prof_pending = 0;
+    prof_reset();
+    prof_running = 1;
+    prof_interval = interval;
+    prof_left = prof_gap();
+    prof_arm(sizeof(struct cons));
+    return FL_T;
+}
+
+// (heap-profile-stop) stops sampling. The sites it found stay, and go
+// on counting what is live.
+static value_t fl_heap_profile_stop(value_t *args, uint32_t nargs)
+{
+    (void)args;
+    argcount("heap-profile-stop", nargs, 0);
+    prof_disarm(sizeof(struct cons));
+    prof_settle();
+    prof_pending = 0;
+    prof_running = 0;
+    return FL_T;
+}
+
+static int prof_cmp(const void *a, const void *b)
+{
+    const struct prof_site *x = *(struct prof_site *const *)a;
+    const struct prof_site *y = *(struct prof_site *const *)b;
+
+    if (x->bytes != y->bytes)
+        return x->bytes < y->bytes ? 1 : -1;
+    return x->live_bytes < y->live_bytes ? 1 : -1;
+}
+
+// The sites, most bytes allocated first, in a malloc'd array of n.
+static struct prof_site **prof_sorted(size_t *n)
+{
+    struct prof_site **v, *s;
+    size_t i;
+
+    prof_settle();
+    if (!(v = malloc((prof_nsites + 1) * sizeof(*v))))
+        lerror(MemoryError, "heap-profile: out of memory");
+    for (i = 0, s = prof_sites; s != NULL; s = s->all)
+        v[i++] = s;
+    qsort(v, i, sizeof(*v), prof_cmp);
+    *n = i;
+    return v;
+}
+
+static value_t prof_kind_name(uintptr_t kind)
+{
+    switch (kind) {
+    case PROF_CONS:
+        return pairsym;
+    case PROF_VECTOR:
+        return vectorsym;
+    case PROF_FUNCTION:
+        return symbol("function");
+    case PROF_GENSYM:
+        return symbol("gensym");
+    case PROF_OTHER:
+        return symbol("other");
+    }
+    return ((struct fltype *)kind)->type;
+}
+
+// (heap-profile) => a list with an entry for each allocation site, the
+// most bytes allocated first: (allocated live samples type frames), the
+// byte counts being estimates and live as of the last collection, and
+// frames a list of (function-name . bytecode-offset), innermost first.
+static value_t fl_heap_profile(value_t *args, uint32_t nargs)
+{
+    struct prof_site **sites, *s;
+    size_t n, i;
+    value_t v;
+    int j;
+
+    (void)args;
+    argcount("heap-profile", nargs, 0);
+    sites = prof_sorted(&n);
+    PUSH(FL_NIL);
+    for (i = n; i-- > 0;) {
+        s = sites[i];
+        PUSH(FL_NIL);
+        for (j = s->depth; j-- > 0;) {
+            v = s->frames[j].offset < 0 ? FL_F : fixnum(s->frames[j].offset);
+            v = fl_cons(s->frames[j].name, v);
+            Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+        }
+        Stack[SP - 1] = fl_cons(Stack[SP - 1], FL_NIL);
+        Stack[SP - 1] = fl_cons(prof_kind_name(s->kind), Stack[SP - 1]);
+        Stack[SP - 1] = fl_cons(return_from_uint64(s->samples), Stack[SP - 1]);
+        v = return_from_uint64(s->live_bytes);
+        Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+        v = return_from_uint64(s->bytes);
+        Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+        v = POP();
+        Stack[SP - 1] = fl_cons(v, Stack[SP - 1]);
+    }
+    free(sites);
+    return POP();
+}
+
+// (heap-profile-write [port]) writes the sites as a table, by default
+// to *output-stream*.
+static value_t fl_heap_profile_write(value_t *args, uint32_t nargs)
+{
+    struct prof_site **sites, *s;
+    struct ios *f;
+    uint64_t total, live;
+    size_t n, i;
+    int j;
+
+    if (nargs > 1)
+        argcount("heap-profile-write", nargs, 1);
+    if (nargs > 0)
+        f = fl_toiostream(args[0], "heap-profile-write");
+    else
+        f = fl_toiostream(symbol_value(outstrsym), "heap-profile-write");
+    sites = prof_sorted(&n);
+    total = live = 0;
+    for (i = 0; i < n; i++) {
+        total += sites[i]->bytes;
+        live += sites[i]->live_bytes;
+    }
+    ios_printf(f, "%lu bytes allocated, %lu live, sampled every %lu\n",
+               (unsigned long)total, (unsigned long)live,
+               (unsigned long)prof_interval);
+    ios_printf(f, "%12s %12s %8s  %s\n", "allocated", "live", "samples",
+               "type / site");
+    for (i = 0; i < n; i++) {
+        s = sites[i];
+        ios_printf(f, "%12lu %12lu %8lu  ", (unsigned long)s->bytes,
+                   (unsigned long)s->live_bytes, (unsigned long)s->samples);
+        fl_print(f, prof_kind_name(s->kind));
+        for (j = 0; j < s->depth; j++) {
+            ios_puts(j ? " < " : " @ ", f);
+            fl_print(f, s->frames[j].name);
+            if (s->frames[j].offset >= 0)
+                ios_printf(f, "+%d", (int)s->frames[j].offset);
+        }
+        ios_putc('\n', f);
+    }
+    free(sites);
+    return FL_T;
+}
@@ -0,0 +1,326 @@
+// Incremental copying collection after Baker, for programs that care
+// more about pause times than throughput. A cycle starts with a flip:
+// the mutator moves to the other semispace and only the roots are
+// copied there. After that, each time allocation reaches lim the
+// collector does a slice of work, scanning gray (copied but unscanned)
+// objects, until none are left and the cycle ends.
+//
+// Meanwhile car_, cdr_ and vector_elt read through fl_slot(), which
+// copies an old-space object before the mutator can see it, so the
+// mutator never holds a pointer into old space and never stores one.
+// Functions, gensyms and cvalues are scanned as soon as they are
+// copied, which is why their fields need no barrier. Memory handed to
+// the mutator during a cycle is zeroed first, since fl_slot() also
+// looks at the slot that a store is about to overwrite.
+//
+// A slice scans in proportion to what the mutator allocated since the
+// last one, at a rate that gets through the old space before the new
+// one fills up, and gives up early after fl_gc_pause microseconds. If
+// the mutator gets too far ahead anyway, the rest of the cycle is done
+// in one go.
+//
+// The size of the next heap is settled when a cycle ends, from what it
+// found live. A smaller one takes effect by starting the next cycle
+// early, before the mutator has filled more than the new heap can take.
+// When even the largest heap allowed has no room for both old space and
+// a slice of allocation, the whole cycle is done at the flip, which
+// needs room only for what is live, and the mutator may then fill the
+// heap up to the end.
+
+#define INC_SLICE (64 * 1024)  // bytes allocated between slices
+#define INC_CLOCK_EVERY 64     // objects scanned between looks at the clock
+
+static value_t *gray;
+static size_t gray_n, gray_cap;
+static int inc_active;
+static size_t inc_copied;        // bytes copied out of old space so far
+static size_t inc_live;          // bytes copied by the last cycle
+static size_t inc_tosize;        // size of tospace
+static size_t inc_next;          // size for the next cycle
+static size_t inc_room;          // what the mutator fills before a cycle
+static double inc_rate;          // bytes to scan per byte allocated
+static unsigned char *inc_mark;  // curheap after the last slice
+static size_t inc_mark_copied;   // inc_copied after the last slice
+static unsigned char *inc_zeroed;
+
+static size_t inc_scan(value_t v);
+
+#define inc_isold(v) \
+    (((v)&3) != 0 && (uintptr_t)(v) - fl_oldspace < fl_oldsize)
+#define inc_trigger() (fromspace + inc_room)
+
+// The mutator may allocate up to here without leaving too little room
+// to copy the rest of old space.
+#define inc_hardlim()                                   \
+    (fromspace + heapsize - (fl_oldsize - inc_copied) - \
+     sizeof(struct cons))
+
+static void inc_push(value_t v)
+{
+    value_t *g;
+
+    if (gray_n == gray_cap) {
+        g = realloc(gray, 2 * gray_cap * sizeof(value_t));
+        if (g == NULL) {
+            inc_scan(v);
+            return;
+        }
+        gray = g;
+        gray_cap *= 2;
+    }
+    gray[gray_n++] = v;
+}
+
+static value_t inc_evacuate(value_t v)
+{
+    value_t oldspace[CVALUE_NWORDS + 1];
+    struct cvalue *old;
+    struct fltype *t;
+    value_t *o, *n, nv;
+    size_t nw;
+
+    if (!inc_isold(v))
+        return v;
+    o = (value_t *)ptr(v);
+    if (o[0] == TAG_FWD)
+        return o[1];
+    if (isvector(v) && (o[0] & 0x1)) {
+        // grown vector
+        nv = inc_evacuate(o[1]);
+        forward(v, nv);
+        return nv;
+    }
+    nw = ALIGN(gc_nwords(v, o[0]), 2);
+    n = (value_t *)curheap;
+    curheap += nw * sizeof(value_t);
+    inc_copied += nw * sizeof(value_t);
+    gc_copied += nw * sizeof(value_t);
+    memcpy(n, o, nw * sizeof(value_t));
+    nv = tagptr(n, tag(v));
+    old = (struct cvalue *)ALIGN((uintptr_t)oldspace, 8);
+    if (iscvalue(v)) {
+        // the relocate hook gets the old header, for the old data
+        // address, since forwarding overwrites it
+        *old = *(struct cvalue *)o;
+        if (isinlined((struct cvalue *)o))
+            ((struct cvalue *)n)->data = &((struct cvalue *)n)->_space[0];
+    }
+    forward(v, nv);
+
+    switch (tag(v)) {
+    case TAG_CONS:
+        inc_push(nv);
+        break;
+    case TAG_VECTOR:
+        if (vector_size(nv) > 0)
+            inc_push(nv);
+        break;
+    case TAG_CVALUE:
+        t = cv_class(old);
+        if (t->vtable != NULL && t->vtable->relocate != NULL)
+            t->vtable->relocate(tagptr(old, TAG_CVALUE), nv);
+        break;
+    case TAG_FUNCTION:
+        n[0] = inc_evacuate(n[0]);
+        n[1] = inc_evacuate(n[1]);
+        n[2] = inc_evacuate(n[2]);
+        break;
+    case TAG_SYM:
+        ((struct gensym *)n)->isconst = 0;
+        if (((struct gensym *)n)->binding != UNBOUND)
+            ((struct gensym *)n)->binding =
+            inc_evacuate(((struct gensym *)n)->binding);
+        break;
+    }
+    return nv;
+}
+
+value_t *fl_gc_forward(value_t *slot)
+{
+    *slot = inc_evacuate(*slot);
+    return slot;
+}
+
+// Copy what a gray object points to, and return its size in bytes.
+static size_t inc_scan(value_t v)
+{
+    value_t *p;
+    size_t i, n;
+
+    p = (value_t *)ptr(v);
+    if (iscons(v)) {
+        p[0] = inc_evacuate(p[0]);
+        p[1] = inc_evacuate(p[1]);
+        return sizeof(struct cons);
+    }
+    n = p[0] >> 2;
+    for (i = 1; i <= n; i++)
+        p[i] = inc_evacuate(p[i]);
+    return (n + 1) * sizeof(value_t);
+}
+
+static void inc_drain(void)
+{
+    while (gray_n > 0)
+        inc_scan(gray[--gray_n]);
+}
+
+static void inc_slice(void)
+{
+    size_t allocated, quota, done, k;
+    double deadline;
+
+    allocated = (size_t)(curheap - inc_mark) - (inc_copied - inc_mark_copied);
+    quota = (size_t)(allocated * inc_rate) + 1;
+    deadline = clock_now() + fl_gc_pause / 1e6;
+    for (done = k = 0; gray_n > 0 && done < quota; k++) {
+        if (k % INC_CLOCK_EVERY == INC_CLOCK_EVERY - 1 &&
+            clock_now() > deadline)
+            break;
+        done += inc_scan(gray[--gray_n]);
+    }
+    inc_mark = curheap;
+    inc_mark_copied = inc_copied;
+}
+
+static void inc_finish(void)
+{
+    sweep_finalizers();
+    prof_sweep();
+    inc_live = inc_copied;
+    inc_next = heap_target(inc_live, 0);
+    inc_room = (inc_next < heapsize ? inc_next : heapsize) / 2;
+    inc_active = 0;
+    fl_oldspace = 0;
+    fl_oldsize = 0;
+    gc_visit = relocate;
+}
+
+static void inc_flip(size_t request)
+{
+    size_t used, want;
+    unsigned char *space;
+    uint32_t *flags;
+    int whole;
+
+    // the new space takes what old space has in use, should it all be
+    // live, the request, and room for the mutator to go on allocating
+    used = (size_t)(curheap - fromspace);
+    want = inc_next;
+    while (want < (used + request) / 2 * 3 + INC_SLICE && want < heap_max)
+        want = heap_grown(want);
+    whole = want < used + request + INC_SLICE;
+    if (want != inc_tosize) {
+        if (!(space = space_resize(tospace, inc_tosize, want)))
+            fl_raise(memory_exception_value);
+        tospace = space;
+        inc_tosize = want;
+    }
+    if (want > heapsize) {
+        flags = bitvector_resize(consflags, 0, want / sizeof(struct cons), 1);
+        if (flags == NULL)
+            fl_raise(memory_exception_value);
+        consflags = flags;
+    }
+
+    fl_oldspace = (uintptr_t)fromspace;
+    fl_oldsize = used;
+    space = fromspace;
+    fromspace = tospace;
+    tospace = space;
+    inc_tosize = heapsize;
+    heapsize = want;
+    curheap = inc_zeroed = fromspace;
+    inc_copied = 0;
+    inc_active = 1;
+    gc_visit = inc_evacuate;
+    trace_roots();
+    if (whole) {
+        inc_drain();
+        inc_finish();
+        if (curheap + request > inc_trigger())
+            inc_room = heapsize - sizeof(struct cons);
+        if (curheap + request > inc_trigger()) {
+            lim = inc_trigger();
+            fl_raise(memory_exception_value);  // at fl_heap_max
+        }
+        return;
+    }
+    inc_rate = (double)used * 5 / 4 / (want - used - request);
+    inc_mark = curheap;
+    inc_mark_copied = inc_copied;
+}
+
+static struct cvalue *inc_survivor(struct cvalue *cv)
+{
+    if (!inc_isold((value_t)cv | TAG_CVALUE))
+        return cv;  // allocated during this cycle
+    if (isforwarded((value_t)cv))
+        return (struct cvalue *)ptr(forwardloc((value_t)cv));
+    return NULL;
+}
+
+// Move lim to the next slice, or to where the next cycle starts, and
+// clear the memory that the mutator may allocate before then.
+static void inc_setlim(size_t request)
+{
+    unsigned char *end;
+
+    if (!inc_active) {
+        lim = inc_trigger();
+        return;
+    }
+    lim = curheap + (request > INC_SLICE ? request : INC_SLICE);
+    if (lim > inc_hardlim())
+        lim = inc_hardlim();
+    end = lim + sizeof(struct cons);
+    if (inc_zeroed < curheap)
+        inc_zeroed = curheap;
+    if (inc_zeroed < end) {
+        memset(inc_zeroed, 0, end - inc_zeroed);
+        inc_zeroed = end;
+    }
+}
+
+static void incremental_gc(size_t request)
+{
+    if (inc_active)
+        inc_slice();
+    else if (curheap + request <= lim)
+        inc_flip(request);  // asked to collect before we had to
+    for (;;) {
+        if (!inc_active) {
+            if (curheap + request <= inc_trigger())
+                break;
+            inc_flip(request);
+        } else if (gray_n == 0) {
+            inc_finish();
+        } else if (curheap + request > inc_hardlim()) {
+            inc_drain();
+        } else {
+            break;
+        }
+    }
+    inc_setlim(request);
+}
+
+// Finish the cycle under way, if any, and do a whole one.
+static void incremental_full_gc(void)
+{
+    if (inc_active) {
+        inc_drain();
+        inc_finish();
+    }
+    inc_flip(sizeof(struct cons));
+    inc_drain();
+    inc_finish();
+    inc_setlim(sizeof(struct cons));
+}
+
+static void incremental_init(void)
+{
+    gray_cap = 4096;
+    gray = malloc(gray_cap * sizeof(value_t));
+    inc_tosize = inc_next = heapsize;
+    inc_room = heapsize / 2;
+}
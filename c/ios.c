@@ -18,10 +18,17 @@
 #include <fcntl.h>
 #else
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/select.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef __linux__
+#include <sys/sendfile.h>
 #endif
 
 #include "scheme.h"
@@ -41,23 +48,25 @@ static void *our_memrchr(const void *s, int c, size_t n)
     return NULL;
 }
 
-#if 0
-// poll for read, unless forwrite!=0
+#define SLEEP_TIME 5  // ms
+
+// wait until fd is ready for reading, or writing if forwrite!=0. this
+// only blocks on one fd; use an event loop to serve many.
 static void _fd_poll(long fd, int forwrite)
 {
 #ifndef _WIN32
-    fd_set set;
-
-    FD_ZERO(&set);
-    FD_SET(fd, &set);
-    if (forwrite)
-        select(fd+1, NULL, &set, NULL, NULL);
-    else
-        select(fd+1, &set, NULL, NULL, NULL);
+    struct pollfd pfd;
+
+    pfd.fd = (int)fd;
+    pfd.events = forwrite ? POLLOUT : POLLIN;
+    pfd.revents = 0;
+    poll(&pfd, 1, -1);
 #else
+    (void)fd;
+    (void)forwrite;
+    sleep_ms(SLEEP_TIME);
 #endif
 }
-#endif
 
 #ifdef _WIN32
 static int _enonfatal(int err)
@@ -75,8 +84,6 @@ static int _enonfatal(int err)
 }
 #endif
 
-#define SLEEP_TIME 5  // ms
-
 // return error code, #bytes read in *nread
 // these wrappers retry operations until success or a fatal error
 static int _os_read(long fd, void *buf, size_t n, size_t *nread)
@@ -93,7 +100,7 @@ static int _os_read(long fd, void *buf, size_t n, size_t *nread)
             *nread = 0;
             return errno;
         }
-        sleep_ms(SLEEP_TIME);
+        _fd_poll(fd, 0);
     }
     return 0;
 }
@@ -131,7 +138,7 @@ static int _os_write(long fd, const void *buf, size_t n, size_t *nwritten)
             *nwritten = 0;
             return errno;
         }
-        sleep_ms(SLEEP_TIME);
+        _fd_poll(fd, 1);
     }
     return 0;
 }
@@ -155,11 +162,184 @@ static int _os_write_all(long fd, const void *buf, size_t n, size_t *nwritten)
     return 0;
 }
 
+#ifndef _WIN32
+static int _os_writev_all(long fd, struct iovec *iov, int n,
+                          size_t *nwritten)
+{
+    ssize_t r;
+
+    *nwritten = 0;
+    while (n > 0) {
+        r = writev((int)fd, iov, n);
+        if (r < 0) {
+            if (!_enonfatal(errno))
+                return errno;
+            _fd_poll(fd, 1);
+            continue;
+        }
+        *nwritten += (size_t)r;
+        while (n > 0 && (size_t)r >= iov->iov_len) {
+            r -= iov->iov_len;
+            iov++;
+            n--;
+        }
+        if (n > 0) {
+            iov->iov_base = (char *)iov->iov_base + r;
+            iov->iov_len -= r;
+        }
+    }
+    return 0;
+}
+#endif
+
+int ios_fd_readall(long fd, void *buf, size_t n, size_t *nread)
+{
+    return _os_read_all(fd, buf, n, nread);
+}
+
+int ios_fd_writeall(long fd, const void *buf, size_t n, size_t *nwritten)
+{
+    return _os_write_all(fd, buf, n, nwritten);
+}
+
+// stream data goes to and from the fd through the filter, if any
+
+// a filter that fails to decode its input raises an io-error, then and
+// on every later read, since it has lost its place in the input
+static int _ios_fdread(struct ios *s, void *buf, size_t n, size_t *nread)
+{
+    int err;
+
+    if (s->filter == NULL)
+        return _os_read(s->fd, buf, n, nread);
+    *nread = 0;
+    if (!(err = s->errcode) && !(err = s->filter->read(s, buf, n, nread)))
+        s->filter->pos += *nread;
+    if (err) {
+        s->errcode = err;
+        s->_eof = 1;
+        lerrorf(IOError, "read: %s",
+                (err == EILSEQ) ? "corrupt or invalid compressed data"
+                                : strerror(err));
+    }
+    return err;
+}
+
+static int _ios_fdread_all(struct ios *s, void *buf, size_t n,
+                           size_t *nread)
+{
+    unsigned char *ubuf;
+    size_t got;
+    int err;
+
+    if (s->filter == NULL)
+        return _os_read_all(s->fd, buf, n, nread);
+    ubuf = buf;
+    *nread = 0;
+    while (n > 0) {
+        err = _ios_fdread(s, ubuf, n, &got);
+        n -= got;
+        *nread += got;
+        ubuf += got;
+        if (err || got == 0)
+            return err;
+    }
+    return 0;
+}
+
+static int _ios_fdwrite_all(struct ios *s, const void *buf, size_t n,
+                            size_t *nwritten)
+{
+    int err;
+
+    if (s->filter == NULL)
+        return _os_write_all(s->fd, buf, n, nwritten);
+    if ((err = s->filter->write(s, buf, n, nwritten)))
+        s->errcode = err;
+    s->filter->pos += *nwritten;
+    return err;
+}
+
 /* internal utility functions */
 
+// drop a file mapping installed by ios_mmap. the caller must have copied
+// anything it still needs out of the buffer.
+static void _buf_unmap(struct ios *s)
+{
+#ifndef _WIN32
+    if (s->mapped)
+        munmap(s->buf, s->maxsize);
+#endif
+    s->mapped = 0;
+}
+
+// buffers of the standard sizes, IOS_INITBUFSIZE doubled up to
+// IOS_BUFSIZE, are kept on free lists when their stream is done with
+// them so that opening and closing streams doesn't churn malloc. like
+// all stream buffers they are malloc'd with room for a NUL terminator,
+// so a buffer taken over by ios_takebuf can still be passed to free().
+#define IOS_POOL_CLASSES 6  // log2(IOS_BUFSIZE / IOS_INITBUFSIZE) + 1
+#define IOS_POOL_DEPTH 16
+
+static struct {
+    char *head;
+    int count;
+} bufpool[IOS_POOL_CLASSES];
+
+static int _buf_class(size_t sz)
+{
+    size_t n;
+    int c;
+
+    for (c = 0, n = IOS_INITBUFSIZE; c < IOS_POOL_CLASSES; c++, n *= 2)
+        if (n == sz)
+            return c;
+    return -1;
+}
+
+static size_t _buf_roundup(size_t sz)
+{
+    size_t n;
+
+    if (sz < IOS_INITBUFSIZE || sz > IOS_BUFSIZE)
+        return sz;
+    for (n = IOS_INITBUFSIZE; n < sz; n *= 2)
+        ;
+    return n;
+}
+
+static char *_buf_alloc(size_t sz)
+{
+    char *buf;
+    int c;
+
+    if ((c = _buf_class(sz)) >= 0 && (buf = bufpool[c].head) != NULL) {
+        memcpy(&bufpool[c].head, buf, sizeof(char *));
+        bufpool[c].count--;
+        return buf;
+    }
+    // always allocate 1 bigger in case user wants to add a NUL
+    // terminator after taking over the buffer
+    return malloc(sz + 1);
+}
+
+static void _buf_free(char *buf, size_t sz)
+{
+    int c;
+
+    if ((c = _buf_class(sz)) >= 0 && bufpool[c].count < IOS_POOL_DEPTH) {
+        memcpy(buf, &bufpool[c].head, sizeof(char *));
+        bufpool[c].head = buf;
+        bufpool[c].count++;
+        return;
+    }
+    free(buf);
+}
+
 static char *_buf_realloc(struct ios *s, size_t sz)
 {
     char *temp;
+    int owned;
 
     if ((s->buf == NULL || s->buf == &s->local[0]) && (sz <= IOS_INLSIZE)) {
         /* TODO: if we want to allow shrinking, see if the buffer shrank
@@ -173,20 +353,23 @@ static char *_buf_realloc(struct ios *s, size_t sz)
     if (sz <= s->maxsize)
         return s->buf;
 
-    if (s->ownbuf && s->buf != &s->local[0]) {
+    sz = _buf_roundup(sz);
+    owned = (s->buf != NULL && s->ownbuf && s->buf != &s->local[0]);
+    if (owned && _buf_class(s->maxsize) < 0 && _buf_class(sz) < 0) {
         // if we own the buffer we're free to resize it
-        // always allocate 1 bigger in case user wants to add a NUL
-        // terminator after taking over the buffer
         temp = realloc(s->buf, sz + 1);
         if (temp == NULL)
             return NULL;
     } else {
-        temp = malloc(sz + 1);
+        temp = _buf_alloc(sz);
         if (temp == NULL)
             return NULL;
-        s->ownbuf = 1;
         if (s->size > 0)
             memcpy(temp, s->buf, s->size);
+        if (owned)
+            _buf_free(s->buf, s->maxsize);
+        _buf_unmap(s);
+        s->ownbuf = 1;
     }
 
     s->buf = temp;
@@ -194,6 +377,14 @@ static char *_buf_realloc(struct ios *s, size_t sz)
     return s->buf;
 }
 
+// fd streams start with a small buffer and double it, up to
+// IOS_BUFSIZE, each time a read or a write uses all of it.
+static void _buf_grow(struct ios *s)
+{
+    if (!s->fixedbuf && s->bm != bm_mem && s->maxsize < IOS_BUFSIZE)
+        _buf_realloc(s, s->maxsize * 2);
+}
+
 // write a block of data into the buffer at the current position, resizing
 // if necessary. returns # written.
 static size_t _write_grow(struct ios *s, const char *data, size_t n)
@@ -269,16 +460,16 @@ static size_t _ios_read(struct ios *s, char *dest, size_t n, int all)
         if (n > MOST_OF(s->maxsize)) {
             // doesn't fit comfortably in buffer; go direct
             if (all)
-                _os_read_all(s->fd, dest, n, &got);
+                _ios_fdread_all(s, dest, n, &got);
             else
-                _os_read(s->fd, dest, n, &got);
+                _ios_fdread(s, dest, n, &got);
             tot += got;
             if (got == 0)
                 s->_eof = 1;
             return tot;
         } else {
             // refill buffer
-            if (_os_read(s->fd, s->buf, s->maxsize, &got)) {
+            if (_ios_fdread(s, s->buf, s->maxsize, &got)) {
                 s->_eof = 1;
                 return tot;
             }
@@ -287,6 +478,8 @@ static size_t _ios_read(struct ios *s, char *dest, size_t n, int all)
                 return tot;
             }
             s->size = got;
+            if (got == s->maxsize)
+                _buf_grow(s);
         }
     }
 
@@ -328,10 +521,12 @@ size_t ios_readprep(struct ios *s, size_t n)
                 return space;
         }
     }
-    result = _os_read(s->fd, s->buf + s->size, s->maxsize - s->size, &got);
+    result = _ios_fdread(s, s->buf + s->size, s->maxsize - s->size, &got);
     if (result)
         return space;
     s->size += got;
+    if (s->size == s->maxsize)
+        _buf_grow(s);
     return s->size - s->bpos;
 }
 
@@ -369,7 +564,7 @@ size_t ios_write(struct ios *s, const char *data, size_t n)
         wrote = _write_grow(s, data, n);
     } else if (s->bm == bm_none) {
         s->fpos = -1;
-        _os_write_all(s->fd, data, n, &wrote);
+        _ios_fdwrite_all(s, data, n, &wrote);
         return wrote;
     } else if (n <= space) {
         if (s->bm == bm_line) {
@@ -390,8 +585,9 @@ size_t ios_write(struct ios *s, const char *data, size_t n)
     } else {
         s->state = bst_wr;
         ios_flush(s);
+        _buf_grow(s);
         if (n > MOST_OF(s->maxsize)) {
-            _os_write_all(s->fd, data, n, &wrote);
+            _ios_fdwrite_all(s, data, n, &wrote);
             return wrote;
         }
         return ios_write(s, data, n);
@@ -400,6 +596,72 @@ size_t ios_write(struct ios *s, const char *data, size_t n)
     return wrote;
 }
 
+#define IOS_IOV_MAX 64
+
+// write several pieces in order. small pieces are copied into the
+// buffer as usual; a piece that doesn't fit in what is left of the
+// buffer goes out in one writev() together with the buffered data and
+// any large pieces right after it, instead of a flush plus a write each.
+size_t ios_writev(struct ios *s, const struct ios_iovec *v, size_t n)
+{
+    size_t i, total, wrote;
+#ifndef _WIN32
+    struct iovec iov[IOS_IOV_MAX];
+    size_t j;
+    int cnt, err;
+#endif
+
+    if (s->readonly)
+        return 0;
+    if (s->bm == bm_mem) {
+        // grow once for the whole lot
+        for (total = i = 0; i < n; i++)
+            total += v[i].len;
+        _buf_realloc(s, s->bpos + total);
+    }
+    total = 0;
+    i = 0;
+    while (i < n) {
+#ifndef _WIN32
+        if (s->bm != bm_mem && s->fd != -1 && !s->filter &&
+            s->state != bst_rd &&
+            s->bpos == s->ndirty && s->size == s->ndirty &&
+            (s->bm == bm_none || v[i].len > s->maxsize - s->bpos)) {
+            cnt = 0;
+            if (s->bpos > 0) {
+                iov[cnt].iov_base = s->buf;
+                iov[cnt].iov_len = s->bpos;
+                cnt++;
+            }
+            j = i;
+            do {
+                iov[cnt].iov_base = (void *)v[j].base;
+                iov[cnt].iov_len = v[j].len;
+                cnt++;
+                j++;
+            } while (j < n && cnt < IOS_IOV_MAX &&
+                     (s->bm == bm_none || v[j].len > s->maxsize / 2));
+            s->fpos = -1;
+            err = _os_writev_all(s->fd, iov, cnt, &wrote);
+            wrote = (wrote > s->bpos) ? wrote - s->bpos : 0;
+            s->state = bst_wr;
+            s->bpos = s->size = s->ndirty = 0;
+            total += wrote;
+            if (err)
+                break;
+            i = j;
+            continue;
+        }
+#endif
+        wrote = ios_write(s, v[i].base, v[i].len);
+        total += wrote;
+        if (wrote < v[i].len)
+            break;
+        i++;
+    }
+    return total;
+}
+
 off_t ios_seek(struct ios *s, off_t pos)
 {
     off_t fdpos;
@@ -410,6 +672,8 @@ off_t ios_seek(struct ios *s, off_t pos)
             return -1;
         s->bpos = pos;
     } else {
+        if (s->filter)
+            return -1;
         ios_flush(s);
         fdpos = lseek(s->fd, pos, SEEK_SET);
         if (fdpos == (off_t)-1)
@@ -427,6 +691,8 @@ off_t ios_seek_end(struct ios *s)
     if (s->bm == bm_mem) {
         s->bpos = s->size;
     } else {
+        if (s->filter)
+            return -1;
         ios_flush(s);
         fdpos = lseek(s->fd, 0, SEEK_END);
         if (fdpos == (off_t)-1)
@@ -458,6 +724,8 @@ off_t ios_skip(struct ios *s, off_t offs)
                 return -1;
             }
         }
+        if (s->filter)
+            return -1;
         ios_flush(s);
         if (s->state == bst_wr)
             offs += s->bpos;
@@ -479,7 +747,7 @@ off_t ios_pos(struct ios *s)
     if (s->bm == bm_mem)
         return (off_t)s->bpos;
 
-    fdpos = s->fpos;
+    fdpos = s->filter ? s->filter->pos : s->fpos;
     if (fdpos == (off_t)-1) {
         fdpos = lseek(s->fd, 0, SEEK_CUR);
         if (fdpos == (off_t)-1)
@@ -541,7 +809,7 @@ int ios_flush(struct ios *s)
 
     ntowrite = s->ndirty;
     s->fpos = -1;
-    err = _os_write_all(s->fd, s->buf, ntowrite, &nw);
+    err = _ios_fdwrite_all(s, s->buf, ntowrite, &nw);
     // todo: try recovering from some kinds of errors (e.g. retry)
 
     if (s->state == bst_rd) {
@@ -574,11 +842,16 @@ int ios_flush(struct ios *s)
 void ios_close(struct ios *s)
 {
     ios_flush(s);
+    if (s->filter != NULL) {
+        s->filter->close(s);
+        s->filter = NULL;
+    }
     if (s->fd != -1 && s->ownfd)
         close(s->fd);
     s->fd = -1;
+    _buf_unmap(s);
     if (s->buf != NULL && s->ownbuf && s->buf != &s->local[0])
-        free(s->buf);
+        _buf_free(s->buf, s->maxsize);
     s->buf = NULL;
     s->size = s->maxsize = s->bpos = 0;
 }
@@ -591,7 +864,7 @@ static void _buf_init(struct ios *s, bufmode_t bm)
         s->maxsize = IOS_INLSIZE;
     } else {
         s->buf = NULL;
-        _buf_realloc(s, IOS_BUFSIZE);
+        _buf_realloc(s, IOS_INITBUFSIZE);
     }
     s->size = s->bpos = 0;
 }
@@ -602,12 +875,13 @@ char *ios_takebuf(struct ios *s, size_t *psize)
 
     ios_flush(s);
 
-    if (s->buf == &s->local[0]) {
+    if (s->buf == &s->local[0] || s->mapped) {
         buf = malloc(s->size + 1);
         if (buf == NULL)
             return NULL;
         if (s->size)
             memcpy(buf, s->buf, s->size);
+        _buf_unmap(s);
     } else {
         buf = s->buf;
     }
@@ -635,14 +909,34 @@ int ios_setbuf(struct ios *s, char *buf, size_t size, int own)
     }
     s->size = nvalid;
 
+    _buf_unmap(s);
     if (s->buf != NULL && s->ownbuf && s->buf != &s->local[0])
-        free(s->buf);
+        _buf_free(s->buf, s->maxsize);
     s->buf = buf;
     s->maxsize = size;
     s->ownbuf = own;
     return 0;
 }
 
+// give an fd stream a buffer of exactly sz bytes that is never grown.
+// fails if the stream already holds more than that.
+int ios_bufsize(struct ios *s, size_t sz)
+{
+    char *buf;
+
+    if (s->bm == bm_mem || s->fd == -1 || sz == 0)
+        return -1;
+    if (ios_flush(s) || s->size > sz)
+        return -1;
+    if (sz != s->maxsize) {
+        if ((buf = _buf_alloc(sz)) == NULL)
+            return -1;
+        ios_setbuf(s, buf, sz, 1);
+    }
+    s->fixedbuf = 1;
+    return 0;
+}
+
 int ios_bufmode(struct ios *s, bufmode_t mode)
 {
     // no fd; can only do mem-only buffering
@@ -661,6 +955,86 @@ void ios_set_readonly(struct ios *s)
     s->readonly = 1;
 }
 
+#ifdef __linux__
+#define KERNEL_COPY_CHUNK ((size_t)1 << 30)
+
+// copy between two fds without passing the data through user space:
+// copy_file_range between files, sendfile from a file to anything,
+// splice when one end is a pipe. stops at the first error or at end of
+// input, leaving the rest (if any) to the caller's buffered loop.
+static size_t _os_copy(long to, long from, size_t n, int all)
+{
+    size_t total, chunk;
+    ssize_t r;
+    int how;
+
+    total = 0;
+    how = 0;
+    while (how < 3 && (all || total < n)) {
+        chunk = (all || n - total > KERNEL_COPY_CHUNK) ? KERNEL_COPY_CHUNK
+                                                       : n - total;
+        if (how == 0)
+            r = copy_file_range((int)from, NULL, (int)to, NULL, chunk, 0);
+        else if (how == 1)
+            r = sendfile((int)to, (int)from, NULL, chunk);
+        else
+            r = splice((int)from, NULL, (int)to, NULL, chunk, SPLICE_F_MOVE);
+        if (r > 0) {
+            total += (size_t)r;
+        } else if (r == 0) {
+            break;
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno == EAGAIN) {
+            _fd_poll(from, 0);
+            _fd_poll(to, 1);
+        } else if (total == 0) {
+            how++;  // not supported for this pair of fds; try the next way
+        } else {
+            break;
+        }
+    }
+    return total;
+}
+#endif
+
+// when both streams are plain fds, empty the buffers and let the kernel
+// move the rest. returns the number of bytes copied.
+static size_t _ios_copy_fd(struct ios *to, struct ios *from, size_t nbytes,
+                           int all)
+{
+#ifdef __linux__
+    size_t total, avail, written;
+
+    if (to->fd == -1 || from->fd == -1 || to->bm == bm_mem ||
+        from->bm == bm_mem || to->filter || from->filter ||
+        to->readonly || to->state == bst_rd || from->state == bst_wr)
+        return 0;
+    total = 0;
+    avail = from->size - from->bpos;
+    if (avail > 0) {
+        if (!all && avail > nbytes)
+            avail = nbytes;
+        written = ios_write(to, from->buf + from->bpos, avail);
+        from->bpos += written;
+        total += written;
+        if (written < avail || (!all && total == nbytes))
+            return total;
+    }
+    if (ios_flush(to) || to->size != 0)
+        return total;
+    from->bpos = from->size = 0;
+    from->fpos = to->fpos = -1;
+    return total + _os_copy(to->fd, from->fd, nbytes - total, all);
+#else
+    (void)to;
+    (void)from;
+    (void)nbytes;
+    (void)all;
+    return 0;
+#endif
+}
+
 static size_t ios_copy_(struct ios *to, struct ios *from, size_t nbytes,
                         int all)
 {
@@ -668,6 +1042,12 @@ static size_t ios_copy_(struct ios *to, struct ios *from, size_t nbytes,
 
     total = 0;
     if (!ios_eof(from)) {
+        total = _ios_copy_fd(to, from, nbytes, all);
+        if (!all) {
+            nbytes -= total;
+            if (nbytes == 0)
+                return total;
+        }
         do {
             avail = ios_readprep(from, IOS_BUFSIZE / 2);
             if (avail == 0) {
@@ -756,6 +1136,9 @@ static void _ios_init(struct ios *s)
     s->_eof = 0;
     s->rereadable = 0;
     s->readonly = 0;
+    s->mapped = 0;
+    s->fixedbuf = 0;
+    s->filter = NULL;
 }
 
 /* stream object initializers. we do no allocation. */
@@ -785,6 +1168,47 @@ open_file_err:
     return NULL;
 }
 
+// switch a freshly opened read-only file stream over to a private
+// mapping of the whole file. the mapping becomes the stream buffer, so
+// reads, ios_readprep and ios_copyuntil work on it without copying.
+// returns 0 and leaves the stream alone if the file can't be mapped
+// (not a regular file, empty, too big, or no mmap on this platform).
+int ios_mmap(struct ios *s)
+{
+#ifdef _WIN32
+    (void)s;
+    return 0;
+#else
+    struct stat st;
+    void *map;
+
+    if (s->fd == -1 || !s->readonly || s->size != 0 || s->mapped ||
+        s->filter)
+        return 0;
+    if (fstat(s->fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_size <= 0)
+        return 0;
+    if ((uintmax_t)st.st_size > (uintmax_t)(SIZE_MAX - 1))
+        return 0;
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, s->fd, 0);
+    if (map == MAP_FAILED)
+        return 0;
+    if (s->buf != NULL && s->ownbuf && s->buf != &s->local[0])
+        free(s->buf);
+    if (s->ownfd)
+        close(s->fd);
+    s->fd = -1;
+    s->bm = bm_mem;
+    s->state = bst_rd;
+    s->buf = map;
+    s->maxsize = s->size = (size_t)st.st_size;
+    s->bpos = 0;
+    s->ownbuf = 0;
+    s->ownfd = 0;
+    s->mapped = 1;
+    return 1;
+#endif
+}
+
 struct ios *ios_mem(struct ios *s, size_t initsize)
 {
     _ios_init(s);
@@ -897,6 +1321,10 @@ int ios_ungetc(int c, struct ios *s)
     if (s->state == bst_wr)
         return IOS_EOF;
     if (s->bpos > 0) {
+        // a mapped buffer is read-only; copy it out before changing it
+        if (s->buf[s->bpos - 1] != (char)c && s->mapped &&
+            _buf_realloc(s, s->maxsize + 1) == NULL)
+            return IOS_EOF;
         s->bpos--;
         s->buf[s->bpos] = (char)c;
         s->_eof = 0;
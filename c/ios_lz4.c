@@ -0,0 +1,665 @@
+// Copyright 2019 Lassi Kortela
+// SPDX-License-Identifier: BSD-3-Clause
+
+// LZ4 compression as a stream filter. A stream with the filter
+// compresses what it writes, or decompresses what it reads, in the LZ4
+// frame format, so its files can be exchanged with the lz4 command line
+// tool. We write independent 64 KiB blocks with a content checksum and
+// can read any frame the format allows except ones that need an
+// external dictionary. Concatenated and skippable frames are fine.
+
+#include <sys/types.h>
+
+#include <errno.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scheme.h"
+
+#define LZ4_MAGIC 0x184D2204
+#define LZ4_SKIP_MAGIC 0x184D2A50  // low 4 bits are free
+
+#define LZ4_BLOCKSIZE 65536  // the blocks we write
+#define LZ4_WINDOW 65536     // how far back a match can reach
+#define LZ4_MINMATCH 4
+#define LZ4_LASTLITERALS 5  // a block ends with at least this many literals
+#define LZ4_MFLIMIT 12      // and its last match starts before this
+#define LZ4_HASHLOG 12
+#define LZ4_SKIPTRIGGER 6
+
+// frame descriptor flags
+#define FLG_VERSION 0x40
+#define FLG_INDEP 0x20
+#define FLG_BLOCKSUM 0x10
+#define FLG_SIZE 0x08
+#define FLG_CONTENTSUM 0x04
+#define FLG_DICTID 0x01
+
+static uint32_t get32(const unsigned char *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+static void put32(unsigned char *p, uint32_t x)
+{
+    p[0] = x & 0xff;
+    p[1] = (x >> 8) & 0xff;
+    p[2] = (x >> 16) & 0xff;
+    p[3] = x >> 24;
+}
+
+static uint32_t load32(const unsigned char *p)
+{
+    uint32_t x;
+
+    memcpy(&x, p, sizeof(x));
+    return x;
+}
+
+static uint64_t load64(const unsigned char *p)
+{
+    uint64_t x;
+
+    memcpy(&x, p, sizeof(x));
+    return x;
+}
+
+//// xxHash32, which the frame format uses for its checksums
+
+#define PRIME32_1 2654435761U
+#define PRIME32_2 2246822519U
+#define PRIME32_3 3266489917U
+#define PRIME32_4 668265263U
+#define PRIME32_5 374761393U
+
+struct xxh32 {
+    uint32_t v[4];
+    uint64_t total;
+    unsigned char mem[16];
+    size_t memsize;
+};
+
+static uint32_t rotl32(uint32_t x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+static void xxh32_init(struct xxh32 *h)
+{
+    h->v[0] = PRIME32_1 + PRIME32_2;
+    h->v[1] = PRIME32_2;
+    h->v[2] = 0;
+    h->v[3] = 0 - PRIME32_1;
+    h->total = 0;
+    h->memsize = 0;
+}
+
+static void xxh32_stripe(struct xxh32 *h, const unsigned char *p)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        h->v[i] += get32(p + 4 * i) * PRIME32_2;
+        h->v[i] = rotl32(h->v[i], 13) * PRIME32_1;
+    }
+}
+
+static void xxh32_update(struct xxh32 *h, const unsigned char *p, size_t n)
+{
+    size_t k;
+
+    h->total += n;
+    if (h->memsize + n < 16) {
+        memcpy(h->mem + h->memsize, p, n);
+        h->memsize += n;
+        return;
+    }
+    if (h->memsize) {
+        k = 16 - h->memsize;
+        memcpy(h->mem + h->memsize, p, k);
+        xxh32_stripe(h, h->mem);
+        p += k;
+        n -= k;
+    }
+    for (; n >= 16; p += 16, n -= 16)
+        xxh32_stripe(h, p);
+    memcpy(h->mem, p, n);
+    h->memsize = n;
+}
+
+static uint32_t xxh32_digest(const struct xxh32 *h)
+{
+    const unsigned char *p, *end;
+    uint32_t x;
+
+    if (h->total >= 16)
+        x = rotl32(h->v[0], 1) + rotl32(h->v[1], 7) + rotl32(h->v[2], 12) +
+            rotl32(h->v[3], 18);
+    else
+        x = h->v[2] + PRIME32_5;
+    x += (uint32_t)h->total;
+    p = h->mem;
+    end = h->mem + h->memsize;
+    for (; p + 4 <= end; p += 4)
+        x = rotl32(x + get32(p) * PRIME32_3, 17) * PRIME32_4;
+    for (; p < end; p++)
+        x = rotl32(x + *p * PRIME32_5, 11) * PRIME32_1;
+    x ^= x >> 15;
+    x *= PRIME32_2;
+    x ^= x >> 13;
+    x *= PRIME32_3;
+    x ^= x >> 16;
+    return x;
+}
+
+static uint32_t xxh32(const unsigned char *p, size_t n)
+{
+    struct xxh32 h;
+
+    xxh32_init(&h);
+    xxh32_update(&h, p, n);
+    return xxh32_digest(&h);
+}
+
+//// Blocks
+
+static uint32_t lz4_hash(uint32_t seq)
+{
+    return (seq * 2654435761U) >> (32 - LZ4_HASHLOG);
+}
+
+static unsigned char *put_length(unsigned char *op, size_t len)
+{
+    for (; len >= 255; len -= 255)
+        *op++ = 255;
+    *op++ = (unsigned char)len;
+    return op;
+}
+
+// Greedy compression of at most LZ4_BLOCKSIZE bytes: look each position
+// up in a hash table of recent 4-byte sequences, skipping ahead faster
+// the longer nothing matches. Returns the compressed size, or 0 if that
+// would exceed cap.
+static size_t lz4_compress_block(const unsigned char *src, size_t n,
+                                 unsigned char *dst, size_t cap,
+                                 uint32_t *table)
+{
+    const unsigned char *ip, *anchor, *ref, *mp, *rp;
+    const unsigned char *end, *mflimit, *matchlimit;
+    unsigned char *op, *oend, *token;
+    size_t lit, len, off, step, attempts;
+    uint32_t seq, h;
+
+    end = src + n;
+    op = dst;
+    oend = dst + cap;
+    anchor = ip = src;
+    if (n > LZ4_MFLIMIT) {
+        memset(table, 0, sizeof(*table) << LZ4_HASHLOG);
+        mflimit = end - LZ4_MFLIMIT;
+        matchlimit = end - LZ4_LASTLITERALS;
+        ip++;
+        for (;;) {
+            step = 1;
+            attempts = 1 << LZ4_SKIPTRIGGER;
+            for (;;) {
+                if (ip > mflimit)
+                    goto last;
+                seq = load32(ip);
+                h = lz4_hash(seq);
+                ref = src + table[h];
+                table[h] = (uint32_t)(ip - src);
+                if (ref < ip && load32(ref) == seq)
+                    break;
+                ip += step;
+                step = attempts++ >> LZ4_SKIPTRIGGER;
+            }
+            while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+                ip--;
+                ref--;
+            }
+            mp = ip + LZ4_MINMATCH;
+            rp = ref + LZ4_MINMATCH;
+            while (mp + 8 <= matchlimit && load64(mp) == load64(rp)) {
+                mp += 8;
+                rp += 8;
+            }
+            while (mp < matchlimit && *mp == *rp) {
+                mp++;
+                rp++;
+            }
+            lit = ip - anchor;
+            len = mp - ip - LZ4_MINMATCH;
+            off = ip - ref;
+            if ((size_t)(oend - op) < lit + lit / 255 + len / 255 + 5)
+                return 0;
+            token = op++;
+            if (lit >= 15) {
+                *token = 15 << 4;
+                op = put_length(op, lit - 15);
+            } else {
+                *token = (unsigned char)(lit << 4);
+            }
+            memcpy(op, anchor, lit);
+            op += lit;
+            *op++ = off & 0xff;
+            *op++ = off >> 8;
+            if (len >= 15) {
+                *token |= 15;
+                op = put_length(op, len - 15);
+            } else {
+                *token |= (unsigned char)len;
+            }
+            anchor = ip = mp;
+            if (ip > mflimit)
+                break;
+            table[lz4_hash(load32(ip - 2))] = (uint32_t)(ip - 2 - src);
+        }
+    }
+last:
+    lit = end - anchor;
+    if ((size_t)(oend - op) < lit + lit / 255 + 2)
+        return 0;
+    token = op++;
+    if (lit >= 15) {
+        *token = 15 << 4;
+        op = put_length(op, lit - 15);
+    } else {
+        *token = (unsigned char)(lit << 4);
+    }
+    memcpy(op, anchor, lit);
+    op += lit;
+    return op - dst;
+}
+
+// Decode the n-byte block at ip into out[pos..cap). Matches may reach
+// back into out[0..pos), which holds the end of the previous block when
+// blocks are linked. Never reads or writes out of bounds, whatever the
+// input. Returns 0 or EILSEQ.
+static int lz4_decompress_block(const unsigned char *ip, size_t n,
+                                unsigned char *out, size_t pos, size_t cap,
+                                size_t *outlen)
+{
+    const unsigned char *iend, *ref;
+    unsigned char *op, *oend;
+    size_t lit, len, off, k;
+    unsigned char b;
+
+    iend = ip + n;
+    op = out + pos;
+    oend = out + cap;
+    for (;;) {
+        if (ip == iend)
+            return EILSEQ;
+        b = *ip++;
+        lit = b >> 4;
+        len = b & 15;
+        if (lit == 15) {
+            do {
+                if (ip == iend)
+                    return EILSEQ;
+                lit += (b = *ip++);
+            } while (b == 255);
+        }
+        if (lit > (size_t)(iend - ip) || lit > (size_t)(oend - op))
+            return EILSEQ;
+        memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+        if (ip == iend)
+            break;  // the last sequence has no match
+        if (iend - ip < 2)
+            return EILSEQ;
+        off = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (off == 0 || off > (size_t)(op - out))
+            return EILSEQ;
+        if (len == 15) {
+            do {
+                if (ip == iend)
+                    return EILSEQ;
+                len += (b = *ip++);
+            } while (b == 255);
+        }
+        len += LZ4_MINMATCH;
+        if (len > (size_t)(oend - op))
+            return EILSEQ;
+        // an overlapping match repeats the last off bytes; copy the
+        // pattern in ever larger non-overlapping pieces
+        ref = op - off;
+        while (len > 0) {
+            k = (size_t)(op - ref);
+            if (k > len)
+                k = len;
+            memcpy(op, ref, k);
+            op += k;
+            len -= k;
+        }
+    }
+    *outlen = (size_t)(op - out) - pos;
+    return 0;
+}
+
+//// Reading
+
+struct lz4_reader {
+    struct ios_filter filter;
+    unsigned char *in;  // compressed block
+    unsigned char *out;  // LZ4_WINDOW bytes of history, then a block
+    size_t blockmax;
+    size_t outpos, outend;  // decoded data not yet read
+    int inframe;
+    unsigned char flg;
+    struct xxh32 sum;
+};
+
+// read exactly n bytes; running out of input is a format error
+static int read_exact(struct ios *s, void *buf, size_t n)
+{
+    size_t got;
+    int err;
+
+    if ((err = ios_fd_readall(s->fd, buf, n, &got)))
+        return err;
+    return (got < n) ? EILSEQ : 0;
+}
+
+static int skip_bytes(struct ios *s, size_t n)
+{
+    unsigned char buf[4096];
+    size_t k;
+    int err;
+
+    for (; n > 0; n -= k) {
+        k = (n < sizeof(buf)) ? n : sizeof(buf);
+        if ((err = read_exact(s, buf, k)))
+            return err;
+    }
+    return 0;
+}
+
+// read up to and including the next frame descriptor. sets *end instead
+// if the input ends cleanly before another frame.
+static int lz4_read_header(struct ios *s, struct lz4_reader *r, int *end)
+{
+    unsigned char hdr[11];
+    unsigned char *in, *out;
+    size_t got, n, blockmax;
+    uint32_t magic;
+    int err;
+
+    for (;;) {
+        if ((err = ios_fd_readall(s->fd, hdr, 4, &got)))
+            return err;
+        if (got == 0) {
+            *end = 1;
+            return 0;
+        }
+        if (got < 4)
+            return EILSEQ;
+        magic = get32(hdr);
+        if (magic == LZ4_MAGIC)
+            break;
+        if ((magic & 0xfffffff0) != LZ4_SKIP_MAGIC)
+            return EILSEQ;
+        if ((err = read_exact(s, hdr, 4)) ||
+            (err = skip_bytes(s, get32(hdr))))
+            return err;
+    }
+    if ((err = read_exact(s, hdr, 2)))
+        return err;
+    if ((hdr[0] & 0xc0) != FLG_VERSION || (hdr[0] & (0x02 | FLG_DICTID)) ||
+        (hdr[1] & 0x8f) || ((hdr[1] >> 4) & 7) < 4)
+        return EILSEQ;
+    n = (hdr[0] & FLG_SIZE) ? 10 : 2;
+    if ((err = read_exact(s, hdr + 2, n - 1)))
+        return err;
+    if (hdr[n] != ((xxh32(hdr, n) >> 8) & 0xff))
+        return EILSEQ;
+    blockmax = (size_t)1 << (8 + 2 * ((hdr[1] >> 4) & 7));
+    if (blockmax > r->blockmax) {
+        in = realloc(r->in, blockmax);
+        if (in != NULL)
+            r->in = in;
+        out = realloc(r->out, LZ4_WINDOW + blockmax);
+        if (out != NULL)
+            r->out = out;
+        if (in == NULL || out == NULL)
+            return ENOMEM;
+        r->blockmax = blockmax;
+    }
+    r->flg = hdr[0];
+    r->outpos = r->outend = 0;
+    r->inframe = 1;
+    xxh32_init(&r->sum);
+    return 0;
+}
+
+// decode the next block, going on to the next frame if need be
+static int lz4_read_block(struct ios *s, struct lz4_reader *r)
+{
+    unsigned char word[4];
+    unsigned char *dst;
+    size_t size, hist, len;
+    int err, end, raw;
+
+    for (;;) {
+        if (!r->inframe) {
+            end = 0;
+            if ((err = lz4_read_header(s, r, &end)) || end)
+                return err;
+        }
+        if ((err = read_exact(s, word, 4)))
+            return err;
+        if ((size = get32(word)) != 0)
+            break;
+        r->inframe = 0;
+        r->outpos = r->outend = 0;
+        if (r->flg & FLG_CONTENTSUM) {
+            if ((err = read_exact(s, word, 4)))
+                return err;
+            if (get32(word) != xxh32_digest(&r->sum))
+                return EILSEQ;
+        }
+    }
+    raw = (size & 0x80000000) != 0;
+    size &= 0x7fffffff;
+    if (size > r->blockmax)
+        return EILSEQ;
+    // linked blocks may refer back to the last 64 KiB of output
+    hist = 0;
+    if (!(r->flg & FLG_INDEP)) {
+        hist = (r->outend < LZ4_WINDOW) ? r->outend : LZ4_WINDOW;
+        memmove(r->out, r->out + r->outend - hist, hist);
+    }
+    dst = raw ? r->out + hist : r->in;
+    if ((err = read_exact(s, dst, size)))
+        return err;
+    if (r->flg & FLG_BLOCKSUM) {
+        if ((err = read_exact(s, word, 4)))
+            return err;
+        if (get32(word) != xxh32(dst, size))
+            return EILSEQ;
+    }
+    len = size;
+    if (!raw && (err = lz4_decompress_block(r->in, size, r->out, hist,
+                                            hist + r->blockmax, &len)))
+        return err;
+    r->outpos = hist;
+    r->outend = hist + len;
+    if (r->flg & FLG_CONTENTSUM)
+        xxh32_update(&r->sum, r->out + hist, len);
+    return 0;
+}
+
+static int lz4_read(struct ios *s, char *buf, size_t n, size_t *nread)
+{
+    struct lz4_reader *r;
+    size_t avail;
+    int err;
+
+    r = (struct lz4_reader *)s->filter;
+    *nread = 0;
+    while (r->outpos == r->outend) {
+        if ((err = lz4_read_block(s, r)))
+            return err;
+        if (!r->inframe)
+            return 0;
+    }
+    avail = r->outend - r->outpos;
+    if (avail > n)
+        avail = n;
+    memcpy(buf, r->out + r->outpos, avail);
+    r->outpos += avail;
+    *nread = avail;
+    return 0;
+}
+
+static int lz4_nowrite(struct ios *s, const char *buf, size_t n,
+                       size_t *nwritten)
+{
+    (void)s;
+    (void)buf;
+    (void)n;
+    *nwritten = 0;
+    return EBADF;
+}
+
+static int lz4_close_reader(struct ios *s)
+{
+    struct lz4_reader *r;
+
+    r = (struct lz4_reader *)s->filter;
+    free(r->in);
+    free(r->out);
+    free(r);
+    return 0;
+}
+
+//// Writing
+
+struct lz4_writer {
+    struct ios_filter filter;
+    int started;
+    struct xxh32 sum;
+    uint32_t table[1 << LZ4_HASHLOG];
+    unsigned char out[4 + LZ4_BLOCKSIZE];
+};
+
+static int lz4_write_header(struct ios *s, struct lz4_writer *w)
+{
+    unsigned char hdr[7];
+    size_t nw;
+
+    put32(hdr, LZ4_MAGIC);
+    hdr[4] = FLG_VERSION | FLG_INDEP | FLG_CONTENTSUM;
+    hdr[5] = 4 << 4;  // 64 KiB blocks
+    hdr[6] = (xxh32(hdr + 4, 2) >> 8) & 0xff;
+    w->started = 1;
+    return ios_fd_writeall(s->fd, hdr, sizeof(hdr), &nw);
+}
+
+// a block that doesn't get smaller is stored as is
+static int lz4_write_block(struct ios *s, struct lz4_writer *w,
+                           const unsigned char *p, size_t n)
+{
+    size_t len, nw;
+    int err;
+
+    if (!w->started && (err = lz4_write_header(s, w)))
+        return err;
+    xxh32_update(&w->sum, p, n);
+    if ((len = lz4_compress_block(p, n, w->out + 4, n - 1, w->table))) {
+        put32(w->out, (uint32_t)len);
+        return ios_fd_writeall(s->fd, w->out, 4 + len, &nw);
+    }
+    put32(w->out, (uint32_t)n | 0x80000000);
+    if ((err = ios_fd_writeall(s->fd, w->out, 4, &nw)))
+        return err;
+    return ios_fd_writeall(s->fd, p, n, &nw);
+}
+
+// each write becomes one or more blocks; the stream buffer is one block
+// long, so only an explicit flush makes a short block
+static int lz4_write(struct ios *s, const char *buf, size_t n,
+                     size_t *nwritten)
+{
+    struct lz4_writer *w;
+    size_t k;
+    int err;
+
+    w = (struct lz4_writer *)s->filter;
+    *nwritten = 0;
+    for (; n > 0; n -= k) {
+        k = (n < LZ4_BLOCKSIZE) ? n : LZ4_BLOCKSIZE;
+        if ((err = lz4_write_block(s, w, (const unsigned char *)buf, k)))
+            return err;
+        buf += k;
+        *nwritten += k;
+    }
+    return 0;
+}
+
+static int lz4_noread(struct ios *s, char *buf, size_t n, size_t *nread)
+{
+    (void)s;
+    (void)buf;
+    (void)n;
+    *nread = 0;
+    return EBADF;
+}
+
+static int lz4_close_writer(struct ios *s)
+{
+    struct lz4_writer *w;
+    unsigned char end[8];
+    size_t nw;
+    int err;
+
+    w = (struct lz4_writer *)s->filter;
+    err = w->started ? 0 : lz4_write_header(s, w);
+    if (!err) {
+        put32(end, 0);
+        put32(end + 4, xxh32_digest(&w->sum));
+        err = ios_fd_writeall(s->fd, end, sizeof(end), &nw);
+    }
+    free(w);
+    return err;
+}
+
+// put an LZ4 filter on a freshly opened fd stream. it compresses if the
+// stream is writable and decompresses otherwise. returns 0 or -1.
+int ios_lz4(struct ios *s)
+{
+    struct lz4_reader *r;
+    struct lz4_writer *w;
+
+    if (s->fd == -1 || s->bm == bm_mem || s->filter != NULL ||
+        s->state != bst_none || s->size != 0)
+        return -1;
+    if (!s->fixedbuf && ios_bufsize(s, LZ4_BLOCKSIZE) == -1)
+        return -1;
+    if (s->readonly) {
+        if ((r = calloc(1, sizeof(*r))) == NULL)
+            return -1;
+        r->filter.read = lz4_read;
+        r->filter.write = lz4_nowrite;
+        r->filter.close = lz4_close_reader;
+        s->filter = &r->filter;
+    } else {
+        if ((w = calloc(1, sizeof(*w))) == NULL)
+            return -1;
+        w->filter.read = lz4_noread;
+        w->filter.write = lz4_write;
+        w->filter.close = lz4_close_writer;
+        xxh32_init(&w->sum);
+        s->filter = &w->filter;
+    }
+    s->rereadable = 0;
+    return 0;
+}
@@ -11,7 +11,8 @@
 
 #include "scheme.h"
 
-static value_t iostreamsym, rdsym, wrsym, apsym, crsym, truncsym;
+static value_t iostreamsym, rdsym, wrsym, apsym, crsym, truncsym, mmapsym;
+static value_t lz4sym;
 value_t instrsym, outstrsym;
 struct fltype *iostreamtype;
 
@@ -77,14 +78,16 @@ struct ios *fl_toiostream(value_t v, const char *fname)
 
 value_t fl_file(value_t *args, uint32_t nargs)
 {
-    int i, r, w, c, t, a;
+    int i, r, w, c, t, a, m, z;
     value_t f;
     char *fname;
     struct ios *s;
+    size_t bufsize;
 
     if (nargs < 1)
         argcount("file", nargs, 1);
-    r = w = c = t = a = 0;
+    r = w = c = t = a = m = z = 0;
+    bufsize = 0;
     for (i = 1; i < (int)nargs; i++) {
         if (args[i] == wrsym)
             w = 1;
@@ -99,6 +102,14 @@ value_t fl_file(value_t *args, uint32_t nargs)
             w = 1;
         } else if (args[i] == rdsym)
             r = 1;
+        else if (args[i] == mmapsym)
+            m = 1;
+        else if (args[i] == lz4sym)
+            z = 1;
+        else if (isfixnum(args[i])) {
+            if ((bufsize = toulong(args[i], "file")) == 0)
+                lerror(ArgError, "file: buffer size must be positive");
+        }
     }
     if ((r | w | c | t | a) == 0)
         r = 1;  // default to reading
@@ -107,8 +118,29 @@ value_t fl_file(value_t *args, uint32_t nargs)
     s = value2c(struct ios *, f);
     if (ios_file(s, fname, r, w, c, t) == NULL)
         lerrorf(IOError, "file: could not open \"%s\"", fname);
+    // a number is the buffer size to use instead of the growing default
+    if (bufsize && ios_bufsize(s, bufsize) == -1)
+        lerrorf(MemoryError, "file: could not allocate a buffer of %lu bytes",
+                (unsigned long)bufsize);
     if (a)
         ios_seek_end(s);
+    // compress what is written, or decompress what is read
+    if (z && ios_lz4(s) == -1)
+        lerrorf(IOError, "file: could not set up :lz4 on \"%s\"", fname);
+    // files that can't be mapped are read through the buffer as usual
+    if (m && !w && !z)
+        ios_mmap(s);
+    return f;
+}
+
+// wrap an open file descriptor, such as a socket, in a stream that
+// closes it when collected
+value_t fl_iostream_fd(long fd)
+{
+    value_t f;
+
+    f = cvalue(iostreamtype, sizeof(struct ios));
+    ios_fd(value2c(struct ios *, f), fd, 0, 1);
     return f;
 }
 
@@ -116,12 +148,14 @@ value_t fl_buffer(value_t *args, uint32_t nargs)
 {
     value_t f;
     struct ios *s;
+    size_t initsize;
 
-    argcount("buffer", nargs, 0);
-    (void)args;
+    if (nargs > 1)
+        argcount("buffer", nargs, 1);
+    initsize = nargs ? toulong(args[0], "buffer") : 0;
     f = cvalue(iostreamtype, sizeof(struct ios));
     s = value2c(struct ios *, f);
-    if (ios_mem(s, 0) == NULL)
+    if (ios_mem(s, initsize) == NULL)
         lerror(MemoryError, "buffer: could not allocate stream");
     return f;
 }
@@ -359,6 +393,66 @@ value_t fl_iowrite(value_t *args, uint32_t nargs)
     return size_wrap(ios_write(s, data, nb));
 }
 
+static value_t writev_piece(value_t lst, size_t i, value_t *pnext)
+{
+    value_t x;
+
+    if (isvector(lst))
+        return vector_elt(lst, i);
+    x = car_(*pnext);
+    *pnext = cdr_(*pnext);
+    return x;
+}
+
+// (io.writev s pieces) writes a list or vector of strings and byte
+// vectors in order without concatenating them first
+value_t fl_iowritev(value_t *args, uint32_t nargs)
+{
+    struct ios_iovec local[32];
+    struct ios_iovec *v;
+    struct ios *s;
+    value_t lst, x, next;
+    size_t n, i, sz, wrote;
+    char *data;
+
+    argcount("io.writev", nargs, 2);
+    s = toiostream(args[0], "io.writev");
+    lst = args[1];
+    if (isvector(lst)) {
+        n = vector_size(lst);
+    } else {
+        for (n = 0, x = lst; iscons(x); x = cdr_(x))
+            n++;
+        if (x != FL_NIL)
+            type_error("io.writev", "list", lst);
+    }
+    // check every piece before there is anything to free
+    for (next = lst, i = 0; i < n; i++) {
+        x = writev_piece(lst, i, &next);
+        if (!iscvalue(x))
+            type_error("io.writev", "string", x);
+        // the write may move the stream's buffer out from under the
+        // later pieces
+        if (x == args[0])
+            lerror(ArgError, "io.writev: can't write a stream to itself");
+        to_sized_ptr(x, "io.writev", &data, &sz);
+    }
+    v = local;
+    if (n > sizeof(local) / sizeof(local[0])) {
+        if ((v = malloc(n * sizeof(*v))) == NULL)
+            lerror(MemoryError, "io.writev: out of memory");
+    }
+    for (next = lst, i = 0; i < n; i++) {
+        to_sized_ptr(writev_piece(lst, i, &next), "io.writev", &data,
+                     &v[i].len);
+        v[i].base = data;
+    }
+    wrote = ios_writev(s, v, n);
+    if (v != local)
+        free(v);
+    return size_wrap(wrote);
+}
+
 value_t fl_dump(value_t *args, uint32_t nargs)
 {
     char *data;
@@ -425,6 +519,159 @@ value_t fl_ioreaduntil(value_t *args, uint32_t nargs)
     return str;
 }
 
+// return whatever is buffered, reading once if nothing is. on a stream
+// that an event loop reported readable this never blocks.
+value_t fl_ioreadsome(value_t *args, uint32_t nargs)
+{
+    struct ios *s;
+    value_t str;
+    size_t n, max;
+
+    if (nargs < 1 || nargs > 2)
+        argcount("io.readsome", nargs, nargs < 1 ? 1 : 2);
+    s = toiostream(args[0], "io.readsome");
+    max = (nargs > 1) ? toulong(args[1], "io.readsome") : IOS_BUFSIZE;
+    if ((n = ios_readprep(s, 1)) == 0) {
+        s->_eof = 1;
+        return FL_EOF;
+    }
+    if (n > max)
+        n = max;
+    str = cvalue_string(n);
+    s = value2c(struct ios *, args[0]);
+    memcpy(cvalue_data(str), s->buf + s->bpos, n);
+    s->bpos += n;
+    return str;
+}
+
+// line iterators. lines are found by scanning the stream buffer and are
+// handed out, minus the newline, each in a new string. a line that is
+// all in the buffer is copied straight into a string of its size.
+
+#define LINE_INITSIZE 128
+
+struct line_iterator {
+    value_t stream;
+};
+
+static value_t lineitersym;
+static struct fltype *lineitertype;
+
+// read the next line of the stream *ps into a new string, or return
+// FL_EOF at end of input. *ps must be GC-rooted.
+static value_t read_line(value_t *ps)
+{
+    struct ios dest;
+    struct cvalue *cv;
+    struct ios *s;
+    const char *p, *q;
+    value_t str;
+    size_t n;
+
+    s = value2c(struct ios *, *ps);
+    if (!ios_readprep(s, 1)) {
+        s->_eof = 1;
+        return FL_EOF;
+    }
+    p = s->buf + s->bpos;
+    n = s->size - s->bpos;
+    if ((q = memchr(p, '\n', n)) != NULL) {
+        n = q - p;
+        str = cvalue_string(n);
+        s = value2c(struct ios *, *ps);
+        memcpy(cvalue_data(str), s->buf + s->bpos, n);
+        s->bpos += n + 1;
+        return str;
+    }
+    // the line goes on past the buffer
+    str = cvalue_string(LINE_INITSIZE);
+    cv = (struct cvalue *)ptr(str);
+    ios_mem(&dest, 0);
+    ios_setbuf(&dest, cv_data(cv), LINE_INITSIZE, 0);
+    n = ios_copyuntil(&dest, value2c(struct ios *, *ps), '\n');
+    if (n > 0 && dest.buf[n - 1] == '\n')
+        n--;
+    cv->len = n;
+    if (dest.buf != cv_data(cv)) {
+        // outgrew initial space
+        cv->data = dest.buf;
+        cv_autorelease(cv);
+    }
+    ((char *)cv->data)[n] = '\0';
+    return str;
+}
+
+static struct line_iterator *tolineiter(value_t v, const char *fname)
+{
+    if (!iscvalue(v) || cv_class((struct cvalue *)ptr(v)) != lineitertype)
+        type_error(fname, "line-iterator", v);
+    return value2c(struct line_iterator *, v);
+}
+
+value_t fl_iolines(value_t *args, uint32_t nargs)
+{
+    value_t v;
+
+    argcount("io.lines", nargs, 1);
+    toiostream(args[0], "io.lines");
+    v = cvalue(lineitertype, sizeof(struct line_iterator));
+    value2c(struct line_iterator *, v)->stream = args[0];
+    return v;
+}
+
+value_t fl_ionextline(value_t *args, uint32_t nargs)
+{
+    value_t s, line;
+
+    argcount("io.nextline", nargs, 1);
+    s = tolineiter(args[0], "io.nextline")->stream;
+    fl_gc_handle(&s);
+    line = read_line(&s);
+    fl_free_gc_handles(1);
+    return line;
+}
+
+// (for-each-line proc s) calls proc on each line of s and returns the
+// number of lines.
+value_t fl_foreachline(value_t *args, uint32_t nargs)
+{
+    value_t f, s, line;
+    size_t nlines;
+
+    argcount("for-each-line", nargs, 2);
+    toiostream(args[1], "for-each-line");
+    f = args[0];
+    s = args[1];
+    fl_gc_handle(&f);
+    fl_gc_handle(&s);
+    nlines = 0;
+    while ((line = read_line(&s)) != FL_EOF) {
+        fl_applyn(1, f, line);
+        nlines++;
+    }
+    fl_free_gc_handles(2);
+    return size_wrap(nlines);
+}
+
+static void print_line_iterator(value_t v, struct ios *f)
+{
+    (void)v;
+    fl_print_str("#<line-iterator>", f);
+}
+
+static void relocate_line_iterator(value_t oldv, value_t newv)
+{
+    struct line_iterator *it;
+
+    (void)oldv;
+    it = value2c(struct line_iterator *, newv);
+    it->stream = relocate_lispvalue(it->stream);
+}
+
+static struct cvtable line_iterator_vtable = { print_line_iterator,
+                                               relocate_line_iterator, NULL,
+                                               NULL };
+
 value_t fl_iocopyuntil(value_t *args, uint32_t nargs)
 {
     struct ios *dest;
@@ -512,6 +759,11 @@ static struct builtinspec iostreamfunc_info[] = {
     { "io.write", fl_iowrite },
     { "io.copy", fl_iocopy },
     { "io.readuntil", fl_ioreaduntil },
+    { "io.readsome", fl_ioreadsome },
+    { "io.lines", fl_iolines },
+    { "io.nextline", fl_ionextline },
+    { "for-each-line", fl_foreachline },
+    { "io.writev", fl_iowritev },
     { "io.copyuntil", fl_iocopyuntil },
     { "io.tostring!", fl_iotostring },
 
@@ -526,10 +778,16 @@ void iostream_init(void)
     apsym = symbol(":append");
     crsym = symbol(":create");
     truncsym = symbol(":truncate");
+    mmapsym = symbol(":mmap");
+    lz4sym = symbol(":lz4");
     instrsym = symbol("*input-stream*");
     outstrsym = symbol("*output-stream*");
     iostreamtype = define_opaque_type(iostreamsym, sizeof(struct ios),
                                       &iostream_vtable, NULL);
+    lineitersym = symbol("line-iterator");
+    lineitertype = define_opaque_type(lineitersym,
+                                      sizeof(struct line_iterator),
+                                      &line_iterator_vtable, NULL);
     assign_global_builtins(iostreamfunc_info);
 
     setc(symbol("*stdout*"), cvalue_from_ref(iostreamtype, ios_stdout,
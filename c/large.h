@@ -0,0 +1,132 @@
+// Large object space. A vector of fl_large_object bytes or more gets a
+// block of its own outside the heap, so that collections don't copy or
+// slide it, and allocating one doesn't need a heap big enough to hold
+// it. All such blocks are on one list. A collection marks the ones it
+// reaches, visiting their elements as it would those of any vector,
+// and then sweeps the rest.
+//
+// Swept blocks are kept until the next collection for new large vectors
+// of about their size to reuse, since a program that makes one big
+// vector tends to make more like it, and fresh memory from the system
+// costs a page fault per page.
+//
+// Every other vector lives in the heap, which is how the collectors
+// tell a large one: it is a vector in neither semispace. The
+// incremental collector doesn't use this, since its read barrier only
+// knows about the old semispace.
+
+struct large {
+    struct large *next;
+    size_t size;         // of the whole block, this header included
+    uint32_t mark;       // reached by the collection under way
+    uint32_t printmark;  // for cycle detection when printing
+    value_t sampled;     // by the heap profiler, and pads to 16 bytes
+};
+
+static struct large *large_list;
+static struct large *large_free;  // swept by the last collection
+static size_t large_bytes;        // in the blocks on large_list
+static size_t large_since_gc;     // allocated since the last collection
+static uint64_t large_allocated;  // since startup
+
+#define islarge(v)                   \
+    (isvector(v) && !ismanaged(v) && \
+     (size_t)((unsigned char *)ptr(v) - tospace) >= tosize)
+#define large_of(v) (((struct large *)ptr(v)) - 1)
+
+// Whether a collection has just reached large vector v for the first
+// time, and should visit its elements.
+#define large_mark(v) (!large_of(v)->mark && (large_of(v)->mark = 1))
+
+// A swept block that fits size bytes without wasting much, or NULL.
+static struct large *large_reuse(size_t size)
+{
+    struct large **pl, *l;
+
+    for (pl = &large_free; (l = *pl) != NULL; pl = &l->next) {
+        if (l->size >= size && l->size - size <= size / 4) {
+            *pl = l->next;
+            return l;
+        }
+    }
+    return NULL;
+}
+
+static value_t *large_alloc(size_t nw)
+{
+    struct large *l;
+    size_t size;
+
+    size = sizeof(struct large) + nw * sizeof(value_t);
+    if (large_since_gc > heapsize ||
+        (fl_heap_max && large_bytes + size > fl_heap_max))
+        gc(0);
+    if (fl_heap_max && large_bytes + size > fl_heap_max)
+        fl_raise(memory_exception_value);
+    if (!(l = large_reuse(size))) {
+        if (!(l = malloc(size)))
+            fl_raise(memory_exception_value);
+        l->size = size;
+    }
+    l->mark = l->printmark = 0;
+    l->sampled = prof_running && prof_large(l + 1, size);
+    l->next = large_list;
+    large_list = l;
+    large_bytes += l->size;
+    large_since_gc += l->size;
+    large_allocated += l->size;
+    return (value_t *)(l + 1);
+}
+
+// Move what the collection didn't reach to large_free, freeing what was
+// there before, and clear the marks on the rest.
+static void large_sweep(void)
+{
+    struct large **pl, *l;
+
+    while ((l = large_free) != NULL) {
+        large_free = l->next;
+        free(l);
+    }
+    pl = &large_list;
+    while ((l = *pl) != NULL) {
+        if (l->mark) {
+            l->mark = 0;
+            pl = &l->next;
+        } else {
+            if (l->sampled)
+                prof_forget(l + 1);
+            *pl = l->next;
+            large_bytes -= l->size;
+            l->next = large_free;
+            large_free = l;
+        }
+    }
+    large_since_gc = 0;
+}
+
+// Clear the marks of a collection that had to give up.
+static void large_unmark(void)
+{
+    struct large *l;
+
+    for (l = large_list; l != NULL; l = l->next)
+        l->mark = 0;
+}
+
+// Apply scan to each large vector.
+static void large_scan(void (*scan)(value_t v))
+{
+    struct large *l;
+
+    for (l = large_list; l != NULL; l = l->next)
+        scan(tagptr(l + 1, TAG_VECTOR));
+}
+
+static void large_clear_printmarks(void)
+{
+    struct large *l;
+
+    for (l = large_list; l != NULL; l = l->next)
+        l->printmark = 0;
+}
@@ -77,6 +77,8 @@ static struct builtin_procedure builtin_procedures[] = {
     { "environment-stack", builtin_environment_stack, UP_2019 },
 
     { "read-ini-file", builtin_read_ini_file, UP_2019 },
+    { "read-csv-row", builtin_read_csv_row, UP_2019 },
+    { "csv-for-each", builtin_csv_for_each, UP_2019 },
 
     { "pid", builtin_pid, SRFI_170 | UP_2019 },
     { "parent-pid", builtin_parent_pid, SRFI_170 | UP_2019 },
@@ -92,6 +94,38 @@ static struct builtin_procedure builtin_procedures[] = {
 
     { "spawn", builtin_spawn, SRFI_170 | UP_2019 },
 
+#ifndef _WIN32
+    { "tcp-listen", builtin_tcp_listen, UP_2019 },
+    { "tcp-accept", builtin_tcp_accept, UP_2019 },
+    { "tcp-connect", builtin_tcp_connect, UP_2019 },
+    { "socket-port", builtin_socket_port, UP_2019 },
+
+    { "udp-listen", builtin_udp_listen, UP_2019 },
+    { "udp-connect", builtin_udp_connect, UP_2019 },
+    { "udp-receive!", builtin_udp_receive, UP_2019 },
+    { "udp-send!", builtin_udp_send, UP_2019 },
+    { "make-datagram-slab", builtin_make_datagram_slab, UP_2019 },
+    { "datagram-count", builtin_datagram_count, UP_2019 },
+    { "datagram-ref", builtin_datagram_ref, UP_2019 },
+    { "datagram-source", builtin_datagram_source, UP_2019 },
+    { "datagram-set!", builtin_datagram_set, UP_2019 },
+
+    { "make-event-loop", builtin_make_event_loop, UP_2019 },
+    { "event-loop-add!", builtin_event_loop_add, UP_2019 },
+    { "event-loop-remove!", builtin_event_loop_remove, UP_2019 },
+    { "wait-events", builtin_wait_events, UP_2019 },
+
+    { "spawn-process", builtin_spawn_process, UP_2019 },
+    { "spawn-pipeline", builtin_spawn_pipeline, UP_2019 },
+    { "process-wait", builtin_process_wait, UP_2019 },
+    { "process-wait-any", builtin_process_wait_any, UP_2019 },
+
+    { "open-directory-walker", builtin_open_directory_walker, UP_2019 },
+    { "read-directory-walker", builtin_read_directory_walker, UP_2019 },
+    { "close-directory-walker", builtin_close_directory_walker, UP_2019 },
+    { "walk-directory", builtin_walk_directory, UP_2019 },
+#endif
+
     { "color-name->rgb24", builtin_color_name_to_rgb24, UP_2019 },
 
     { "file-exists?", builtin_file_exists, R7RS_FILE | UP_2019 },
@@ -30,6 +30,8 @@ void llt_init()
 {
     locale_is_utf8 = u8_is_locale_utf8(setlocale(LC_ALL, ""));
 
+    u8_init();
+
     randomize();
 
     ios_init_stdstreams();
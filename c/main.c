@@ -1,6 +1,9 @@
 #include <sys/types.h>
 
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
 #include <math.h>
 #include <setjmp.h>
 #include <stdarg.h>
@@ -55,6 +58,26 @@ static const char runtime_usage_message[] =
 "\n"
 "debug     set debugging options"
 "\n"
+"gc        collector: copy (default), compact (half the heap memory)"
+"\n"
+"          parallel or incremental"
+"\n"
+"gcthreads threads for the parallel collector (default one per CPU)"
+"\n"
+"gcpause   pause budget of the incremental collector, in usec (1000)"
+"\n"
+"gclog     write a line about each garbage collection to this file"
+"\n"
+"heap      initial heap size in bytes, or with a k, m or g suffix (512k)"
+"\n"
+"maxheap   heap size past which allocation raises memory-error"
+"\n"
+"heapgrow  factor to grow the heap by when it is too full (2)"
+"\n"
+"heapfill  percent of the heap that may stay live after a collection (80)"
+"\n"
+"largeobj  vectors of this many bytes go outside the heap, 0 for none (8k)"
+"\n"
 "search    set module search path"
 "\n"
 "version   show version information"
@@ -70,6 +93,8 @@ static int evalflag;
 static int helpflag;
 static int versionflag;
 static int boot_env;
+static char *gclog_file;
+static size_t heap_size = 512 * 1024;
 
 static void generic_usage(FILE *out, int status)
 {
@@ -87,6 +112,12 @@ static void generic_runtime_usage(FILE *out, int status)
 
 static void runtime_usage(void) { generic_runtime_usage(stderr, 2); }
 
+static void out_of_memory(void)
+{
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+}
+
 static void version(void)
 {
     value_t list;
@@ -110,8 +141,37 @@ static const char **long_option(const char **argv, const char *option)
     return argv;
 }
 
+// A number of bytes, with an optional k, m or g suffix.
+static size_t parse_size(const char *value)
+{
+    unsigned long long n;
+    char *end;
+    int shift;
+
+    if (!value || !isdigit((unsigned char)*value))
+        runtime_usage();
+    errno = 0;
+    n = strtoull(value, &end, 10);
+    shift = 0;
+    if (*end == 'k' || *end == 'K')
+        shift = 10;
+    else if (*end == 'm' || *end == 'M')
+        shift = 20;
+    else if (*end == 'g' || *end == 'G')
+        shift = 30;
+    if (shift)
+        end++;
+    if (*end || errno || n > (SIZE_MAX >> 1 >> shift))
+        runtime_usage();
+    return (size_t)n << shift;
+}
+
 static void runtime_option(const char *name, const char *value)
 {
+    char *end;
+    double x;
+    long n;
+
     if (!strcmp("null", name)) {
         if (value)
             runtime_usage();
@@ -127,6 +187,63 @@ static void runtime_option(const char *name, const char *value)
     } else if (!strcmp("debug", name)) {
         if (!value)
             runtime_usage();
+    } else if (!strcmp("gc", name)) {
+        if (!value)
+            runtime_usage();
+        if (!strcmp(value, "copy"))
+            fl_gc_mode = GC_COPY;
+        else if (!strcmp(value, "compact"))
+            fl_gc_mode = GC_COMPACT;
+        else if (!strcmp(value, "parallel"))
+            fl_gc_mode = GC_PARALLEL;
+        else if (!strcmp(value, "incremental"))
+            fl_gc_mode = GC_INCREMENTAL;
+        else
+            runtime_usage();
+    } else if (!strcmp("gcthreads", name)) {
+        if (!value)
+            runtime_usage();
+        n = strtol(value, &end, 10);
+        if (*end || n < 0 || n > INT_MAX)
+            runtime_usage();
+        fl_gc_threads = (int)n;
+    } else if (!strcmp("gcpause", name)) {
+        if (!value)
+            runtime_usage();
+        n = strtol(value, &end, 10);
+        if (*end || n < 1 || n > INT_MAX)
+            runtime_usage();
+        fl_gc_pause = (int)n;
+    } else if (!strcmp("gclog", name)) {
+        if (!value || !*value)
+            runtime_usage();
+        free(gclog_file);
+        if (!(gclog_file = strdup(value)))
+            out_of_memory();
+    } else if (!strcmp("heap", name)) {
+        heap_size = parse_size(value);
+        if (heap_size < 64 * 1024)
+            runtime_usage();
+    } else if (!strcmp("maxheap", name)) {
+        fl_heap_max = parse_size(value);
+        if (fl_heap_max < 64 * 1024)
+            runtime_usage();
+    } else if (!strcmp("heapgrow", name)) {
+        if (!value)
+            runtime_usage();
+        x = strtod(value, &end);
+        if (*end || !(x > 1 && x <= 16))
+            runtime_usage();
+        fl_heap_growth = x;
+    } else if (!strcmp("heapfill", name)) {
+        if (!value)
+            runtime_usage();
+        n = strtol(value, &end, 10);
+        if (*end || n < 10 || n > 95)
+            runtime_usage();
+        fl_heap_occupancy = (int)n;
+    } else if (!strcmp("largeobj", name)) {
+        fl_large_object = parse_size(value);
     } else if (!strcmp("search", name)) {
         if (!value)
             runtime_usage();
@@ -222,17 +339,32 @@ int main(int argc, char **argv)
 {
     static const char **cargv;
     static const char **command_line;
+    static value_t start_argv;
 
     cargv = (const char **)argv;
     command_line = parse_command_line_flags(cargv + 1);
     if (helpflag) {
         generic_usage(stdout, 0);
     }
-    fl_init(512 * 1024);
+    fl_init(heap_size);
+    if (gclog_file) {
+        static struct ios gclog;
+
+        if (!ios_file(&gclog, gclog_file, 0, 1, 1, 1)) {
+            fprintf(stderr, "cannot open GC log %s\n", gclog_file);
+            return 1;
+        }
+        ios_bufmode(&gclog, bm_line);
+        fl_gc_log = &gclog;
+    }
     {
         fl_gc_handle(&os_command_line);
+        fl_gc_handle(&start_argv);
         os_command_line = argv_list(argc, cargv);
         command_line_offset = command_line - cargv;
+        // __start sees the program name and what follows our own flags
+        start_argv = argv_list(argc - command_line_offset, command_line);
+        start_argv = fl_cons(car_(os_command_line), start_argv);
         FL_TRY_EXTERN
         {
             if (versionflag) {
@@ -245,7 +377,7 @@ int main(int argc, char **argv)
                 script_file = realpath(command_line[0], 0);
             }
             (void)fl_applyn(1, symbol_value(symbol("__start")),
-                            os_command_line);
+                            start_argv);
         }
         FL_CATCH_EXTERN
         {
@@ -0,0 +1,148 @@
+/*
+  Substring search
+
+  Two-way string matching (Crochemore and Perrin, 1991): linear time in
+  the worst case and constant extra space. The needle is preprocessed
+  into a struct memsearch once, so the same needle can then be searched
+  for in any number of haystacks. A bad-character shift on the last
+  byte of the window lets typical searches skip most of the haystack.
+*/
+
+#include <sys/types.h>
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scheme.h"
+
+#define BYTESET_BITS (8 * sizeof(size_t))
+
+#define byteset_has(set, c) \
+    (((set)[(c) / BYTESET_BITS] >> ((c) % BYTESET_BITS)) & 1)
+
+#define byteset_add(set, c) \
+    ((set)[(c) / BYTESET_BITS] |= (size_t)1 << ((c) % BYTESET_BITS))
+
+// Start of the maximal suffix of the needle under the byte order (if rev
+// is zero) or the reverse order. Its period is stored in *period.
+static size_t maximal_suffix(const unsigned char *n, size_t len, int rev,
+                             size_t *period)
+{
+    size_t i, j, k, p;
+    unsigned char a, b;
+
+    i = (size_t)-1;
+    j = 0;
+    k = p = 1;
+    while (j + k < len) {
+        a = n[i + k];
+        b = n[j + k];
+        if (a == b) {
+            if (k == p) {
+                j += p;
+                k = 1;
+            } else {
+                k++;
+            }
+        } else if (rev ? (a < b) : (a > b)) {
+            j += k;
+            k = 1;
+            p = j - i;
+        } else {
+            i = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+    return i;
+}
+
+void memsearch_init(struct memsearch *m, const char *needle, size_t len)
+{
+    const unsigned char *n = (const unsigned char *)needle;
+    size_t i, ms, ms2, p, p2;
+
+    // shift[] is only consulted for bytes in the byteset
+    memset(m->byteset, 0, sizeof(m->byteset));
+    m->len = len;
+    m->critical = m->period = m->memory = 0;
+    for (i = 0; i < len; i++) {
+        byteset_add(m->byteset, n[i]);
+        m->shift[n[i]] = i + 1;
+    }
+    if (len < 2) {
+        return;
+    }
+    ms = maximal_suffix(n, len, 0, &p);
+    ms2 = maximal_suffix(n, len, 1, &p2);
+    if (ms2 + 1 > ms + 1) {
+        ms = ms2;
+        p = p2;
+    }
+    m->critical = ms;
+    if (memcmp(n, n + p, ms + 1)) {
+        // Not periodic: no memory is kept between windows.
+        m->period = ((ms > len - ms - 1) ? ms : len - ms - 1) + 1;
+        m->memory = 0;
+    } else {
+        m->period = p;
+        m->memory = len - p;
+    }
+}
+
+const char *memsearch(const struct memsearch *m, const char *needle,
+                      const char *haystack, size_t haylen)
+{
+    const unsigned char *n = (const unsigned char *)needle;
+    const unsigned char *h = (const unsigned char *)haystack;
+    const unsigned char *z = h + haylen;
+    size_t len = m->len;
+    size_t k, mem;
+
+    if (len == 0) {
+        return haystack;
+    }
+    if (len > haylen) {
+        return NULL;
+    }
+    if (len == 1) {
+        return memchr(haystack, needle[0], haylen);
+    }
+    mem = 0;
+    while ((size_t)(z - h) >= len) {
+        if (!byteset_has(m->byteset, h[len - 1])) {
+            h += len;
+            mem = 0;
+            continue;
+        }
+        if ((k = len - m->shift[h[len - 1]])) {
+            h += (k < mem) ? mem : k;
+            mem = 0;
+            continue;
+        }
+        // Right half, then left half of the critical factorization.
+        k = (m->critical + 1 > mem) ? m->critical + 1 : mem;
+        while (k < len && n[k] == h[k]) {
+            k++;
+        }
+        if (k < len) {
+            h += k - m->critical;
+            mem = 0;
+            continue;
+        }
+        k = m->critical + 1;
+        while (k > mem && n[k - 1] == h[k - 1]) {
+            k--;
+        }
+        if (k <= mem) {
+            return (const char *)h;
+        }
+        h += m->period;
+        mem = m->memory;
+    }
+    return NULL;
+}
@@ -257,4 +257,8 @@ void os_init(void)
 {
     dirsym = symbol("dir");
     dirtype = define_opaque_type(dirsym, sizeof(DIR *), &dir_vtable, NULL);
+    os_events_init();
+    os_process_init();
+    os_walk_init();
+    socket_init();
 }
@@ -0,0 +1,380 @@
+// Copyright 2019 Lassi Kortela
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Readiness notification for many streams at once. An event loop keeps
+// a table of watched streams indexed by file descriptor. On Linux the
+// table is mirrored in an epoll instance so that waiting costs time in
+// proportion to the number of ready streams, not watched ones; other
+// systems rebuild a poll() set on each wait.
+
+#include <sys/types.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#define USE_EPOLL
+#endif
+
+#include <errno.h>
+#include <math.h>
+#include <poll.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "scheme.h"
+
+#define EV_READ 1
+#define EV_WRITE 2
+
+#define MAX_EVENTS 256
+
+struct event_loop {
+    int epfd;          // epoll instance, or -1 if we use poll()
+    int nfds;          // size of the tables below
+    int count;         // number of watched streams
+    value_t *streams;  // stream watched on each fd, or FL_F
+    unsigned char *interest;
+};
+
+static value_t eventloopsym, readsym, writesym;
+static struct fltype *eventlooptype;
+
+static struct event_loop *toeventloop(value_t v, const char *fname)
+{
+    if (!iscvalue(v) || cv_class((struct cvalue *)ptr(v)) != eventlooptype)
+        type_error((char *)fname, "event-loop", v);
+    return value2c(struct event_loop *, v);
+}
+
+static int stream_fd(value_t v, const char *fname)
+{
+    struct ios *s;
+
+    s = fl_toiostream(v, fname);
+    if (s->fd < 0)
+        lerrorf(ArgError, "%s: stream has no file descriptor", fname);
+    return (int)s->fd;
+}
+
+static int interest_arg(value_t v, const char *fname)
+{
+    int interest;
+
+    interest = 0;
+    if (issymbol(v))
+        v = fl_cons(v, FL_NIL);
+    for (; iscons(v); v = cdr_(v)) {
+        if (car_(v) == readsym)
+            interest |= EV_READ;
+        else if (car_(v) == writesym)
+            interest |= EV_WRITE;
+        else
+            lerrorf(ArgError, "%s: interest must be read or write", fname);
+    }
+    if (!interest)
+        lerrorf(ArgError, "%s: no interest given", fname);
+    return interest;
+}
+
+// Timeout in milliseconds from a number of seconds, -1 for #f.
+static int timeout_arg(value_t v, const char *fname)
+{
+    struct cprim *cp;
+    double secs;
+
+    if (v == FL_F)
+        return -1;
+    if (isfixnum(v)) {
+        secs = (double)numval(v);
+    } else if (iscprim(v)) {
+        cp = (struct cprim *)ptr(v);
+        secs = conv_to_double(cp_data(cp), cp_numtype(cp));
+    } else {
+        type_error((char *)fname, "number", v);
+        return -1;
+    }
+    if (!(secs > 0))
+        return 0;
+    if (secs > INT32_MAX / 1000)
+        return INT32_MAX;
+    return (int)ceil(secs * 1000);
+}
+
+#ifdef USE_EPOLL
+static uint32_t epoll_interest(int interest)
+{
+    return ((interest & EV_READ) ? EPOLLIN : 0) |
+           ((interest & EV_WRITE) ? EPOLLOUT : 0);
+}
+#endif
+
+static void grow_tables(struct event_loop *loop, int fd)
+{
+    value_t *streams;
+    unsigned char *interest;
+    int n, i;
+
+    for (n = loop->nfds ? loop->nfds : 64; n <= fd; n *= 2)
+        ;
+    streams = realloc(loop->streams, n * sizeof(*streams));
+    if (streams)
+        loop->streams = streams;
+    interest = realloc(loop->interest, n);
+    if (interest)
+        loop->interest = interest;
+    if (!streams || !interest)
+        lerror(MemoryError, "event-loop-add!: out of memory");
+    for (i = loop->nfds; i < n; i++) {
+        loop->streams[i] = FL_F;
+        loop->interest[i] = 0;
+    }
+    loop->nfds = n;
+}
+
+value_t builtin_make_event_loop(value_t *args, uint32_t nargs)
+{
+    struct event_loop *loop;
+    value_t v;
+    int epfd;
+
+    (void)args;
+    argcount("make-event-loop", nargs, 0);
+    epfd = -1;
+#ifdef USE_EPOLL
+    if ((epfd = epoll_create1(EPOLL_CLOEXEC)) == -1)
+        lerrorf(IOError, "make-event-loop: %s", strerror(errno));
+#endif
+    v = cvalue(eventlooptype, sizeof(struct event_loop));
+    loop = value2c(struct event_loop *, v);
+    memset(loop, 0, sizeof(*loop));
+    loop->epfd = epfd;
+    return v;
+}
+
+value_t builtin_event_loop_add(value_t *args, uint32_t nargs)
+{
+    struct event_loop *loop;
+    int fd, interest;
+
+    if (nargs < 2 || nargs > 3)
+        argcount("event-loop-add!", nargs, nargs < 2 ? 2 : 3);
+    loop = toeventloop(args[0], "event-loop-add!");
+    fd = stream_fd(args[1], "event-loop-add!");
+    interest = (nargs > 2) ? interest_arg(args[2], "event-loop-add!")
+                           : EV_READ;
+    loop = value2c(struct event_loop *, args[0]);
+    if (fd >= loop->nfds)
+        grow_tables(loop, fd);
+#ifdef USE_EPOLL
+    {
+        struct epoll_event ev;
+        int op;
+
+        memset(&ev, 0, sizeof(ev));
+        ev.events = epoll_interest(interest);
+        ev.data.fd = fd;
+        // the fd may belong to a new file by now, if the stream it was
+        // added for was closed without being removed
+        op = loop->interest[fd] ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+        if (epoll_ctl(loop->epfd, op, fd, &ev) == -1 &&
+            (op == EPOLL_CTL_ADD || errno != ENOENT ||
+             epoll_ctl(loop->epfd, EPOLL_CTL_ADD, fd, &ev) == -1))
+            lerrorf(IOError, "event-loop-add!: %s", strerror(errno));
+    }
+#endif
+    if (!loop->interest[fd])
+        loop->count++;
+    loop->interest[fd] = interest;
+    loop->streams[fd] = args[1];
+    return FL_T;
+}
+
+value_t builtin_event_loop_remove(value_t *args, uint32_t nargs)
+{
+    struct event_loop *loop;
+    struct ios *s;
+    int fd;
+
+    argcount("event-loop-remove!", nargs, 2);
+    loop = toeventloop(args[0], "event-loop-remove!");
+    s = fl_toiostream(args[1], "event-loop-remove!");
+    if (s->fd < 0) {
+        // closed since it was added, which dropped it from the kernel's
+        // set but not from ours
+        for (fd = 0; fd < loop->nfds; fd++) {
+            if (loop->interest[fd] && loop->streams[fd] == args[1])
+                break;
+        }
+    } else {
+        fd = (int)s->fd;
+    }
+    if (fd >= loop->nfds || !loop->interest[fd])
+        return FL_F;
+#ifdef USE_EPOLL
+    if (s->fd >= 0)
+        epoll_ctl(loop->epfd, EPOLL_CTL_DEL, fd, NULL);
+#endif
+    loop->interest[fd] = 0;
+    loop->streams[fd] = FL_F;
+    loop->count--;
+    return FL_T;
+}
+
+// Streams with unread data in their buffer are ready whatever the fd
+// says; mark them so the wait doesn't block.
+static int mark_buffered(struct event_loop *loop, unsigned char *ready)
+{
+    struct ios *s;
+    int fd, n;
+
+    n = 0;
+    for (fd = 0; fd < loop->nfds; fd++) {
+        if (loop->interest[fd] & EV_READ) {
+            s = value2c(struct ios *, loop->streams[fd]);
+            if (s->bpos < s->size) {
+                ready[fd] |= EV_READ;
+                n++;
+            }
+        }
+    }
+    return n;
+}
+
+#ifdef USE_EPOLL
+static int wait_fds(struct event_loop *loop, unsigned char *ready,
+                    int timeout)
+{
+    struct epoll_event evs[MAX_EVENTS];
+    int i, n, fd;
+
+    n = epoll_wait(loop->epfd, evs, MAX_EVENTS, timeout);
+    for (i = 0; i < n; i++) {
+        fd = evs[i].data.fd;
+        if (evs[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            ready[fd] |= EV_READ;
+        if (evs[i].events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+            ready[fd] |= EV_WRITE;
+    }
+    return n;
+}
+#else
+static int wait_fds(struct event_loop *loop, unsigned char *ready,
+                    int timeout)
+{
+    struct pollfd *pfds;
+    int i, n, npfds, fd;
+
+    if (!(pfds = calloc(loop->count + 1, sizeof(*pfds))))
+        lerror(MemoryError, "wait-events: out of memory");
+    for (npfds = fd = 0; fd < loop->nfds; fd++) {
+        if (loop->interest[fd]) {
+            pfds[npfds].fd = fd;
+            pfds[npfds].events =
+                ((loop->interest[fd] & EV_READ) ? POLLIN : 0) |
+                ((loop->interest[fd] & EV_WRITE) ? POLLOUT : 0);
+            npfds++;
+        }
+    }
+    n = poll(pfds, npfds, timeout);
+    for (i = 0; n > 0 && i < npfds; i++) {
+        fd = pfds[i].fd;
+        if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR))
+            ready[fd] |= EV_READ;
+        if (pfds[i].revents & (POLLOUT | POLLHUP | POLLERR))
+            ready[fd] |= EV_WRITE;
+    }
+    free(pfds);
+    return n;
+}
+#endif
+
+// (wait-events loop [timeout]) waits until some watched stream is ready
+// or timeout seconds pass, and returns a list of (stream . (read write))
+// pairs naming the ready streams and what they are ready for.
+value_t builtin_wait_events(value_t *args, uint32_t nargs)
+{
+    struct event_loop *loop;
+    unsigned char *ready;
+    value_t v, lst, evs;
+    int timeout, fd, nfds;
+
+    if (nargs < 1 || nargs > 2)
+        argcount("wait-events", nargs, nargs < 1 ? 1 : 2);
+    loop = toeventloop(args[0], "wait-events");
+    timeout = (nargs > 1) ? timeout_arg(args[1], "wait-events") : -1;
+    if (!(ready = calloc(loop->nfds + 1, 1)))
+        lerror(MemoryError, "wait-events: out of memory");
+    if (mark_buffered(loop, ready))
+        timeout = 0;
+    if (wait_fds(loop, ready, timeout) == -1 && errno != EINTR) {
+        free(ready);
+        lerrorf(IOError, "wait-events: %s", strerror(errno));
+    }
+    v = args[0];
+    lst = FL_NIL;
+    fl_gc_handle(&v);
+    fl_gc_handle(&lst);
+    nfds = loop->nfds;
+    for (fd = nfds - 1; fd >= 0; fd--) {
+        loop = value2c(struct event_loop *, v);
+        if (!(ready[fd] &= loop->interest[fd]))
+            continue;
+        evs = (ready[fd] & EV_WRITE) ? fl_cons(writesym, FL_NIL) : FL_NIL;
+        if (ready[fd] & EV_READ)
+            evs = fl_cons(readsym, evs);
+        loop = value2c(struct event_loop *, v);
+        evs = fl_cons(loop->streams[fd], evs);
+        lst = fl_cons(evs, lst);
+    }
+    fl_free_gc_handles(2);
+    free(ready);
+    return lst;
+}
+
+static void print_event_loop(value_t v, struct ios *f)
+{
+    (void)v;
+    fl_print_str("#<event-loop>", f);
+}
+
+static void relocate_event_loop(value_t oldv, value_t newv)
+{
+    struct event_loop *loop;
+    int fd;
+
+    (void)oldv;
+    loop = value2c(struct event_loop *, newv);
+    for (fd = 0; fd < loop->nfds; fd++) {
+        if (loop->interest[fd])
+            loop->streams[fd] = relocate_lispvalue(loop->streams[fd]);
+    }
+}
+
+static void free_event_loop(value_t self)
+{
+    struct event_loop *loop;
+
+    loop = value2c(struct event_loop *, self);
+    if (loop->epfd != -1)
+        close(loop->epfd);
+    free(loop->streams);
+    free(loop->interest);
+}
+
+static struct cvtable event_loop_vtable = { print_event_loop,
+                                            relocate_event_loop,
+                                            free_event_loop, NULL };
+
+void os_events_init(void)
+{
+    eventloopsym = symbol("event-loop");
+    readsym = symbol("read");
+    writesym = symbol("write");
+    eventlooptype =
+        define_opaque_type(eventloopsym, sizeof(struct event_loop),
+                           &event_loop_vtable, NULL);
+}
@@ -9,6 +9,8 @@
 #include <math.h>
 #include <poll.h>
 #include <setjmp.h>
+#include <signal.h>
+#include <spawn.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -18,6 +20,8 @@
 
 #include "scheme.h"
 
+extern char **environ;
+
 static void warn(const char *msg) { fprintf(stderr, "%s\n", msg); }
 
 static void warnsys(const char *msg)
@@ -25,92 +29,127 @@ static void warnsys(const char *msg)
     fprintf(stderr, "%s: %s\n", msg, strerror(errno));
 }
 
-static void diesys(const char *msg)
+static value_t pipesym;
+
+// Pipes are close-on-exec at both ends; a child only gets the ends that
+// are dup'ed onto its stdin, stdout or stderr.
+static int open_pipe(int fds[2])
+{
+#ifdef __linux__
+    return pipe2(fds, O_CLOEXEC);
+#else
+    if (pipe(fds) == -1) {
+        return -1;
+    }
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    return 0;
+#endif
+}
+
+static void close_fd(int *fd)
+{
+    if (*fd != -1) {
+        close(*fd);
+        *fd = -1;
+    }
+}
+
+static void check_argv(value_t lst, const char *fname)
 {
-    warnsys(msg);
-    exit(1);
+    if (lst == FL_NIL) {
+        lerrorf(ArgError, "%s: executable argument list is empty", fname);
+    }
+    for (; iscons(lst); lst = cdr_(lst)) {
+        tostring(car_(lst), (char *)fname);
+    }
+    if (lst != FL_NIL) {
+        lerrorf(ArgError, "%s: executable arguments not a proper list",
+                fname);
+    }
 }
 
-static void set_close_on_exec(int fd)
+// The list must have passed check_argv.
+static char **make_argv(value_t lst)
 {
-    int flags;
+    struct sv_accum argv;
 
-    if ((flags = fcntl(fd, F_GETFD)) == -1) {
-        diesys("cannot get file descriptor flags");
+    sv_accum_init(&argv);
+    for (; iscons(lst); lst = cdr_(lst)) {
+        sv_accum_strdup(&argv, cvalue_data(car_(lst)));
     }
-    flags |= FD_CLOEXEC;
-    if (fcntl(fd, F_SETFD, flags) == -1) {
-        diesys("cannot set close-on-exec");
+    return argv.vec;
+}
+
+static void free_argv(char **argv)
+{
+    char **p;
+
+    for (p = argv; *p; p++) {
+        free(*p);
     }
+    free(argv);
+}
+
+// posix_spawn() lets the C library use vfork() or clone() so that
+// starting a process doesn't copy the page tables of a big heap. The
+// child gets the given fds (or ours if -1) as stdin, stdout and stderr,
+// and the default SIGPIPE action even if we were started with it
+// ignored. Returns an errno value.
+static int spawn_argv(char **argv, const int fds[3], pid_t *pid)
+{
+    posix_spawn_file_actions_t actions;
+    posix_spawnattr_t attr;
+    sigset_t sigs;
+    int i, err;
+
+    posix_spawn_file_actions_init(&actions);
+    for (i = 0; i < 3; i++) {
+        if (fds[i] != -1 && fds[i] != i) {
+            posix_spawn_file_actions_adddup2(&actions, fds[i], i);
+        }
+    }
+    posix_spawnattr_init(&attr);
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGPIPE);
+    posix_spawnattr_setsigdefault(&attr, &sigs);
+    sigemptyset(&sigs);
+    posix_spawnattr_setsigmask(&attr, &sigs);
+    posix_spawnattr_setflags(&attr,
+                             POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK);
+    err = posix_spawnp(pid, argv[0], &actions, &attr, argv, environ);
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    return err;
+}
+
+static int wait_pid(pid_t pid, int *status, int options)
+{
+    pid_t r;
+
+    while ((r = waitpid(pid, status, options)) == -1 && errno == EINTR)
+        ;
+    return r;
 }
 
 value_t builtin_spawn(value_t *args, uint32_t nargs)
 {
+    static const int inherit[3] = { -1, -1, -1 };
+    char **argv;
     pid_t child;
-    int status, exec_errno;
-    int fds[2];
-    struct pollfd pollfd;
-    ssize_t nbyte;
-    value_t unix_argv_obj;
-    struct sv_accum unix_argv;
-
-    // TODO: memory leak: unix_argv not freed on type error
+    int status, err;
+
     argcount("spawn", nargs, 1);
-    unix_argv_obj = args[0];
-    if (unix_argv_obj == FL_NIL) {
-        lerror(ArgError, "executable argument list is empty");
-    }
-    sv_accum_init(&unix_argv);
-    do {
-        if (!iscons(unix_argv_obj)) {
-            lerror(ArgError, "executable arguments not a proper list");
-        }
-        sv_accum_strdup(&unix_argv,
-                        tostring(car_(unix_argv_obj), "executable argument"));
-        unix_argv_obj = cdr_(unix_argv_obj);
-    } while (unix_argv_obj != FL_NIL);
-    // TODO: Signal mask for the child process.
-    if (pipe(fds) == -1) {
-        diesys("cannot create pipe");
-    }
-    set_close_on_exec(fds[0]);
-    set_close_on_exec(fds[1]);
-    if ((child = fork()) == -1) {
-        diesys("cannot fork");
-    }
-    if (!child) {
-        // We are in the new child process.
-        close(fds[0]);
-        execvp(unix_argv.vec[0], unix_argv.vec);
-        exec_errno = errno;
-        nbyte = write(fds[1], &exec_errno, sizeof(exec_errno));
-        if (nbyte == (ssize_t)-1) {
-            warnsys("completely borked (child)");
-        } else if (nbyte != (ssize_t)sizeof(exec_errno)) {
-            warn("completely borked (child)");
-        }
-        _exit(126);
-    }
-    // We are in the old parent process.
-    close(fds[1]);
-    memset(&pollfd, 0, sizeof(pollfd));
-    pollfd.fd = fds[0];
-    pollfd.events = POLLIN;
-    if (poll(&pollfd, 1, -1) == -1) {
-        diesys("cannot poll");
-    }
-    exec_errno = 0;
-    if (pollfd.revents & POLLIN) {
-        nbyte = read(pollfd.fd, &exec_errno, sizeof(exec_errno));
-        if (nbyte == 0) {
-            // We don't get any data, means the pipe was closed.
-        } else if (nbyte == (ssize_t)-1) {
-            warnsys("completely borked (parent)");
-        } else if (nbyte != (ssize_t)sizeof(exec_errno)) {
-            warn("completely borked (parent)");
-        }
+    check_argv(args[0], "spawn");
+    argv = make_argv(args[0]);
+    err = spawn_argv(argv, inherit, &child);
+    free_argv(argv);
+    if (err != 0) {
+        errno = err;
+        warnsys("cannot execute command");
+        return FL_NIL;
     }
-    if (waitpid(child, &status, 0) == -1) {
+    if (wait_pid(child, &status, 0) == -1) {
         warnsys("cannot wait for child process");
         return FL_NIL;
     }
@@ -118,10 +157,322 @@ value_t builtin_spawn(value_t *args, uint32_t nargs)
         warn("child process did not exit normally");
         return FL_NIL;
     }
-    if (exec_errno != 0) {
-        errno = exec_errno;
-        warnsys("cannot execute command");
-        return FL_NIL;
+    return fixnum(WEXITSTATUS(status));
+}
+
+// Process pipelines
+
+// What a child's stdin, stdout or stderr is connected to: #f for ours,
+// 'pipe for a new pipe whose other end we return as a stream, or any
+// stream with a file descriptor.
+static void check_redirect(value_t v, const char *fname)
+{
+    struct ios *s;
+
+    if (v == FL_F || v == pipesym) {
+        return;
+    }
+    s = fl_toiostream(v, fname);
+    if (s->fd < 0) {
+        lerrorf(ArgError, "%s: stream has no file descriptor", fname);
+    }
+}
+
+// Make a pipe for each 'pipe. childfds[] get the ends the children
+// use and parentfds[] the ends we keep.
+static int open_redirects(value_t *redir, int childfds[3], int parentfds[3])
+{
+    struct ios *s;
+    int i, fds[2];
+
+    for (i = 0; i < 3; i++) {
+        childfds[i] = parentfds[i] = -1;
+    }
+    for (i = 0; i < 3; i++) {
+        if (redir[i] == pipesym) {
+            if (open_pipe(fds) == -1) {
+                return errno;
+            }
+            childfds[i] = fds[i ? 1 : 0];
+            parentfds[i] = fds[i ? 0 : 1];
+        } else if (redir[i] != FL_F) {
+            s = value2c(struct ios *, redir[i]);
+            ios_flush(s);
+            childfds[i] = (int)s->fd;
+        }
+    }
+    return 0;
+}
+
+static value_t parent_stream(int fd)
+{
+    return (fd == -1) ? FL_F : fl_iostream_fd(fd);
+}
+
+// (spawn-pipeline (argv ...) [stdin [stdout [stderr]]]) starts the
+// commands with the stdout of each piped to the stdin of the next; all
+// of them share stderr. Returns #(pids stdin stdout stderr) where the
+// streams are our ends of any 'pipe redirections, else #f.
+static value_t spawn_pipeline(value_t cmds, value_t *args, uint32_t nargs,
+                              const char *fname)
+{
+    value_t redir[3], pids, v;
+    int childfds[3], parentfds[3], fds[3], link[2];
+    int i, ncmds, err, status, in;
+    pid_t *children, pid;
+    char **argv;
+
+    for (i = 0; i < 3; i++) {
+        redir[i] = ((uint32_t)i < nargs) ? args[i] : FL_F;
+        check_redirect(redir[i], fname);
+    }
+    for (v = cmds, ncmds = 0; iscons(v); v = cdr_(v), ncmds++) {
+        check_argv(car_(v), fname);
+    }
+    if (!ncmds || v != FL_NIL) {
+        lerrorf(ArgError, "%s: expected a list of commands", fname);
+    }
+    if (!(children = calloc(ncmds, sizeof(*children)))) {
+        lerror(MemoryError, "out of memory");
+    }
+    err = open_redirects(redir, childfds, parentfds);
+    in = childfds[0];
+    for (i = 0, v = cmds; !err && i < ncmds; i++, v = cdr_(v)) {
+        link[0] = link[1] = -1;
+        if (i < ncmds - 1 && open_pipe(link) == -1) {
+            err = errno;
+            break;
+        }
+        fds[0] = in;
+        fds[1] = (i < ncmds - 1) ? link[1] : childfds[1];
+        fds[2] = childfds[2];
+        argv = make_argv(car_(v));
+        if (!(err = spawn_argv(argv, fds, &pid))) {
+            children[i] = pid;
+        }
+        free_argv(argv);
+        if (in != childfds[0]) {
+            close_fd(&in);
+        }
+        close_fd(&link[1]);
+        in = link[0];
+    }
+    if (in != childfds[0]) {
+        close_fd(&in);
+    }
+    for (i = 0; i < 3; i++) {
+        if (redir[i] == pipesym) {
+            close_fd(&childfds[i]);
+        }
+    }
+    if (err) {
+        // don't leave half a pipeline running
+        for (i = 0; i < 3; i++) {
+            close_fd(&parentfds[i]);
+        }
+        for (i = 0; i < ncmds && children[i] > 0; i++) {
+            kill(children[i], SIGTERM);
+            wait_pid(children[i], &status, 0);
+        }
+        free(children);
+        lerrorf(IOError, "%s: %s", fname, strerror(err));
+    }
+    pids = FL_NIL;
+    for (i = ncmds - 1; i >= 0; i--) {
+        pids = fl_cons(fixnum(children[i]), pids);
+    }
+    free(children);
+    fl_gc_handle(&pids);
+    v = alloc_vector(4, 0);
+    vector_elt(v, 0) = pids;
+    for (i = 0; i < 3; i++) {
+        vector_elt(v, i + 1) = FL_F;
+    }
+    fl_gc_handle(&v);
+    for (i = 0; i < 3; i++) {
+        redir[i] = parent_stream(parentfds[i]);
+        vector_elt(v, i + 1) = redir[i];
+    }
+    fl_free_gc_handles(2);
+    return v;
+}
+
+value_t builtin_spawn_pipeline(value_t *args, uint32_t nargs)
+{
+    if (nargs < 1 || nargs > 4) {
+        argcount("spawn-pipeline", nargs, nargs < 1 ? 1 : 4);
+    }
+    return spawn_pipeline(args[0], args + 1, nargs - 1, "spawn-pipeline");
+}
+
+// (spawn-process argv [stdin [stdout [stderr]]]) is a pipeline of one
+// and returns #(pid stdin stdout stderr).
+value_t builtin_spawn_process(value_t *args, uint32_t nargs)
+{
+    value_t v;
+
+    if (nargs < 1 || nargs > 4) {
+        argcount("spawn-process", nargs, nargs < 1 ? 1 : 4);
+    }
+    v = fl_cons(args[0], FL_NIL);
+    v = spawn_pipeline(v, args + 1, nargs - 1, "spawn-process");
+    vector_elt(v, 0) = car_(vector_elt(v, 0));
+    return v;
+}
+
+// Waiting
+
+// The exit code, or 128 plus the signal number like the shell does.
+static value_t status_value(int status)
+{
+    if (WIFSIGNALED(status)) {
+        return fixnum(128 + WTERMSIG(status));
     }
     return fixnum(WEXITSTATUS(status));
 }
+
+static int nohang_arg(value_t *args, uint32_t nargs)
+{
+    return (nargs > 1 && args[1] != FL_F) ? WNOHANG : 0;
+}
+
+// (process-wait pid [nohang]) returns the exit status of the child, or
+// #f if nohang is true and it is still running.
+value_t builtin_process_wait(value_t *args, uint32_t nargs)
+{
+    pid_t pid, r;
+    int status;
+
+    if (nargs < 1 || nargs > 2) {
+        argcount("process-wait", nargs, nargs < 1 ? 1 : 2);
+    }
+    pid = (pid_t)toulong(args[0], "process-wait");
+    if ((r = wait_pid(pid, &status, nohang_arg(args, nargs))) == -1) {
+        lerrorf(IOError, "process-wait: %s", strerror(errno));
+    }
+    return r ? status_value(status) : FL_F;
+}
+
+// While process-wait-any sleeps, a SIGCHLD handler writes a byte to
+// this pipe for each child that exits, so that it wakes up and looks
+// at the children it was asked about. Only those are reaped.
+static int sigchld_pipe[2] = { -1, -1 };
+
+static void sigchld_handler(int sig)
+{
+    ssize_t n;
+    int saved;
+
+    (void)sig;
+    saved = errno;
+    n = write(sigchld_pipe[1], "", 1);  // if full, it wakes us anyway
+    (void)n;
+    errno = saved;
+}
+
+static void sigchld_drain(void)
+{
+    char buf[64];
+
+    while (read(sigchld_pipe[0], buf, sizeof(buf)) > 0)
+        ;
+}
+
+static void sigchld_catch(struct sigaction *old)
+{
+    struct sigaction sa;
+
+    if (sigchld_pipe[0] == -1) {
+        if (open_pipe(sigchld_pipe) == -1) {
+            lerrorf(IOError, "process-wait-any: %s", strerror(errno));
+        }
+        fcntl(sigchld_pipe[0], F_SETFL, O_NONBLOCK);
+        fcntl(sigchld_pipe[1], F_SETFL, O_NONBLOCK);
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = sigchld_handler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    if (sigaction(SIGCHLD, &sa, old) == -1) {
+        lerrorf(IOError, "process-wait-any: %s", strerror(errno));
+    }
+}
+
+// Reap the first child in the list that has exited, if any, into the
+// pair, which is allocated up front so that a status once reaped can't
+// be lost to an out-of-memory error. Returns -1 with errno set if the
+// list has a pid that isn't our child.
+static int reap_any(value_t pids, value_t pair)
+{
+    pid_t pid;
+    int status;
+
+    for (; iscons(pids); pids = cdr_(pids)) {
+        pid = (pid_t)numval(car_(pids));
+        if ((pid = wait_pid(pid, &status, WNOHANG)) == -1) {
+            return -1;
+        }
+        if (pid != 0) {
+            car_(pair) = car_(pids);
+            cdr_(pair) = status_value(status);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// (process-wait-any pids [nohang]) waits for whichever of the children
+// exits first and returns (pid . status), or #f if nohang is true and
+// none has exited. Other children are left for their own wait.
+value_t builtin_process_wait_any(value_t *args, uint32_t nargs)
+{
+    struct sigaction old;
+    struct pollfd pfd;
+    value_t v, pair;
+    int r, err;
+
+    if (nargs < 1 || nargs > 2) {
+        argcount("process-wait-any", nargs, nargs < 1 ? 1 : 2);
+    }
+    for (v = args[0]; iscons(v); v = cdr_(v)) {
+        if (!isfixnum(car_(v)) || numval(car_(v)) <= 0) {
+            type_error("process-wait-any", "pid", car_(v));
+        }
+    }
+    if (v != FL_NIL || args[0] == FL_NIL) {
+        lerror(ArgError, "process-wait-any: expected a list of pids");
+    }
+    pair = fl_cons(FL_F, FL_F);
+    if (nohang_arg(args, nargs)) {
+        if ((r = reap_any(args[0], pair)) == -1) {
+            lerrorf(IOError, "process-wait-any: %s", strerror(errno));
+        }
+        return r ? pair : FL_F;
+    }
+    // catch SIGCHLD before looking, so no exit goes unnoticed between
+    // looking and going to sleep
+    sigchld_catch(&old);
+    for (;;) {
+        sigchld_drain();
+        if ((r = reap_any(args[0], pair)) != 0) {
+            break;
+        }
+        pfd.fd = sigchld_pipe[0];
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, -1) == -1 && errno != EINTR) {
+            r = -1;
+            break;
+        }
+    }
+    err = (r == -1) ? errno : 0;
+    sigaction(SIGCHLD, &old, NULL);
+    if (err) {
+        lerrorf(IOError, "process-wait-any: %s", strerror(err));
+    }
+    return pair;
+}
+
+void os_process_init(void)
+{
+    pipesym = symbol("pipe");
+}
@@ -0,0 +1,575 @@
+// Copyright 2019 Lassi Kortela
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Recursive directory walks. A walker keeps a stack of directories still
+// to be read and hands out their entries in batches, each entry with its
+// type, size and modification time from fstatat() relative to the open
+// directory. With worker threads several directories are read and
+// stat'ed at once while the calling thread turns finished batches into
+// Scheme values; without them the caller does all the work itself.
+
+#include <sys/types.h>
+
+#include <sys/stat.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "scheme.h"
+
+#define WALK_BATCH 1024
+#define WALK_MAXTHREADS 64
+
+struct walk_job {
+    struct walk_job *next;
+    char path[];
+};
+
+struct walk_entry {
+    size_t path;  // offset in the batch's names
+    mode_t mode;
+    int64_t size;
+    int64_t mtime;
+};
+
+struct walk_batch {
+    struct walk_batch *next;
+    size_t count;
+    size_t namelen;
+    size_t namecap;
+    char *names;
+    struct walk_entry entries[WALK_BATCH];
+};
+
+// A directory being read, by a worker or by the caller
+struct walk_cursor {
+    DIR *dir;
+    struct walk_job *job;
+    size_t pathlen;
+};
+
+struct walker {
+    pthread_mutex_t lock;
+    pthread_cond_t work;   // jobs pushed or nothing left to do
+    pthread_cond_t ready;  // batch finished or a worker exited
+    pthread_cond_t room;   // batch taken by the caller
+    struct walk_job *jobs;
+    struct walk_batch *head;
+    struct walk_batch *tail;
+    struct walk_batch *current;  // batch the caller is consuming
+    struct walk_cursor cursor;   // used when there are no threads
+    size_t nbatches;
+    int busy;     // cursors with a directory open
+    int running;  // worker threads that have not exited
+    int nthreads;
+    int stop;
+    int nomem;
+    pthread_t threads[WALK_MAXTHREADS];
+};
+
+static value_t walkersym;
+static value_t regularsym, directorysym, symlinksym, fifosym, socketsym;
+static value_t chardevsym, blockdevsym, unknownsym;
+static struct fltype *walkertype;
+
+static struct walker **towalkerptr(value_t v, const char *fname)
+{
+    if (!iscvalue(v) || cv_class((struct cvalue *)ptr(v)) != walkertype)
+        type_error((char *)fname, "directory-walker", v);
+    return value2c(struct walker **, v);
+}
+
+static value_t type_symbol(mode_t mode)
+{
+    if (S_ISREG(mode))
+        return regularsym;
+    if (S_ISDIR(mode))
+        return directorysym;
+    if (S_ISLNK(mode))
+        return symlinksym;
+    if (S_ISFIFO(mode))
+        return fifosym;
+    if (S_ISSOCK(mode))
+        return socketsym;
+    if (S_ISCHR(mode))
+        return chardevsym;
+    if (S_ISBLK(mode))
+        return blockdevsym;
+    return unknownsym;
+}
+
+static struct walk_job *make_job(const char *path, size_t len)
+{
+    struct walk_job *job;
+
+    if ((job = malloc(sizeof(*job) + len + 1))) {
+        memcpy(job->path, path, len + 1);
+        job->next = NULL;
+    }
+    return job;
+}
+
+static void out_of_memory(struct walker *w)
+{
+    pthread_mutex_lock(&w->lock);
+    w->nomem = 1;
+    __atomic_store_n(&w->stop, 1, __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&w->work);
+    pthread_cond_broadcast(&w->ready);
+    pthread_cond_broadcast(&w->room);
+    pthread_mutex_unlock(&w->lock);
+}
+
+static void push_jobs(struct walker *w, struct walk_job *first,
+                      struct walk_job *last)
+{
+    pthread_mutex_lock(&w->lock);
+    last->next = w->jobs;
+    w->jobs = first;
+    pthread_cond_broadcast(&w->work);
+    pthread_mutex_unlock(&w->lock);
+}
+
+// Open the next directory on the stack, waiting for other cursors to
+// push more if the stack is empty. Returns 0 when the walk is done.
+// Directories that can't be opened are skipped.
+static int next_dir(struct walker *w, struct walk_cursor *cur)
+{
+    struct walk_job *job;
+
+    for (;;) {
+        pthread_mutex_lock(&w->lock);
+        while (!w->jobs && w->busy && !w->stop)
+            pthread_cond_wait(&w->work, &w->lock);
+        if (w->stop || !(job = w->jobs)) {
+            pthread_mutex_unlock(&w->lock);
+            return 0;
+        }
+        w->jobs = job->next;
+        w->busy++;
+        pthread_mutex_unlock(&w->lock);
+        if ((cur->dir = opendir(job->path))) {
+            cur->job = job;
+            cur->pathlen = strlen(job->path);
+            if (cur->pathlen && job->path[cur->pathlen - 1] == '/')
+                cur->pathlen--;
+            return 1;
+        }
+        free(job);
+        pthread_mutex_lock(&w->lock);
+        if (!--w->busy && !w->jobs)
+            pthread_cond_broadcast(&w->work);
+        pthread_mutex_unlock(&w->lock);
+    }
+}
+
+static void finish_dir(struct walker *w, struct walk_cursor *cur)
+{
+    closedir(cur->dir);
+    free(cur->job);
+    cur->dir = NULL;
+    cur->job = NULL;
+    pthread_mutex_lock(&w->lock);
+    if (!--w->busy && !w->jobs)
+        pthread_cond_broadcast(&w->work);
+    pthread_mutex_unlock(&w->lock);
+}
+
+static struct walk_entry *add_entry(struct walk_batch *b,
+                                    struct walk_cursor *cur,
+                                    const char *name)
+{
+    struct walk_entry *e;
+    size_t namelen, need, cap;
+    char *names, *p;
+
+    namelen = strlen(name);
+    need = b->namelen + cur->pathlen + namelen + 2;
+    if (need > b->namecap) {
+        for (cap = b->namecap ? b->namecap : 64 * WALK_BATCH; cap < need;
+             cap *= 2)
+            ;
+        if (!(names = realloc(b->names, cap)))
+            return NULL;
+        b->names = names;
+        b->namecap = cap;
+    }
+    e = &b->entries[b->count++];
+    e->path = b->namelen;
+    p = b->names + b->namelen;
+    memcpy(p, cur->job->path, cur->pathlen);
+    p[cur->pathlen] = '/';
+    memcpy(p + cur->pathlen + 1, name, namelen + 1);
+    b->namelen = need;
+    return e;
+}
+
+// Fill b with up to WALK_BATCH entries. Subdirectories found on the way
+// are pushed on the stack before their parent is finished so that other
+// cursors never see an empty stack while work remains.
+static size_t fill_batch(struct walker *w, struct walk_cursor *cur,
+                         struct walk_batch *b)
+{
+    struct walk_job *first, *last, *job;
+    struct walk_entry *e;
+    struct dirent *d;
+    struct stat st;
+
+    b->count = b->namelen = 0;
+    first = last = NULL;
+    while (b->count < WALK_BATCH &&
+           !__atomic_load_n(&w->stop, __ATOMIC_RELAXED)) {
+        if (!cur->dir && !next_dir(w, cur))
+            break;
+        if (!(d = readdir(cur->dir))) {
+            if (first) {
+                push_jobs(w, first, last);
+                first = last = NULL;
+            }
+            finish_dir(w, cur);
+            continue;
+        }
+        if (d->d_name[0] == '.' &&
+            (!d->d_name[1] || (d->d_name[1] == '.' && !d->d_name[2])))
+            continue;
+        if (fstatat(dirfd(cur->dir), d->d_name, &st, AT_SYMLINK_NOFOLLOW) ==
+            -1)
+            continue;
+        if (!(e = add_entry(b, cur, d->d_name))) {
+            out_of_memory(w);
+            break;
+        }
+        e->mode = st.st_mode;
+        e->size = (int64_t)st.st_size;
+        e->mtime = (int64_t)st.st_mtime;
+        if (S_ISDIR(st.st_mode)) {
+            if (!(job = make_job(b->names + e->path,
+                                 b->namelen - e->path - 1))) {
+                out_of_memory(w);
+                break;
+            }
+            if (last)
+                last->next = job;
+            else
+                first = job;
+            last = job;
+        }
+    }
+    if (first)
+        push_jobs(w, first, last);
+    return b->count;
+}
+
+static struct walk_batch *new_batch(void)
+{
+    struct walk_batch *b;
+
+    if ((b = malloc(sizeof(*b)))) {
+        b->next = NULL;
+        b->count = b->namelen = b->namecap = 0;
+        b->names = NULL;
+    }
+    return b;
+}
+
+static void free_batch(struct walk_batch *b)
+{
+    if (b) {
+        free(b->names);
+        free(b);
+    }
+}
+
+static void *walk_thread(void *arg)
+{
+    struct walker *w = arg;
+    struct walk_cursor cur;
+    struct walk_batch *b;
+
+    memset(&cur, 0, sizeof(cur));
+    b = NULL;
+    for (;;) {
+        if (!b && !(b = new_batch())) {
+            out_of_memory(w);
+            break;
+        }
+        if (!fill_batch(w, &cur, b))
+            break;
+        pthread_mutex_lock(&w->lock);
+        while (w->nbatches >= (size_t)w->nthreads * 2 && !w->stop)
+            pthread_cond_wait(&w->room, &w->lock);
+        if (w->tail)
+            w->tail->next = b;
+        else
+            w->head = b;
+        w->tail = b;
+        w->nbatches++;
+        pthread_cond_signal(&w->ready);
+        pthread_mutex_unlock(&w->lock);
+        b = NULL;
+    }
+    if (cur.dir)
+        finish_dir(w, &cur);
+    free_batch(b);
+    pthread_mutex_lock(&w->lock);
+    w->running--;
+    pthread_cond_broadcast(&w->ready);
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+
+// Make w->current the next batch of entries. Returns its entry count, 0
+// at the end of the walk.
+static size_t next_batch(struct walker *w)
+{
+    struct walk_batch *b;
+
+    if (!w->nthreads) {
+        if (!w->current && !(w->current = new_batch()))
+            lerror(MemoryError, "directory walk: out of memory");
+        fill_batch(w, &w->cursor, w->current);
+    } else {
+        free_batch(w->current);
+        w->current = NULL;
+        pthread_mutex_lock(&w->lock);
+        while (!(b = w->head) && w->running)
+            pthread_cond_wait(&w->ready, &w->lock);
+        if (b) {
+            if (!(w->head = b->next))
+                w->tail = NULL;
+            w->nbatches--;
+            pthread_cond_signal(&w->room);
+        }
+        pthread_mutex_unlock(&w->lock);
+        w->current = b;
+    }
+    if (w->nomem)
+        lerror(MemoryError, "directory walk: out of memory");
+    return w->current ? w->current->count : 0;
+}
+
+static void free_walker(struct walker *w)
+{
+    struct walk_job *job;
+    struct walk_batch *b;
+    int i;
+
+    pthread_mutex_lock(&w->lock);
+    __atomic_store_n(&w->stop, 1, __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&w->work);
+    pthread_cond_broadcast(&w->room);
+    pthread_mutex_unlock(&w->lock);
+    for (i = 0; i < w->nthreads; i++)
+        pthread_join(w->threads[i], NULL);
+    if (w->cursor.dir) {
+        closedir(w->cursor.dir);
+        free(w->cursor.job);
+    }
+    while ((job = w->jobs)) {
+        w->jobs = job->next;
+        free(job);
+    }
+    while ((b = w->head)) {
+        w->head = b->next;
+        free_batch(b);
+    }
+    free_batch(w->current);
+    pthread_mutex_destroy(&w->lock);
+    pthread_cond_destroy(&w->work);
+    pthread_cond_destroy(&w->ready);
+    pthread_cond_destroy(&w->room);
+    free(w);
+}
+
+static value_t make_walker(value_t *args, uint32_t nargs, const char *fname)
+{
+    struct walker *w;
+    struct walk_job *job;
+    const char *path;
+    value_t v;
+    DIR *dir;
+    fixnum_t nthreads;
+    int i;
+
+    path = tostring(args[0], (char *)fname);
+    nthreads = 0;
+    if (nargs > 1 && args[1] != FL_F) {
+        if (!isfixnum(args[1]))
+            type_error((char *)fname, "fixnum", args[1]);
+        nthreads = numval(args[1]);
+        if (nthreads < 0 || nthreads > WALK_MAXTHREADS)
+            lerrorf(ArgError, "%s: thread count must be from 0 to %d",
+                    fname, WALK_MAXTHREADS);
+    }
+    if (!(dir = opendir(path)))
+        lerrorf(IOError, "%s: %s: %s", fname, path, strerror(errno));
+    closedir(dir);
+    v = cvalue(walkertype, sizeof(struct walker *));
+    *value2c(struct walker **, v) = NULL;
+    path = tostring(args[0], (char *)fname);
+    if (!(w = calloc(1, sizeof(*w))) ||
+        !(job = make_job(path, strlen(path)))) {
+        free(w);
+        lerrorf(MemoryError, "%s: out of memory", fname);
+    }
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_cond_init(&w->work, NULL);
+    pthread_cond_init(&w->ready, NULL);
+    pthread_cond_init(&w->room, NULL);
+    w->jobs = job;
+    *value2c(struct walker **, v) = w;
+    // threads count themselves out under the lock, so count them in
+    // under it too
+    pthread_mutex_lock(&w->lock);
+    for (i = 0; i < nthreads; i++) {
+        if (pthread_create(&w->threads[i], NULL, walk_thread, w))
+            break;
+        w->nthreads = w->running = i + 1;
+    }
+    pthread_mutex_unlock(&w->lock);
+    if (nthreads && !w->nthreads)
+        lerrorf(IOError, "%s: cannot start threads", fname);
+    return v;
+}
+
+static value_t close_walker(value_t v)
+{
+    struct walker **wp;
+
+    wp = value2c(struct walker **, v);
+    if (*wp) {
+        free_walker(*wp);
+        *wp = NULL;
+    }
+    return FL_T;
+}
+
+// (open-directory-walker dir [threads]) starts a recursive walk of dir
+// using the given number of worker threads, none by default.
+value_t builtin_open_directory_walker(value_t *args, uint32_t nargs)
+{
+    if (nargs < 1 || nargs > 2)
+        argcount("open-directory-walker", nargs, nargs < 1 ? 1 : 2);
+    return make_walker(args, nargs, "open-directory-walker");
+}
+
+// (read-directory-walker w) returns the next batch of entries as a
+// vector of #(path type size mtime) vectors, or the eof object when the
+// walk is done.
+value_t builtin_read_directory_walker(value_t *args, uint32_t nargs)
+{
+    struct walker *w;
+    struct walk_batch *b;
+    struct walk_entry *e;
+    value_t wv, batch, ent, v;
+    size_t i, n;
+
+    argcount("read-directory-walker", nargs, 1);
+    if (!(w = *towalkerptr(args[0], "read-directory-walker")))
+        return FL_EOF;
+    if (!(n = next_batch(w)))
+        return FL_EOF;
+    wv = args[0];
+    batch = alloc_vector(n, 1);
+    ent = FL_F;
+    fl_gc_handle(&wv);
+    fl_gc_handle(&batch);
+    fl_gc_handle(&ent);
+    for (i = 0; i < n; i++) {
+        ent = alloc_vector(4, 1);
+        vector_elt(batch, i) = ent;
+        b = (*value2c(struct walker **, wv))->current;
+        v = string_from_cstr(b->names + b->entries[i].path);
+        vector_elt(ent, 0) = v;
+        e = &b->entries[i];
+        vector_elt(ent, 1) = type_symbol(e->mode);
+        v = return_from_int64(e->size);
+        vector_elt(ent, 2) = v;
+        v = return_from_int64(e->mtime);
+        vector_elt(ent, 3) = v;
+    }
+    fl_free_gc_handles(3);
+    return batch;
+}
+
+value_t builtin_close_directory_walker(value_t *args, uint32_t nargs)
+{
+    argcount("close-directory-walker", nargs, 1);
+    towalkerptr(args[0], "close-directory-walker");
+    return close_walker(args[0]);
+}
+
+// (walk-directory proc dir [threads]) calls (proc path type size mtime)
+// on each entry under dir, subdirectories included, and returns the
+// number of entries.
+value_t builtin_walk_directory(value_t *args, uint32_t nargs)
+{
+    struct walk_batch *b;
+    struct walk_entry *e;
+    value_t f, wv, path, size, mtime;
+    size_t i, n, total;
+
+    if (nargs < 2 || nargs > 3)
+        argcount("walk-directory", nargs, nargs < 2 ? 2 : 3);
+    f = args[0];
+    wv = make_walker(args + 1, nargs - 1, "walk-directory");
+    path = size = mtime = FL_F;
+    fl_gc_handle(&f);
+    fl_gc_handle(&wv);
+    fl_gc_handle(&path);
+    fl_gc_handle(&size);
+    fl_gc_handle(&mtime);
+    total = 0;
+    while ((n = next_batch(*value2c(struct walker **, wv)))) {
+        for (i = 0; i < n; i++) {
+            b = (*value2c(struct walker **, wv))->current;
+            e = &b->entries[i];
+            size = return_from_int64(e->size);
+            mtime = return_from_int64(e->mtime);
+            path = string_from_cstr(b->names + e->path);
+            fl_applyn(4, f, path, type_symbol(e->mode), size, mtime);
+        }
+        total += n;
+    }
+    close_walker(wv);
+    fl_free_gc_handles(5);
+    return size_wrap(total);
+}
+
+static void print_walker(value_t v, struct ios *f)
+{
+    (void)v;
+    fl_print_str("#<directory-walker>", f);
+}
+
+static void free_walker_value(value_t self)
+{
+    close_walker(self);
+}
+
+static struct cvtable walker_vtable = { print_walker, NULL,
+                                        free_walker_value, NULL };
+
+void os_walk_init(void)
+{
+    walkersym = symbol("directory-walker");
+    regularsym = symbol("regular");
+    directorysym = symbol("directory");
+    symlinksym = symbol("symlink");
+    fifosym = symbol("fifo");
+    socketsym = symbol("socket");
+    chardevsym = symbol("char-device");
+    blockdevsym = symbol("block-device");
+    unknownsym = symbol("unknown");
+    walkertype = define_opaque_type(walkersym, sizeof(struct walker *),
+                                    &walker_vtable, NULL);
+}
@@ -0,0 +1,452 @@
+// Parallel copying collection. The thread that called gc() evacuates
+// the roots and deals the copies out to the workers, so that each starts
+// on its own share. Each worker then scans the gray objects in its own
+// deque, evacuating what they point to, and steals from the other
+// deques when it runs dry.
+//
+// A thread claims an object by swapping its first word for GC_BUSY, so
+// each object is copied exactly once; threads that find the claim wait
+// for the forwarding address. Copies go into allocation buffers carved
+// out of tospace for each thread. What is left of a buffer when it's
+// retired is wasted, and parallel_reserve() keeps enough of the heap
+// back from the mutator to pay for that.
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define GC_BUSY ((value_t)0x9)  // an invalid value, like TAG_FWD
+#define GC_MAX_THREADS 64
+#define LAB_SIZE 4096
+#define LAB_MAX_OBJECT 64  // bigger objects bypass the buffers
+#define GC_LOCAL 256
+
+struct gc_ring {
+    struct gc_ring *prev;  // outgrown; freed after the collection
+    long size;  // a power of two
+    value_t buf[1];
+};
+
+struct gc_worker {
+    long top, bottom;  // Chase-Lev work-stealing deque
+    struct gc_ring *ring;
+    value_t local[GC_LOCAL];  // private, so cheaper than the deque
+    int nlocal;
+    unsigned char *lab, *labend;
+    uint32_t seed;
+    unsigned generation;
+    pthread_t thread;
+};
+
+static struct gc_worker *gc_workers;
+static int gc_nworkers;  // including the thread that calls gc()
+static unsigned char *gc_top;  // where the next buffer starts
+static int gc_idle;
+static unsigned gc_generation, gc_finished;
+static pthread_mutex_t gc_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gc_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t gc_done = PTHREAD_COND_INITIALIZER;
+static __thread struct gc_worker *gc_self;
+
+static void par_scan(value_t v);
+
+static struct gc_ring *gc_ring_new(long size)
+{
+    struct gc_ring *r;
+
+    r = malloc(sizeof(*r) + (size - 1) * sizeof(value_t));
+    if (r != NULL) {
+        r->prev = NULL;
+        r->size = size;
+    }
+    return r;
+}
+
+static int gc_push(struct gc_worker *w, value_t v)
+{
+    struct gc_ring *r, *nr;
+    long b, t, i;
+
+    b = __atomic_load_n(&w->bottom, __ATOMIC_RELAXED);
+    t = __atomic_load_n(&w->top, __ATOMIC_ACQUIRE);
+    r = w->ring;
+    if (b - t > r->size - 1) {
+        if ((nr = gc_ring_new(2 * r->size)) == NULL)
+            return 0;
+        for (i = t; i < b; i++)
+            nr->buf[i & (nr->size - 1)] = r->buf[i & (r->size - 1)];
+        nr->prev = r;
+        __atomic_store_n(&w->ring, nr, __ATOMIC_RELEASE);
+        r = nr;
+    }
+    __atomic_store_n(&r->buf[b & (r->size - 1)], v, __ATOMIC_RELAXED);
+    __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+// Pop from our own end of the deque. Returns 0 if it's empty.
+static value_t gc_take(struct gc_worker *w)
+{
+    struct gc_ring *r;
+    long b, t;
+    value_t v;
+
+    b = __atomic_load_n(&w->bottom, __ATOMIC_RELAXED) - 1;
+    r = w->ring;
+    __atomic_store_n(&w->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    t = __atomic_load_n(&w->top, __ATOMIC_RELAXED);
+    if (t > b) {
+        __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+        return 0;
+    }
+    v = __atomic_load_n(&r->buf[b & (r->size - 1)], __ATOMIC_RELAXED);
+    if (t == b) {
+        // last one; race the thieves for it
+        if (!__atomic_compare_exchange_n(&w->top, &t, t + 1, 0,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+            v = 0;
+        __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return v;
+}
+
+// Take from the other end of someone else's deque. Returns 0 if it's
+// empty or another thread got there first.
+static value_t gc_steal(struct gc_worker *w)
+{
+    struct gc_ring *r;
+    long b, t;
+    value_t v;
+
+    t = __atomic_load_n(&w->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    b = __atomic_load_n(&w->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b)
+        return 0;
+    r = __atomic_load_n(&w->ring, __ATOMIC_ACQUIRE);
+    v = __atomic_load_n(&r->buf[t & (r->size - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&w->top, &t, t + 1, 0, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_RELAXED))
+        return 0;
+    return v;
+}
+
+// Queue a gray object. It goes on the private stack while that has
+// room and on the deque, where others can steal it, when it hasn't.
+static void gc_defer(value_t v)
+{
+    struct gc_worker *w = gc_self;
+
+    if (w->nlocal < GC_LOCAL)
+        w->local[w->nlocal++] = v;
+    else if (!gc_push(w, v))
+        par_scan(v);
+}
+
+// Publish the older half of the private stack, for idle workers to
+// steal.
+static void gc_share(struct gc_worker *w)
+{
+    int i, n;
+
+    n = w->nlocal / 2;
+    for (i = 0; i < n; i++) {
+        if (!gc_push(w, w->local[i]))
+            break;
+    }
+    memmove(w->local, w->local + i, (w->nlocal - i) * sizeof(value_t));
+    w->nlocal -= i;
+}
+
+static value_t *gc_alloc(size_t nw)
+{
+    struct gc_worker *w = gc_self;
+    size_t n = ALIGN(nw, 2) * sizeof(value_t);
+    unsigned char *p;
+
+    if (n > LAB_MAX_OBJECT)
+        return (value_t *)__atomic_fetch_add(&gc_top, n, __ATOMIC_RELAXED);
+    if (w->lab + n > w->labend) {
+        w->lab = __atomic_fetch_add(&gc_top, LAB_SIZE, __ATOMIC_RELAXED);
+        w->labend = w->lab + LAB_SIZE;
+    }
+    p = w->lab;
+    w->lab += n;
+    return (value_t *)p;
+}
+
+static value_t par_visit(value_t v)
+{
+    value_t oldspace[CVALUE_NWORDS + 1];
+    struct cvalue *old;
+    value_t *o, *n, w0, nv;
+    struct fltype *t;
+    size_t nw;
+
+    if ((tag(v) & 3) == 0)
+        return v;
+    if (!ismanaged(v)) {
+        if (!islarge(v))
+            return v;
+        if (vector_elt(v, -1) & 0x1)  // grown vector
+            return par_visit(vector_elt(v, 0));
+        if (!__atomic_exchange_n(&large_of(v)->mark, 1, __ATOMIC_RELAXED))
+            gc_defer(v);  // to scan in place
+        return v;
+    }
+    o = (value_t *)ptr(v);
+    for (;;) {
+        w0 = __atomic_load_n(&o[0], __ATOMIC_ACQUIRE);
+        if (w0 == TAG_FWD)
+            return __atomic_load_n(&o[1], __ATOMIC_RELAXED);
+        if (w0 == GC_BUSY) {
+            sched_yield();
+            continue;
+        }
+        if (isvector(v) && (w0 & 0x1))  // grown vector
+            return par_visit(o[1]);
+        if (__atomic_compare_exchange_n(&o[0], &w0, GC_BUSY, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            break;
+    }
+    nw = gc_nwords(v, w0);
+    n = gc_alloc(nw);
+    n[0] = w0;
+    memcpy(n + 1, o + 1, (nw - 1) * sizeof(value_t));
+    nv = tagptr(n, tag(v));
+    if (iscvalue(v)) {
+        // the relocate hook gets the old header, for the old data
+        // address, since forwarding overwrites it
+        old = (struct cvalue *)ALIGN((uintptr_t)oldspace, 8);
+        *old = *(struct cvalue *)n;
+        if (isinlined((struct cvalue *)o))
+            ((struct cvalue *)n)->data = &((struct cvalue *)n)->_space[0];
+    } else if (issymbol(v)) {
+        ((struct gensym *)n)->isconst = 0;
+    }
+    __atomic_store_n(&o[1], nv, __ATOMIC_RELAXED);
+    __atomic_store_n(&o[0], TAG_FWD, __ATOMIC_RELEASE);
+
+    switch (tag(v)) {
+    case TAG_CPRIM:
+        return nv;
+    case TAG_CVALUE:
+        t = cv_class(old);
+        if (t->vtable != NULL && t->vtable->relocate != NULL)
+            t->vtable->relocate(tagptr(old, TAG_CVALUE), nv);
+        return nv;
+    case TAG_VECTOR:
+        if (vector_size(nv) == 0)
+            return nv;
+        break;
+    case TAG_SYM:
+        if (((struct gensym *)n)->binding == UNBOUND)
+            return nv;
+        break;
+    }
+    gc_defer(nv);
+    return nv;
+}
+
+static void par_scan(value_t v)
+{
+    size_t i, n;
+
+    switch (tag(v)) {
+    case TAG_CONS:
+        car_(v) = par_visit(car_(v));
+        cdr_(v) = par_visit(cdr_(v));
+        break;
+    case TAG_VECTOR:
+        n = vector_size(v);
+        for (i = 0; i < n; i++)
+            vector_elt(v, i) = par_visit(vector_elt(v, i));
+        break;
+    case TAG_FUNCTION:
+        assert(!ismanaged(fn_name(v)));
+        fn_env(v) = par_visit(fn_env(v));
+        fn_vals(v) = par_visit(fn_vals(v));
+        fn_bcode(v) = par_visit(fn_bcode(v));
+        break;
+    case TAG_SYM:
+        ((struct gensym *)ptr(v))->binding =
+        par_visit(((struct gensym *)ptr(v))->binding);
+        break;
+    }
+}
+
+static int gc_any_work(void)
+{
+    int i;
+
+    for (i = 0; i < gc_nworkers; i++) {
+        if (__atomic_load_n(&gc_workers[i].top, __ATOMIC_SEQ_CST) <
+            __atomic_load_n(&gc_workers[i].bottom, __ATOMIC_SEQ_CST))
+            return 1;
+    }
+    return 0;
+}
+
+static value_t gc_steal_any(struct gc_worker *w)
+{
+    value_t v;
+    int i, k;
+
+    w->seed = w->seed * 1103515245 + 12345;
+    k = (int)((w->seed >> 16) % (uint32_t)gc_nworkers);
+    for (i = 0; i < gc_nworkers; i++, k = (k + 1) % gc_nworkers) {
+        if (&gc_workers[k] != w && (v = gc_steal(&gc_workers[k])))
+            return v;
+    }
+    return 0;
+}
+
+// Scan until every deque is empty and every worker is looking for
+// work, at which point none can turn up.
+static void gc_drain(struct gc_worker *w)
+{
+    value_t v;
+
+    for (;;) {
+        while (w->nlocal) {
+            if (w->nlocal > 1 &&
+                __atomic_load_n(&gc_idle, __ATOMIC_RELAXED) &&
+                __atomic_load_n(&w->top, __ATOMIC_RELAXED) >= w->bottom)
+                gc_share(w);
+            par_scan(w->local[--w->nlocal]);
+        }
+        if ((v = gc_take(w)) != 0 || (v = gc_steal_any(w)) != 0) {
+            par_scan(v);
+            continue;
+        }
+        __atomic_add_fetch(&gc_idle, 1, __ATOMIC_SEQ_CST);
+        for (;;) {
+            if (__atomic_load_n(&gc_idle, __ATOMIC_SEQ_CST) == gc_nworkers)
+                return;
+            if (gc_any_work()) {
+                __atomic_sub_fetch(&gc_idle, 1, __ATOMIC_SEQ_CST);
+                break;
+            }
+            sched_yield();
+        }
+    }
+}
+
+static void *gc_worker_main(void *arg)
+{
+    struct gc_worker *w = arg;
+
+    gc_self = w;
+    pthread_mutex_lock(&gc_lock);
+    for (;;) {
+        while (w->generation == gc_generation)
+            pthread_cond_wait(&gc_start, &gc_lock);
+        w->generation = gc_generation;
+        pthread_mutex_unlock(&gc_lock);
+        gc_drain(w);
+        pthread_mutex_lock(&gc_lock);
+        if (++gc_finished == (unsigned)gc_nworkers - 1)
+            pthread_cond_signal(&gc_done);
+    }
+    return NULL;
+}
+
+// Start the workers; the calling thread is worker 0. With fewer
+// threads than asked for we make do, down to collecting alone.
+static void parallel_init(void)
+{
+    long n;
+    int i;
+
+    n = fl_gc_threads;
+    if (n < 1)
+        n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1)
+        n = 1;
+    if (n > GC_MAX_THREADS)
+        n = GC_MAX_THREADS;
+    gc_workers = calloc((size_t)n, sizeof(*gc_workers));
+    if (gc_workers == NULL)
+        return;
+    for (i = 0; i < n; i++) {
+        gc_workers[i].seed = (uint32_t)i + 1;
+        if ((gc_workers[i].ring = gc_ring_new(1024)) == NULL)
+            break;
+        if (i > 0 && pthread_create(&gc_workers[i].thread, NULL,
+                                    gc_worker_main, &gc_workers[i])) {
+            free(gc_workers[i].ring);
+            break;
+        }
+    }
+    gc_nworkers = i;
+}
+
+// Heap space the mutator must leave free for buffer waste: less than
+// one small object per buffer, plus each thread's last buffer.
+static size_t parallel_reserve(size_t space)
+{
+    return space / (LAB_SIZE / LAB_MAX_OBJECT) +
+           (size_t)gc_nworkers * LAB_SIZE;
+}
+
+// Copy everything reachable into tospace, which has room bytes, from a
+// fromspace with used bytes allocated. Returns 0 without doing anything
+// if the waste might not fit, or if there are no workers to do it.
+static int parallel_copy(size_t used, size_t room)
+{
+    struct gc_worker *w;
+    struct gc_ring *r;
+    value_t v;
+    long k, n;
+    int i;
+
+    if (gc_nworkers < 1 || used + parallel_reserve(used) > room)
+        return 0;
+    for (i = 0; i < gc_nworkers; i++) {
+        w = &gc_workers[i];
+        w->top = w->bottom = 0;
+        w->nlocal = 0;
+        w->lab = w->labend = NULL;
+    }
+    gc_top = curheap;
+    gc_idle = 0;
+    gc_self = &gc_workers[0];
+    gc_visit = par_visit;
+    trace_roots();
+
+    // deal the evacuated roots round-robin to the other workers
+    w = &gc_workers[0];
+    while (w->nlocal) {
+        v = w->local[--w->nlocal];
+        if (!gc_push(w, v))
+            par_scan(v);
+    }
+    n = w->bottom - w->top;
+    for (k = n - n / gc_nworkers; k > 0; k--) {
+        v = gc_take(w);
+        if (!gc_push(&gc_workers[1 + k % (gc_nworkers - 1)], v))
+            par_scan(v);
+    }
+
+    pthread_mutex_lock(&gc_lock);
+    gc_finished = 0;
+    gc_generation++;
+    pthread_cond_broadcast(&gc_start);
+    pthread_mutex_unlock(&gc_lock);
+    gc_drain(w);
+    pthread_mutex_lock(&gc_lock);
+    while (gc_finished < (unsigned)gc_nworkers - 1)
+        pthread_cond_wait(&gc_done, &gc_lock);
+    pthread_mutex_unlock(&gc_lock);
+
+    gc_visit = relocate;
+    curheap = gc_top;
+    for (i = 0; i < gc_nworkers; i++) {
+        while ((r = gc_workers[i].ring->prev) != NULL) {
+            gc_workers[i].ring->prev = r->prev;
+            free(r);
+        }
+    }
+    return 1;
+}
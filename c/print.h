@@ -82,7 +82,7 @@ void print_traverse(value_t v)
         print_traverse(car_(v));
         v = cdr_(v);
     }
-    if (!ismanaged(v) || issymbol(v))
+    if ((!ismanaged(v) && !islarge(v)) || issymbol(v))
         return;
     if (ismarked(v)) {
         bp = (value_t *)ptrhash_bp(&pr.cycle_traversed, (void *)v);
@@ -386,7 +386,7 @@ static int write_cycle_prefix(struct ios *f, value_t v)
         }
         pr.column += ios_printf(f, "#%ld=", numval(label));
     }
-    if (ismanaged(v))
+    if (ismanaged(v) || islarge(v))
         unmark_cons(v);
     return 0;
 }
@@ -893,6 +893,7 @@ void print_with_options(struct ios *f, value_t v,
     if (pr.opts.level >= 0 || pr.opts.length >= 0) {
         memset(consflags, 0,
                4 * bitvector_nwords(heapsize / sizeof(struct cons)));
+        large_clear_printmarks();
     }
 
     if ((iscons(v) || isvector(v) || isfunction(v) || iscvalue(v)) &&
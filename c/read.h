@@ -464,7 +464,7 @@ static value_t vector_grow(value_t v)
     if (s > 0) {
         ((size_t *)ptr(v))[0] |= 0x1;
         vector_elt(v, 0) = newv;
-        gc(0);
+        full_gc();
     }
     return POP();
 }
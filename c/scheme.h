@@ -57,6 +57,9 @@ int isdigit_base(char c, int base);
 
 extern int locale_is_utf8;
 
+// select the fastest bulk routines for this CPU
+void u8_init(void);
+
 #ifdef _WIN32
 extern int wcwidth(uint32_t);
 #endif
@@ -209,6 +212,21 @@ typedef enum { bst_none, bst_rd, bst_wr } bufstate_t;
 
 #define IOS_INLSIZE 54
 #define IOS_BUFSIZE 131072
+#define IOS_INITBUFSIZE 4096  // fd streams start here and grow on demand
+
+struct ios;
+
+// a filter sits between a stream buffer and its fd and transforms the
+// data passing through, e.g. to compress it. read and write work like
+// read() and a complete write(), returning an errno value; close ends
+// the encoded data and frees the filter. pos counts decoded bytes.
+struct ios_filter {
+    int (*read)(struct ios *s, char *buf, size_t n, size_t *nread);
+    int (*write)(struct ios *s, const char *buf, size_t n,
+                 size_t *nwritten);
+    int (*close)(struct ios *s);
+    off_t pos;
+};
 
 struct ios {
     bufmode_t bm;
@@ -242,13 +260,29 @@ struct ios {
     // again any number of times. usually only true for files and strings.
     unsigned char rereadable : 1;
 
+    // buf is a read-only file mapping made by ios_mmap
+    unsigned char mapped : 1;
+
+    // buffer size was set by ios_bufsize; don't grow it
+    unsigned char fixedbuf : 1;
+
+    // transforms what goes to and from fd; NULL for plain streams
+    struct ios_filter *filter;
+
     char local[IOS_INLSIZE];
 };
 
+// one piece of a gather write
+struct ios_iovec {
+    const char *base;
+    size_t len;
+};
+
 // low-level interface functions
 size_t ios_read(struct ios *s, char *dest, size_t n);
 size_t ios_readall(struct ios *s, char *dest, size_t n);
 size_t ios_write(struct ios *s, const char *data, size_t n);
+size_t ios_writev(struct ios *s, const struct ios_iovec *v, size_t n);
 off_t ios_seek(struct ios *s, off_t pos);  // absolute seek
 off_t ios_seek_end(struct ios *s);
 off_t ios_skip(struct ios *s, off_t offs);  // relative seek
@@ -261,6 +295,7 @@ char *ios_takebuf(struct ios *s,
                   size_t *psize);  // release buffer to caller
 // set buffer space to use
 int ios_setbuf(struct ios *s, char *buf, size_t size, int own);
+int ios_bufsize(struct ios *s, size_t sz);
 int ios_bufmode(struct ios *s, bufmode_t mode);
 void ios_set_readonly(struct ios *s);
 size_t ios_copy(struct ios *to, struct ios *from, size_t nbytes);
@@ -279,6 +314,11 @@ struct ios *ios_mem(struct ios *s, size_t initsize);
 struct ios *ios_str(struct ios *s, char *str);
 struct ios *ios_static_buffer(struct ios *s, char *buf, size_t sz);
 struct ios *ios_fd(struct ios *s, long fd, int isfile, int own);
+int ios_mmap(struct ios *s);
+int ios_lz4(struct ios *s);
+// unbuffered fd I/O for filters
+int ios_fd_readall(long fd, void *buf, size_t n, size_t *nread);
+int ios_fd_writeall(long fd, const void *buf, size_t n, size_t *nwritten);
 // todo: ios_socket
 extern struct ios *ios_stdin;
 extern struct ios *ios_stdout;
@@ -406,8 +446,30 @@ int sendall(int sockfd, char *buffer, int bufLen, int flags);
 int readall(int sockfd, char *buffer, int bufLen, int flags);
 int socket_ready(int sock);
 
+value_t builtin_tcp_listen(value_t *args, uint32_t nargs);
+value_t builtin_tcp_accept(value_t *args, uint32_t nargs);
+value_t builtin_tcp_connect(value_t *args, uint32_t nargs);
+value_t builtin_socket_port(value_t *args, uint32_t nargs);
+value_t builtin_udp_listen(value_t *args, uint32_t nargs);
+value_t builtin_udp_connect(value_t *args, uint32_t nargs);
+value_t builtin_make_datagram_slab(value_t *args, uint32_t nargs);
+value_t builtin_datagram_count(value_t *args, uint32_t nargs);
+value_t builtin_datagram_ref(value_t *args, uint32_t nargs);
+value_t builtin_datagram_source(value_t *args, uint32_t nargs);
+value_t builtin_datagram_set(value_t *args, uint32_t nargs);
+value_t builtin_udp_receive(value_t *args, uint32_t nargs);
+value_t builtin_udp_send(value_t *args, uint32_t nargs);
+void socket_init(void);
+
+value_t builtin_make_event_loop(value_t *args, uint32_t nargs);
+value_t builtin_event_loop_add(value_t *args, uint32_t nargs);
+value_t builtin_event_loop_remove(value_t *args, uint32_t nargs);
+value_t builtin_wait_events(value_t *args, uint32_t nargs);
+void os_events_init(void);
+
 //// #include "timefuncs.h"
 
+double clock_now(void);
 uint64_t i64time();
 void sleep_ms(int ms);
 void timeparts(int32_t *buf, double t);
@@ -426,6 +488,22 @@ uint32_t int64to32hash(uint64_t key);
 uint64_t memhash(const char *buf, size_t n);
 uint32_t memhash32(const char *buf, size_t n);
 
+//// #include "memsearch.h"
+
+// a needle preprocessed for two-way string matching
+struct memsearch {
+    size_t len;
+    size_t critical;
+    size_t period;
+    size_t memory;
+    size_t byteset[256 / (8 * sizeof(size_t))];
+    size_t shift[256];
+};
+
+void memsearch_init(struct memsearch *m, const char *needle, size_t len);
+const char *memsearch(const struct memsearch *m, const char *needle,
+                      const char *haystack, size_t haylen);
+
 //// #include "htable.h"
 
 #define HT_N_INLINE 32
@@ -661,13 +739,25 @@ struct gensym {
         (((value_t *)ptr(v))[1] = to);      \
     } while (0)
 
+// Read barrier for the incremental collector (see incremental.h): while
+// a collection is under way, a slot that points into the space being
+// evacuated is updated to the object's new copy before it is used.
+// fl_oldsize is 0 the rest of the time.
+extern uintptr_t fl_oldspace;
+extern size_t fl_oldsize;
+value_t *fl_gc_forward(value_t *slot);
+#define fl_slot(p)                                             \
+    (__unlikely((uintptr_t)*(p) - fl_oldspace < fl_oldsize) ? \
+     fl_gc_forward(p) :                                        \
+     (p))
+
 #define vector_size(v) (((size_t *)ptr(v))[0] >> 2)
 #define vector_setsize(v, n) (((size_t *)ptr(v))[0] = ((n) << 2))
-#define vector_elt(v, i) (((value_t *)ptr(v))[1 + (i)])
+#define vector_elt(v, i) (*fl_slot(&((value_t *)ptr(v))[1 + (i)]))
 #define vector_grow_amt(x) ((x) < 8 ? 5 : 6 * ((x) >> 3))
 // functions ending in _ are unsafe, faster versions
-#define car_(v) (((struct cons *)ptr(v))->car)
-#define cdr_(v) (((struct cons *)ptr(v))->cdr)
+#define car_(v) (*fl_slot(&((struct cons *)ptr(v))->car))
+#define cdr_(v) (*fl_slot(&((struct cons *)ptr(v))->cdr))
 #define car(v) (tocons((v), "car")->car)
 #define cdr(v) (tocons((v), "cdr")->cdr)
 #define fn_bcode(f) (((value_t *)ptr(f))[0])
@@ -778,7 +868,7 @@ extern value_t fl_lasterror;
 void fl_savestate(struct fl_exception_context *_ctx);
 void fl_restorestate(struct fl_exception_context *_ctx);
 extern value_t ArgError, IOError, KeyError, MemoryError, EnumerationError;
-extern value_t UnboundError;
+extern value_t UnboundError, ParseError;
 
 struct cvtable {
     void (*print)(value_t self, struct ios *f);
@@ -919,6 +1009,7 @@ int fl_isnumber(value_t v);
 int fl_isgensym(value_t v);
 int fl_isiostream(value_t v);
 struct ios *fl_toiostream(value_t v, const char *fname);
+value_t fl_iostream_fd(long fd);
 value_t cvalue_compare(value_t a, value_t b);
 int numeric_compare(value_t a, value_t b, int eq, int eqnans, char *fname);
 
@@ -964,6 +1055,35 @@ value_t fl_hash(value_t *args, uint32_t nargs);
 value_t cvalue_byte(value_t *args, uint32_t nargs);
 value_t cvalue_wchar(value_t *args, uint32_t nargs);
 
+// Collectors selectable before fl_init(): two copying semispaces, a
+// single heap compacted in place (see compact.h), copying with
+// fl_gc_threads threads, 0 meaning one per CPU (see parallel.h), or
+// copying in slices of about fl_gc_pause microseconds (see
+// incremental.h).
+#define GC_COPY 0
+#define GC_COMPACT 1
+#define GC_PARALLEL 2
+#define GC_INCREMENTAL 3
+extern int fl_gc_mode;
+extern int fl_gc_threads;
+extern int fl_gc_pause;
+extern struct ios *fl_gc_log;  // a line per collection, if not NULL
+
+// Heap sizing, also set before fl_init(). After a collection the heap
+// grows by a factor of fl_heap_growth until live data takes up no more
+// than fl_heap_occupancy percent of it, and shrinks back a step at a
+// time, not below its initial size, when they have used much less for
+// a while. It never grows past fl_heap_max bytes (0 for no limit);
+// allocation raises memory-error instead.
+extern size_t fl_heap_max;
+extern double fl_heap_growth;
+extern int fl_heap_occupancy;
+
+// Vectors of at least fl_large_object bytes (0 for none) are allocated
+// outside the heap, are never moved, and count against fl_heap_max on
+// their own. The incremental collector ignores this.
+extern size_t fl_large_object;
+
 void fl_init(size_t initial_heapsize);
 int fl_load_boot_image(void);
 
@@ -1065,9 +1185,22 @@ value_t builtin_term_init(value_t *args, uint32_t nargs);
 value_t builtin_term_exit(value_t *args, uint32_t nargs);
 
 value_t builtin_spawn(value_t *args, uint32_t nargs);
+value_t builtin_spawn_process(value_t *args, uint32_t nargs);
+value_t builtin_spawn_pipeline(value_t *args, uint32_t nargs);
+value_t builtin_process_wait(value_t *args, uint32_t nargs);
+value_t builtin_process_wait_any(value_t *args, uint32_t nargs);
+void os_process_init(void);
+value_t builtin_open_directory_walker(value_t *args, uint32_t nargs);
+value_t builtin_read_directory_walker(value_t *args, uint32_t nargs);
+value_t builtin_close_directory_walker(value_t *args, uint32_t nargs);
+value_t builtin_walk_directory(value_t *args, uint32_t nargs);
+void os_walk_init(void);
 
 value_t builtin_read_ini_file(value_t *args, uint32_t nargs);
 
+value_t builtin_read_csv_row(value_t *args, uint32_t nargs);
+value_t builtin_csv_for_each(value_t *args, uint32_t nargs);
+
 value_t builtin_file_exists(value_t *args, uint32_t nargs);
 
 value_t builtin_get_environment_variables(value_t *args, uint32_t nargs);
@@ -1079,6 +1212,7 @@ value_t builtin_set_environment_variable(value_t *args, uint32_t nargs);
 value_t fl_stringp(value_t *args, uint32_t nargs);
 value_t fl_string_reverse(value_t *args, uint32_t nargs);
 value_t builtin_string_split(value_t *args, uint32_t nargs);
+void string_index_forget(const char *data);
 value_t fl_string_sub(value_t *args, uint32_t nargs);
 
 // util.c
@@ -3,8 +3,12 @@
 #include <sys/select.h>
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <arpa/inet.h>
 
 #include <assert.h>
 #include <errno.h>
@@ -21,17 +25,10 @@
 
 #include "scheme.h"
 
+// the kernel's own buffer sizing does better than any fixed size here
 int mysocket(int domain, int type, int protocol)
 {
-    int val;
-    int s = socket(domain, type, protocol);
-    if (s < 0)
-        return s;
-    val = 4096;
-    setsockopt(s, SOL_SOCKET, SO_RCVBUF, (char *)&val, sizeof(int));
-    val = 4096;
-    setsockopt(s, SOL_SOCKET, SO_SNDBUF, (char *)&val, sizeof(int));
-    return s;
+    return socket(domain, type, protocol);
 }
 
 void set_nonblock(int socket, int yes)
@@ -48,21 +45,23 @@ void set_nonblock(int socket, int yes)
 /* returns a socket on which to accept() connections */
 int open_tcp_port(short portno)
 {
-    int sockfd;
+    int sockfd, yes = 1;
     struct sockaddr_in serv_addr;
 
     sockfd = mysocket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
     if (sockfd < 0)
         return -1;
+    (void)setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(int));
     memset(&serv_addr, 0, sizeof(serv_addr));
     serv_addr.sin_family = AF_INET;
     serv_addr.sin_addr.s_addr = htonl(INADDR_ANY);
     serv_addr.sin_port = htons(portno);
     if (bind(sockfd, (struct sockaddr *)&serv_addr, sizeof(serv_addr)) < 0) {
+        closesocket(sockfd);
         return -1;
     }
 
-    listen(sockfd, 4);
+    listen(sockfd, SOMAXCONN);
     return sockfd;
 }
 
@@ -118,6 +117,13 @@ int open_any_udp_port(short *portno)
 void closesocket(int fd) { close(fd); }
 #endif
 
+static void set_nodelay(int sockfd)
+{
+    int yes = 1;
+
+    (void)setsockopt(sockfd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(int));
+}
+
 /* returns a socket to use to send data to the given address */
 int connect_to_host(char *hostname, short portno)
 {
@@ -223,3 +229,480 @@ int socket_ready(int sock)
     select(sock + 1, &fds, NULL, NULL, &timeout);
     return FD_ISSET(sock, &fds);
 }
+
+static short toportno(value_t v, const char *fname)
+{
+    size_t portno;
+
+    portno = toulong(v, (char *)fname);
+    if (portno > 65535)
+        lerrorf(ArgError, "%s: port number out of range", fname);
+    return (short)portno;
+}
+
+// Sockets are wrapped in ordinary fd streams. The listening socket is
+// non-blocking so that tcp-accept can be driven by an event loop;
+// connected sockets block, but one read on a socket that an event loop
+// reported readable always returns at once (see io.readsome).
+
+value_t builtin_tcp_listen(value_t *args, uint32_t nargs)
+{
+    int sockfd;
+
+    argcount("tcp-listen", nargs, 1);
+    sockfd = open_tcp_port(toportno(args[0], "tcp-listen"));
+    if (sockfd < 0)
+        lerrorf(IOError, "tcp-listen: %s", strerror(errno));
+    set_nonblock(sockfd, 1);
+    return fl_iostream_fd(sockfd);
+}
+
+value_t builtin_tcp_accept(value_t *args, uint32_t nargs)
+{
+    struct ios *s;
+    int sockfd;
+
+    argcount("tcp-accept", nargs, 1);
+    s = fl_toiostream(args[0], "tcp-accept");
+    if ((sockfd = accept((int)s->fd, NULL, NULL)) < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ||
+            errno == ECONNABORTED)
+            return FL_F;
+        lerrorf(IOError, "tcp-accept: %s", strerror(errno));
+    }
+    set_nonblock(sockfd, 0);
+    set_nodelay(sockfd);
+    return fl_iostream_fd(sockfd);
+}
+
+value_t builtin_tcp_connect(value_t *args, uint32_t nargs)
+{
+    char *host;
+    int sockfd;
+
+    argcount("tcp-connect", nargs, 2);
+    host = tostring(args[0], "tcp-connect");
+    sockfd = connect_to_host(host, toportno(args[1], "tcp-connect"));
+    if (sockfd < 0)
+        lerrorf(IOError, "tcp-connect: could not connect to %s", host);
+    set_nodelay(sockfd);
+    return fl_iostream_fd(sockfd);
+}
+
+value_t builtin_socket_port(value_t *args, uint32_t nargs)
+{
+    struct sockaddr_in addr;
+    socklen_t len;
+    struct ios *s;
+
+    argcount("socket-port", nargs, 1);
+    s = fl_toiostream(args[0], "socket-port");
+    len = sizeof(addr);
+    if (getsockname((int)s->fd, (struct sockaddr *)&addr, &len) < 0)
+        lerrorf(IOError, "socket-port: %s", strerror(errno));
+    return fixnum(ntohs(addr.sin_port));
+}
+
+// UDP sockets move datagrams in batches through a datagram slab: a
+// fixed number of equal-sized slots in one preallocated block, with the
+// length and peer address of each datagram alongside. A socket from
+// udp-connect sends to its peer; any other sends each datagram to the
+// address of its slot, so that a datagram received into a slot goes
+// back where it came from unless datagram-set! is given another one.
+// On Linux a whole
+// slab is received with one recvmmsg() and sent with one sendmmsg(),
+// using message headers built once when the slab is made; elsewhere we
+// fall back to a recvfrom() or sendto() per datagram.
+
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+#define USE_MMSG
+#endif
+
+struct datagram_slab {
+    size_t count;  // number of slots
+    size_t size;   // bytes per slot
+    size_t used;   // slots holding a datagram
+    char *data;
+    size_t *lens;
+    struct sockaddr_in *addrs;
+#ifdef USE_MMSG
+    struct mmsghdr *msgs;
+    struct iovec *iovs;
+#endif
+};
+
+static value_t slabsym;
+static struct fltype *slabtype;
+
+static struct datagram_slab *toslab(value_t v, const char *fname)
+{
+    if (!iscvalue(v) || cv_class((struct cvalue *)ptr(v)) != slabtype)
+        type_error((char *)fname, "datagram-slab", v);
+    return value2c(struct datagram_slab *, v);
+}
+
+// The slot args[1] of the slab args[0], which must come before slot n.
+static size_t toslot(value_t *args, size_t n, const char *fname)
+{
+    size_t i;
+
+    i = toulong(args[1], (char *)fname);
+    if (i >= n)
+        bounds_error(fname, args[0], args[1]);
+    return i;
+}
+
+static int udp_socket(void)
+{
+    int sockfd;
+
+    if ((sockfd = mysocket(PF_INET, SOCK_DGRAM, 0)) < 0)
+        return -1;
+#ifdef FD_CLOEXEC
+    fcntl(sockfd, F_SETFD, FD_CLOEXEC);
+#endif
+    return sockfd;
+}
+
+// (udp-listen port) returns a socket bound to port on all interfaces.
+// Port 0 picks any free port; socket-port tells which.
+value_t builtin_udp_listen(value_t *args, uint32_t nargs)
+{
+    struct sockaddr_in addr;
+    int sockfd;
+
+    argcount("udp-listen", nargs, 1);
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(toportno(args[0], "udp-listen"));
+    if ((sockfd = udp_socket()) < 0)
+        lerrorf(IOError, "udp-listen: %s", strerror(errno));
+    if (bind(sockfd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        closesocket(sockfd);
+        lerrorf(IOError, "udp-listen: %s", strerror(errno));
+    }
+    return fl_iostream_fd(sockfd);
+}
+
+// (udp-connect host port) returns a socket whose datagrams go to
+// host:port. It can also receive replies from there.
+value_t builtin_udp_connect(value_t *args, uint32_t nargs)
+{
+    struct sockaddr_in addr;
+    struct hostent *host_info;
+    char *host;
+    int sockfd;
+
+    argcount("udp-connect", nargs, 2);
+    host = tostring(args[0], "udp-connect");
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_port = htons(toportno(args[1], "udp-connect"));
+    if (!(host_info = gethostbyname(host)) ||
+        host_info->h_addrtype != AF_INET)
+        lerrorf(IOError, "udp-connect: cannot resolve %s", host);
+    addr.sin_family = AF_INET;
+    memcpy(&addr.sin_addr, host_info->h_addr, sizeof(addr.sin_addr));
+    if ((sockfd = udp_socket()) < 0)
+        lerrorf(IOError, "udp-connect: %s", strerror(errno));
+    if (connect(sockfd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        closesocket(sockfd);
+        lerrorf(IOError, "udp-connect: could not connect to %s", host);
+    }
+    return fl_iostream_fd(sockfd);
+}
+
+// (make-datagram-slab count size) makes room for count datagrams of up
+// to size bytes each.
+value_t builtin_make_datagram_slab(value_t *args, uint32_t nargs)
+{
+    struct datagram_slab *slab;
+    size_t count, size;
+    value_t v;
+
+    argcount("make-datagram-slab", nargs, 2);
+    count = toulong(args[0], "make-datagram-slab");
+    size = toulong(args[1], "make-datagram-slab");
+    if (!count || !size || count > 65536 || size > 65536)
+        lerror(ArgError, "make-datagram-slab: bad slab dimensions");
+    v = cvalue(slabtype, sizeof(struct datagram_slab));
+    slab = value2c(struct datagram_slab *, v);
+    memset(slab, 0, sizeof(*slab));
+    slab->count = count;
+    slab->size = size;
+    slab->data = malloc(count * size);
+    slab->lens = calloc(count, sizeof(*slab->lens));
+    slab->addrs = calloc(count, sizeof(*slab->addrs));
+#ifdef USE_MMSG
+    slab->msgs = calloc(count, sizeof(*slab->msgs));
+    slab->iovs = calloc(count, sizeof(*slab->iovs));
+    if (slab->msgs && slab->iovs && slab->data) {
+        size_t i;
+
+        for (i = 0; i < count; i++) {
+            slab->iovs[i].iov_base = slab->data + i * size;
+            slab->iovs[i].iov_len = size;
+            slab->msgs[i].msg_hdr.msg_iov = &slab->iovs[i];
+            slab->msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+    if (!slab->msgs || !slab->iovs)
+        slab->count = 0;
+#endif
+    if (!slab->data || !slab->lens || !slab->addrs)
+        slab->count = 0;
+    if (!slab->count)
+        lerror(MemoryError, "make-datagram-slab: out of memory");
+    return v;
+}
+
+// (datagram-count slab) is the number of datagrams in the slab: those
+// received by the last udp-receive!, or set by datagram-set!.
+value_t builtin_datagram_count(value_t *args, uint32_t nargs)
+{
+    argcount("datagram-count", nargs, 1);
+    return size_wrap(toslab(args[0], "datagram-count")->used);
+}
+
+value_t builtin_datagram_ref(value_t *args, uint32_t nargs)
+{
+    struct datagram_slab *slab;
+    value_t v;
+    size_t i;
+
+    argcount("datagram-ref", nargs, 2);
+    slab = toslab(args[0], "datagram-ref");
+    i = toslot(args, slab->used, "datagram-ref");
+    v = cvalue_string(slab->lens[i]);
+    slab = value2c(struct datagram_slab *, args[0]);
+    memcpy(cvalue_data(v), slab->data + i * slab->size, slab->lens[i]);
+    return v;
+}
+
+// (datagram-source slab i) is the (address . port) a received datagram
+// came from.
+value_t builtin_datagram_source(value_t *args, uint32_t nargs)
+{
+    struct datagram_slab *slab;
+    char buf[INET_ADDRSTRLEN];
+    value_t v;
+    size_t i;
+    int port;
+
+    argcount("datagram-source", nargs, 2);
+    slab = toslab(args[0], "datagram-source");
+    i = toslot(args, slab->used, "datagram-source");
+    if (!inet_ntop(AF_INET, &slab->addrs[i].sin_addr, buf, sizeof(buf)))
+        buf[0] = '\0';
+    port = ntohs(slab->addrs[i].sin_port);
+    v = string_from_cstr(buf);
+    return fl_cons(v, fixnum(port));
+}
+
+// (datagram-set! slab i data [dest]) puts a datagram in slot i for
+// sending and makes sure the slab's count covers it. dest is an
+// (address . port) to send it to from a socket that isn't connected,
+// such as one from datagram-source.
+value_t builtin_datagram_set(value_t *args, uint32_t nargs)
+{
+    struct datagram_slab *slab;
+    struct sockaddr_in addr;
+    struct hostent *host_info;
+    char *data, *host;
+    size_t i, len;
+
+    if (nargs < 3 || nargs > 4)
+        argcount("datagram-set!", nargs, nargs < 3 ? 3 : 4);
+    slab = toslab(args[0], "datagram-set!");
+    i = toslot(args, slab->count, "datagram-set!");
+    to_sized_ptr(args[2], "datagram-set!", &data, &len);
+    if (len > slab->size)
+        lerror(ArgError, "datagram-set!: datagram too big for slab");
+    if (nargs > 3) {
+        if (!iscons(args[3]))
+            type_error("datagram-set!", "cons", args[3]);
+        host = tostring(car_(args[3]), "datagram-set!");
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_port = htons(toportno(cdr_(args[3]), "datagram-set!"));
+        if (!(host_info = gethostbyname(host)) ||
+            host_info->h_addrtype != AF_INET)
+            lerrorf(IOError, "datagram-set!: cannot resolve %s", host);
+        addr.sin_family = AF_INET;
+        memcpy(&addr.sin_addr, host_info->h_addr, sizeof(addr.sin_addr));
+        slab->addrs[i] = addr;
+    }
+    memcpy(slab->data + i * slab->size, data, len);
+    slab->lens[i] = len;
+    if (slab->used < i + 1)
+        slab->used = i + 1;
+    return args[0];
+}
+
+#ifdef USE_MMSG
+static int slab_recv(int fd, struct datagram_slab *slab)
+{
+    size_t i;
+    int n;
+
+    for (i = 0; i < slab->count; i++) {
+        slab->iovs[i].iov_len = slab->size;
+        slab->msgs[i].msg_hdr.msg_name = &slab->addrs[i];
+        slab->msgs[i].msg_hdr.msg_namelen = sizeof(slab->addrs[i]);
+    }
+    do
+        n = recvmmsg(fd, slab->msgs, slab->count, MSG_WAITFORONE, NULL);
+    while (n < 0 && errno == EINTR);
+    for (i = 0; (int)i < n; i++)
+        slab->lens[i] = slab->msgs[i].msg_len;
+    return n;
+}
+
+static int slab_send(int fd, struct datagram_slab *slab, size_t count,
+                     int connected)
+{
+    size_t i;
+    int n;
+
+    for (i = 0; i < count; i++) {
+        slab->iovs[i].iov_len = slab->lens[i];
+        slab->msgs[i].msg_hdr.msg_name = connected ? NULL : &slab->addrs[i];
+        slab->msgs[i].msg_hdr.msg_namelen =
+        connected ? 0 : sizeof(slab->addrs[i]);
+    }
+    for (i = 0; i < count; i += n) {
+        n = sendmmsg(fd, slab->msgs + i, count - i, 0);
+        if (n < 0 && errno == EINTR)
+            n = 0;
+        else if (n < 0)
+            return i ? (int)i : -1;
+    }
+    return (int)i;
+}
+#else
+static int slab_recv(int fd, struct datagram_slab *slab)
+{
+    socklen_t addrlen;
+    ssize_t len;
+    size_t i;
+
+    len = 0;
+    for (i = 0; i < slab->count; i++) {
+        addrlen = sizeof(slab->addrs[i]);
+        do
+            len = recvfrom(fd, slab->data + i * slab->size, slab->size,
+                           i ? MSG_DONTWAIT : 0,
+                           (struct sockaddr *)&slab->addrs[i], &addrlen);
+        while (len < 0 && errno == EINTR);
+        if (len < 0)
+            break;
+        slab->lens[i] = (size_t)len;
+    }
+    if (!i && len < 0)
+        return -1;
+    return (int)i;
+}
+
+static int slab_send(int fd, struct datagram_slab *slab, size_t count,
+                     int connected)
+{
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (sendto(fd, slab->data + i * slab->size, slab->lens[i], 0,
+                   connected ? NULL : (struct sockaddr *)&slab->addrs[i],
+                   connected ? 0 : sizeof(slab->addrs[i])) < 0) {
+            if (errno == EINTR) {
+                i--;
+                continue;
+            }
+            return i ? (int)i : -1;
+        }
+    }
+    return (int)i;
+}
+#endif
+
+// (udp-receive! s slab) waits for at least one datagram and fills the
+// slab with as many as are waiting, returning how many. A non-blocking
+// socket with nothing waiting gives 0.
+value_t builtin_udp_receive(value_t *args, uint32_t nargs)
+{
+    struct datagram_slab *slab;
+    struct ios *s;
+    int n;
+
+    argcount("udp-receive!", nargs, 2);
+    s = fl_toiostream(args[0], "udp-receive!");
+    slab = toslab(args[1], "udp-receive!");
+    if ((n = slab_recv((int)s->fd, slab)) < 0) {
+        slab->used = 0;
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return fixnum(0);
+        lerrorf(IOError, "udp-receive!: %s", strerror(errno));
+    }
+    slab->used = (size_t)n;
+    return fixnum(n);
+}
+
+// (udp-send! s slab [count]) sends the first count datagrams of the
+// slab, by default all of them, and returns how many were sent.
+value_t builtin_udp_send(value_t *args, uint32_t nargs)
+{
+    struct datagram_slab *slab;
+    struct sockaddr_in peer;
+    socklen_t peerlen;
+    struct ios *s;
+    size_t count;
+    int n, connected;
+
+    if (nargs < 2 || nargs > 3)
+        argcount("udp-send!", nargs, nargs < 2 ? 2 : 3);
+    s = fl_toiostream(args[0], "udp-send!");
+    slab = toslab(args[1], "udp-send!");
+    count = slab->used;
+    if (nargs > 2 && (count = toulong(args[2], "udp-send!")) > slab->used)
+        lerror(ArgError, "udp-send!: count exceeds datagrams in slab");
+    peerlen = sizeof(peer);
+    connected =
+    !getpeername((int)s->fd, (struct sockaddr *)&peer, &peerlen);
+    if ((n = slab_send((int)s->fd, slab, count, connected)) < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+            return fixnum(0);
+        lerrorf(IOError, "udp-send!: %s", strerror(errno));
+    }
+    return fixnum(n);
+}
+
+static void print_slab(value_t v, struct ios *f)
+{
+    struct datagram_slab *slab;
+    char buf[64];
+
+    slab = value2c(struct datagram_slab *, v);
+    snprintf(buf, sizeof(buf), "#<datagram-slab %lu/%lu>",
+             (unsigned long)slab->used, (unsigned long)slab->count);
+    fl_print_str(buf, f);
+}
+
+static void free_slab(value_t self)
+{
+    struct datagram_slab *slab;
+
+    slab = value2c(struct datagram_slab *, self);
+    free(slab->data);
+    free(slab->lens);
+    free(slab->addrs);
+#ifdef USE_MMSG
+    free(slab->msgs);
+    free(slab->iovs);
+#endif
+}
+
+static struct cvtable slab_vtable = { print_slab, NULL, free_slab, NULL };
+
+void socket_init(void)
+{
+    slabsym = symbol("datagram-slab");
+    slabtype = define_opaque_type(slabsym, sizeof(struct datagram_slab),
+                                  &slab_vtable, NULL);
+}
@@ -0,0 +1,162 @@
+// Memory for the heap spaces. Each space is a range of address space
+// reserved up front with mmap, big enough for any size the heap may
+// grow to, of which only the first size bytes are usable. Resizing a
+// space then never moves it or copies what it holds, and shrinking
+// gives the memory back. The ranges are aligned for huge pages and
+// marked with MADV_HUGEPAGE, so a big heap takes fewer TLB entries.
+// space_discard() drops pages whose contents are dead, such as the part
+// of tospace the next collection likely won't reach; they come back
+// zeroed when touched.
+//
+// Where address space is limited, as by ulimit -v, the reservations are
+// halved until two spaces fit with as much again to spare, but not below
+// the initial heap size. Failing that, and always on Windows, a space is
+// plain malloc memory of exactly its size.
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#define SPACE_ALIGN ((size_t)2 << 20)  // a huge page on most machines
+#define SPACE_PAGE ((size_t)4096)
+
+static size_t space_reserved;  // bytes reserved for each space, or 0
+
+// Reserve enough for spaces of max bytes, SIZE_MAX meaning no limit,
+// but at least min, and return the size spaces can actually grow to.
+static size_t space_init(size_t max, size_t min)
+{
+#ifdef _WIN32
+    (void)min;
+    return max;
+#else
+    size_t want, probe;
+    void *p;
+
+    want = max;
+    if (want == SIZE_MAX)
+        want = sizeof(void *) > 4 ? (size_t)1 << 36 : (size_t)1 << 28;
+    if (min > want)
+        min = want;
+    for (;;) {
+        space_reserved = (want + SPACE_ALIGN - 1) & ~(SPACE_ALIGN - 1);
+        probe = 4 * (space_reserved + SPACE_ALIGN);
+        p = mmap(NULL, probe, PROT_NONE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (p != MAP_FAILED) {
+            munmap(p, probe);
+            return want;
+        }
+        if (want <= min)
+            break;
+        want = (want / 2) & ~(SPACE_PAGE - 1);
+        if (want < min)
+            want = min;
+    }
+    space_reserved = 0;
+    return max;
+#endif
+}
+
+#ifndef _WIN32
+// Make the first size bytes of a reserved space usable, and return the
+// rest to the system.
+static int space_commit(unsigned char *p, size_t oldsize, size_t size)
+{
+    oldsize = (oldsize + SPACE_PAGE - 1) & ~(SPACE_PAGE - 1);
+    size = (size + SPACE_PAGE - 1) & ~(SPACE_PAGE - 1);
+    if (size > oldsize)
+        return !mprotect(p + oldsize, size - oldsize, PROT_READ | PROT_WRITE);
+    if (size < oldsize) {
+        madvise(p + size, oldsize - size, MADV_DONTNEED);
+        mprotect(p + size, oldsize - size, PROT_NONE);
+    }
+    return 1;
+}
+#endif
+
+// A new space of the given size, or NULL.
+static unsigned char *space_new(size_t size)
+{
+#ifdef _WIN32
+    return malloc(size);
+#else
+    unsigned char *p, *q;
+    size_t head;
+
+    if (!space_reserved)
+        return malloc(size);
+    if (size > space_reserved)
+        return NULL;
+    p = mmap(NULL, space_reserved + SPACE_ALIGN, PROT_NONE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED)
+        return NULL;
+    q = (unsigned char *)(((uintptr_t)p + SPACE_ALIGN - 1) &
+                          ~(uintptr_t)(SPACE_ALIGN - 1));
+    head = (size_t)(q - p);
+    if (head)
+        munmap(p, head);
+    munmap(q + space_reserved, SPACE_ALIGN - head);
+#ifdef MADV_HUGEPAGE
+    madvise(q, space_reserved, MADV_HUGEPAGE);
+#endif
+    if (!space_commit(q, 0, size)) {
+        munmap(q, space_reserved);
+        return NULL;
+    }
+    return q;
+#endif
+}
+
+static void space_free(unsigned char *p)
+{
+#ifdef _WIN32
+    free(p);
+#else
+    if (!space_reserved)
+        free(p);
+    else
+        munmap(p, space_reserved);
+#endif
+}
+
+// Resize a space in place, keeping what it holds. Returns 0 if we
+// can't, which on Windows is always.
+static int space_adjust(unsigned char *p, size_t oldsize, size_t size)
+{
+#ifdef _WIN32
+    (void)p;
+    (void)oldsize;
+    (void)size;
+    return 0;
+#else
+    return size <= space_reserved && space_commit(p, oldsize, size);
+#endif
+}
+
+// Give a space whose contents are dead a new size. Returns NULL, with
+// the space as it was, if we can't.
+static unsigned char *space_resize(unsigned char *p, size_t oldsize,
+                                   size_t size)
+{
+    unsigned char *q;
+
+    if (space_adjust(p, oldsize, size))
+        return p;
+    if (!(q = space_new(size)))
+        return NULL;
+    space_free(p);
+    return q;
+}
+
+static void space_discard(unsigned char *p, size_t size)
+{
+#ifdef _WIN32
+    (void)p;
+    (void)size;
+#else
+    if (space_reserved)
+        madvise(p, size & ~(SPACE_PAGE - 1), MADV_DONTNEED);
+#endif
+}
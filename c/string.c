@@ -25,8 +25,153 @@ value_t fl_stringp(value_t *args, uint32_t nargs)
     return fl_isstring(args[0]) ? FL_T : FL_F;
 }
 
+// Character index for large strings
+//
+// Strings are UTF-8, so finding a character by number means scanning
+// from the start. Strings too big to be inlined in the heap live in
+// malloc'd storage that the collector never moves, so their data pointer
+// names them until they are freed. For recently used strings of that
+// kind a small direct-mapped cache records whether the string is pure
+// ASCII and, if not, the byte offset of every STRING_INDEX_STRIDE'th
+// character. Positions then cost a table lookup plus a short scan.
+
+#define STRING_INDEX_STRIDE 64
+#define STRING_INDEX_SLOTS 64
+
+struct string_index {
+    const char *data;
+    size_t len;
+    size_t nchars;
+    int ascii;
+    size_t nmarks;
+    size_t *marks;
+};
+
+static struct string_index *string_index_cache[STRING_INDEX_SLOTS];
+
+// advance past one character the same way string.inc does
+#define u8_step(s, i) \
+    (void)(isutf(s[++(i)]) || isutf(s[++(i)]) || isutf(s[++(i)]) || ++(i))
+
+static int mem_isascii(const char *s, size_t n)
+{
+    uint64_t w, acc;
+    size_t i;
+
+    acc = 0;
+    for (i = 0; i + sizeof(w) <= n; i += sizeof(w)) {
+        memcpy(&w, s + i, sizeof(w));
+        acc |= w;
+    }
+    for (; i < n; i++)
+        acc |= (unsigned char)s[i];
+    return !(acc & 0x8080808080808080ULL);
+}
+
+static struct string_index *string_index_build(const char *s, size_t len)
+{
+    struct string_index *idx;
+    size_t i, c, nchars, nmarks;
+    int ascii;
+
+    nchars = len;
+    nmarks = 0;
+    if (!(ascii = mem_isascii(s, len))) {
+        for (nchars = i = 0; i < len; nchars++)
+            u8_step(s, i);
+        nmarks = (nchars + STRING_INDEX_STRIDE - 1) / STRING_INDEX_STRIDE;
+    }
+    idx = malloc(sizeof(*idx) + nmarks * sizeof(size_t));
+    if (idx == NULL)
+        return NULL;
+    idx->data = s;
+    idx->len = len;
+    idx->nchars = nchars;
+    idx->ascii = ascii;
+    idx->nmarks = nmarks;
+    idx->marks = (size_t *)(idx + 1);
+    if (!ascii) {
+        for (c = i = 0; i < len; c++) {
+            if (c % STRING_INDEX_STRIDE == 0)
+                idx->marks[c / STRING_INDEX_STRIDE] = i;
+            u8_step(s, i);
+        }
+    }
+    return idx;
+}
+
+// Returns NULL for strings that are cheap enough to scan or that may
+// move, in which case callers fall back to scanning.
+static struct string_index *string_index(value_t str)
+{
+    struct string_index **slot;
+    struct cvalue *cv;
+    const char *s;
+    size_t len;
+
+    cv = (struct cvalue *)ptr(str);
+    s = cv_data(cv);
+    len = cv_len(cv);
+    if (isinlined(cv) || !owned(cv) || len < STRING_INDEX_STRIDE)
+        return NULL;
+    slot = &string_index_cache[inthash((uintptr_t)s) % STRING_INDEX_SLOTS];
+    if (*slot && (*slot)->data == s && (*slot)->len == len)
+        return *slot;
+    free(*slot);
+    return (*slot = string_index_build(s, len));
+}
+
+void string_index_forget(const char *data)
+{
+    struct string_index **slot;
+
+    slot = &string_index_cache[inthash((uintptr_t)data) % STRING_INDEX_SLOTS];
+    if (*slot && (*slot)->data == data) {
+        free(*slot);
+        *slot = NULL;
+    }
+}
+
+// byte offset of character number c
+static size_t string_index_offset(struct string_index *idx, size_t c)
+{
+    size_t i;
+
+    if (idx->ascii)
+        return c;
+    if (c >= idx->nchars)
+        return idx->len;
+    i = idx->marks[c / STRING_INDEX_STRIDE];
+    for (c %= STRING_INDEX_STRIDE; c; c--)
+        u8_step(idx->data, i);
+    return i;
+}
+
+// number of characters that start before byte offset i
+static size_t string_index_charnum(struct string_index *idx, size_t i)
+{
+    size_t lo, hi, mid, c, j;
+
+    if (idx->ascii)
+        return i;
+    lo = 0;
+    hi = idx->nmarks;
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (idx->marks[mid] <= i)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    c = lo * STRING_INDEX_STRIDE;
+    for (j = idx->marks[lo]; j < i; c++)
+        u8_step(idx->data, j);
+    return c;
+}
+
 value_t fl_string_count(value_t *args, uint32_t nargs)
 {
+    struct string_index *idx;
     char *str;
     size_t start, len, stop;
 
@@ -50,6 +195,9 @@ value_t fl_string_count(value_t *args, uint32_t nargs)
         }
     }
     str = cvalue_data(args[0]);
+    if ((idx = string_index(args[0])) && isutf(str[start]))
+        return size_wrap(string_index_charnum(idx, stop) -
+                         string_index_charnum(idx, start));
     return size_wrap(u8_charnum(str + start, stop - start));
 }
 
@@ -108,6 +256,7 @@ value_t fl_string_encode(value_t *args, uint32_t nargs)
 
 value_t fl_string_decode(value_t *args, uint32_t nargs)
 {
+    struct string_index *idx;
     int term;
     struct cvalue *cv;
     char *ptr;
@@ -126,22 +275,68 @@ value_t fl_string_decode(value_t *args, uint32_t nargs)
     cv = (struct cvalue *)ptr(args[0]);
     ptr = (char *)cv_data(cv);
     nb = cv_len(cv);
-    nc = u8_charnum(ptr, nb);
+    // invalid UTF-8 doesn't decode to as many characters as it counts,
+    // but never to more than it has bytes
+    if (!u8_isvalid(ptr, nb))
+        nc = nb;
+    else if ((idx = string_index(args[0])))
+        nc = idx->nchars;
+    else
+        nc = u8_charnum(ptr, nb);
     newsz = nc * sizeof(uint32_t);
     if (term)
         newsz += sizeof(uint32_t);
     wcstr = cvalue(wcstringtype, newsz);
     ptr = cv_data((struct cvalue *)ptr(args[0]));  // relocatable pointer
     pwc = cvalue_data(wcstr);
-    u8_toucs(pwc, nc, ptr, nb);
+    nc = u8_toucs(pwc, nc, ptr, nb);
     if (term)
         pwc[nc] = 0;
+    ((struct cvalue *)ptr(wcstr))->len = (nc + term) * sizeof(uint32_t);
     return wcstr;
 }
 
 extern value_t fl_buffer(value_t *args, uint32_t nargs);
 extern value_t stream_to_string(value_t *ps);
 
+static int iswchar(value_t v)
+{
+    return iscprim(v) && cp_class((struct cprim *)ptr(v)) == wchartype;
+}
+
+#define wchar_value(v) (*(uint32_t *)cp_data((struct cprim *)ptr(v)))
+
+// Concatenate strings and characters straight into a string of the
+// right size. Returns 0 if some argument is something else.
+static int string_concat(value_t *args, uint32_t nargs, value_t *out)
+{
+    char *dest;
+    size_t len;
+    uint32_t i;
+
+    len = 0;
+    for (i = 0; i < nargs; i++) {
+        if (fl_isstring(args[i]))
+            len += cv_len((struct cvalue *)ptr(args[i]));
+        else if (iswchar(args[i]))
+            len += u8_charlen(wchar_value(args[i]));
+        else
+            return 0;
+    }
+    *out = cvalue_string(len);
+    dest = cvalue_data(*out);
+    for (i = 0; i < nargs; i++) {
+        if (fl_isstring(args[i])) {
+            len = cv_len((struct cvalue *)ptr(args[i]));
+            memcpy(dest, cvalue_data(args[i]), len);
+            dest += len;
+        } else {
+            dest += u8_wc_toutf8(dest, wchar_value(args[i]));
+        }
+    }
+    return 1;
+}
+
 value_t fl_string(value_t *args, uint32_t nargs)
 {
     value_t arg, buf;
@@ -151,6 +346,8 @@ value_t fl_string(value_t *args, uint32_t nargs)
 
     if (nargs == 1 && fl_isstring(args[0]))
         return args[0];
+    if (string_concat(args, nargs, &outp))
+        return outp;
     buf = fl_buffer(NULL, 0);
     fl_gc_handle(&buf);
     s = value2c(struct ios *, buf);
@@ -160,6 +357,156 @@ value_t fl_string(value_t *args, uint32_t nargs)
     return outp;
 }
 
+// String builders
+//
+// A string builder collects text in a malloc'd buffer that grows
+// geometrically, and string-builder->string hands that buffer over to
+// the resulting string without copying it.
+
+struct string_builder {
+    char *buf;
+    size_t len;
+    size_t cap;
+};
+
+static struct fltype *buildertype;
+
+static struct string_builder *tobuilder(value_t v, char *fname)
+{
+    if (!iscvalue(v) || cv_class((struct cvalue *)ptr(v)) != buildertype)
+        type_error(fname, "string-builder", v);
+    return value2c(struct string_builder *, v);
+}
+
+static char *builder_reserve(struct string_builder *sb, size_t n)
+{
+    size_t cap;
+    char *buf;
+
+    if (sb->cap - sb->len <= n) {
+        // keep room for the terminating NUL added when freezing
+        if (n > SIZE_MAX - sb->len - 1)
+            lerror(MemoryError, "string-builder: out of memory");
+        for (cap = sb->cap ? sb->cap : 64; cap - sb->len <= n; cap *= 2) {
+            if (cap > SIZE_MAX / 2) {
+                cap = sb->len + n + 1;
+                break;
+            }
+        }
+        if (!(buf = realloc(sb->buf, cap)))
+            lerror(MemoryError, "string-builder: out of memory");
+        sb->buf = buf;
+        sb->cap = cap;
+    }
+    return sb->buf + sb->len;
+}
+
+value_t builtin_string_builder(value_t *args, uint32_t nargs)
+{
+    struct string_builder *sb;
+    value_t v;
+    size_t cap;
+
+    cap = 0;
+    if (nargs == 1)
+        cap = toulong(args[0], "string-builder");
+    else
+        argcount("string-builder", nargs, 0);
+    v = cvalue(buildertype, sizeof(struct string_builder));
+    sb = value2c(struct string_builder *, v);
+    memset(sb, 0, sizeof(*sb));
+    if (cap)
+        builder_reserve(sb, cap);
+    return v;
+}
+
+value_t builtin_string_builder_p(value_t *args, uint32_t nargs)
+{
+    argcount("string-builder?", nargs, 1);
+    return (iscvalue(args[0]) &&
+            cv_class((struct cvalue *)ptr(args[0])) == buildertype)
+           ? FL_T
+           : FL_F;
+}
+
+value_t builtin_string_builder_append(value_t *args, uint32_t nargs)
+{
+    struct string_builder *sb;
+    struct cvalue *cv;
+    uint32_t i, c;
+
+    if (nargs < 1)
+        argcount("string-builder-append!", nargs, 1);
+    sb = tobuilder(args[0], "string-builder-append!");
+    for (i = 1; i < nargs; i++) {
+        if (fl_isstring(args[i])) {
+            cv = (struct cvalue *)ptr(args[i]);
+            memcpy(builder_reserve(sb, cv_len(cv)), cv_data(cv), cv_len(cv));
+            sb->len += cv_len(cv);
+        } else if (iswchar(args[i])) {
+            c = wchar_value(args[i]);
+            sb->len += u8_wc_toutf8(builder_reserve(sb, 4), c);
+        } else {
+            type_error("string-builder-append!", "string", args[i]);
+        }
+    }
+    return args[0];
+}
+
+value_t builtin_string_builder_length(value_t *args, uint32_t nargs)
+{
+    argcount("string-builder-length", nargs, 1);
+    return size_wrap(tobuilder(args[0], "string-builder-length")->len);
+}
+
+// The builder is left empty, ready to build another string.
+value_t builtin_string_builder_to_string(value_t *args, uint32_t nargs)
+{
+    struct string_builder *sb;
+    struct cvalue *cv;
+    value_t str;
+    char *buf;
+    size_t len;
+
+    argcount("string-builder->string", nargs, 1);
+    sb = tobuilder(args[0], "string-builder->string");
+    if (sb->len <= MAX_INL_SIZE) {
+        str = cvalue_string(sb->len);
+        sb = value2c(struct string_builder *, args[0]);
+        memcpy(cvalue_data(str), sb->buf, sb->len);
+        sb->len = 0;
+        return str;
+    }
+    // the builder keeps the buffer until the string that takes it over
+    // exists and will free it, so that a failed allocation leaks nothing
+    str = cvalue_from_ref(stringtype, NULL, 0, FL_NIL);
+    sb = value2c(struct string_builder *, args[0]);
+    len = sb->len;
+    if ((buf = realloc(sb->buf, len + 1)) != NULL)
+        sb->buf = buf;
+    sb->buf[len] = '\0';
+    cv = (struct cvalue *)ptr(str);
+    cv->data = sb->buf;
+    cv->len = len;
+    cv_autorelease(cv);
+    memset(sb, 0, sizeof(*sb));
+    return str;
+}
+
+static void print_builder(value_t v, struct ios *f)
+{
+    (void)v;
+    fl_print_str("#<string-builder>", f);
+}
+
+static void free_builder(value_t self)
+{
+    free(value2c(struct string_builder *, self)->buf);
+}
+
+static struct cvtable builder_vtable = { print_builder, NULL, free_builder,
+                                         NULL };
+
 value_t builtin_string_split(value_t *args, uint32_t nargs)
 {
     char *s;
@@ -312,24 +659,58 @@ value_t builtin_char_alphabetic(value_t *args, uint32_t nargs)
     return iswalpha(*(int32_t *)cp_data(cp)) ? FL_T : FL_F;
 }
 
-static value_t mem_find_byte(char *s, char c, size_t start, size_t len)
+static struct fltype *searchertype;
+
+// A string searcher is a struct memsearch followed by the needle bytes.
+#define searcher_needle(m) ((char *)((struct memsearch *)(m) + 1))
+
+static int issearcher(value_t v)
 {
-    char *p;
+    return iscvalue(v) && cv_class((struct cvalue *)ptr(v)) == searchertype;
+}
 
-    p = memchr(s + start, c, len - start);
-    if (p == NULL)
-        return FL_F;
-    return size_wrap((size_t)(p - s));
+// Prepare a search for v, which is a string, a character, a byte or a
+// string searcher. Ad hoc needles are preprocessed into *m; cbuf holds
+// the encoding of a character needle.
+static struct memsearch *get_searcher(value_t v, struct memsearch *m,
+                                      const char **pneedle, char *cbuf,
+                                      char *fname)
+{
+    struct cprim *cp;
+    size_t needlesz;
+
+    if (issearcher(v)) {
+        m = value2c(struct memsearch *, v);
+        *pneedle = searcher_needle(m);
+        return m;
+    }
+    cp = (struct cprim *)ptr(v);
+    if (iscprim(v) && cp_class(cp) == wchartype) {
+        needlesz = u8_toutf8(cbuf, 8, (uint32_t *)cp_data(cp), 1);
+        *pneedle = cbuf;
+    } else if (iscprim(v) && cp_class(cp) == bytetype) {
+        cbuf[0] = *(char *)cp_data(cp);
+        needlesz = 1;
+        *pneedle = cbuf;
+    } else if (fl_isstring(v)) {
+        needlesz = cv_len((struct cvalue *)ptr(v));
+        *pneedle = cvalue_data(v);
+    } else {
+        type_error(fname, "string", v);
+    }
+    memsearch_init(m, *pneedle, needlesz);
+    return m;
 }
 
 value_t fl_string_find(value_t *args, uint32_t nargs)
 {
+    struct memsearch tmp;
+    struct memsearch *m;
     char cbuf[8];
+    const char *needle;
+    const char *p;
     char *s;
-    char *needle;
-    struct cprim *cp;
-    value_t v;
-    size_t start, len, needlesz, i;
+    size_t start, len;
 
     if (nargs == 3)
         start = toulong(args[2], "string.find");
@@ -341,43 +722,106 @@ value_t fl_string_find(value_t *args, uint32_t nargs)
     len = cv_len((struct cvalue *)ptr(args[0]));
     if (start > len)
         bounds_error("string.find", args[0], args[2]);
+    m = get_searcher(args[1], &tmp, &needle, cbuf, "string.find");
+    p = memsearch(m, needle, s + start, len - start);
+    if (p == NULL)
+        return FL_F;
+    return size_wrap((size_t)(p - s));
+}
 
-    v = args[1];
-    cp = (struct cprim *)ptr(v);
-    if (iscprim(v) && cp_class(cp) == wchartype) {
-        uint32_t c = *(uint32_t *)cp_data(cp);
-        if (c <= 0x7f)
-            return mem_find_byte(s, (char)c, start, len);
-        needlesz = u8_toutf8(cbuf, sizeof(cbuf), &c, 1);
-        needle = cbuf;
-    } else if (iscprim(v) && cp_class(cp) == bytetype) {
-        return mem_find_byte(s, *(char *)cp_data(cp), start, len);
-    } else if (fl_isstring(v)) {
-        struct cvalue *cv = (struct cvalue *)ptr(v);
-        needlesz = cv_len(cv);
-        needle = (char *)cv_data(cv);
-    } else {
-        type_error("string.find", "string", args[1]);
+// Byte offsets of all non-overlapping occurrences, in ascending order.
+value_t builtin_string_search_all(value_t *args, uint32_t nargs)
+{
+    struct memsearch tmp;
+    struct memsearch *m;
+    char cbuf[8];
+    const char *needle;
+    const char *p;
+    char *s;
+    size_t *offs, *grown;
+    size_t start, len, cap, n;
+    value_t lst, v;
+
+    if (nargs == 3)
+        start = toulong(args[2], "string-search-all");
+    else {
+        argcount("string-search-all", nargs, 2);
+        start = 0;
     }
-    if (needlesz > len - start)
-        return FL_F;
-    else if (needlesz == 1)
-        return mem_find_byte(s, needle[0], start, len);
-    else if (needlesz == 0)
-        return size_wrap(start);
-    for (i = start; i < len - needlesz + 1; i++) {
-        if (s[i] == needle[0]) {
-            if (!memcmp(&s[i + 1], needle + 1, needlesz - 1))
-                return size_wrap(i);
+    s = tostring(args[0], "string-search-all");
+    len = cv_len((struct cvalue *)ptr(args[0]));
+    if (start > len)
+        bounds_error("string-search-all", args[0], args[2]);
+    m = get_searcher(args[1], &tmp, &needle, cbuf, "string-search-all");
+    if (m->len == 0)
+        lerror(ArgError, "string-search-all: empty needle");
+    offs = NULL;
+    cap = n = 0;
+    while ((p = memsearch(m, needle, s + start, len - start))) {
+        if (n == cap) {
+            cap = cap ? 2 * cap : 16;
+            if (!(grown = realloc(offs, cap * sizeof(*offs)))) {
+                free(offs);
+                lerror(MemoryError, "string-search-all: out of memory");
+            }
+            offs = grown;
         }
+        offs[n++] = (size_t)(p - s);
+        start = offs[n - 1] + m->len;
     }
-    return FL_F;
+    lst = FL_NIL;
+    fl_gc_handle(&lst);
+    // the offsets go even if making the list runs out of memory
+    FL_TRY_EXTERN
+    {
+        while (n) {
+            v = size_wrap(offs[--n]);
+            lst = fl_cons(v, lst);
+        }
+    }
+    FL_CATCH_EXTERN
+    {
+        free(offs);
+        fl_raise(fl_lasterror);
+    }
+    fl_free_gc_handles(1);
+    free(offs);
+    return lst;
+}
+
+value_t builtin_string_searcher(value_t *args, uint32_t nargs)
+{
+    struct memsearch tmp;
+    struct memsearch *m;
+    char cbuf[8];
+    const char *needle;
+    value_t v;
+
+    argcount("string-searcher", nargs, 1);
+    if (issearcher(args[0]))
+        return args[0];
+    m = get_searcher(args[0], &tmp, &needle, cbuf, "string-searcher");
+    v = cvalue(searchertype, sizeof(*m) + m->len);
+    m = value2c(struct memsearch *, v);
+    *m = tmp;
+    // the allocation may have moved a string needle
+    if (needle != cbuf)
+        needle = cvalue_data(args[0]);
+    memcpy(searcher_needle(m), needle, m->len);
+    return v;
+}
+
+value_t builtin_string_searcher_p(value_t *args, uint32_t nargs)
+{
+    argcount("string-searcher?", nargs, 1);
+    return issearcher(args[0]) ? FL_T : FL_F;
 }
 
 value_t fl_string_inc(value_t *args, uint32_t nargs)
 {
+    struct string_index *idx;
     char *s;
-    size_t len, cnt, i;
+    size_t len, cnt, i, c;
 
     if (nargs < 2 || nargs > 3)
         argcount("string.inc", nargs, 2);
@@ -387,6 +831,12 @@ value_t fl_string_inc(value_t *args, uint32_t nargs)
     cnt = 1;
     if (nargs == 3)
         cnt = toulong(args[2], "string.inc");
+    if (cnt > 1 && i < len && isutf(s[i]) && (idx = string_index(args[0]))) {
+        c = string_index_charnum(idx, i) + cnt;
+        if (c > idx->nchars)
+            bounds_error("string.inc", args[0], args[1]);
+        return size_wrap(string_index_offset(idx, c));
+    }
     while (cnt--) {
         if (i >= len)
             bounds_error("string.inc", args[0], args[1]);
@@ -397,8 +847,9 @@ value_t fl_string_inc(value_t *args, uint32_t nargs)
 
 value_t fl_string_dec(value_t *args, uint32_t nargs)
 {
+    struct string_index *idx;
     char *s;
-    size_t len, cnt, i;
+    size_t len, cnt, i, c;
 
     if (nargs < 2 || nargs > 3)
         argcount("string.dec", nargs, 2);
@@ -411,6 +862,13 @@ value_t fl_string_dec(value_t *args, uint32_t nargs)
     // note: i is allowed to start at index len
     if (i > len)
         bounds_error("string.dec", args[0], args[1]);
+    if (cnt > 1 && (i == len || isutf(s[i])) &&
+        (idx = string_index(args[0]))) {
+        c = string_index_charnum(idx, i);
+        if (cnt > c)
+            bounds_error("string.dec", args[0], args[1]);
+        return size_wrap(string_index_offset(idx, c - cnt));
+    }
     while (cnt--) {
         if (i == 0)
             bounds_error("string.dec", args[0], args[1]);
@@ -497,6 +955,14 @@ static struct builtinspec stringfunc_info[] = {
     { "string.width", fl_string_width },
     { "string.sub", fl_string_sub },
     { "string.find", fl_string_find },
+    { "string-search-all", builtin_string_search_all },
+    { "string-searcher", builtin_string_searcher },
+    { "string-searcher?", builtin_string_searcher_p },
+    { "string-builder", builtin_string_builder },
+    { "string-builder?", builtin_string_builder_p },
+    { "string-builder-append!", builtin_string_builder_append },
+    { "string-builder-length", builtin_string_builder_length },
+    { "string-builder->string", builtin_string_builder_to_string },
     { "string.char", fl_string_char },
     { "string.inc", fl_string_inc },
     { "string.dec", fl_string_dec },
@@ -518,4 +984,20 @@ static struct builtinspec stringfunc_info[] = {
     { NULL, NULL }
 };
 
-void stringfuncs_init(void) { assign_global_builtins(stringfunc_info); }
+static void print_searcher(value_t v, struct ios *f)
+{
+    (void)v;
+    fl_print_str("#<string-searcher>", f);
+}
+
+static struct cvtable searcher_vtable = { print_searcher, NULL, NULL, NULL };
+
+void stringfuncs_init(void)
+{
+    searchertype = define_opaque_type(symbol("string-searcher"), 0,
+                                      &searcher_vtable, NULL);
+    buildertype = define_opaque_type(symbol("string-builder"),
+                                     sizeof(struct string_builder),
+                                     &builder_vtable, NULL);
+    assign_global_builtins(stringfunc_info);
+}
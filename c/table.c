@@ -61,7 +61,7 @@ void relocate_htable(value_t oldv, value_t newv)
 
     oldh = (struct htable *)cv_data((struct cvalue *)ptr(oldv));
     h = (struct htable *)cv_data((struct cvalue *)ptr(newv));
-    if (oldh->table == &oldh->_space[0])
+    if (h->table == &oldh->_space[0])
         h->table = &h->_space[0];
     for (i = 0; i < h->size; i++) {
         if (h->table[i] != HT_NOTFOUND)
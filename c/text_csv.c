@@ -0,0 +1,260 @@
+// Copyright 2019 Lassi Kortela
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Streaming reader for comma- and tab-separated values. Fields are
+// scanned straight out of the stream buffer into a scratch buffer and
+// become Lisp strings only once complete; no line string is made.
+
+#include <sys/types.h>
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scheme.h"
+
+// Scratch space for the field being read. No Lisp code runs while a
+// row is being read, so one buffer serves every stream.
+static struct buf csv_field;
+
+static int csv_peek(struct ios *s)
+{
+    if (s->bpos == s->size) {
+        if (!ios_readprep(s, 1)) {
+            s->_eof = 1;
+            return -1;
+        }
+    }
+    return (unsigned char)s->buf[s->bpos];
+}
+
+static int csv_getc(struct ios *s)
+{
+    int c;
+
+    if ((c = csv_peek(s)) != -1) {
+        s->bpos++;
+    }
+    return c;
+}
+
+// Copy bytes up to the next quote (if quoted) or the next delimiter or
+// newline (if not) from the stream buffer into the field.
+static void csv_scan(struct ios *s, int delim, int quoted)
+{
+    const char *p, *q, *end;
+
+    while (csv_peek(s) != -1) {
+        p = s->buf + s->bpos;
+        end = s->buf + s->size;
+        if (quoted) {
+            if (!(q = memchr(p, '"', end - p))) {
+                q = end;
+            }
+        } else {
+            for (q = p; q < end; q++) {
+                if (*q == delim || *q == '\n' || *q == '\r') {
+                    break;
+                }
+            }
+        }
+        buf_putb(&csv_field, p, q - p);
+        s->bpos += q - p;
+        if (q < end) {
+            break;
+        }
+    }
+}
+
+// Read one field into csv_field. Returns the delimiter if more fields
+// follow on the same row, '\n' at the end of a row, or -1 at the end of
+// input. A doubled quote inside a quoted field stands for one quote,
+// and input that ends before the closing quote is a parse error.
+static int csv_read_field(struct ios *s, int delim, const char *fname)
+{
+    int c, quoted;
+
+    csv_field.fill = 0;
+    if ((quoted = (csv_peek(s) == '"'))) {
+        s->bpos++;
+    }
+    for (;;) {
+        csv_scan(s, delim, quoted);
+        if ((c = csv_getc(s)) == -1) {
+            if (quoted) {
+                lerrorf(ParseError, "%s: unterminated quoted field", fname);
+            }
+            return -1;
+        }
+        if (quoted) {
+            if (csv_peek(s) == '"') {
+                s->bpos++;
+                buf_putc(&csv_field, '"');
+            } else {
+                quoted = 0;
+            }
+        } else if (c == delim) {
+            return c;
+        } else if (c == '\r') {
+            if (csv_peek(s) == '\n') {
+                s->bpos++;
+            }
+            return '\n';
+        } else if (c == '\n') {
+            return c;
+        } else {
+            buf_putc(&csv_field, c);
+        }
+    }
+}
+
+static value_t csv_column_type(value_t types, size_t col)
+{
+    if (isvector(types)) {
+        return (col < vector_size(types)) ? vector_elt(types, col) : FL_F;
+    }
+    for (; iscons(types); types = cdr_(types)) {
+        if (!col--) {
+            return car_(types);
+        }
+    }
+    return FL_F;
+}
+
+static value_t csv_field_value(value_t type, size_t col, const char *fname)
+{
+    const char *name;
+    value_t v;
+
+    if (type == FL_F) {
+        return string_from_cstrn(csv_field.bytes, csv_field.fill);
+    }
+    if (!issymbol(type)) {
+        type_error(fname, "symbol", type);
+    }
+    name = symbol_name(type);
+    if (!strcmp(name, "string")) {
+        return string_from_cstrn(csv_field.bytes, csv_field.fill);
+    }
+    buf_putc(&csv_field, 0);
+    if (!strcmp(name, "symbol")) {
+        return symbol(csv_field.bytes);
+    }
+    if (!strcmp(name, "number")) {
+        if (!csv_field.bytes[0]) {
+            return FL_F;
+        }
+        if (!isnumtok_base(csv_field.bytes, &v, 10)) {
+            lerrorf(ArgError, "%s: column %lu: not a number: %s", fname,
+                    (unsigned long)col, csv_field.bytes);
+        }
+        return v;
+    }
+    lerrorf(ArgError, "%s: unknown column type: %s", fname, name);
+    return FL_F;
+}
+
+// The stream and the column types are passed by reference since a
+// field allocation may move them. Returns FL_EOF at the end of input.
+static value_t csv_read_row(value_t *ps, int delim, value_t *ptypes,
+                            const char *fname)
+{
+    struct ios *s;
+    value_t row, v;
+    size_t n, i;
+    int c;
+
+    s = value2c(struct ios *, *ps);
+    if ((c = csv_peek(s)) == -1) {
+        return FL_EOF;
+    }
+    if (c == '\n' || c == '\r') {
+        csv_read_field(s, delim, fname);
+        return alloc_vector(0, 0);
+    }
+    row = FL_NIL;
+    fl_gc_handle(&row);
+    n = 0;
+    do {
+        c = csv_read_field(s, delim, fname);
+        v = csv_field_value(csv_column_type(*ptypes, n), n, fname);
+        row = fl_cons(v, row);
+        n++;
+        s = value2c(struct ios *, *ps);
+    } while (c == delim);
+    v = alloc_vector(n, 0);
+    for (i = n; i > 0; i--) {
+        vector_elt(v, i - 1) = car_(row);
+        row = cdr_(row);
+    }
+    fl_free_gc_handles(1);
+    return v;
+}
+
+static int csv_delim_arg(value_t *args, uint32_t nargs, uint32_t i,
+                         const char *fname)
+{
+    size_t delim;
+
+    if (nargs <= i) {
+        return ',';
+    }
+    delim = toulong(args[i], (char *)fname);
+    if (delim > 0x7f || delim == '"' || delim == '\n' || delim == '\r') {
+        lerrorf(ArgError, "%s: invalid delimiter", fname);
+    }
+    return (int)delim;
+}
+
+value_t builtin_read_csv_row(value_t *args, uint32_t nargs)
+{
+    value_t types;
+    int delim;
+
+    if (nargs < 1 || nargs > 3) {
+        argcount("read-csv-row", nargs, nargs < 1 ? 1 : 3);
+    }
+    fl_toiostream(args[0], "read-csv-row");
+    delim = csv_delim_arg(args, nargs, 1, "read-csv-row");
+    types = FL_F;
+    return csv_read_row(&args[0], delim, (nargs > 2) ? &args[2] : &types,
+                        "read-csv-row");
+}
+
+value_t builtin_csv_for_each(value_t *args, uint32_t nargs)
+{
+    value_t f, s, types, row;
+    size_t nrows;
+    int delim;
+
+    if (nargs < 2 || nargs > 4) {
+        argcount("csv-for-each", nargs, nargs < 2 ? 2 : 4);
+    }
+    fl_toiostream(args[1], "csv-for-each");
+    delim = csv_delim_arg(args, nargs, 2, "csv-for-each");
+    f = args[0];
+    s = args[1];
+    types = (nargs > 3) ? args[3] : FL_F;
+    fl_gc_handle(&f);
+    fl_gc_handle(&s);
+    fl_gc_handle(&types);
+    nrows = 0;
+    for (;;) {
+        row = csv_read_row(&s, delim, &types, "csv-for-each");
+        if (row == FL_EOF) {
+            break;
+        }
+        fl_applyn(1, f, row);
+        nrows++;
+    }
+    fl_free_gc_handles(3);
+    return size_wrap(nrows);
+}
@@ -21,6 +21,14 @@ double diff_time(struct timeval *tv1, struct timeval *tv2)
     return tv2float(tv1) - tv2float(tv2);
 }
 
+double clock_now(void)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    return tv2float(&now);
+}
+
 uint64_t i64time(void)
 {
     uint64_t a;
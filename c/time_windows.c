@@ -13,6 +13,17 @@ double tvals2float(struct tm *t, struct timeb *tstruct)
 }
 #endif
 
+double clock_now(void)
+{
+    FILETIME ft;
+    uint64_t t;
+
+    GetSystemTimeAsFileTime(&ft);
+    t = ((uint64_t)ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+    // 100-nanosecond intervals since 1601-01-01
+    return (double)t / 1.0e7 - 11644473600.0;
+}
+
 uint64_t i64time(void) { return 0; }
 
 void sleep_ms(int ms)
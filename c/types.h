@@ -93,7 +93,7 @@ void relocate_typetable(void)
     h = &TypeTable;
     for (i = 0; i < h->size; i += 2) {
         if (h->table[i] != HT_NOTFOUND) {
-            nv = (void *)relocate((value_t)h->table[i]);
+            nv = (void *)relocate_lispvalue((value_t)h->table[i]);
             h->table[i] = nv;
             if (h->table[i + 1] != HT_NOTFOUND)
                 ((struct fltype *)h->table[i + 1])->type = (value_t)nv;
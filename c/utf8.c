@@ -32,6 +32,14 @@
 
 #include "scheme.h"
 
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define U8_X86_DISPATCH
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 static const uint32_t offsetsFromUTF8[6] = { 0x00000000UL, 0x00003080UL,
                                              0x000E2080UL, 0x03C82080UL,
                                              0xFA082080UL, 0x82082080UL };
@@ -50,6 +58,202 @@ static const char trailingBytesForUTF8[256] = {
     3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5
 };
 
+/* bulk kernels
+
+   The hot loops below are built on two primitives: the length of the
+   leading run of ASCII bytes, and the number of bytes that are not
+   continuation bytes (which is the number of characters in valid
+   UTF-8). Both have a portable version working on 64-bit words. On x86
+   with GCC or Clang there are also SSE2 and AVX2 versions, and
+   u8_init() picks the widest one the running CPU supports.
+*/
+
+#define ONES64 0x0101010101010101ULL
+#define HIGH64 0x8080808080808080ULL
+
+static size_t ascii_prefix_word(const char *s, size_t n)
+{
+    uint64_t w;
+    size_t i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        memcpy(&w, s + i, 8);
+        if (w & HIGH64)
+            break;
+    }
+    while (i < n && !(s[i] & 0x80))
+        i++;
+    return i;
+}
+
+static size_t count_chars_word(const char *s, size_t n)
+{
+    uint64_t w, cont;
+    size_t i, c = 0;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        memcpy(&w, s + i, 8);
+        // continuation bytes have bit 7 set and bit 6 clear
+        cont = ((w & ~(w << 1)) & HIGH64) >> 7;
+        c += 8 - (size_t)((cont * ONES64) >> 56);
+    }
+    for (; i < n; i++)
+        c += isutf(s[i]);
+    return c;
+}
+
+#ifdef U8_X86_DISPATCH
+
+__attribute__((target("sse2"))) static size_t
+ascii_prefix_sse2(const char *s, size_t n)
+{
+    size_t i;
+    int m;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        m = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(s + i)));
+        if (m)
+            return i + __builtin_ctz(m);
+    }
+    return i + ascii_prefix_word(s + i, n - i);
+}
+
+__attribute__((target("sse2"))) static size_t
+count_chars_sse2(const char *s, size_t n)
+{
+    // continuation bytes are 0x80..0xBF, i.e. -128..-65 as signed bytes
+    const __m128i limit = _mm_set1_epi8(-65);
+    __m128i v, acc;
+    size_t i, k, c;
+
+    i = c = 0;
+    while (n - i >= 16) {
+        // each byte lane of acc counts up to 255
+        acc = _mm_setzero_si128();
+        for (k = 0; k < 255 && n - i >= 16; k++, i += 16) {
+            v = _mm_loadu_si128((const __m128i *)(s + i));
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, limit));
+        }
+        acc = _mm_sad_epu8(acc, _mm_setzero_si128());
+        c += (size_t)_mm_cvtsi128_si32(acc) + _mm_extract_epi16(acc, 4);
+    }
+    return c + count_chars_word(s + i, n - i);
+}
+
+__attribute__((target("avx2"))) static size_t
+ascii_prefix_avx2(const char *s, size_t n)
+{
+    size_t i;
+    unsigned int m;
+
+    for (i = 0; i + 32 <= n; i += 32) {
+        m = (unsigned int)_mm256_movemask_epi8(
+        _mm256_loadu_si256((const __m256i *)(s + i)));
+        if (m)
+            return i + __builtin_ctz(m);
+    }
+    return i + ascii_prefix_sse2(s + i, n - i);
+}
+
+__attribute__((target("avx2"))) static size_t
+count_chars_avx2(const char *s, size_t n)
+{
+    const __m256i limit = _mm256_set1_epi8(-65);
+    __m256i v, acc;
+    uint64_t lanes[4];
+    size_t i, k, c;
+
+    i = c = 0;
+    while (n - i >= 32) {
+        acc = _mm256_setzero_si256();
+        for (k = 0; k < 255 && n - i >= 32; k++, i += 32) {
+            v = _mm256_loadu_si256((const __m256i *)(s + i));
+            acc = _mm256_sub_epi8(acc, _mm256_cmpgt_epi8(v, limit));
+        }
+        acc = _mm256_sad_epu8(acc, _mm256_setzero_si256());
+        _mm256_storeu_si256((__m256i *)lanes, acc);
+        c += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+    return c + count_chars_sse2(s + i, n - i);
+}
+
+#endif
+
+static size_t (*ascii_prefix)(const char *s, size_t n) = ascii_prefix_word;
+static size_t (*count_chars)(const char *s, size_t n) = count_chars_word;
+
+void u8_init(void)
+{
+#ifdef U8_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        ascii_prefix = ascii_prefix_avx2;
+        count_chars = count_chars_avx2;
+    } else if (__builtin_cpu_supports("sse2")) {
+        ascii_prefix = ascii_prefix_sse2;
+        count_chars = count_chars_sse2;
+    }
+#endif
+}
+
+// Widen the leading run of ASCII bytes of src, at most n of them, into
+// dest. Returns the number of bytes converted.
+static size_t ascii_widen(uint32_t *dest, const char *src, size_t n)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v, lo, hi;
+
+    for (; i + 16 <= n; i += 16) {
+        v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v))
+            break;
+        lo = _mm_unpacklo_epi8(v, zero);
+        hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(dest + i + 4),
+                         _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *)(dest + i + 8),
+                         _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *)(dest + i + 12),
+                         _mm_unpackhi_epi16(hi, zero));
+    }
+#endif
+    for (; i < n && !(src[i] & 0x80); i++)
+        dest[i] = (unsigned char)src[i];
+    return i;
+}
+
+// Narrow the leading run of ASCII code points of src, at most n of
+// them, into dest. Returns the number of code points converted.
+static size_t ascii_narrow(char *dest, const uint32_t *src, size_t n)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i high = _mm_set1_epi32(~0x7f);
+    __m128i a, b, c, d, any;
+
+    for (; i + 16 <= n; i += 16) {
+        a = _mm_loadu_si128((const __m128i *)(src + i));
+        b = _mm_loadu_si128((const __m128i *)(src + i + 4));
+        c = _mm_loadu_si128((const __m128i *)(src + i + 8));
+        d = _mm_loadu_si128((const __m128i *)(src + i + 12));
+        any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        any = _mm_and_si128(any, high);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, _mm_setzero_si128())) !=
+            0xffff)
+            break;
+        _mm_storeu_si128((__m128i *)(dest + i),
+                         _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                          _mm_packs_epi32(c, d)));
+    }
+#endif
+    for (; i < n && src[i] < 0x80; i++)
+        dest[i] = (char)src[i];
+    return i;
+}
+
 /* returns length of next utf-8 sequence */
 size_t u8_seqlen(const char *s)
 {
@@ -81,7 +285,9 @@ size_t u8_codingsize(uint32_t *wcstr, size_t n)
 }
 
 /* conversions without error checking
-   only works for valid UTF-8, i.e. no 5- or 6-byte sequences
+   only works for valid UTF-8, i.e. no 5- or 6-byte sequences; a stray
+   continuation byte, or a sequence cut short by the end of src, becomes
+   U+FFFD, so there are never more characters than source bytes
    srcsz = source size in bytes
    sz = dest size in # of wide characters
 
@@ -92,13 +298,20 @@ size_t u8_toucs(uint32_t *dest, size_t sz, const char *src, size_t srcsz)
 {
     uint32_t ch;
     const char *src_end = src + srcsz;
-    size_t nb;
+    size_t nb, n;
     size_t i = 0;
 
     if (sz == 0 || srcsz == 0)
         return 0;
 
-    while (i < sz) {
+    while (i < sz && src < src_end) {
+        if (!(*src & 0x80)) {
+            n = (size_t)(src_end - src);
+            n = ascii_widen(dest + i, src, (n < sz - i) ? n : sz - i);
+            src += n;
+            i += n;
+            continue;
+        }
         if (!isutf(*src)) {  // invalid sequence
             dest[i++] = 0xFFFD;
             src++;
@@ -107,8 +320,10 @@ size_t u8_toucs(uint32_t *dest, size_t sz, const char *src, size_t srcsz)
             continue;
         }
         nb = trailingBytesForUTF8[(unsigned char)*src];
-        if (src + nb >= src_end)
+        if (src + nb >= src_end) {
+            dest[i++] = 0xFFFD;
             break;
+        }
         ch = 0;
         switch (nb) {
         case 5:
@@ -149,16 +364,20 @@ size_t u8_toucs(uint32_t *dest, size_t sz, const char *src, size_t srcsz)
 size_t u8_toutf8(char *dest, size_t sz, const uint32_t *src, size_t srcsz)
 {
     uint32_t ch;
-    size_t i = 0;
+    size_t i = 0, n;
     char *dest0 = dest;
     char *dest_end = dest + sz;
 
     while (i < srcsz) {
         ch = src[i];
         if (ch < 0x80) {
-            if (dest >= dest_end)
+            n = (size_t)(dest_end - dest);
+            n = ascii_narrow(dest, src + i, (n < srcsz - i) ? n : srcsz - i);
+            if (n == 0)
                 break;
-            *dest++ = (char)ch;
+            dest += n;
+            i += n;
+            continue;
         } else if (ch < 0x800) {
             if (dest >= dest_end - 1)
                 break;
@@ -227,35 +446,11 @@ size_t u8_offset(const char *s, size_t charnum)
 /* byte offset => charnum */
 size_t u8_charnum(const char *s, size_t offset)
 {
-    size_t charnum = 0, i = 0;
-
-    while (i < offset) {
-        if (s[i++] & 0x80) {
-            (void)(isutf(s[++i]) || isutf(s[++i]) || ++i);
-        }
-        charnum++;
-    }
-    return charnum;
+    return count_chars(s, offset);
 }
 
 /* number of characters in NUL-terminated string */
-size_t u8_strlen(const char *s)
-{
-    size_t count = 0;
-    size_t i = 0, lasti;
-
-    while (1) {
-        lasti = i;
-        while (s[i] > 0)
-            i++;
-        count += (i - lasti);
-        if (s[i++] == 0)
-            break;
-        (void)(isutf(s[++i]) || isutf(s[++i]) || ++i);
-        count++;
-    }
-    return count;
-}
+size_t u8_strlen(const char *s) { return count_chars(s, strlen(s)); }
 
 #ifdef _WIN32
 #include "wcwidth.h"
@@ -685,15 +880,17 @@ int u8_isvalid(const char *str, int length)
     int ab;
 
     for (p = (unsigned char *)str; p < pend; p++) {
+        if (*p < 128) {
+            p += ascii_prefix((const char *)p, pend - p);
+            if (p == pend)
+                break;
+        }
         c = *p;
-        if (c < 128)
-            continue;
         if ((c & 0xc0) != 0xc0)
             return 0;
         ab = trailingBytesForUTF8[c];
-        if (length < ab)
+        if (pend - p <= ab)
             return 0;
-        length -= ab;
 
         p++;
         /* Check top bits in the second byte */
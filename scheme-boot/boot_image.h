@@ -604,5553 +604,5518 @@ unsigned char boot_image[] = {
 0x70,0x61,0x63,0x65,0x2a,0x20,0x22,0x5c,
 0x74,0x5c,0x6e,0x5c,0x76,0x5c,0x66,0x5c,
 0x72,0x20,0x5c,0x75,0x30,0x30,0x38,0x35,
-0xc2,0xa0,0xe1,0x9a,0x80,0x5c,0x75,0x31,
-0x38,0x30,0x65,0xe2,0x80,0x80,0xe2,0x80,
-0x81,0xe2,0x80,0x82,0xe2,0x80,0x83,0xe2,
-0x80,0x84,0xe2,0x80,0x85,0xe2,0x80,0x86,
-0xe2,0x80,0x87,0xe2,0x80,0x88,0xe2,0x80,
-0x89,0xe2,0x80,0x8a,0xe2,0x80,0xa8,0xe2,
-0x80,0xa9,0xe2,0x80,0xaf,0xe2,0x81,0x9f,
-0xe3,0x80,0x80,0x22,0x20,0x31,0x2b,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x61,0x77,0x3b,0x22,
-0x20,0x5b,0x5d,0x20,0x31,0x2b,0x29,0x20,
-0x31,0x2d,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x61,
-0x78,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x31,
-0x2d,0x29,0x20,0x31,0x61,0x72,0x67,0x2d,
-0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x46,0x31,0x36,0x54,
-0x30,0x32,0x7c,0x4d,0x63,0x30,0x3c,0x31,
-0x36,0x4a,0x30,0x32,0x7c,0x4e,0x46,0x31,
-0x36,0x42,0x30,0x32,0x7c,0x5c,0x78,0x38,
-0x34,0x46,0x31,0x36,0x3a,0x30,0x32,0x65,
-0x31,0x7c,0x5c,0x78,0x38,0x34,0x61,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x6c,0x61,0x6d,
-0x62,0x64,0x61,0x20,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3d,0x5d,0x20,0x31,0x61,0x72,
-0x67,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,
-0x3f,0x29,0x20,0x3c,0x3d,0x20,0x23,0x30,
-0x3d,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x32,0x7d,0x7c,0x58,0x31,
-0x37,0x42,0x30,0x32,0x65,0x30,0x7c,0x33,
-0x31,0x31,0x36,0x38,0x30,0x32,0x65,0x30,
-0x7d,0x33,0x31,0x40,0x3b,0x22,0x20,0x5b,
-0x6e,0x61,0x6e,0x3f,0x5d,0x20,0x3c,0x3d,
-0x29,0x20,0x3e,0x20,0x23,0x32,0x3d,0x23,
+0x5c,0x75,0x30,0x30,0x61,0x30,0x5c,0x75,
+0x31,0x36,0x38,0x30,0x5c,0x75,0x31,0x38,
+0x30,0x65,0x5c,0x75,0x32,0x30,0x30,0x30,
+0x5c,0x75,0x32,0x30,0x30,0x31,0x5c,0x75,
+0x32,0x30,0x30,0x32,0x5c,0x75,0x32,0x30,
+0x30,0x33,0x5c,0x75,0x32,0x30,0x30,0x34,
+0x5c,0x75,0x32,0x30,0x30,0x35,0x5c,0x75,
+0x32,0x30,0x30,0x36,0x5c,0x75,0x32,0x30,
+0x30,0x37,0x5c,0x75,0x32,0x30,0x30,0x38,
+0x5c,0x75,0x32,0x30,0x30,0x39,0x5c,0x75,
+0x32,0x30,0x30,0x61,0x5c,0x75,0x32,0x30,
+0x32,0x38,0x5c,0x75,0x32,0x30,0x32,0x39,
+0x5c,0x75,0x32,0x30,0x32,0x66,0x5c,0x75,
+0x32,0x30,0x35,0x66,0x5c,0x75,0x33,0x30,
+0x30,0x30,0x22,0x20,0x31,0x2b,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x32,0x7d,0x7c,0x58,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x3e,0x29,0x20,0x3e,0x3d,
-0x20,0x23,0x31,0x3d,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x32,0x7c,
-0x7d,0x58,0x31,0x37,0x42,0x30,0x32,0x65,
-0x30,0x7c,0x33,0x31,0x31,0x36,0x38,0x30,
-0x32,0x65,0x30,0x7d,0x33,0x31,0x40,0x3b,
-0x22,0x20,0x5b,0x6e,0x61,0x6e,0x3f,0x5d,
-0x20,0x3e,0x3d,0x29,0x20,0x49,0x6e,0x73,
-0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,
-0x73,0x20,0x23,0x74,0x61,0x62,0x6c,0x65,
-0x28,0x6e,0x6f,0x74,0x20,0x31,0x36,0x20,
-0x20,0x76,0x61,0x72,0x67,0x63,0x20,0x36,
-0x37,0x20,0x20,0x6c,0x6f,0x61,0x64,0x31,
-0x20,0x34,0x39,0x20,0x20,0x3d,0x20,0x33,
-0x39,0x20,0x20,0x73,0x65,0x74,0x63,0x2e,
-0x6c,0x20,0x36,0x34,0x20,0x20,0x73,0x75,
-0x62,0x32,0x20,0x37,0x32,0x20,0x20,0x62,
-0x72,0x6e,0x65,0x2e,0x6c,0x20,0x38,0x33,
-0x20,0x20,0x6c,0x61,0x72,0x67,0x63,0x20,
-0x37,0x34,0x20,0x20,0x62,0x72,0x6e,0x6e,
-0x20,0x38,0x35,0x20,0x20,0x6c,0x6f,0x61,
-0x64,0x63,0x2e,0x6c,0x20,0x35,0x38,0x20,
-0x20,0x6c,0x6f,0x61,0x64,0x69,0x38,0x20,
-0x35,0x30,0x20,0x20,0x3c,0x20,0x34,0x30,
-0x20,0x20,0x6e,0x6f,0x70,0x20,0x30,0x20,
-0x20,0x73,0x65,0x74,0x2d,0x63,0x64,0x72,
-0x21,0x20,0x33,0x32,0x20,0x20,0x6c,0x6f,
-0x61,0x64,0x61,0x20,0x35,0x35,0x20,0x20,
-0x62,0x6f,0x75,0x6e,0x64,0x3f,0x20,0x32,
-0x31,0x20,0x20,0x2f,0x20,0x33,0x37,0x20,
-0x20,0x6e,0x65,0x67,0x20,0x37,0x33,0x20,
-0x20,0x62,0x72,0x6e,0x2e,0x6c,0x20,0x38,
-0x38,0x20,0x20,0x6c,0x76,0x61,0x72,0x67,
-0x63,0x20,0x37,0x35,0x20,0x20,0x62,0x72,
-0x74,0x20,0x37,0x20,0x20,0x74,0x72,0x79,
-0x63,0x61,0x74,0x63,0x68,0x20,0x36,0x38,
-0x20,0x20,0x6e,0x75,0x6c,0x6c,0x3f,0x20,
-0x31,0x37,0x20,0x20,0x6c,0x6f,0x61,0x64,
-0x30,0x20,0x34,0x38,0x20,0x20,0x6a,0x6d,
-0x70,0x2e,0x6c,0x20,0x38,0x20,0x20,0x6c,
-0x6f,0x61,0x64,0x76,0x20,0x35,0x31,0x20,
-0x20,0x73,0x65,0x74,0x61,0x20,0x36,0x31,
-0x20,0x20,0x6b,0x65,0x79,0x61,0x72,0x67,
-0x73,0x20,0x39,0x31,0x20,0x20,0x2a,0x20,
-0x33,0x36,0x20,0x20,0x66,0x75,0x6e,0x63,
-0x74,0x69,0x6f,0x6e,0x3f,0x20,0x32,0x36,
-0x20,0x20,0x62,0x75,0x69,0x6c,0x74,0x69,
-0x6e,0x3f,0x20,0x32,0x33,0x20,0x20,0x61,
-0x72,0x65,0x66,0x20,0x34,0x33,0x20,0x20,
-0x6f,0x70,0x74,0x61,0x72,0x67,0x73,0x20,
-0x38,0x39,0x20,0x20,0x76,0x65,0x63,0x74,
-0x6f,0x72,0x3f,0x20,0x32,0x34,0x20,0x20,
-0x6c,0x6f,0x61,0x64,0x74,0x20,0x34,0x35,
-0x20,0x20,0x62,0x72,0x66,0x20,0x36,0x20,
-0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3f,
-0x20,0x31,0x39,0x20,0x20,0x63,0x64,0x72,
-0x20,0x33,0x30,0x20,0x20,0x66,0x6f,0x72,
-0x20,0x36,0x39,0x20,0x20,0x6c,0x6f,0x61,
-0x64,0x63,0x30,0x30,0x20,0x37,0x38,0x20,
-0x20,0x70,0x6f,0x70,0x20,0x32,0x20,0x20,
-0x70,0x61,0x69,0x72,0x3f,0x20,0x32,0x32,
-0x20,0x20,0x63,0x61,0x64,0x72,0x20,0x38,
-0x34,0x20,0x20,0x63,0x6c,0x6f,0x73,0x75,
-0x72,0x65,0x20,0x36,0x35,0x20,0x20,0x6c,
-0x6f,0x61,0x64,0x66,0x20,0x34,0x36,0x20,
-0x20,0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,
-0x20,0x34,0x31,0x20,0x20,0x6c,0x6f,0x61,
-0x64,0x76,0x2e,0x6c,0x20,0x35,0x32,0x20,
-0x20,0x73,0x65,0x74,0x67,0x2e,0x6c,0x20,
-0x36,0x30,0x20,0x20,0x62,0x72,0x6e,0x20,
-0x38,0x37,0x20,0x20,0x65,0x71,0x76,0x3f,
-0x20,0x31,0x33,0x20,0x20,0x61,0x73,0x65,
-0x74,0x21,0x20,0x34,0x34,0x20,0x20,0x65,
-0x71,0x3f,0x20,0x31,0x32,0x20,0x20,0x61,
-0x74,0x6f,0x6d,0x3f,0x20,0x31,0x35,0x20,
-0x20,0x62,0x6f,0x6f,0x6c,0x65,0x61,0x6e,
-0x3f,0x20,0x31,0x38,0x20,0x20,0x62,0x72,
-0x74,0x2e,0x6c,0x20,0x31,0x30,0x20,0x20,
-0x74,0x61,0x70,0x70,0x6c,0x79,0x20,0x37,
-0x30,0x20,0x20,0x64,0x75,0x6d,0x6d,0x79,
-0x5f,0x6e,0x69,0x6c,0x20,0x39,0x34,0x20,
-0x20,0x6c,0x6f,0x61,0x64,0x61,0x30,0x20,
-0x37,0x36,0x20,0x20,0x62,0x72,0x62,0x6f,
-0x75,0x6e,0x64,0x20,0x39,0x30,0x20,0x20,
-0x6c,0x69,0x73,0x74,0x20,0x32,0x38,0x20,
-0x20,0x64,0x75,0x70,0x20,0x31,0x20,0x20,
-0x61,0x70,0x70,0x6c,0x79,0x20,0x33,0x33,
-0x20,0x20,0x6c,0x6f,0x61,0x64,0x63,0x20,
-0x35,0x37,0x20,0x20,0x6c,0x6f,0x61,0x64,
-0x63,0x30,0x31,0x20,0x37,0x39,0x20,0x20,
-0x64,0x75,0x6d,0x6d,0x79,0x5f,0x74,0x20,
-0x39,0x32,0x20,0x20,0x73,0x65,0x74,0x67,
-0x20,0x35,0x39,0x20,0x20,0x6c,0x6f,0x61,
-0x64,0x61,0x31,0x20,0x37,0x37,0x20,0x20,
-0x74,0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,
-0x38,0x31,0x20,0x20,0x6a,0x6d,0x70,0x20,
-0x35,0x20,0x20,0x66,0x69,0x78,0x6e,0x75,
-0x6d,0x3f,0x20,0x32,0x35,0x20,0x20,0x63,
-0x6f,0x6e,0x73,0x20,0x32,0x37,0x20,0x20,
-0x6c,0x6f,0x61,0x64,0x67,0x2e,0x6c,0x20,
-0x35,0x34,0x20,0x20,0x74,0x63,0x61,0x6c,
-0x6c,0x20,0x34,0x20,0x20,0x63,0x61,0x6c,
-0x6c,0x20,0x33,0x20,0x20,0x2d,0x20,0x33,
-0x35,0x20,0x20,0x62,0x72,0x66,0x2e,0x6c,
-0x20,0x39,0x20,0x20,0x2b,0x20,0x33,0x34,
+0x72,0x31,0x7c,0x61,0x77,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x31,0x2b,0x29,0x20,0x31,
+0x2d,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x61,0x78,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x31,0x2d,
+0x29,0x20,0x31,0x61,0x72,0x67,0x2d,0x6c,
+0x61,0x6d,0x62,0x64,0x61,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x46,0x31,0x36,0x54,0x30,
+0x32,0x7c,0x4d,0x63,0x30,0x3c,0x31,0x36,
+0x4a,0x30,0x32,0x7c,0x4e,0x46,0x31,0x36,
+0x42,0x30,0x32,0x7c,0x5c,0x78,0x38,0x34,
+0x46,0x31,0x36,0x3a,0x30,0x32,0x65,0x31,
+0x7c,0x5c,0x78,0x38,0x34,0x61,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x6c,0x61,0x6d,0x62,
+0x64,0x61,0x20,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x3d,0x5d,0x20,0x31,0x61,0x72,0x67,
+0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,
+0x29,0x20,0x3c,0x3d,0x20,0x23,0x30,0x3d,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x32,0x7d,0x7c,0x58,0x31,0x37,
+0x42,0x30,0x32,0x65,0x30,0x7c,0x33,0x31,
+0x31,0x36,0x38,0x30,0x32,0x65,0x30,0x7d,
+0x33,0x31,0x40,0x3b,0x22,0x20,0x5b,0x6e,
+0x61,0x6e,0x3f,0x5d,0x20,0x3c,0x3d,0x29,
+0x20,0x3e,0x20,0x23,0x32,0x3d,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x32,0x7d,0x7c,0x58,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x3e,0x29,0x20,0x3e,0x3d,0x20,
+0x23,0x31,0x3d,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x32,0x7c,0x7d,
+0x58,0x31,0x37,0x42,0x30,0x32,0x65,0x30,
+0x7c,0x33,0x31,0x31,0x36,0x38,0x30,0x32,
+0x65,0x30,0x7d,0x33,0x31,0x40,0x3b,0x22,
+0x20,0x5b,0x6e,0x61,0x6e,0x3f,0x5d,0x20,
+0x3e,0x3d,0x29,0x20,0x49,0x6e,0x73,0x74,
+0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x73,
+0x20,0x23,0x74,0x61,0x62,0x6c,0x65,0x28,
+0x6e,0x6f,0x74,0x20,0x31,0x36,0x20,0x20,
+0x76,0x61,0x72,0x67,0x63,0x20,0x36,0x37,
+0x20,0x20,0x6c,0x6f,0x61,0x64,0x31,0x20,
+0x34,0x39,0x20,0x20,0x3d,0x20,0x33,0x39,
+0x20,0x20,0x73,0x65,0x74,0x63,0x2e,0x6c,
+0x20,0x36,0x34,0x20,0x20,0x73,0x75,0x62,
+0x32,0x20,0x37,0x32,0x20,0x20,0x62,0x72,
+0x6e,0x65,0x2e,0x6c,0x20,0x38,0x33,0x20,
+0x20,0x6c,0x61,0x72,0x67,0x63,0x20,0x37,
+0x34,0x20,0x20,0x62,0x72,0x6e,0x6e,0x20,
+0x38,0x35,0x20,0x20,0x6c,0x6f,0x61,0x64,
+0x63,0x2e,0x6c,0x20,0x35,0x38,0x20,0x20,
+0x6c,0x6f,0x61,0x64,0x69,0x38,0x20,0x35,
+0x30,0x20,0x20,0x3c,0x20,0x34,0x30,0x20,
+0x20,0x6e,0x6f,0x70,0x20,0x30,0x20,0x20,
+0x73,0x65,0x74,0x2d,0x63,0x64,0x72,0x21,
+0x20,0x33,0x32,0x20,0x20,0x6c,0x6f,0x61,
+0x64,0x61,0x20,0x35,0x35,0x20,0x20,0x62,
+0x6f,0x75,0x6e,0x64,0x3f,0x20,0x32,0x31,
+0x20,0x20,0x2f,0x20,0x33,0x37,0x20,0x20,
+0x6e,0x65,0x67,0x20,0x37,0x33,0x20,0x20,
+0x62,0x72,0x6e,0x2e,0x6c,0x20,0x38,0x38,
+0x20,0x20,0x6c,0x76,0x61,0x72,0x67,0x63,
+0x20,0x37,0x35,0x20,0x20,0x62,0x72,0x74,
+0x20,0x37,0x20,0x20,0x74,0x72,0x79,0x63,
+0x61,0x74,0x63,0x68,0x20,0x36,0x38,0x20,
+0x20,0x6e,0x75,0x6c,0x6c,0x3f,0x20,0x31,
+0x37,0x20,0x20,0x6c,0x6f,0x61,0x64,0x30,
+0x20,0x34,0x38,0x20,0x20,0x6a,0x6d,0x70,
+0x2e,0x6c,0x20,0x38,0x20,0x20,0x6c,0x6f,
+0x61,0x64,0x76,0x20,0x35,0x31,0x20,0x20,
+0x73,0x65,0x74,0x61,0x20,0x36,0x31,0x20,
+0x20,0x6b,0x65,0x79,0x61,0x72,0x67,0x73,
+0x20,0x39,0x31,0x20,0x20,0x2a,0x20,0x33,
+0x36,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x3f,0x20,0x32,0x36,0x20,
+0x20,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,
+0x3f,0x20,0x32,0x33,0x20,0x20,0x61,0x72,
+0x65,0x66,0x20,0x34,0x33,0x20,0x20,0x6f,
+0x70,0x74,0x61,0x72,0x67,0x73,0x20,0x38,
+0x39,0x20,0x20,0x76,0x65,0x63,0x74,0x6f,
+0x72,0x3f,0x20,0x32,0x34,0x20,0x20,0x6c,
+0x6f,0x61,0x64,0x74,0x20,0x34,0x35,0x20,
+0x20,0x62,0x72,0x66,0x20,0x36,0x20,0x20,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3f,0x20,
+0x31,0x39,0x20,0x20,0x63,0x64,0x72,0x20,
+0x33,0x30,0x20,0x20,0x66,0x6f,0x72,0x20,
+0x36,0x39,0x20,0x20,0x6c,0x6f,0x61,0x64,
+0x63,0x30,0x30,0x20,0x37,0x38,0x20,0x20,
+0x70,0x6f,0x70,0x20,0x32,0x20,0x20,0x70,
+0x61,0x69,0x72,0x3f,0x20,0x32,0x32,0x20,
+0x20,0x63,0x61,0x64,0x72,0x20,0x38,0x34,
+0x20,0x20,0x63,0x6c,0x6f,0x73,0x75,0x72,
+0x65,0x20,0x36,0x35,0x20,0x20,0x6c,0x6f,
+0x61,0x64,0x66,0x20,0x34,0x36,0x20,0x20,
+0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0x20,
+0x34,0x31,0x20,0x20,0x6c,0x6f,0x61,0x64,
+0x76,0x2e,0x6c,0x20,0x35,0x32,0x20,0x20,
+0x73,0x65,0x74,0x67,0x2e,0x6c,0x20,0x36,
+0x30,0x20,0x20,0x62,0x72,0x6e,0x20,0x38,
+0x37,0x20,0x20,0x65,0x71,0x76,0x3f,0x20,
+0x31,0x33,0x20,0x20,0x61,0x73,0x65,0x74,
+0x21,0x20,0x34,0x34,0x20,0x20,0x65,0x71,
+0x3f,0x20,0x31,0x32,0x20,0x20,0x61,0x74,
+0x6f,0x6d,0x3f,0x20,0x31,0x35,0x20,0x20,
+0x62,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x3f,
+0x20,0x31,0x38,0x20,0x20,0x62,0x72,0x74,
+0x2e,0x6c,0x20,0x31,0x30,0x20,0x20,0x74,
+0x61,0x70,0x70,0x6c,0x79,0x20,0x37,0x30,
 0x20,0x20,0x64,0x75,0x6d,0x6d,0x79,0x5f,
-0x66,0x20,0x39,0x33,0x20,0x20,0x61,0x64,
-0x64,0x32,0x20,0x37,0x31,0x20,0x20,0x73,
-0x65,0x74,0x61,0x2e,0x6c,0x20,0x36,0x32,
-0x20,0x20,0x6c,0x6f,0x61,0x64,0x6e,0x69,
-0x6c,0x20,0x34,0x37,0x20,0x20,0x62,0x72,
-0x6e,0x6e,0x2e,0x6c,0x20,0x38,0x36,0x20,
-0x20,0x73,0x65,0x74,0x63,0x20,0x36,0x33,
-0x20,0x20,0x73,0x65,0x74,0x2d,0x63,0x61,
-0x72,0x21,0x20,0x33,0x31,0x20,0x20,0x76,
-0x65,0x63,0x74,0x6f,0x72,0x20,0x34,0x32,
-0x20,0x20,0x6c,0x6f,0x61,0x64,0x67,0x20,
-0x35,0x33,0x20,0x20,0x6c,0x6f,0x61,0x64,
-0x61,0x2e,0x6c,0x20,0x35,0x36,0x20,0x20,
-0x61,0x72,0x67,0x63,0x20,0x36,0x36,0x20,
-0x20,0x64,0x69,0x76,0x30,0x20,0x33,0x38,
-0x20,0x20,0x72,0x65,0x74,0x20,0x31,0x31,
-0x20,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,
-0x3f,0x20,0x32,0x30,0x20,0x20,0x65,0x71,
-0x75,0x61,0x6c,0x3f,0x20,0x31,0x34,0x20,
-0x20,0x63,0x61,0x72,0x20,0x32,0x39,0x20,
-0x20,0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,
-0x38,0x30,0x20,0x20,0x62,0x72,0x6e,0x65,
-0x20,0x38,0x32,0x29,0x20,0x5f,0x5f,0x69,
-0x6e,0x69,0x74,0x5f,0x67,0x6c,0x6f,0x62,
-0x61,0x6c,0x73,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x30,0x65,
-0x30,0x63,0x31,0x5c,0x78,0x38,0x32,0x3e,
-0x30,0x63,0x32,0x6b,0x33,0x32,0x63,0x34,
-0x6b,0x35,0x35,0x3b,0x30,0x63,0x36,0x6b,
-0x33,0x32,0x63,0x37,0x6b,0x35,0x32,0x65,
-0x38,0x6b,0x39,0x32,0x65,0x3a,0x6b,0x3b,
-0x32,0x65,0x3c,0x6b,0x3d,0x3b,0x22,0x20,
-0x5b,0x2a,0x6f,0x73,0x2d,0x6e,0x61,0x6d,
-0x65,0x2a,0x20,0x77,0x69,0x6e,0x64,0x6f,
-0x77,0x73,0x20,0x22,0x5c,0x5c,0x22,0x20,
-0x2a,0x64,0x69,0x72,0x65,0x63,0x74,0x6f,
-0x72,0x79,0x2d,0x73,0x65,0x70,0x61,0x72,
-0x61,0x74,0x6f,0x72,0x2a,0x20,0x22,0x5c,
-0x72,0x5c,0x6e,0x22,0x20,0x2a,0x6c,0x69,
-0x6e,0x65,0x66,0x65,0x65,0x64,0x2a,0x20,
-0x22,0x2f,0x22,0x20,0x22,0x5c,0x6e,0x22,
-0x20,0x2a,0x73,0x74,0x64,0x6f,0x75,0x74,
-0x2a,0x20,0x2a,0x6f,0x75,0x74,0x70,0x75,
-0x74,0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,
-0x2a,0x20,0x2a,0x73,0x74,0x64,0x69,0x6e,
-0x2a,0x20,0x2a,0x69,0x6e,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
-0x20,0x2a,0x73,0x74,0x64,0x65,0x72,0x72,
-0x2a,0x20,0x2a,0x65,0x72,0x72,0x6f,0x72,
+0x6e,0x69,0x6c,0x20,0x39,0x34,0x20,0x20,
+0x6c,0x6f,0x61,0x64,0x61,0x30,0x20,0x37,
+0x36,0x20,0x20,0x62,0x72,0x62,0x6f,0x75,
+0x6e,0x64,0x20,0x39,0x30,0x20,0x20,0x6c,
+0x69,0x73,0x74,0x20,0x32,0x38,0x20,0x20,
+0x64,0x75,0x70,0x20,0x31,0x20,0x20,0x61,
+0x70,0x70,0x6c,0x79,0x20,0x33,0x33,0x20,
+0x20,0x6c,0x6f,0x61,0x64,0x63,0x20,0x35,
+0x37,0x20,0x20,0x6c,0x6f,0x61,0x64,0x63,
+0x30,0x31,0x20,0x37,0x39,0x20,0x20,0x64,
+0x75,0x6d,0x6d,0x79,0x5f,0x74,0x20,0x39,
+0x32,0x20,0x20,0x73,0x65,0x74,0x67,0x20,
+0x35,0x39,0x20,0x20,0x6c,0x6f,0x61,0x64,
+0x61,0x31,0x20,0x37,0x37,0x20,0x20,0x74,
+0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,0x38,
+0x31,0x20,0x20,0x6a,0x6d,0x70,0x20,0x35,
+0x20,0x20,0x66,0x69,0x78,0x6e,0x75,0x6d,
+0x3f,0x20,0x32,0x35,0x20,0x20,0x63,0x6f,
+0x6e,0x73,0x20,0x32,0x37,0x20,0x20,0x6c,
+0x6f,0x61,0x64,0x67,0x2e,0x6c,0x20,0x35,
+0x34,0x20,0x20,0x74,0x63,0x61,0x6c,0x6c,
+0x20,0x34,0x20,0x20,0x63,0x61,0x6c,0x6c,
+0x20,0x33,0x20,0x20,0x2d,0x20,0x33,0x35,
+0x20,0x20,0x62,0x72,0x66,0x2e,0x6c,0x20,
+0x39,0x20,0x20,0x2b,0x20,0x33,0x34,0x20,
+0x20,0x64,0x75,0x6d,0x6d,0x79,0x5f,0x66,
+0x20,0x39,0x33,0x20,0x20,0x61,0x64,0x64,
+0x32,0x20,0x37,0x31,0x20,0x20,0x73,0x65,
+0x74,0x61,0x2e,0x6c,0x20,0x36,0x32,0x20,
+0x20,0x6c,0x6f,0x61,0x64,0x6e,0x69,0x6c,
+0x20,0x34,0x37,0x20,0x20,0x62,0x72,0x6e,
+0x6e,0x2e,0x6c,0x20,0x38,0x36,0x20,0x20,
+0x73,0x65,0x74,0x63,0x20,0x36,0x33,0x20,
+0x20,0x73,0x65,0x74,0x2d,0x63,0x61,0x72,
+0x21,0x20,0x33,0x31,0x20,0x20,0x76,0x65,
+0x63,0x74,0x6f,0x72,0x20,0x34,0x32,0x20,
+0x20,0x6c,0x6f,0x61,0x64,0x67,0x20,0x35,
+0x33,0x20,0x20,0x6c,0x6f,0x61,0x64,0x61,
+0x2e,0x6c,0x20,0x35,0x36,0x20,0x20,0x61,
+0x72,0x67,0x63,0x20,0x36,0x36,0x20,0x20,
+0x64,0x69,0x76,0x30,0x20,0x33,0x38,0x20,
+0x20,0x72,0x65,0x74,0x20,0x31,0x31,0x20,
+0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x3f,
+0x20,0x32,0x30,0x20,0x20,0x65,0x71,0x75,
+0x61,0x6c,0x3f,0x20,0x31,0x34,0x20,0x20,
+0x63,0x61,0x72,0x20,0x32,0x39,0x20,0x20,
+0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,0x38,
+0x30,0x20,0x20,0x62,0x72,0x6e,0x65,0x20,
+0x38,0x32,0x29,0x20,0x5f,0x5f,0x69,0x6e,
+0x69,0x74,0x5f,0x67,0x6c,0x6f,0x62,0x61,
+0x6c,0x73,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x30,0x65,0x30,
+0x63,0x31,0x5c,0x78,0x38,0x32,0x3e,0x30,
+0x63,0x32,0x6b,0x33,0x32,0x63,0x34,0x6b,
+0x35,0x35,0x3b,0x30,0x63,0x36,0x6b,0x33,
+0x32,0x63,0x37,0x6b,0x35,0x32,0x65,0x38,
+0x6b,0x39,0x32,0x65,0x3a,0x6b,0x3b,0x32,
+0x65,0x3c,0x6b,0x3d,0x3b,0x22,0x20,0x5b,
+0x2a,0x6f,0x73,0x2d,0x6e,0x61,0x6d,0x65,
+0x2a,0x20,0x77,0x69,0x6e,0x64,0x6f,0x77,
+0x73,0x20,0x22,0x5c,0x5c,0x22,0x20,0x2a,
+0x64,0x69,0x72,0x65,0x63,0x74,0x6f,0x72,
+0x79,0x2d,0x73,0x65,0x70,0x61,0x72,0x61,
+0x74,0x6f,0x72,0x2a,0x20,0x22,0x5c,0x72,
+0x5c,0x6e,0x22,0x20,0x2a,0x6c,0x69,0x6e,
+0x65,0x66,0x65,0x65,0x64,0x2a,0x20,0x22,
+0x2f,0x22,0x20,0x22,0x5c,0x6e,0x22,0x20,
+0x2a,0x73,0x74,0x64,0x6f,0x75,0x74,0x2a,
+0x20,0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,
 0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
-0x5d,0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,
-0x5f,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,
-0x29,0x20,0x5f,0x5f,0x73,0x63,0x72,0x69,
-0x70,0x74,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x63,0x31,0x74,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x30,0x65,0x30,0x7e,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x6c,0x6f,0x61,0x64,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x7c,0x33,0x31,0x32,0x63,0x31,0x61,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x74,0x6f,0x70,
-0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2d,0x65,
-0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
-0x2d,0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,
-0x20,0x23,0x66,0x6e,0x28,0x65,0x78,0x69,
-0x74,0x29,0x5d,0x29,0x5d,0x20,0x5f,0x5f,
-0x73,0x63,0x72,0x69,0x70,0x74,0x29,0x20,
-0x5f,0x5f,0x73,0x74,0x61,0x72,0x74,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x33,0x30,0x32,
-0x7c,0x4e,0x46,0x36,0x44,0x30,0x7c,0x4e,
-0x6b,0x31,0x32,0x5e,0x6b,0x32,0x32,0x65,
-0x33,0x7c,0x5c,0x78,0x38,0x34,0x33,0x31,
-0x35,0x43,0x30,0x7c,0x6b,0x31,0x32,0x5d,
-0x6b,0x32,0x32,0x65,0x34,0x33,0x30,0x32,
-0x65,0x35,0x33,0x30,0x32,0x63,0x36,0x60,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x5f,0x5f,
-0x69,0x6e,0x69,0x74,0x5f,0x67,0x6c,0x6f,
-0x62,0x61,0x6c,0x73,0x20,0x2a,0x61,0x72,
-0x67,0x76,0x2a,0x20,0x2a,0x69,0x6e,0x74,
-0x65,0x72,0x61,0x63,0x74,0x69,0x76,0x65,
-0x2a,0x20,0x5f,0x5f,0x73,0x63,0x72,0x69,
-0x70,0x74,0x20,0x64,0x69,0x73,0x70,0x6c,
-0x61,0x79,0x2d,0x62,0x61,0x6e,0x6e,0x65,
-0x72,0x20,0x72,0x65,0x70,0x6c,0x20,0x23,
-0x66,0x6e,0x28,0x65,0x78,0x69,0x74,0x29,
-0x5d,0x20,0x5f,0x5f,0x73,0x74,0x61,0x72,
-0x74,0x29,0x20,0x61,0x62,0x73,0x20,0x23,
+0x20,0x2a,0x73,0x74,0x64,0x69,0x6e,0x2a,
+0x20,0x2a,0x69,0x6e,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,
+0x2a,0x73,0x74,0x64,0x65,0x72,0x72,0x2a,
+0x20,0x2a,0x65,0x72,0x72,0x6f,0x72,0x2d,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x5d,
+0x20,0x5f,0x5f,0x69,0x6e,0x69,0x74,0x5f,
+0x67,0x6c,0x6f,0x62,0x61,0x6c,0x73,0x29,
+0x20,0x5f,0x5f,0x73,0x63,0x72,0x69,0x70,
+0x74,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x63,0x31,0x74,0x3b,0x22,0x20,0x5b,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x60,0x58,0x36,0x35,0x30,
-0x7c,0x79,0x3b,0x7c,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x61,0x62,0x73,0x29,0x20,0x61,
-0x6e,0x64,0x6d,0x61,0x70,0x20,0x23,0x35,
-0x3d,0x23,0x66,0x6e,0x28,0x22,0x3f,0x30,
-0x30,0x30,0x73,0x32,0x7d,0x41,0x31,0x37,
-0x54,0x30,0x32,0x7c,0x7d,0x4d,0x63,0x30,
-0x63,0x31,0x67,0x32,0x33,0x32,0x51,0x33,
-0x31,0x36,0x42,0x30,0x32,0x65,0x32,0x7c,
-0x7d,0x4e,0x63,0x30,0x63,0x33,0x67,0x32,
-0x33,0x32,0x76,0x34,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,
-0x20,0x23,0x2e,0x63,0x61,0x72,0x20,0x66,
-0x6f,0x72,0x2d,0x61,0x6c,0x6c,0x20,0x23,
-0x2e,0x63,0x64,0x72,0x5d,0x20,0x66,0x6f,
-0x72,0x2d,0x61,0x6c,0x6c,0x29,0x20,0x61,
-0x6e,0x79,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x32,0x7d,0x46,
-0x31,0x36,0x44,0x30,0x32,0x7c,0x7d,0x4d,
-0x33,0x31,0x31,0x37,0x3a,0x30,0x32,0x65,
-0x30,0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x61,0x6e,0x79,0x5d,0x20,0x61,
-0x6e,0x79,0x29,0x20,0x61,0x70,0x72,0x6f,
-0x70,0x6f,0x73,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x73,0x30,0x63,
-0x30,0x65,0x31,0x7c,0x51,0x32,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x41,0x40,0x31,0x36,0x40,0x30,0x32,0x65,
-0x30,0x63,0x31,0x7c,0x33,0x32,0x31,0x36,
-0x34,0x30,0x32,0x5d,0x3b,0x22,0x20,0x5b,
-0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x65,0x31,
-0x63,0x32,0x65,0x33,0x7c,0x33,0x31,0x33,
-0x31,0x63,0x34,0x65,0x35,0x7c,0x33,0x31,
-0x33,0x33,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
-0x6c,0x61,0x79,0x6c,0x6e,0x29,0x20,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2d,0x61,0x70,
-0x70,0x65,0x6e,0x64,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x4a,0x36,0x35,0x30,0x63,0x30,0x3b,
-0x63,0x31,0x3b,0x22,0x20,0x5b,0x22,0x70,
-0x72,0x6f,0x63,0x65,0x64,0x75,0x72,0x65,
-0x22,0x20,0x22,0x76,0x61,0x72,0x69,0x61,
-0x62,0x6c,0x65,0x20,0x22,0x5d,0x29,0x20,
-0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x76,
-0x61,0x6c,0x75,0x65,0x20,0x22,0x20,0x20,
-0x22,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x5d,0x29,0x5d,0x29,0x20,0x61,0x70,0x72,
-0x6f,0x70,0x6f,0x73,0x2d,0x6c,0x69,0x73,
-0x74,0x5d,0x20,0x61,0x70,0x72,0x6f,0x70,
-0x6f,0x73,0x29,0x20,0x61,0x70,0x72,0x6f,
+0x72,0x30,0x65,0x30,0x7e,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x6c,0x6f,0x61,0x64,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x7c,
+0x33,0x31,0x32,0x63,0x31,0x61,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x74,0x6f,0x70,0x2d,
+0x6c,0x65,0x76,0x65,0x6c,0x2d,0x65,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,
+0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,
+0x23,0x66,0x6e,0x28,0x65,0x78,0x69,0x74,
+0x29,0x5d,0x29,0x5d,0x20,0x5f,0x5f,0x73,
+0x63,0x72,0x69,0x70,0x74,0x29,0x20,0x5f,
+0x5f,0x73,0x74,0x61,0x72,0x74,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x33,0x30,0x32,0x7c,
+0x4e,0x46,0x36,0x44,0x30,0x7c,0x4e,0x6b,
+0x31,0x32,0x5e,0x6b,0x32,0x32,0x65,0x33,
+0x7c,0x5c,0x78,0x38,0x34,0x33,0x31,0x35,
+0x43,0x30,0x7c,0x6b,0x31,0x32,0x5d,0x6b,
+0x32,0x32,0x65,0x34,0x33,0x30,0x32,0x65,
+0x35,0x33,0x30,0x32,0x63,0x36,0x60,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x5f,0x5f,0x69,
+0x6e,0x69,0x74,0x5f,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x73,0x20,0x2a,0x61,0x72,0x67,
+0x76,0x2a,0x20,0x2a,0x69,0x6e,0x74,0x65,
+0x72,0x61,0x63,0x74,0x69,0x76,0x65,0x2a,
+0x20,0x5f,0x5f,0x73,0x63,0x72,0x69,0x70,
+0x74,0x20,0x64,0x69,0x73,0x70,0x6c,0x61,
+0x79,0x2d,0x62,0x61,0x6e,0x6e,0x65,0x72,
+0x20,0x72,0x65,0x70,0x6c,0x20,0x23,0x66,
+0x6e,0x28,0x65,0x78,0x69,0x74,0x29,0x5d,
+0x20,0x5f,0x5f,0x73,0x74,0x61,0x72,0x74,
+0x29,0x20,0x61,0x62,0x73,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x60,0x58,0x36,0x35,0x30,0x7c,
+0x79,0x3b,0x7c,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x61,0x62,0x73,0x29,0x20,0x61,0x6e,
+0x64,0x6d,0x61,0x70,0x20,0x23,0x35,0x3d,
+0x23,0x66,0x6e,0x28,0x22,0x3f,0x30,0x30,
+0x30,0x73,0x32,0x7d,0x41,0x31,0x37,0x54,
+0x30,0x32,0x7c,0x7d,0x4d,0x63,0x30,0x63,
+0x31,0x67,0x32,0x33,0x32,0x51,0x33,0x31,
+0x36,0x42,0x30,0x32,0x65,0x32,0x7c,0x7d,
+0x4e,0x63,0x30,0x63,0x33,0x67,0x32,0x33,
+0x32,0x76,0x34,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
+0x23,0x2e,0x63,0x61,0x72,0x20,0x66,0x6f,
+0x72,0x2d,0x61,0x6c,0x6c,0x20,0x23,0x2e,
+0x63,0x64,0x72,0x5d,0x20,0x66,0x6f,0x72,
+0x2d,0x61,0x6c,0x6c,0x29,0x20,0x61,0x6e,
+0x79,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x32,0x7d,0x46,0x31,
+0x36,0x44,0x30,0x32,0x7c,0x7d,0x4d,0x33,
+0x31,0x31,0x37,0x3a,0x30,0x32,0x65,0x30,
+0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x61,0x6e,0x79,0x5d,0x20,0x61,0x6e,
+0x79,0x29,0x20,0x61,0x70,0x72,0x6f,0x70,
+0x6f,0x73,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3a,0x30,0x30,0x30,0x73,0x30,0x63,0x30,
+0x65,0x31,0x7c,0x51,0x32,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x7c,0x41,
+0x40,0x31,0x36,0x40,0x30,0x32,0x65,0x30,
+0x63,0x31,0x7c,0x33,0x32,0x31,0x36,0x34,
+0x30,0x32,0x5d,0x3b,0x22,0x20,0x5b,0x66,
+0x6f,0x72,0x2d,0x65,0x61,0x63,0x68,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x65,0x31,0x63,
+0x32,0x65,0x33,0x7c,0x33,0x31,0x33,0x31,
+0x63,0x34,0x65,0x35,0x7c,0x33,0x31,0x33,
+0x33,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,
+0x61,0x79,0x6c,0x6e,0x29,0x20,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x2d,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x4a,0x36,0x35,0x30,0x63,0x30,0x3b,0x63,
+0x31,0x3b,0x22,0x20,0x5b,0x22,0x70,0x72,
+0x6f,0x63,0x65,0x64,0x75,0x72,0x65,0x22,
+0x20,0x22,0x76,0x61,0x72,0x69,0x61,0x62,
+0x6c,0x65,0x20,0x22,0x5d,0x29,0x20,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x76,0x61,
+0x6c,0x75,0x65,0x20,0x22,0x20,0x20,0x22,
+0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,
+0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,0x5d,
+0x29,0x5d,0x29,0x20,0x61,0x70,0x72,0x6f,
 0x70,0x6f,0x73,0x2d,0x6c,0x69,0x73,0x74,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x63,0x31,
-0x63,0x32,0x7c,0x33,0x31,0x36,0x36,0x30,
-0x7c,0x35,0x45,0x30,0x7c,0x43,0x36,0x3a,
-0x30,0x65,0x33,0x7c,0x33,0x31,0x35,0x38,
-0x30,0x65,0x34,0x63,0x35,0x33,0x31,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x31,0x60,0x65,0x30,0x7c,0x33,0x31,
-0x57,0x36,0x34,0x30,0x5f,0x3b,0x65,0x31,
-0x65,0x32,0x63,0x33,0x71,0x63,0x34,0x33,
-0x30,0x33,0x32,0x65,0x35,0x65,0x36,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2d,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x20,0x73,0x6f,0x72,0x74,0x20,
-0x66,0x69,0x6c,0x74,0x65,0x72,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x63,0x31,0x65,0x32,
-0x7c,0x33,0x31,0x33,0x31,0x7e,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x66,
-0x69,0x6e,0x64,0x29,0x20,0x23,0x66,0x6e,
+0x5d,0x20,0x61,0x70,0x72,0x6f,0x70,0x6f,
+0x73,0x29,0x20,0x61,0x70,0x72,0x6f,0x70,
+0x6f,0x73,0x2d,0x6c,0x69,0x73,0x74,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x63,0x31,0x63,
+0x32,0x7c,0x33,0x31,0x36,0x36,0x30,0x7c,
+0x35,0x45,0x30,0x7c,0x43,0x36,0x3a,0x30,
+0x65,0x33,0x7c,0x33,0x31,0x35,0x38,0x30,
+0x65,0x34,0x63,0x35,0x33,0x31,0x33,0x31,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x31,0x60,0x65,0x30,0x7c,0x33,0x31,0x57,
+0x36,0x34,0x30,0x5f,0x3b,0x65,0x31,0x65,
+0x32,0x63,0x33,0x71,0x63,0x34,0x33,0x30,
+0x33,0x32,0x65,0x35,0x65,0x36,0x34,0x33,
+0x3b,0x22,0x20,0x5b,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2d,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x20,0x73,0x6f,0x72,0x74,0x20,0x66,
+0x69,0x6c,0x74,0x65,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x63,0x31,0x65,0x32,0x7c,
+0x33,0x31,0x33,0x31,0x7e,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x66,0x69,
+0x6e,0x64,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x64,
+0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,0x29,
+0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,
+0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x65,0x6e,
+0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,
+0x74,0x29,0x20,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x3c,0x3f,0x20,0x73,0x79,0x6d,0x62,
+0x6f,0x6c,0x2d,0x3e,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x5d,0x29,0x20,0x23,0x66,0x6e,
 0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,
 0x64,0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,
-0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x65,
-0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,
-0x6e,0x74,0x29,0x20,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x3c,0x3f,0x20,0x73,0x79,0x6d,
-0x62,0x6f,0x6c,0x2d,0x3e,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x5d,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x2d,0x64,0x6f,0x77,0x6e,0x63,0x61,0x73,
-0x65,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x3f,0x29,0x20,
-0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x3e,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x65,
-0x72,0x72,0x6f,0x72,0x20,0x22,0x50,0x6c,
-0x65,0x61,0x73,0x65,0x20,0x67,0x69,0x76,
-0x65,0x20,0x61,0x20,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x20,0x6f,0x72,0x20,0x73,0x79,
-0x6d,0x62,0x6f,0x6c,0x20,0x6b,0x65,0x79,
-0x22,0x5d,0x20,0x61,0x70,0x72,0x6f,0x70,
-0x6f,0x73,0x2d,0x6c,0x69,0x73,0x74,0x29,
-0x20,0x61,0x72,0x67,0x2d,0x63,0x6f,0x75,
-0x6e,0x74,0x73,0x20,0x23,0x74,0x61,0x62,
-0x6c,0x65,0x28,0x23,0x2e,0x65,0x71,0x75,
-0x61,0x6c,0x3f,0x20,0x32,0x20,0x20,0x23,
-0x2e,0x61,0x74,0x6f,0x6d,0x3f,0x20,0x31,
-0x20,0x20,0x23,0x2e,0x73,0x65,0x74,0x2d,
-0x63,0x64,0x72,0x21,0x20,0x32,0x20,0x20,
-0x23,0x2e,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-0x3f,0x20,0x31,0x20,0x20,0x23,0x2e,0x63,
-0x61,0x72,0x20,0x31,0x20,0x20,0x23,0x2e,
-0x65,0x71,0x3f,0x20,0x32,0x20,0x20,0x23,
-0x2e,0x61,0x72,0x65,0x66,0x20,0x32,0x20,
-0x20,0x23,0x2e,0x62,0x6f,0x6f,0x6c,0x65,
-0x61,0x6e,0x3f,0x20,0x31,0x20,0x20,0x23,
-0x2e,0x6e,0x6f,0x74,0x20,0x31,0x20,0x20,
-0x23,0x2e,0x6e,0x75,0x6c,0x6c,0x3f,0x20,
-0x31,0x20,0x20,0x23,0x2e,0x65,0x71,0x76,
-0x3f,0x20,0x32,0x20,0x20,0x23,0x2e,0x6e,
-0x75,0x6d,0x62,0x65,0x72,0x3f,0x20,0x31,
-0x20,0x20,0x23,0x2e,0x70,0x61,0x69,0x72,
-0x3f,0x20,0x31,0x20,0x20,0x23,0x2e,0x62,
-0x75,0x69,0x6c,0x74,0x69,0x6e,0x3f,0x20,
-0x31,0x20,0x20,0x23,0x2e,0x61,0x73,0x65,
-0x74,0x21,0x20,0x33,0x20,0x20,0x23,0x2e,
-0x64,0x69,0x76,0x30,0x20,0x32,0x20,0x20,
-0x23,0x2e,0x3d,0x20,0x32,0x20,0x20,0x23,
-0x2e,0x62,0x6f,0x75,0x6e,0x64,0x3f,0x20,
-0x31,0x20,0x20,0x23,0x2e,0x63,0x6f,0x6d,
-0x70,0x61,0x72,0x65,0x20,0x32,0x20,0x20,
-0x23,0x2e,0x76,0x65,0x63,0x74,0x6f,0x72,
-0x3f,0x20,0x31,0x20,0x20,0x23,0x2e,0x63,
-0x64,0x72,0x20,0x31,0x20,0x20,0x23,0x2e,
-0x73,0x65,0x74,0x2d,0x63,0x61,0x72,0x21,
-0x20,0x32,0x20,0x20,0x23,0x2e,0x3c,0x20,
-0x32,0x20,0x20,0x23,0x2e,0x66,0x69,0x78,
-0x6e,0x75,0x6d,0x3f,0x20,0x31,0x20,0x20,
-0x23,0x2e,0x63,0x6f,0x6e,0x73,0x20,0x32,
-0x29,0x20,0x61,0x72,0x67,0x63,0x2d,0x65,
-0x72,0x72,0x6f,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3c,0x30,0x30,0x30,0x72,0x32,
-0x65,0x30,0x63,0x31,0x7c,0x63,0x32,0x7d,
-0x7d,0x61,0x57,0x36,0x37,0x30,0x63,0x33,
-0x35,0x34,0x30,0x63,0x34,0x34,0x35,0x3b,
-0x22,0x20,0x5b,0x65,0x72,0x72,0x6f,0x72,
-0x20,0x22,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,
-0x20,0x22,0x20,0x22,0x20,0x65,0x78,0x70,
-0x65,0x63,0x74,0x73,0x20,0x22,0x20,0x22,
-0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,
-0x74,0x2e,0x22,0x20,0x22,0x20,0x61,0x72,
-0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0x2e,
-0x22,0x5d,0x20,0x61,0x72,0x67,0x63,0x2d,
-0x65,0x72,0x72,0x6f,0x72,0x29,0x20,0x61,
-0x72,0x69,0x74,0x68,0x6d,0x65,0x74,0x69,
-0x63,0x2d,0x73,0x68,0x69,0x66,0x74,0x20,
-0x23,0x66,0x6e,0x28,0x61,0x73,0x68,0x29,
-0x20,0x61,0x72,0x72,0x61,0x79,0x2d,0x64,
-0x69,0x6d,0x65,0x6e,0x73,0x69,0x6f,0x6e,
-0x73,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
-0x33,0x31,0x4c,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x29,0x5d,0x20,0x61,0x72,0x72,
-0x61,0x79,0x2d,0x64,0x69,0x6d,0x65,0x6e,
-0x73,0x69,0x6f,0x6e,0x73,0x29,0x20,0x61,
-0x72,0x72,0x61,0x79,0x2d,0x72,0x65,0x66,
-0x20,0x23,0x2e,0x61,0x72,0x65,0x66,0x20,
-0x61,0x72,0x72,0x61,0x79,0x2d,0x73,0x65,
-0x74,0x21,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3d,0x30,0x30,0x30,0x73,0x33,0x67,0x33,
-0x5c,0x78,0x38,0x35,0x38,0x30,0x7c,0x67,
-0x32,0x7d,0x5c,0x5c,0x3b,0x65,0x30,0x63,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x65,
-0x72,0x72,0x6f,0x72,0x20,0x22,0x61,0x72,
-0x72,0x61,0x79,0x2d,0x73,0x65,0x74,0x21,
-0x3a,0x20,0x6d,0x75,0x6c,0x74,0x69,0x70,
-0x6c,0x65,0x20,0x64,0x69,0x6d,0x65,0x6e,
-0x73,0x69,0x6f,0x6e,0x73,0x20,0x6e,0x6f,
-0x74,0x20,0x79,0x65,0x74,0x20,0x69,0x6d,
-0x70,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x65,
-0x64,0x22,0x5d,0x20,0x61,0x72,0x72,0x61,
-0x79,0x2d,0x73,0x65,0x74,0x21,0x29,0x20,
-0x61,0x72,0x72,0x61,0x79,0x3f,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x48,0x31,0x37,0x3c,0x30,
-0x32,0x63,0x30,0x63,0x31,0x7c,0x33,0x31,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x46,0x31,0x36,0x38,0x30,0x32,
-0x7c,0x4d,0x63,0x30,0x3c,0x3b,0x22,0x20,
-0x5b,0x61,0x72,0x72,0x61,0x79,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x74,0x79,0x70,
-0x65,0x6f,0x66,0x29,0x5d,0x20,0x61,0x72,
-0x72,0x61,0x79,0x3f,0x29,0x20,0x61,0x73,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x3f,0x29,0x20,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x3e,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x20,0x65,0x72,
+0x72,0x6f,0x72,0x20,0x22,0x50,0x6c,0x65,
+0x61,0x73,0x65,0x20,0x67,0x69,0x76,0x65,
+0x20,0x61,0x20,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x20,0x6f,0x72,0x20,0x73,0x79,0x6d,
+0x62,0x6f,0x6c,0x20,0x6b,0x65,0x79,0x22,
+0x5d,0x20,0x61,0x70,0x72,0x6f,0x70,0x6f,
+0x73,0x2d,0x6c,0x69,0x73,0x74,0x29,0x20,
+0x61,0x72,0x67,0x2d,0x63,0x6f,0x75,0x6e,
+0x74,0x73,0x20,0x23,0x74,0x61,0x62,0x6c,
+0x65,0x28,0x23,0x2e,0x65,0x71,0x75,0x61,
+0x6c,0x3f,0x20,0x32,0x20,0x20,0x23,0x2e,
+0x61,0x74,0x6f,0x6d,0x3f,0x20,0x31,0x20,
+0x20,0x23,0x2e,0x73,0x65,0x74,0x2d,0x63,
+0x64,0x72,0x21,0x20,0x32,0x20,0x20,0x23,
+0x2e,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x3f,
+0x20,0x31,0x20,0x20,0x23,0x2e,0x63,0x61,
+0x72,0x20,0x31,0x20,0x20,0x23,0x2e,0x65,
+0x71,0x3f,0x20,0x32,0x20,0x20,0x23,0x2e,
+0x61,0x72,0x65,0x66,0x20,0x32,0x20,0x20,
+0x23,0x2e,0x62,0x6f,0x6f,0x6c,0x65,0x61,
+0x6e,0x3f,0x20,0x31,0x20,0x20,0x23,0x2e,
+0x6e,0x6f,0x74,0x20,0x31,0x20,0x20,0x23,
+0x2e,0x6e,0x75,0x6c,0x6c,0x3f,0x20,0x31,
+0x20,0x20,0x23,0x2e,0x65,0x71,0x76,0x3f,
+0x20,0x32,0x20,0x20,0x23,0x2e,0x6e,0x75,
+0x6d,0x62,0x65,0x72,0x3f,0x20,0x31,0x20,
+0x20,0x23,0x2e,0x70,0x61,0x69,0x72,0x3f,
+0x20,0x31,0x20,0x20,0x23,0x2e,0x62,0x75,
+0x69,0x6c,0x74,0x69,0x6e,0x3f,0x20,0x31,
+0x20,0x20,0x23,0x2e,0x61,0x73,0x65,0x74,
+0x21,0x20,0x33,0x20,0x20,0x23,0x2e,0x64,
+0x69,0x76,0x30,0x20,0x32,0x20,0x20,0x23,
+0x2e,0x3d,0x20,0x32,0x20,0x20,0x23,0x2e,
+0x62,0x6f,0x75,0x6e,0x64,0x3f,0x20,0x31,
+0x20,0x20,0x23,0x2e,0x63,0x6f,0x6d,0x70,
+0x61,0x72,0x65,0x20,0x32,0x20,0x20,0x23,
+0x2e,0x76,0x65,0x63,0x74,0x6f,0x72,0x3f,
+0x20,0x31,0x20,0x20,0x23,0x2e,0x63,0x64,
+0x72,0x20,0x31,0x20,0x20,0x23,0x2e,0x73,
+0x65,0x74,0x2d,0x63,0x61,0x72,0x21,0x20,
+0x32,0x20,0x20,0x23,0x2e,0x3c,0x20,0x32,
+0x20,0x20,0x23,0x2e,0x66,0x69,0x78,0x6e,
+0x75,0x6d,0x3f,0x20,0x31,0x20,0x20,0x23,
+0x2e,0x63,0x6f,0x6e,0x73,0x20,0x32,0x29,
+0x20,0x61,0x72,0x67,0x63,0x2d,0x65,0x72,
+0x72,0x6f,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3c,0x30,0x30,0x30,0x72,0x32,0x65,
+0x30,0x63,0x31,0x7c,0x63,0x32,0x7d,0x7d,
+0x61,0x57,0x36,0x37,0x30,0x63,0x33,0x35,
+0x34,0x30,0x63,0x34,0x34,0x35,0x3b,0x22,
+0x20,0x5b,0x65,0x72,0x72,0x6f,0x72,0x20,
+0x22,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,
+0x22,0x20,0x22,0x20,0x65,0x78,0x70,0x65,
+0x63,0x74,0x73,0x20,0x22,0x20,0x22,0x20,
+0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,
+0x2e,0x22,0x20,0x22,0x20,0x61,0x72,0x67,
+0x75,0x6d,0x65,0x6e,0x74,0x73,0x2e,0x22,
+0x5d,0x20,0x61,0x72,0x67,0x63,0x2d,0x65,
+0x72,0x72,0x6f,0x72,0x29,0x20,0x61,0x72,
+0x69,0x74,0x68,0x6d,0x65,0x74,0x69,0x63,
+0x2d,0x73,0x68,0x69,0x66,0x74,0x20,0x23,
+0x66,0x6e,0x28,0x61,0x73,0x68,0x29,0x20,
+0x61,0x72,0x72,0x61,0x79,0x2d,0x64,0x69,
+0x6d,0x65,0x6e,0x73,0x69,0x6f,0x6e,0x73,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x33,
+0x31,0x4c,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x29,0x5d,0x20,0x61,0x72,0x72,0x61,
+0x79,0x2d,0x64,0x69,0x6d,0x65,0x6e,0x73,
+0x69,0x6f,0x6e,0x73,0x29,0x20,0x61,0x72,
+0x72,0x61,0x79,0x2d,0x72,0x65,0x66,0x20,
+0x23,0x2e,0x61,0x72,0x65,0x66,0x20,0x61,
+0x72,0x72,0x61,0x79,0x2d,0x73,0x65,0x74,
+0x21,0x20,0x23,0x66,0x6e,0x28,0x22,0x3d,
+0x30,0x30,0x30,0x73,0x33,0x67,0x33,0x5c,
+0x78,0x38,0x35,0x38,0x30,0x7c,0x67,0x32,
+0x7d,0x5c,0x5c,0x3b,0x65,0x30,0x63,0x31,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x65,0x72,
+0x72,0x6f,0x72,0x20,0x22,0x61,0x72,0x72,
+0x61,0x79,0x2d,0x73,0x65,0x74,0x21,0x3a,
+0x20,0x6d,0x75,0x6c,0x74,0x69,0x70,0x6c,
+0x65,0x20,0x64,0x69,0x6d,0x65,0x6e,0x73,
+0x69,0x6f,0x6e,0x73,0x20,0x6e,0x6f,0x74,
+0x20,0x79,0x65,0x74,0x20,0x69,0x6d,0x70,
+0x6c,0x65,0x6d,0x65,0x6e,0x74,0x65,0x64,
+0x22,0x5d,0x20,0x61,0x72,0x72,0x61,0x79,
+0x2d,0x73,0x65,0x74,0x21,0x29,0x20,0x61,
+0x72,0x72,0x61,0x79,0x3f,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x48,0x31,0x37,0x3c,0x30,0x32,
+0x63,0x30,0x63,0x31,0x7c,0x33,0x31,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x46,0x31,0x36,0x38,0x30,0x32,0x7c,
+0x4d,0x63,0x30,0x3c,0x3b,0x22,0x20,0x5b,
+0x61,0x72,0x72,0x61,0x79,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x74,0x79,0x70,0x65,
+0x6f,0x66,0x29,0x5d,0x20,0x61,0x72,0x72,
+0x61,0x79,0x3f,0x29,0x20,0x61,0x73,0x73,
+0x65,0x72,0x74,0x69,0x6f,0x6e,0x2d,0x76,
+0x69,0x6f,0x6c,0x61,0x74,0x69,0x6f,0x6e,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x73,0x30,0x63,0x30,0x63,0x31,
+0x33,0x31,0x32,0x63,0x30,0x7c,0x33,0x31,
+0x32,0x5e,0x4d,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,
+0x61,0x79,0x6c,0x6e,0x29,0x20,0x61,0x73,
 0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x2d,
 0x76,0x69,0x6f,0x6c,0x61,0x74,0x69,0x6f,
-0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x73,0x30,0x63,0x30,0x63,
-0x31,0x33,0x31,0x32,0x63,0x30,0x7c,0x33,
-0x31,0x32,0x5e,0x4d,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
-0x6c,0x61,0x79,0x6c,0x6e,0x29,0x20,0x61,
-0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,
-0x2d,0x76,0x69,0x6f,0x6c,0x61,0x74,0x69,
-0x6f,0x6e,0x5d,0x29,0x20,0x61,0x73,0x73,
-0x6f,0x63,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x32,0x7d,0x3f,
-0x36,0x34,0x30,0x5e,0x3b,0x65,0x30,0x7d,
-0x33,0x31,0x7c,0x3e,0x36,0x35,0x30,0x7d,
-0x4d,0x3b,0x65,0x31,0x7c,0x7d,0x4e,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x63,0x61,0x61,
-0x72,0x20,0x61,0x73,0x73,0x6f,0x63,0x5d,
-0x20,0x61,0x73,0x73,0x6f,0x63,0x29,0x20,
-0x61,0x73,0x73,0x70,0x20,0x23,0x66,0x6e,
+0x6e,0x5d,0x29,0x20,0x61,0x73,0x73,0x6f,
+0x63,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x32,0x7d,0x3f,0x36,
+0x34,0x30,0x5e,0x3b,0x65,0x30,0x7d,0x33,
+0x31,0x7c,0x3e,0x36,0x35,0x30,0x7d,0x4d,
+0x3b,0x65,0x31,0x7c,0x7d,0x4e,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x63,0x61,0x61,0x72,
+0x20,0x61,0x73,0x73,0x6f,0x63,0x5d,0x20,
+0x61,0x73,0x73,0x6f,0x63,0x29,0x20,0x61,
+0x73,0x73,0x70,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x32,0x7d,
+0x3f,0x36,0x34,0x30,0x5e,0x3b,0x7c,0x65,
+0x30,0x7d,0x33,0x31,0x33,0x31,0x36,0x35,
+0x30,0x7d,0x4d,0x3b,0x65,0x31,0x7c,0x7d,
+0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,
+0x61,0x61,0x72,0x20,0x61,0x73,0x73,0x70,
+0x5d,0x20,0x61,0x73,0x73,0x70,0x29,0x20,
+0x61,0x73,0x73,0x76,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
-0x7d,0x3f,0x36,0x34,0x30,0x5e,0x3b,0x7c,
-0x65,0x30,0x7d,0x33,0x31,0x33,0x31,0x36,
-0x35,0x30,0x7d,0x4d,0x3b,0x65,0x31,0x7c,
-0x7d,0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x63,0x61,0x61,0x72,0x20,0x61,0x73,0x73,
-0x70,0x5d,0x20,0x61,0x73,0x73,0x70,0x29,
-0x20,0x61,0x73,0x73,0x76,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x7d,0x3f,0x36,0x34,0x30,0x5e,0x3b,
-0x65,0x30,0x7d,0x33,0x31,0x7c,0x3d,0x36,
-0x35,0x30,0x7d,0x4d,0x3b,0x65,0x31,0x7c,
-0x7d,0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x63,0x61,0x61,0x72,0x20,0x61,0x73,0x73,
-0x76,0x5d,0x20,0x61,0x73,0x73,0x76,0x29,
-0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,
-0x64,0x65,0x70,0x74,0x68,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
-0x32,0x7c,0x62,0x33,0x65,0x30,0x7c,0x62,
-0x33,0x5b,0x7d,0x33,0x32,0x5c,0x5c,0x3b,
-0x22,0x20,0x5b,0x6d,0x69,0x6e,0x5d,0x20,
+0x7d,0x3f,0x36,0x34,0x30,0x5e,0x3b,0x65,
+0x30,0x7d,0x33,0x31,0x7c,0x3d,0x36,0x35,
+0x30,0x7d,0x4d,0x3b,0x65,0x31,0x7c,0x7d,
+0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,
+0x61,0x61,0x72,0x20,0x61,0x73,0x73,0x76,
+0x5d,0x20,0x61,0x73,0x73,0x76,0x29,0x20,
 0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,0x64,
-0x65,0x70,0x74,0x68,0x29,0x20,0x62,0x63,
-0x6f,0x64,0x65,0x3a,0x63,0x6f,0x64,0x65,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x60,0x5b,0x3b,
-0x22,0x20,0x5b,0x5d,0x20,0x62,0x63,0x6f,
-0x64,0x65,0x3a,0x63,0x6f,0x64,0x65,0x29,
+0x65,0x70,0x74,0x68,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x32,
+0x7c,0x62,0x33,0x65,0x30,0x7c,0x62,0x33,
+0x5b,0x7d,0x33,0x32,0x5c,0x5c,0x3b,0x22,
+0x20,0x5b,0x6d,0x69,0x6e,0x5d,0x20,0x62,
+0x63,0x6f,0x64,0x65,0x3a,0x63,0x64,0x65,
+0x70,0x74,0x68,0x29,0x20,0x62,0x63,0x6f,
+0x64,0x65,0x3a,0x63,0x6f,0x64,0x65,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x31,0x7c,0x60,0x5b,0x3b,0x22,
+0x20,0x5b,0x5d,0x20,0x62,0x63,0x6f,0x64,
+0x65,0x3a,0x63,0x6f,0x64,0x65,0x29,0x20,
+0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,0x74,
+0x61,0x62,0x6c,0x65,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x61,0x5b,0x3b,0x22,0x20,0x5b,0x5d,
 0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,
-0x74,0x61,0x62,0x6c,0x65,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x61,0x5b,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,
-0x63,0x74,0x61,0x62,0x6c,0x65,0x29,0x20,
+0x74,0x61,0x62,0x6c,0x65,0x29,0x20,0x62,
+0x63,0x6f,0x64,0x65,0x3a,0x69,0x6e,0x64,
+0x65,0x78,0x66,0x6f,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x32,0x63,0x30,0x71,0x65,0x31,0x7c,0x33,
+0x31,0x65,0x32,0x7c,0x33,0x31,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3a,0x30,0x30,0x30,0x72,0x32,0x63,
+0x30,0x7c,0x5c,0x78,0x37,0x66,0x33,0x32,
+0x36,0x39,0x30,0x63,0x31,0x7c,0x5c,0x78,
+0x37,0x66,0x34,0x32,0x3b,0x63,0x32,0x7c,
+0x5c,0x78,0x37,0x66,0x7d,0x33,0x33,0x32,
+0x7d,0x7e,0x62,0x32,0x7d,0x61,0x77,0x5c,
+0x5c,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x68,0x61,0x73,0x3f,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x67,0x65,0x74,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x70,0x75,0x74,
+0x21,0x29,0x5d,0x29,0x20,0x62,0x63,0x6f,
+0x64,0x65,0x3a,0x63,0x74,0x61,0x62,0x6c,
+0x65,0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,
+0x6e,0x63,0x6f,0x6e,0x73,0x74,0x5d,0x20,
 0x62,0x63,0x6f,0x64,0x65,0x3a,0x69,0x6e,
-0x64,0x65,0x78,0x66,0x6f,0x72,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x71,0x65,0x31,0x7c,
-0x33,0x31,0x65,0x32,0x7c,0x33,0x31,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x32,
-0x63,0x30,0x7c,0x5c,0x78,0x37,0x66,0x33,
-0x32,0x36,0x39,0x30,0x63,0x31,0x7c,0x5c,
-0x78,0x37,0x66,0x34,0x32,0x3b,0x63,0x32,
-0x7c,0x5c,0x78,0x37,0x66,0x7d,0x33,0x33,
-0x32,0x7d,0x7e,0x62,0x32,0x7d,0x61,0x77,
-0x5c,0x5c,0x32,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x68,0x61,0x73,0x3f,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x67,0x65,0x74,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x70,0x75,
-0x74,0x21,0x29,0x5d,0x29,0x20,0x62,0x63,
-0x6f,0x64,0x65,0x3a,0x63,0x74,0x61,0x62,
-0x6c,0x65,0x20,0x62,0x63,0x6f,0x64,0x65,
-0x3a,0x6e,0x63,0x6f,0x6e,0x73,0x74,0x5d,
-0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,0x69,
-0x6e,0x64,0x65,0x78,0x66,0x6f,0x72,0x29,
-0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,0x6e,
-0x63,0x6f,0x6e,0x73,0x74,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x62,0x32,0x5b,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x62,0x63,0x6f,0x64,0x65,
-0x3a,0x6e,0x63,0x6f,0x6e,0x73,0x74,0x29,
-0x20,0x62,0x67,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x62,
-0x58,0x7c,0x77,0x3b,0x22,0x20,0x5b,0x5d,
-0x20,0x62,0x67,0x29,0x20,0x62,0x69,0x74,
-0x77,0x69,0x73,0x65,0x2d,0x61,0x6e,0x64,
-0x20,0x23,0x66,0x6e,0x28,0x6c,0x6f,0x67,
-0x61,0x6e,0x64,0x29,0x20,0x62,0x69,0x74,
-0x77,0x69,0x73,0x65,0x2d,0x6e,0x6f,0x74,
-0x20,0x23,0x66,0x6e,0x28,0x6c,0x6f,0x67,
-0x6e,0x6f,0x74,0x29,0x20,0x62,0x69,0x74,
-0x77,0x69,0x73,0x65,0x2d,0x6f,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x6c,0x6f,0x67,0x69,
-0x6f,0x72,0x29,0x20,0x62,0x69,0x74,0x77,
-0x69,0x73,0x65,0x2d,0x78,0x6f,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x6c,0x6f,0x67,0x78,
-0x6f,0x72,0x29,0x20,0x62,0x6c,0x61,0x63,
-0x6b,0x20,0x30,0x20,0x62,0x6c,0x75,0x65,
-0x20,0x34,0x20,0x62,0x6f,0x6c,0x64,0x20,
-0x31,0x20,0x62,0x71,0x2d,0x62,0x72,0x61,
-0x63,0x6b,0x65,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3c,0x30,0x30,0x30,0x72,0x32,
-0x7c,0x3f,0x36,0x3d,0x30,0x63,0x30,0x65,
-0x31,0x7c,0x7d,0x33,0x32,0x4c,0x32,0x3b,
-0x7c,0x4d,0x63,0x32,0x5c,0x78,0x38,0x32,
-0x52,0x30,0x7d,0x60,0x57,0x36,0x38,0x30,
-0x63,0x30,0x7c,0x4e,0x4b,0x3b,0x63,0x30,
-0x63,0x33,0x63,0x34,0x65,0x31,0x7c,0x4e,
+0x64,0x65,0x78,0x66,0x6f,0x72,0x29,0x20,
+0x62,0x63,0x6f,0x64,0x65,0x3a,0x6e,0x63,
+0x6f,0x6e,0x73,0x74,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x62,0x32,0x5b,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,
+0x6e,0x63,0x6f,0x6e,0x73,0x74,0x29,0x20,
+0x62,0x67,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x62,0x58,
+0x7c,0x77,0x3b,0x22,0x20,0x5b,0x5d,0x20,
+0x62,0x67,0x29,0x20,0x62,0x69,0x74,0x77,
+0x69,0x73,0x65,0x2d,0x61,0x6e,0x64,0x20,
+0x23,0x66,0x6e,0x28,0x6c,0x6f,0x67,0x61,
+0x6e,0x64,0x29,0x20,0x62,0x69,0x74,0x77,
+0x69,0x73,0x65,0x2d,0x6e,0x6f,0x74,0x20,
+0x23,0x66,0x6e,0x28,0x6c,0x6f,0x67,0x6e,
+0x6f,0x74,0x29,0x20,0x62,0x69,0x74,0x77,
+0x69,0x73,0x65,0x2d,0x6f,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x6c,0x6f,0x67,0x69,0x6f,
+0x72,0x29,0x20,0x62,0x69,0x74,0x77,0x69,
+0x73,0x65,0x2d,0x78,0x6f,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x6c,0x6f,0x67,0x78,0x6f,
+0x72,0x29,0x20,0x62,0x6c,0x61,0x63,0x6b,
+0x20,0x30,0x20,0x62,0x6c,0x75,0x65,0x20,
+0x34,0x20,0x62,0x6f,0x6c,0x64,0x20,0x31,
+0x20,0x62,0x71,0x2d,0x62,0x72,0x61,0x63,
+0x6b,0x65,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3c,0x30,0x30,0x30,0x72,0x32,0x7c,
+0x3f,0x36,0x3d,0x30,0x63,0x30,0x65,0x31,
+0x7c,0x7d,0x33,0x32,0x4c,0x32,0x3b,0x7c,
+0x4d,0x63,0x32,0x5c,0x78,0x38,0x32,0x52,
+0x30,0x7d,0x60,0x57,0x36,0x38,0x30,0x63,
+0x30,0x7c,0x4e,0x4b,0x3b,0x63,0x30,0x63,
+0x33,0x63,0x34,0x65,0x31,0x7c,0x4e,0x7d,
+0x61,0x78,0x33,0x32,0x4c,0x33,0x4c,0x32,
+0x3b,0x7c,0x4d,0x63,0x35,0x5c,0x78,0x38,
+0x32,0x53,0x30,0x7d,0x60,0x57,0x36,0x39,
+0x30,0x63,0x36,0x7c,0x5c,0x78,0x38,0x34,
+0x4c,0x32,0x3b,0x63,0x30,0x63,0x30,0x63,
+0x37,0x65,0x31,0x7c,0x5c,0x78,0x38,0x34,
 0x7d,0x61,0x78,0x33,0x32,0x4c,0x33,0x4c,
-0x32,0x3b,0x7c,0x4d,0x63,0x35,0x5c,0x78,
-0x38,0x32,0x53,0x30,0x7d,0x60,0x57,0x36,
-0x39,0x30,0x63,0x36,0x7c,0x5c,0x78,0x38,
-0x34,0x4c,0x32,0x3b,0x63,0x30,0x63,0x30,
-0x63,0x37,0x65,0x31,0x7c,0x5c,0x78,0x38,
-0x34,0x7d,0x61,0x78,0x33,0x32,0x4c,0x33,
-0x4c,0x32,0x3b,0x7c,0x4d,0x63,0x38,0x5c,
-0x78,0x38,0x32,0x4f,0x30,0x7d,0x60,0x57,
-0x36,0x35,0x30,0x7c,0x5c,0x78,0x38,0x34,
-0x3b,0x63,0x30,0x63,0x30,0x63,0x39,0x65,
-0x31,0x7c,0x5c,0x78,0x38,0x34,0x7d,0x61,
-0x78,0x33,0x32,0x4c,0x33,0x4c,0x32,0x3b,
-0x63,0x30,0x65,0x31,0x7c,0x7d,0x33,0x32,
-0x4c,0x32,0x3b,0x22,0x20,0x5b,0x23,0x2e,
-0x6c,0x69,0x73,0x74,0x20,0x62,0x71,0x2d,
-0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0x20,
-0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x20,
-0x23,0x2e,0x63,0x6f,0x6e,0x73,0x20,0x27,
-0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x20,
-0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,
-0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,
-0x20,0x63,0x6f,0x70,0x79,0x2d,0x6c,0x69,
-0x73,0x74,0x20,0x27,0x75,0x6e,0x71,0x75,
-0x6f,0x74,0x65,0x2d,0x73,0x70,0x6c,0x69,
-0x63,0x69,0x6e,0x67,0x20,0x75,0x6e,0x71,
-0x75,0x6f,0x74,0x65,0x2d,0x6e,0x73,0x70,
-0x6c,0x69,0x63,0x69,0x6e,0x67,0x20,0x27,
-0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,
-0x6e,0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,
-0x67,0x5d,0x20,0x62,0x71,0x2d,0x62,0x72,
-0x61,0x63,0x6b,0x65,0x74,0x29,0x20,0x62,
-0x71,0x2d,0x62,0x72,0x61,0x63,0x6b,0x65,
-0x74,0x31,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3b,0x30,0x30,0x30,0x72,0x32,0x7c,0x46,
-0x31,0x36,0x38,0x30,0x32,0x7c,0x4d,0x63,
-0x30,0x3c,0x36,0x4b,0x30,0x7d,0x60,0x57,
-0x36,0x35,0x30,0x7c,0x5c,0x78,0x38,0x34,
-0x3b,0x63,0x31,0x63,0x32,0x65,0x33,0x7c,
-0x4e,0x7d,0x61,0x78,0x33,0x32,0x4c,0x33,
-0x3b,0x65,0x33,0x7c,0x7d,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x75,0x6e,0x71,0x75,0x6f,
-0x74,0x65,0x20,0x23,0x2e,0x63,0x6f,0x6e,
-0x73,0x20,0x27,0x75,0x6e,0x71,0x75,0x6f,
-0x74,0x65,0x20,0x62,0x71,0x2d,0x70,0x72,
-0x6f,0x63,0x65,0x73,0x73,0x5d,0x20,0x62,
-0x71,0x2d,0x62,0x72,0x61,0x63,0x6b,0x65,
-0x74,0x31,0x29,0x20,0x62,0x71,0x2d,0x70,
-0x72,0x6f,0x63,0x65,0x73,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x32,0x7c,0x43,0x36,0x38,0x30,0x63,
-0x30,0x7c,0x4c,0x32,0x3b,0x7c,0x48,0x36,
-0x41,0x30,0x63,0x31,0x65,0x32,0x65,0x33,
-0x7c,0x33,0x31,0x7d,0x33,0x32,0x34,0x31,
-0x3b,0x7c,0x3f,0x36,0x34,0x30,0x7c,0x3b,
-0x7c,0x4d,0x63,0x34,0x5c,0x78,0x38,0x32,
-0x42,0x30,0x63,0x35,0x63,0x36,0x65,0x32,
-0x7c,0x5c,0x78,0x38,0x34,0x7d,0x61,0x77,
-0x33,0x32,0x4c,0x33,0x3b,0x7c,0x4d,0x63,
-0x37,0x5c,0x78,0x38,0x32,0x57,0x30,0x7d,
-0x60,0x57,0x31,0x36,0x3a,0x30,0x32,0x65,
-0x38,0x7c,0x62,0x32,0x33,0x32,0x36,0x35,
-0x30,0x7c,0x5c,0x78,0x38,0x34,0x3b,0x63,
-0x39,0x63,0x3a,0x65,0x32,0x7c,0x4e,0x7d,
-0x61,0x78,0x33,0x32,0x4c,0x33,0x3b,0x65,
-0x3b,0x65,0x3c,0x7c,0x33,0x32,0x37,0x45,
-0x30,0x63,0x3d,0x71,0x65,0x3e,0x7c,0x33,
-0x31,0x63,0x3f,0x63,0x40,0x71,0x7c,0x33,
-0x32,0x34,0x32,0x3b,0x63,0x41,0x71,0x5d,
-0x33,0x31,0x7c,0x5f,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x71,0x75,0x6f,0x74,0x65,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x4d,0x63,0x30,0x5c,
-0x78,0x38,0x32,0x38,0x30,0x63,0x31,0x7c,
-0x4e,0x4b,0x3b,0x63,0x32,0x63,0x31,0x7c,
-0x4c,0x33,0x3b,0x22,0x20,0x5b,0x23,0x2e,
-0x6c,0x69,0x73,0x74,0x20,0x23,0x2e,0x76,
-0x65,0x63,0x74,0x6f,0x72,0x20,0x23,0x2e,
-0x61,0x70,0x70,0x6c,0x79,0x5d,0x29,0x20,
-0x62,0x71,0x2d,0x70,0x72,0x6f,0x63,0x65,
-0x73,0x73,0x20,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x2d,0x3e,0x6c,0x69,0x73,0x74,0x20,
-0x71,0x75,0x61,0x73,0x69,0x71,0x75,0x6f,
-0x74,0x65,0x20,0x23,0x2e,0x6c,0x69,0x73,
-0x74,0x20,0x27,0x71,0x75,0x61,0x73,0x69,
-0x71,0x75,0x6f,0x74,0x65,0x20,0x75,0x6e,
-0x71,0x75,0x6f,0x74,0x65,0x20,0x6c,0x65,
-0x6e,0x67,0x74,0x68,0x3d,0x20,0x23,0x2e,
-0x63,0x6f,0x6e,0x73,0x20,0x27,0x75,0x6e,
-0x71,0x75,0x6f,0x74,0x65,0x20,0x61,0x6e,
-0x79,0x20,0x73,0x70,0x6c,0x69,0x63,0x65,
-0x2d,0x66,0x6f,0x72,0x6d,0x3f,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x32,0x7c,0x5c,0x78,0x38,0x35,0x37,
-0x30,0x63,0x30,0x7d,0x4b,0x3b,0x7d,0x4e,
-0x5c,0x78,0x38,0x35,0x3f,0x30,0x63,0x31,
-0x7d,0x4d,0x65,0x32,0x7c,0x5c,0x78,0x37,
-0x66,0x33,0x32,0x4c,0x33,0x3b,0x63,0x33,
-0x63,0x34,0x7d,0x4b,0x65,0x32,0x7c,0x5c,
-0x78,0x37,0x66,0x33,0x32,0x4c,0x31,0x34,
+0x32,0x3b,0x7c,0x4d,0x63,0x38,0x5c,0x78,
+0x38,0x32,0x4f,0x30,0x7d,0x60,0x57,0x36,
+0x35,0x30,0x7c,0x5c,0x78,0x38,0x34,0x3b,
+0x63,0x30,0x63,0x30,0x63,0x39,0x65,0x31,
+0x7c,0x5c,0x78,0x38,0x34,0x7d,0x61,0x78,
+0x33,0x32,0x4c,0x33,0x4c,0x32,0x3b,0x63,
+0x30,0x65,0x31,0x7c,0x7d,0x33,0x32,0x4c,
 0x32,0x3b,0x22,0x20,0x5b,0x23,0x2e,0x6c,
-0x69,0x73,0x74,0x20,0x23,0x2e,0x63,0x6f,
-0x6e,0x73,0x20,0x62,0x71,0x2d,0x70,0x72,
+0x69,0x73,0x74,0x20,0x62,0x71,0x2d,0x70,
+0x72,0x6f,0x63,0x65,0x73,0x73,0x20,0x75,
+0x6e,0x71,0x75,0x6f,0x74,0x65,0x20,0x23,
+0x2e,0x63,0x6f,0x6e,0x73,0x20,0x27,0x75,
+0x6e,0x71,0x75,0x6f,0x74,0x65,0x20,0x75,
+0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x73,
+0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,0x20,
+0x63,0x6f,0x70,0x79,0x2d,0x6c,0x69,0x73,
+0x74,0x20,0x27,0x75,0x6e,0x71,0x75,0x6f,
+0x74,0x65,0x2d,0x73,0x70,0x6c,0x69,0x63,
+0x69,0x6e,0x67,0x20,0x75,0x6e,0x71,0x75,
+0x6f,0x74,0x65,0x2d,0x6e,0x73,0x70,0x6c,
+0x69,0x63,0x69,0x6e,0x67,0x20,0x27,0x75,
+0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x6e,
+0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,
+0x5d,0x20,0x62,0x71,0x2d,0x62,0x72,0x61,
+0x63,0x6b,0x65,0x74,0x29,0x20,0x62,0x71,
+0x2d,0x62,0x72,0x61,0x63,0x6b,0x65,0x74,
+0x31,0x20,0x23,0x66,0x6e,0x28,0x22,0x3b,
+0x30,0x30,0x30,0x72,0x32,0x7c,0x46,0x31,
+0x36,0x38,0x30,0x32,0x7c,0x4d,0x63,0x30,
+0x3c,0x36,0x4b,0x30,0x7d,0x60,0x57,0x36,
+0x35,0x30,0x7c,0x5c,0x78,0x38,0x34,0x3b,
+0x63,0x31,0x63,0x32,0x65,0x33,0x7c,0x4e,
+0x7d,0x61,0x78,0x33,0x32,0x4c,0x33,0x3b,
+0x65,0x33,0x7c,0x7d,0x34,0x32,0x3b,0x22,
+0x20,0x5b,0x75,0x6e,0x71,0x75,0x6f,0x74,
+0x65,0x20,0x23,0x2e,0x63,0x6f,0x6e,0x73,
+0x20,0x27,0x75,0x6e,0x71,0x75,0x6f,0x74,
+0x65,0x20,0x62,0x71,0x2d,0x70,0x72,0x6f,
+0x63,0x65,0x73,0x73,0x5d,0x20,0x62,0x71,
+0x2d,0x62,0x72,0x61,0x63,0x6b,0x65,0x74,
+0x31,0x29,0x20,0x62,0x71,0x2d,0x70,0x72,
 0x6f,0x63,0x65,0x73,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x6c,0x69,0x73,
-0x74,0x2a,0x29,0x5d,0x29,0x20,0x6c,0x61,
-0x73,0x74,0x63,0x64,0x72,0x20,0x23,0x66,
-0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,0x23,
+0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
+0x32,0x7c,0x43,0x36,0x38,0x30,0x63,0x30,
+0x7c,0x4c,0x32,0x3b,0x7c,0x48,0x36,0x41,
+0x30,0x63,0x31,0x65,0x32,0x65,0x33,0x7c,
+0x33,0x31,0x7d,0x33,0x32,0x34,0x31,0x3b,
+0x7c,0x3f,0x36,0x34,0x30,0x7c,0x3b,0x7c,
+0x4d,0x63,0x34,0x5c,0x78,0x38,0x32,0x42,
+0x30,0x63,0x35,0x63,0x36,0x65,0x32,0x7c,
+0x5c,0x78,0x38,0x34,0x7d,0x61,0x77,0x33,
+0x32,0x4c,0x33,0x3b,0x7c,0x4d,0x63,0x37,
+0x5c,0x78,0x38,0x32,0x57,0x30,0x7d,0x60,
+0x57,0x31,0x36,0x3a,0x30,0x32,0x65,0x38,
+0x7c,0x62,0x32,0x33,0x32,0x36,0x35,0x30,
+0x7c,0x5c,0x78,0x38,0x34,0x3b,0x63,0x39,
+0x63,0x3a,0x65,0x32,0x7c,0x4e,0x7d,0x61,
+0x78,0x33,0x32,0x4c,0x33,0x3b,0x65,0x3b,
+0x65,0x3c,0x7c,0x33,0x32,0x37,0x45,0x30,
+0x63,0x3d,0x71,0x65,0x3e,0x7c,0x33,0x31,
+0x63,0x3f,0x63,0x40,0x71,0x7c,0x33,0x32,
+0x34,0x32,0x3b,0x63,0x41,0x71,0x5d,0x33,
+0x31,0x7c,0x5f,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x71,0x75,0x6f,0x74,0x65,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x7c,0x5c,0x78,0x37,
-0x66,0x34,0x32,0x3b,0x22,0x20,0x5b,0x62,
-0x71,0x2d,0x62,0x72,0x61,0x63,0x6b,0x65,
-0x74,0x31,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3e,0x30,0x30,0x30,0x72,0x32,0x7c,0x5c,
-0x78,0x38,0x35,0x3b,0x30,0x63,0x30,0x65,
-0x31,0x7d,0x33,0x31,0x4b,0x3b,0x7c,0x46,
-0x36,0x73,0x30,0x7c,0x4d,0x63,0x32,0x5c,
-0x78,0x38,0x32,0x5b,0x30,0x63,0x30,0x65,
-0x33,0x7d,0x69,0x31,0x31,0x60,0x57,0x36,
-0x37,0x30,0x7c,0x4e,0x35,0x45,0x30,0x63,
-0x34,0x63,0x35,0x4c,0x32,0x65,0x36,0x7c,
-0x4e,0x69,0x31,0x31,0x61,0x78,0x33,0x32,
-0x4c,0x32,0x33,0x32,0x4b,0x3b,0x7e,0x7c,
-0x4e,0x65,0x37,0x7c,0x4d,0x69,0x31,0x31,
-0x33,0x32,0x7d,0x4b,0x34,0x32,0x3b,0x63,
-0x30,0x65,0x31,0x65,0x36,0x7c,0x69,0x31,
-0x31,0x33,0x32,0x7d,0x4b,0x33,0x31,0x4b,
-0x3b,0x22,0x20,0x5b,0x6e,0x63,0x6f,0x6e,
-0x63,0x20,0x72,0x65,0x76,0x65,0x72,0x73,
-0x65,0x21,0x20,0x75,0x6e,0x71,0x75,0x6f,
-0x74,0x65,0x20,0x6e,0x72,0x65,0x63,0x6f,
-0x6e,0x63,0x20,0x23,0x2e,0x6c,0x69,0x73,
-0x74,0x20,0x27,0x75,0x6e,0x71,0x75,0x6f,
-0x74,0x65,0x20,0x62,0x71,0x2d,0x70,0x72,
-0x6f,0x63,0x65,0x73,0x73,0x20,0x62,0x71,
+0x72,0x31,0x7c,0x4d,0x63,0x30,0x5c,0x78,
+0x38,0x32,0x38,0x30,0x63,0x31,0x7c,0x4e,
+0x4b,0x3b,0x63,0x32,0x63,0x31,0x7c,0x4c,
+0x33,0x3b,0x22,0x20,0x5b,0x23,0x2e,0x6c,
+0x69,0x73,0x74,0x20,0x23,0x2e,0x76,0x65,
+0x63,0x74,0x6f,0x72,0x20,0x23,0x2e,0x61,
+0x70,0x70,0x6c,0x79,0x5d,0x29,0x20,0x62,
+0x71,0x2d,0x70,0x72,0x6f,0x63,0x65,0x73,
+0x73,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,
+0x2d,0x3e,0x6c,0x69,0x73,0x74,0x20,0x71,
+0x75,0x61,0x73,0x69,0x71,0x75,0x6f,0x74,
+0x65,0x20,0x23,0x2e,0x6c,0x69,0x73,0x74,
+0x20,0x27,0x71,0x75,0x61,0x73,0x69,0x71,
+0x75,0x6f,0x74,0x65,0x20,0x75,0x6e,0x71,
+0x75,0x6f,0x74,0x65,0x20,0x6c,0x65,0x6e,
+0x67,0x74,0x68,0x3d,0x20,0x23,0x2e,0x63,
+0x6f,0x6e,0x73,0x20,0x27,0x75,0x6e,0x71,
+0x75,0x6f,0x74,0x65,0x20,0x61,0x6e,0x79,
+0x20,0x73,0x70,0x6c,0x69,0x63,0x65,0x2d,
+0x66,0x6f,0x72,0x6d,0x3f,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x32,0x7c,0x5c,0x78,0x38,0x35,0x37,0x30,
+0x63,0x30,0x7d,0x4b,0x3b,0x7d,0x4e,0x5c,
+0x78,0x38,0x35,0x3f,0x30,0x63,0x31,0x7d,
+0x4d,0x65,0x32,0x7c,0x5c,0x78,0x37,0x66,
+0x33,0x32,0x4c,0x33,0x3b,0x63,0x33,0x63,
+0x34,0x7d,0x4b,0x65,0x32,0x7c,0x5c,0x78,
+0x37,0x66,0x33,0x32,0x4c,0x31,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x23,0x2e,0x6c,0x69,
+0x73,0x74,0x20,0x23,0x2e,0x63,0x6f,0x6e,
+0x73,0x20,0x62,0x71,0x2d,0x70,0x72,0x6f,
+0x63,0x65,0x73,0x73,0x20,0x23,0x66,0x6e,
+0x28,0x6e,0x63,0x6f,0x6e,0x63,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x6c,0x69,0x73,0x74,
+0x2a,0x29,0x5d,0x29,0x20,0x6c,0x61,0x73,
+0x74,0x63,0x64,0x72,0x20,0x23,0x66,0x6e,
+0x28,0x6d,0x61,0x70,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x7c,0x5c,0x78,0x37,0x66,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x62,0x71,
 0x2d,0x62,0x72,0x61,0x63,0x6b,0x65,0x74,
-0x5d,0x29,0x5d,0x29,0x5d,0x20,0x62,0x71,
-0x2d,0x70,0x72,0x6f,0x63,0x65,0x73,0x73,
-0x29,0x20,0x62,0x75,0x69,0x6c,0x74,0x69,
-0x6e,0x2d,0x3e,0x69,0x6e,0x73,0x74,0x72,
-0x75,0x63,0x74,0x69,0x6f,0x6e,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x7e,0x7c,0x5e,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x67,0x65,0x74,0x29,0x5d,0x20,0x5b,
-0x23,0x74,0x61,0x62,0x6c,0x65,0x28,0x23,
-0x2e,0x65,0x71,0x75,0x61,0x6c,0x3f,0x20,
-0x65,0x71,0x75,0x61,0x6c,0x3f,0x20,0x20,
-0x23,0x2e,0x2a,0x20,0x2a,0x20,0x20,0x23,
-0x2e,0x63,0x61,0x72,0x20,0x63,0x61,0x72,
-0x20,0x20,0x23,0x2e,0x61,0x70,0x70,0x6c,
-0x79,0x20,0x61,0x70,0x70,0x6c,0x79,0x20,
-0x20,0x23,0x2e,0x61,0x72,0x65,0x66,0x20,
-0x61,0x72,0x65,0x66,0x20,0x20,0x23,0x2e,
-0x2d,0x20,0x2d,0x20,0x20,0x23,0x2e,0x62,
+0x31,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x6d,0x30,0x32,0x7c,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3e,
+0x30,0x30,0x30,0x72,0x32,0x7c,0x5c,0x78,
+0x38,0x35,0x3b,0x30,0x63,0x30,0x65,0x31,
+0x7d,0x33,0x31,0x4b,0x3b,0x7c,0x46,0x36,
+0x73,0x30,0x7c,0x4d,0x63,0x32,0x5c,0x78,
+0x38,0x32,0x5b,0x30,0x63,0x30,0x65,0x33,
+0x7d,0x69,0x31,0x31,0x60,0x57,0x36,0x37,
+0x30,0x7c,0x4e,0x35,0x45,0x30,0x63,0x34,
+0x63,0x35,0x4c,0x32,0x65,0x36,0x7c,0x4e,
+0x69,0x31,0x31,0x61,0x78,0x33,0x32,0x4c,
+0x32,0x33,0x32,0x4b,0x3b,0x7e,0x7c,0x4e,
+0x65,0x37,0x7c,0x4d,0x69,0x31,0x31,0x33,
+0x32,0x7d,0x4b,0x34,0x32,0x3b,0x63,0x30,
+0x65,0x31,0x65,0x36,0x7c,0x69,0x31,0x31,
+0x33,0x32,0x7d,0x4b,0x33,0x31,0x4b,0x3b,
+0x22,0x20,0x5b,0x6e,0x63,0x6f,0x6e,0x63,
+0x20,0x72,0x65,0x76,0x65,0x72,0x73,0x65,
+0x21,0x20,0x75,0x6e,0x71,0x75,0x6f,0x74,
+0x65,0x20,0x6e,0x72,0x65,0x63,0x6f,0x6e,
+0x63,0x20,0x23,0x2e,0x6c,0x69,0x73,0x74,
+0x20,0x27,0x75,0x6e,0x71,0x75,0x6f,0x74,
+0x65,0x20,0x62,0x71,0x2d,0x70,0x72,0x6f,
+0x63,0x65,0x73,0x73,0x20,0x62,0x71,0x2d,
+0x62,0x72,0x61,0x63,0x6b,0x65,0x74,0x5d,
+0x29,0x5d,0x29,0x5d,0x20,0x62,0x71,0x2d,
+0x70,0x72,0x6f,0x63,0x65,0x73,0x73,0x29,
+0x20,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,
+0x2d,0x3e,0x69,0x6e,0x73,0x74,0x72,0x75,
+0x63,0x74,0x69,0x6f,0x6e,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x7e,0x7c,0x5e,0x34,0x33,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x67,0x65,0x74,0x29,0x5d,0x20,0x5b,0x23,
+0x74,0x61,0x62,0x6c,0x65,0x28,0x23,0x2e,
+0x65,0x71,0x75,0x61,0x6c,0x3f,0x20,0x65,
+0x71,0x75,0x61,0x6c,0x3f,0x20,0x20,0x23,
+0x2e,0x2a,0x20,0x2a,0x20,0x20,0x23,0x2e,
+0x63,0x61,0x72,0x20,0x63,0x61,0x72,0x20,
+0x20,0x23,0x2e,0x61,0x70,0x70,0x6c,0x79,
+0x20,0x61,0x70,0x70,0x6c,0x79,0x20,0x20,
+0x23,0x2e,0x61,0x72,0x65,0x66,0x20,0x61,
+0x72,0x65,0x66,0x20,0x20,0x23,0x2e,0x2d,
+0x20,0x2d,0x20,0x20,0x23,0x2e,0x62,0x6f,
+0x6f,0x6c,0x65,0x61,0x6e,0x3f,0x20,0x62,
 0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x3f,0x20,
-0x62,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x3f,
-0x20,0x20,0x23,0x2e,0x62,0x75,0x69,0x6c,
-0x74,0x69,0x6e,0x3f,0x20,0x62,0x75,0x69,
-0x6c,0x74,0x69,0x6e,0x3f,0x20,0x20,0x23,
-0x2e,0x6e,0x75,0x6c,0x6c,0x3f,0x20,0x6e,
-0x75,0x6c,0x6c,0x3f,0x20,0x20,0x23,0x2e,
-0x65,0x71,0x76,0x3f,0x20,0x65,0x71,0x76,
-0x3f,0x20,0x20,0x23,0x2e,0x66,0x75,0x6e,
-0x63,0x74,0x69,0x6f,0x6e,0x3f,0x20,0x66,
-0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x3f,
-0x20,0x20,0x23,0x2e,0x62,0x6f,0x75,0x6e,
-0x64,0x3f,0x20,0x62,0x6f,0x75,0x6e,0x64,
-0x3f,0x20,0x20,0x23,0x2e,0x63,0x64,0x72,
-0x20,0x63,0x64,0x72,0x20,0x20,0x23,0x2e,
-0x6c,0x69,0x73,0x74,0x20,0x6c,0x69,0x73,
-0x74,0x20,0x20,0x23,0x2e,0x73,0x65,0x74,
-0x2d,0x63,0x61,0x72,0x21,0x20,0x73,0x65,
-0x74,0x2d,0x63,0x61,0x72,0x21,0x20,0x20,
-0x23,0x2e,0x63,0x6f,0x6e,0x73,0x20,0x63,
-0x6f,0x6e,0x73,0x20,0x20,0x23,0x2e,0x61,
-0x74,0x6f,0x6d,0x3f,0x20,0x61,0x74,0x6f,
-0x6d,0x3f,0x20,0x20,0x23,0x2e,0x73,0x65,
-0x74,0x2d,0x63,0x64,0x72,0x21,0x20,0x73,
-0x65,0x74,0x2d,0x63,0x64,0x72,0x21,0x20,
-0x20,0x23,0x2e,0x73,0x79,0x6d,0x62,0x6f,
-0x6c,0x3f,0x20,0x73,0x79,0x6d,0x62,0x6f,
-0x6c,0x3f,0x20,0x20,0x23,0x2e,0x65,0x71,
-0x3f,0x20,0x65,0x71,0x3f,0x20,0x20,0x23,
-0x2e,0x76,0x65,0x63,0x74,0x6f,0x72,0x20,
-0x76,0x65,0x63,0x74,0x6f,0x72,0x20,0x20,
-0x23,0x2e,0x6e,0x6f,0x74,0x20,0x6e,0x6f,
-0x74,0x20,0x20,0x23,0x2e,0x70,0x61,0x69,
-0x72,0x3f,0x20,0x70,0x61,0x69,0x72,0x3f,
-0x20,0x20,0x23,0x2e,0x6e,0x75,0x6d,0x62,
-0x65,0x72,0x3f,0x20,0x6e,0x75,0x6d,0x62,
-0x65,0x72,0x3f,0x20,0x20,0x23,0x2e,0x64,
-0x69,0x76,0x30,0x20,0x64,0x69,0x76,0x30,
-0x20,0x20,0x23,0x2e,0x61,0x73,0x65,0x74,
-0x21,0x20,0x61,0x73,0x65,0x74,0x21,0x20,
-0x20,0x23,0x2e,0x2b,0x20,0x2b,0x20,0x20,
-0x23,0x2e,0x3d,0x20,0x3d,0x20,0x20,0x23,
-0x2e,0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,
-0x20,0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,
-0x20,0x20,0x23,0x2e,0x76,0x65,0x63,0x74,
-0x6f,0x72,0x3f,0x20,0x76,0x65,0x63,0x74,
-0x6f,0x72,0x3f,0x20,0x20,0x23,0x2e,0x2f,
-0x20,0x2f,0x20,0x20,0x23,0x2e,0x3c,0x20,
-0x3c,0x20,0x20,0x23,0x2e,0x66,0x69,0x78,
-0x6e,0x75,0x6d,0x3f,0x20,0x66,0x69,0x78,
-0x6e,0x75,0x6d,0x3f,0x29,0x20,0x28,0x29,
-0x5d,0x29,0x20,0x63,0x61,0x61,0x61,0x61,
-0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,0x4d,
-0x4d,0x4d,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x63,0x61,0x61,0x61,0x61,0x72,0x29,0x20,
-0x63,0x61,0x61,0x61,0x64,0x72,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x5c,0x78,0x38,0x34,0x4d,
+0x20,0x23,0x2e,0x62,0x75,0x69,0x6c,0x74,
+0x69,0x6e,0x3f,0x20,0x62,0x75,0x69,0x6c,
+0x74,0x69,0x6e,0x3f,0x20,0x20,0x23,0x2e,
+0x6e,0x75,0x6c,0x6c,0x3f,0x20,0x6e,0x75,
+0x6c,0x6c,0x3f,0x20,0x20,0x23,0x2e,0x65,
+0x71,0x76,0x3f,0x20,0x65,0x71,0x76,0x3f,
+0x20,0x20,0x23,0x2e,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x3f,0x20,0x66,0x75,
+0x6e,0x63,0x74,0x69,0x6f,0x6e,0x3f,0x20,
+0x20,0x23,0x2e,0x62,0x6f,0x75,0x6e,0x64,
+0x3f,0x20,0x62,0x6f,0x75,0x6e,0x64,0x3f,
+0x20,0x20,0x23,0x2e,0x63,0x64,0x72,0x20,
+0x63,0x64,0x72,0x20,0x20,0x23,0x2e,0x6c,
+0x69,0x73,0x74,0x20,0x6c,0x69,0x73,0x74,
+0x20,0x20,0x23,0x2e,0x73,0x65,0x74,0x2d,
+0x63,0x61,0x72,0x21,0x20,0x73,0x65,0x74,
+0x2d,0x63,0x61,0x72,0x21,0x20,0x20,0x23,
+0x2e,0x63,0x6f,0x6e,0x73,0x20,0x63,0x6f,
+0x6e,0x73,0x20,0x20,0x23,0x2e,0x61,0x74,
+0x6f,0x6d,0x3f,0x20,0x61,0x74,0x6f,0x6d,
+0x3f,0x20,0x20,0x23,0x2e,0x73,0x65,0x74,
+0x2d,0x63,0x64,0x72,0x21,0x20,0x73,0x65,
+0x74,0x2d,0x63,0x64,0x72,0x21,0x20,0x20,
+0x23,0x2e,0x73,0x79,0x6d,0x62,0x6f,0x6c,
+0x3f,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
+0x3f,0x20,0x20,0x23,0x2e,0x65,0x71,0x3f,
+0x20,0x65,0x71,0x3f,0x20,0x20,0x23,0x2e,
+0x76,0x65,0x63,0x74,0x6f,0x72,0x20,0x76,
+0x65,0x63,0x74,0x6f,0x72,0x20,0x20,0x23,
+0x2e,0x6e,0x6f,0x74,0x20,0x6e,0x6f,0x74,
+0x20,0x20,0x23,0x2e,0x70,0x61,0x69,0x72,
+0x3f,0x20,0x70,0x61,0x69,0x72,0x3f,0x20,
+0x20,0x23,0x2e,0x6e,0x75,0x6d,0x62,0x65,
+0x72,0x3f,0x20,0x6e,0x75,0x6d,0x62,0x65,
+0x72,0x3f,0x20,0x20,0x23,0x2e,0x64,0x69,
+0x76,0x30,0x20,0x64,0x69,0x76,0x30,0x20,
+0x20,0x23,0x2e,0x61,0x73,0x65,0x74,0x21,
+0x20,0x61,0x73,0x65,0x74,0x21,0x20,0x20,
+0x23,0x2e,0x2b,0x20,0x2b,0x20,0x20,0x23,
+0x2e,0x3d,0x20,0x3d,0x20,0x20,0x23,0x2e,
+0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0x20,
+0x63,0x6f,0x6d,0x70,0x61,0x72,0x65,0x20,
+0x20,0x23,0x2e,0x76,0x65,0x63,0x74,0x6f,
+0x72,0x3f,0x20,0x76,0x65,0x63,0x74,0x6f,
+0x72,0x3f,0x20,0x20,0x23,0x2e,0x2f,0x20,
+0x2f,0x20,0x20,0x23,0x2e,0x3c,0x20,0x3c,
+0x20,0x20,0x23,0x2e,0x66,0x69,0x78,0x6e,
+0x75,0x6d,0x3f,0x20,0x66,0x69,0x78,0x6e,
+0x75,0x6d,0x3f,0x29,0x20,0x28,0x29,0x5d,
+0x29,0x20,0x63,0x61,0x61,0x61,0x61,0x72,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x4d,0x4d,0x4d,
 0x4d,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
-0x61,0x61,0x61,0x64,0x72,0x29,0x20,0x63,
-0x61,0x61,0x61,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x4d,0x4d,0x4d,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x63,0x61,0x61,0x61,0x72,0x29,
-0x20,0x63,0x61,0x61,0x64,0x61,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x4d,0x5c,0x78,0x38,
-0x34,0x4d,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x63,0x61,0x61,0x64,0x61,0x72,0x29,0x20,
-0x63,0x61,0x61,0x64,0x64,0x72,0x20,0x23,
+0x61,0x61,0x61,0x61,0x72,0x29,0x20,0x63,
+0x61,0x61,0x61,0x64,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x5c,0x78,0x38,0x34,0x4d,0x4d,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,0x61,
+0x61,0x61,0x64,0x72,0x29,0x20,0x63,0x61,
+0x61,0x61,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x4d,0x4d,0x4d,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x63,0x61,0x61,0x61,0x72,0x29,0x20,
+0x63,0x61,0x61,0x64,0x61,0x72,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x4e,0x5c,0x78,0x38,0x34,
+0x72,0x31,0x7c,0x4d,0x5c,0x78,0x38,0x34,
 0x4d,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
-0x61,0x61,0x64,0x64,0x72,0x29,0x20,0x63,
-0x61,0x61,0x64,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x5c,0x78,0x38,0x34,0x4d,0x3b,0x22,
-0x20,0x5b,0x5d,0x20,0x63,0x61,0x61,0x64,
-0x72,0x29,0x20,0x63,0x61,0x61,0x72,0x20,
+0x61,0x61,0x64,0x61,0x72,0x29,0x20,0x63,
+0x61,0x61,0x64,0x64,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x4e,0x5c,0x78,0x38,0x34,0x4d,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,0x61,
+0x61,0x64,0x64,0x72,0x29,0x20,0x63,0x61,
+0x61,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x5c,0x78,0x38,0x34,0x4d,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x63,0x61,0x61,0x64,0x72,
+0x29,0x20,0x63,0x61,0x61,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x4d,0x4d,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x63,0x61,0x61,0x72,0x29,
+0x20,0x63,0x61,0x64,0x61,0x61,0x72,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x4d,0x4d,0x3b,0x22,
-0x20,0x5b,0x5d,0x20,0x63,0x61,0x61,0x72,
-0x29,0x20,0x63,0x61,0x64,0x61,0x61,0x72,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x4d,0x4d,0x5c,
+0x30,0x72,0x31,0x7c,0x4d,0x4d,0x5c,0x78,
+0x38,0x34,0x3b,0x22,0x20,0x5b,0x5d,0x20,
+0x63,0x61,0x64,0x61,0x61,0x72,0x29,0x20,
+0x63,0x61,0x64,0x61,0x64,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x5c,0x78,0x38,0x34,0x5c,
 0x78,0x38,0x34,0x3b,0x22,0x20,0x5b,0x5d,
-0x20,0x63,0x61,0x64,0x61,0x61,0x72,0x29,
-0x20,0x63,0x61,0x64,0x61,0x64,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x5c,0x78,0x38,0x34,
-0x5c,0x78,0x38,0x34,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x63,0x61,0x64,0x61,0x64,0x72,
-0x29,0x20,0x63,0x61,0x64,0x61,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x4d,0x5c,0x78,0x38,
-0x34,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
-0x61,0x64,0x61,0x72,0x29,0x20,0x63,0x61,
-0x64,0x64,0x61,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x4d,0x4e,0x5c,0x78,0x38,0x34,0x3b,
-0x22,0x20,0x5b,0x5d,0x20,0x63,0x61,0x64,
+0x20,0x63,0x61,0x64,0x61,0x64,0x72,0x29,
+0x20,0x63,0x61,0x64,0x61,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x4d,0x5c,0x78,0x38,0x34,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,0x61,
 0x64,0x61,0x72,0x29,0x20,0x63,0x61,0x64,
-0x64,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x64,0x61,0x72,0x20,0x23,0x66,0x6e,0x28,
 0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x4e,0x4e,0x5c,0x78,0x38,0x34,0x3b,0x22,
+0x4d,0x4e,0x5c,0x78,0x38,0x34,0x3b,0x22,
 0x20,0x5b,0x5d,0x20,0x63,0x61,0x64,0x64,
-0x64,0x72,0x29,0x20,0x63,0x61,0x64,0x64,
-0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x4e,0x5c,
-0x78,0x38,0x34,0x3b,0x22,0x20,0x5b,0x5d,
-0x20,0x63,0x61,0x64,0x64,0x72,0x29,0x20,
-0x63,0x61,0x64,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x5c,0x78,0x38,0x34,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x63,0x61,0x64,0x72,0x29,
-0x20,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,
-0x74,0x68,0x2d,0x69,0x6e,0x70,0x75,0x74,
-0x2d,0x66,0x69,0x6c,0x65,0x20,0x23,0x66,
+0x61,0x72,0x29,0x20,0x63,0x61,0x64,0x64,
+0x64,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x36,0x30,0x30,0x30,0x72,0x31,0x7c,0x4e,
+0x4e,0x5c,0x78,0x38,0x34,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x63,0x61,0x64,0x64,0x64,
+0x72,0x29,0x20,0x63,0x61,0x64,0x64,0x72,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x4e,0x5c,0x78,
+0x38,0x34,0x3b,0x22,0x20,0x5b,0x5d,0x20,
+0x63,0x61,0x64,0x64,0x72,0x29,0x20,0x63,
+0x61,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x5c,0x78,0x38,0x34,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x63,0x61,0x64,0x72,0x29,0x20,
+0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,
+0x68,0x2d,0x69,0x6e,0x70,0x75,0x74,0x2d,
+0x66,0x69,0x6c,0x65,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x71,0x65,0x31,0x7c,0x33,0x31,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
 0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x65,0x31,0x7c,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x31,0x5c,0x78,0x37,0x66,0x7c,0x33,0x31,
+0x63,0x30,0x7c,0x33,0x31,0x32,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
+0x2e,0x63,0x6c,0x6f,0x73,0x65,0x29,0x5d,
+0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x66,0x69,0x6c,
+0x65,0x5d,0x20,0x63,0x61,0x6c,0x6c,0x2d,
+0x77,0x69,0x74,0x68,0x2d,0x69,0x6e,0x70,
+0x75,0x74,0x2d,0x66,0x69,0x6c,0x65,0x29,
+0x20,0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,
+0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,0x75,
+0x74,0x2d,0x66,0x69,0x6c,0x65,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x5c,0x78,0x37,0x66,0x7c,0x33,
-0x31,0x63,0x30,0x7c,0x33,0x31,0x32,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x29,
-0x5d,0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,
-0x69,0x6e,0x70,0x75,0x74,0x2d,0x66,0x69,
-0x6c,0x65,0x5d,0x20,0x63,0x61,0x6c,0x6c,
-0x2d,0x77,0x69,0x74,0x68,0x2d,0x69,0x6e,
-0x70,0x75,0x74,0x2d,0x66,0x69,0x6c,0x65,
-0x29,0x20,0x63,0x61,0x6c,0x6c,0x2d,0x77,
-0x69,0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,
-0x75,0x74,0x2d,0x66,0x69,0x6c,0x65,0x20,
+0x72,0x32,0x63,0x30,0x71,0x65,0x31,0x7c,
+0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x32,0x63,0x30,0x71,0x65,0x31,
-0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x5c,0x78,0x37,0x66,
-0x7c,0x33,0x31,0x63,0x30,0x7c,0x33,0x31,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,
-0x65,0x29,0x5d,0x29,0x20,0x6f,0x70,0x65,
-0x6e,0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,
-0x2d,0x66,0x69,0x6c,0x65,0x5d,0x20,0x63,
-0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,
+0x30,0x72,0x31,0x5c,0x78,0x37,0x66,0x7c,
+0x33,0x31,0x63,0x30,0x7c,0x33,0x31,0x32,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,0x65,
+0x29,0x5d,0x29,0x20,0x6f,0x70,0x65,0x6e,
 0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
-0x66,0x69,0x6c,0x65,0x29,0x20,0x63,0x61,
+0x66,0x69,0x6c,0x65,0x5d,0x20,0x63,0x61,
 0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,
-0x76,0x61,0x6c,0x75,0x65,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x71,0x7c,0x33,0x30,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x66,
+0x69,0x6c,0x65,0x29,0x20,0x63,0x61,0x6c,
+0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,0x76,
+0x61,0x6c,0x75,0x65,0x73,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x46,0x31,0x36,0x39,0x30,0x32,
-0x69,0x31,0x30,0x7c,0x4d,0x3c,0x36,0x38,
-0x30,0x5c,0x78,0x37,0x66,0x7c,0x4e,0x76,
-0x32,0x3b,0x5c,0x78,0x37,0x66,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,
-0x20,0x23,0x31,0x31,0x3d,0x5b,0x28,0x2a,
-0x76,0x61,0x6c,0x75,0x65,0x73,0x2a,0x29,
-0x20,0x28,0x29,0x5d,0x29,0x20,0x63,0x64,
-0x61,0x61,0x61,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x4d,0x4d,0x4d,0x4e,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x63,0x64,0x61,0x61,0x61,
-0x72,0x29,0x20,0x63,0x64,0x61,0x61,0x64,
-0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x5c,0x78,
-0x38,0x34,0x4d,0x4e,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x63,0x64,0x61,0x61,0x64,0x72,
-0x29,0x20,0x63,0x64,0x61,0x61,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x4d,0x4d,0x4e,0x3b,
-0x22,0x20,0x5b,0x5d,0x20,0x63,0x64,0x61,
-0x61,0x72,0x29,0x20,0x63,0x64,0x61,0x64,
-0x61,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x36,0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,
-0x5c,0x78,0x38,0x34,0x4e,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x63,0x64,0x61,0x64,0x61,
-0x72,0x29,0x20,0x63,0x64,0x61,0x64,0x64,
-0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x4e,0x5c,
-0x78,0x38,0x34,0x4e,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x63,0x64,0x61,0x64,0x64,0x72,
-0x29,0x20,0x63,0x64,0x61,0x64,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x5c,0x78,0x38,0x34,
-0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
-0x64,0x61,0x64,0x72,0x29,0x20,0x63,0x64,
-0x61,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x36,0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,
-0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
-0x64,0x61,0x72,0x29,0x20,0x63,0x64,0x64,
+0x32,0x63,0x30,0x71,0x7c,0x33,0x30,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x46,0x31,0x36,0x39,0x30,0x32,0x69,
+0x31,0x30,0x7c,0x4d,0x3c,0x36,0x38,0x30,
+0x5c,0x78,0x37,0x66,0x7c,0x4e,0x76,0x32,
+0x3b,0x5c,0x78,0x37,0x66,0x7c,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,
+0x23,0x31,0x31,0x3d,0x5b,0x28,0x2a,0x76,
+0x61,0x6c,0x75,0x65,0x73,0x2a,0x29,0x20,
+0x28,0x29,0x5d,0x29,0x20,0x63,0x64,0x61,
 0x61,0x61,0x72,0x20,0x23,0x66,0x6e,0x28,
 0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x4d,0x4d,0x4e,0x4e,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x63,0x64,0x64,0x61,0x61,0x72,
-0x29,0x20,0x63,0x64,0x64,0x61,0x64,0x72,
+0x4d,0x4d,0x4d,0x4e,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x63,0x64,0x61,0x61,0x61,0x72,
+0x29,0x20,0x63,0x64,0x61,0x61,0x64,0x72,
 0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
 0x30,0x30,0x72,0x31,0x7c,0x5c,0x78,0x38,
-0x34,0x4e,0x4e,0x3b,0x22,0x20,0x5b,0x5d,
-0x20,0x63,0x64,0x64,0x61,0x64,0x72,0x29,
-0x20,0x63,0x64,0x64,0x61,0x72,0x20,0x23,
+0x34,0x4d,0x4e,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x63,0x64,0x61,0x61,0x64,0x72,0x29,
+0x20,0x63,0x64,0x61,0x61,0x72,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x4d,0x4e,0x4e,0x3b,0x22,
-0x20,0x5b,0x5d,0x20,0x63,0x64,0x64,0x61,
-0x72,0x29,0x20,0x63,0x64,0x64,0x64,0x61,
+0x72,0x31,0x7c,0x4d,0x4d,0x4e,0x3b,0x22,
+0x20,0x5b,0x5d,0x20,0x63,0x64,0x61,0x61,
+0x72,0x29,0x20,0x63,0x64,0x61,0x64,0x61,
 0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,0x4e,
-0x4e,0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x63,0x64,0x64,0x64,0x61,0x72,0x29,0x20,
-0x63,0x64,0x64,0x64,0x64,0x72,0x20,0x23,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,0x5c,
+0x78,0x38,0x34,0x4e,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x63,0x64,0x61,0x64,0x61,0x72,
+0x29,0x20,0x63,0x64,0x61,0x64,0x64,0x72,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x4e,0x5c,0x78,
+0x38,0x34,0x4e,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x63,0x64,0x61,0x64,0x64,0x72,0x29,
+0x20,0x63,0x64,0x61,0x64,0x72,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x4e,0x4e,0x4e,0x4e,0x3b,
-0x22,0x20,0x5b,0x5d,0x20,0x63,0x64,0x64,
-0x64,0x64,0x72,0x29,0x20,0x63,0x64,0x64,
+0x72,0x31,0x7c,0x5c,0x78,0x38,0x34,0x4e,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,0x64,
+0x61,0x64,0x72,0x29,0x20,0x63,0x64,0x61,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,0x4e,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,0x64,
+0x61,0x72,0x29,0x20,0x63,0x64,0x64,0x61,
+0x61,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x36,0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,
+0x4d,0x4e,0x4e,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x63,0x64,0x64,0x61,0x61,0x72,0x29,
+0x20,0x63,0x64,0x64,0x61,0x64,0x72,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
+0x30,0x72,0x31,0x7c,0x5c,0x78,0x38,0x34,
+0x4e,0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,
+0x63,0x64,0x64,0x61,0x64,0x72,0x29,0x20,
+0x63,0x64,0x64,0x61,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x4d,0x4e,0x4e,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x63,0x64,0x64,0x61,0x72,
+0x29,0x20,0x63,0x64,0x64,0x64,0x61,0x72,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x4d,0x4e,0x4e,
+0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
+0x64,0x64,0x64,0x61,0x72,0x29,0x20,0x63,
+0x64,0x64,0x64,0x64,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x4e,0x4e,0x4e,0x4e,0x3b,0x22,
+0x20,0x5b,0x5d,0x20,0x63,0x64,0x64,0x64,
+0x64,0x72,0x29,0x20,0x63,0x64,0x64,0x64,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x4e,0x4e,
+0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
+0x64,0x64,0x64,0x72,0x29,0x20,0x63,0x64,
 0x64,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
 0x36,0x30,0x30,0x30,0x72,0x31,0x7c,0x4e,
-0x4e,0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x63,0x64,0x64,0x64,0x72,0x29,0x20,0x63,
-0x64,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x4e,0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x63,0x64,0x64,0x72,0x29,0x20,0x63,0x65,
-0x69,0x6c,0x69,0x6e,0x67,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x60,0x58,0x36,0x38,0x30,0x63,
-0x30,0x7c,0x34,0x31,0x3b,0x63,0x30,0x7c,
-0x63,0x31,0x77,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x74,0x72,0x75,
-0x6e,0x63,0x61,0x74,0x65,0x29,0x20,0x30,
-0x2e,0x35,0x5d,0x20,0x63,0x65,0x69,0x6c,
-0x69,0x6e,0x67,0x29,0x20,0x63,0x68,0x61,
-0x72,0x2d,0x3e,0x69,0x6e,0x74,0x65,0x67,
-0x65,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x66,0x69,0x78,0x6e,0x75,
-0x6d,0x29,0x5d,0x20,0x63,0x68,0x61,0x72,
+0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
+0x64,0x64,0x72,0x29,0x20,0x63,0x65,0x69,
+0x6c,0x69,0x6e,0x67,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x60,0x58,0x36,0x38,0x30,0x63,0x30,
+0x7c,0x34,0x31,0x3b,0x63,0x30,0x7c,0x63,
+0x31,0x77,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x74,0x72,0x75,0x6e,
+0x63,0x61,0x74,0x65,0x29,0x20,0x30,0x2e,
+0x35,0x5d,0x20,0x63,0x65,0x69,0x6c,0x69,
+0x6e,0x67,0x29,0x20,0x63,0x68,0x61,0x72,
 0x2d,0x3e,0x69,0x6e,0x74,0x65,0x67,0x65,
-0x72,0x29,0x20,0x63,0x68,0x61,0x72,0x2d,
-0x6e,0x75,0x6d,0x65,0x72,0x69,0x63,0x3f,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x63,0x31,
-0x7c,0x33,0x32,0x40,0x40,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2e,0x66,0x69,0x6e,0x64,
-0x29,0x20,0x22,0x30,0x31,0x32,0x33,0x34,
-0x35,0x36,0x37,0x38,0x39,0x22,0x5d,0x20,
-0x63,0x68,0x61,0x72,0x2d,0x6e,0x75,0x6d,
-0x65,0x72,0x69,0x63,0x3f,0x29,0x20,0x63,
-0x68,0x61,0x72,0x2d,0x77,0x68,0x69,0x74,
-0x65,0x73,0x70,0x61,0x63,0x65,0x3f,0x20,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x66,0x69,0x78,0x6e,0x75,0x6d,
+0x29,0x5d,0x20,0x63,0x68,0x61,0x72,0x2d,
+0x3e,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x29,0x20,0x63,0x68,0x61,0x72,0x2d,0x6e,
+0x75,0x6d,0x65,0x72,0x69,0x63,0x3f,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x65,0x31,0x7c,
+0x30,0x72,0x31,0x63,0x30,0x63,0x31,0x7c,
 0x33,0x32,0x40,0x40,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
 0x6e,0x67,0x2e,0x66,0x69,0x6e,0x64,0x29,
-0x20,0x2a,0x77,0x68,0x69,0x74,0x65,0x73,
-0x70,0x61,0x63,0x65,0x2a,0x5d,0x20,0x63,
-0x68,0x61,0x72,0x2d,0x77,0x68,0x69,0x74,
-0x65,0x73,0x70,0x61,0x63,0x65,0x3f,0x29,
-0x20,0x63,0x68,0x61,0x72,0x3c,0x3d,0x3f,
-0x20,0x23,0x30,0x23,0x20,0x63,0x68,0x61,
-0x72,0x3c,0x3f,0x20,0x23,0x2e,0x3c,0x20,
-0x63,0x68,0x61,0x72,0x3d,0x3f,0x20,0x23,
-0x2e,0x65,0x71,0x76,0x3f,0x20,0x63,0x68,
-0x61,0x72,0x3e,0x3d,0x3f,0x20,0x23,0x31,
-0x23,0x20,0x63,0x68,0x61,0x72,0x3e,0x3f,
-0x20,0x23,0x32,0x23,0x20,0x63,0x68,0x61,
-0x72,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x7c,0x33,0x31,0x63,0x31,0x3c,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x74,0x79,
-0x70,0x65,0x6f,0x66,0x29,0x20,0x77,0x63,
-0x68,0x61,0x72,0x5d,0x20,0x63,0x68,0x61,
-0x72,0x3f,0x29,0x20,0x63,0x6c,0x6f,0x73,
-0x65,0x2d,0x69,0x6e,0x70,0x75,0x74,0x2d,
-0x70,0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,
-0x65,0x29,0x20,0x63,0x6c,0x6f,0x73,0x65,
-0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
-0x70,0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,
-0x65,0x29,0x20,0x63,0x6c,0x6f,0x73,0x75,
-0x72,0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x4a,0x31,0x36,0x36,0x30,0x32,0x7c,0x47,
-0x40,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,
-0x6c,0x6f,0x73,0x75,0x72,0x65,0x3f,0x29,
-0x20,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,
-0x2d,0x6c,0x69,0x6e,0x65,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
-0x30,0x65,0x30,0x3b,0x22,0x20,0x5b,0x2a,
-0x61,0x72,0x67,0x76,0x2a,0x5d,0x20,0x63,
-0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x2d,0x6c,
-0x69,0x6e,0x65,0x29,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x65,0x30,0x5f,0x7c,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x66,0x5d,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x29,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x6e,
-0x64,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
-0x30,0x30,0x30,0x72,0x34,0x65,0x30,0x7c,
-0x7d,0x67,0x32,0x67,0x33,0x5d,0x63,0x31,
-0x34,0x36,0x3b,0x22,0x20,0x5b,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,0x68,
-0x6f,0x72,0x74,0x2d,0x63,0x69,0x72,0x63,
-0x75,0x69,0x74,0x20,0x62,0x72,0x66,0x5d,
-0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x61,0x6e,0x64,0x29,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,
-0x70,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x34,0x63,0x30,0x71,
-0x67,0x33,0x4d,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x7c,
-0x43,0x31,0x36,0x56,0x30,0x32,0x65,0x31,
-0x7c,0x5c,0x78,0x37,0x66,0x33,0x32,0x40,
-0x31,0x36,0x4a,0x30,0x32,0x7c,0x45,0x31,
-0x36,0x43,0x30,0x32,0x63,0x32,0x7c,0x33,
-0x31,0x31,0x36,0x39,0x30,0x32,0x63,0x33,
-0x7c,0x33,0x31,0x47,0x36,0x3a,0x30,0x63,
-0x33,0x7c,0x33,0x31,0x35,0x33,0x30,0x7c,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
-0x31,0x65,0x30,0x69,0x31,0x33,0x4e,0x63,
-0x31,0x33,0x32,0x36,0x53,0x30,0x65,0x32,
-0x69,0x31,0x30,0x69,0x31,0x31,0x5e,0x7c,
-0x33,0x34,0x32,0x63,0x33,0x71,0x65,0x34,
-0x69,0x31,0x30,0x69,0x31,0x31,0x69,0x31,
-0x33,0x4e,0x33,0x33,0x34,0x31,0x3b,0x63,
-0x35,0x71,0x7c,0x47,0x31,0x36,0x38,0x30,
-0x32,0x65,0x36,0x7c,0x33,0x31,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3e,0x20,0x32,0x35,0x35,0x20,
+0x20,0x22,0x30,0x31,0x32,0x33,0x34,0x35,
+0x36,0x37,0x38,0x39,0x22,0x5d,0x20,0x63,
+0x68,0x61,0x72,0x2d,0x6e,0x75,0x6d,0x65,
+0x72,0x69,0x63,0x3f,0x29,0x20,0x63,0x68,
+0x61,0x72,0x2d,0x77,0x68,0x69,0x74,0x65,
+0x73,0x70,0x61,0x63,0x65,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x65,0x31,0x7c,0x33,
+0x32,0x40,0x40,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x66,0x69,0x6e,0x64,0x29,0x20,
+0x2a,0x77,0x68,0x69,0x74,0x65,0x73,0x70,
+0x61,0x63,0x65,0x2a,0x5d,0x20,0x63,0x68,
+0x61,0x72,0x2d,0x77,0x68,0x69,0x74,0x65,
+0x73,0x70,0x61,0x63,0x65,0x3f,0x29,0x20,
+0x63,0x68,0x61,0x72,0x3c,0x3d,0x3f,0x20,
+0x23,0x30,0x23,0x20,0x63,0x68,0x61,0x72,
+0x3c,0x3f,0x20,0x23,0x2e,0x3c,0x20,0x63,
+0x68,0x61,0x72,0x3d,0x3f,0x20,0x23,0x2e,
+0x65,0x71,0x76,0x3f,0x20,0x63,0x68,0x61,
+0x72,0x3e,0x3d,0x3f,0x20,0x23,0x31,0x23,
+0x20,0x63,0x68,0x61,0x72,0x3e,0x3f,0x20,
+0x23,0x32,0x23,0x20,0x63,0x68,0x61,0x72,
+0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
+0x33,0x31,0x63,0x31,0x3c,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x74,0x79,0x70,
+0x65,0x6f,0x66,0x29,0x20,0x77,0x63,0x68,
+0x61,0x72,0x5d,0x20,0x63,0x68,0x61,0x72,
+0x3f,0x29,0x20,0x63,0x6c,0x6f,0x73,0x65,
+0x2d,0x69,0x6e,0x70,0x75,0x74,0x2d,0x70,
+0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,0x65,
+0x29,0x20,0x63,0x6c,0x6f,0x73,0x65,0x2d,
+0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x70,
+0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,0x65,
+0x29,0x20,0x63,0x6c,0x6f,0x73,0x75,0x72,
+0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x4a,
+0x31,0x36,0x36,0x30,0x32,0x7c,0x47,0x40,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x63,0x6c,
+0x6f,0x73,0x75,0x72,0x65,0x3f,0x29,0x20,
+0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x2d,
+0x6c,0x69,0x6e,0x65,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x30,
+0x65,0x30,0x3b,0x22,0x20,0x5b,0x2a,0x61,
+0x72,0x67,0x76,0x2a,0x5d,0x20,0x63,0x6f,
+0x6d,0x6d,0x61,0x6e,0x64,0x2d,0x6c,0x69,
+0x6e,0x65,0x29,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x5f,0x7c,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x2d,0x66,0x5d,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x29,0x20,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x61,0x6e,0x64,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,
+0x30,0x30,0x72,0x34,0x65,0x30,0x7c,0x7d,
+0x67,0x32,0x67,0x33,0x5d,0x63,0x31,0x34,
+0x36,0x3b,0x22,0x20,0x5b,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x73,0x68,0x6f,
+0x72,0x74,0x2d,0x63,0x69,0x72,0x63,0x75,
+0x69,0x74,0x20,0x62,0x72,0x66,0x5d,0x20,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x61,0x6e,0x64,0x29,0x20,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x34,0x63,0x30,0x71,0x67,
+0x33,0x4d,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x71,0x7c,0x43,
+0x31,0x36,0x56,0x30,0x32,0x65,0x31,0x7c,
+0x5c,0x78,0x37,0x66,0x33,0x32,0x40,0x31,
+0x36,0x4a,0x30,0x32,0x7c,0x45,0x31,0x36,
+0x43,0x30,0x32,0x63,0x32,0x7c,0x33,0x31,
+0x31,0x36,0x39,0x30,0x32,0x63,0x33,0x7c,
+0x33,0x31,0x47,0x36,0x3a,0x30,0x63,0x33,
+0x7c,0x33,0x31,0x35,0x33,0x30,0x7c,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x31,
+0x65,0x30,0x69,0x31,0x33,0x4e,0x63,0x31,
+0x33,0x32,0x36,0x53,0x30,0x65,0x32,0x69,
+0x31,0x30,0x69,0x31,0x31,0x5e,0x7c,0x33,
+0x34,0x32,0x63,0x33,0x71,0x65,0x34,0x69,
+0x31,0x30,0x69,0x31,0x31,0x69,0x31,0x33,
+0x4e,0x33,0x33,0x34,0x31,0x3b,0x63,0x35,
+0x71,0x7c,0x47,0x31,0x36,0x38,0x30,0x32,
+0x65,0x36,0x7c,0x33,0x31,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x3e,0x20,0x32,0x35,0x35,0x20,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,
+0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x69,
+0x32,0x30,0x69,0x32,0x32,0x36,0x37,0x30,
+0x63,0x31,0x35,0x34,0x30,0x63,0x32,0x7c,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x65,0x6d,
+0x69,0x74,0x20,0x74,0x63,0x61,0x6c,0x6c,
+0x2e,0x6c,0x20,0x63,0x61,0x6c,0x6c,0x2e,
+0x6c,0x5d,0x29,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x2d,0x61,0x72,0x67,0x6c,
+0x69,0x73,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3b,0x30,0x30,0x30,0x72,0x31,0x7e,
+0x63,0x30,0x3c,0x31,0x36,0x58,0x30,0x32,
+0x65,0x31,0x7e,0x69,0x32,0x31,0x33,0x32,
+0x40,0x31,0x36,0x4a,0x30,0x32,0x63,0x32,
+0x63,0x30,0x33,0x31,0x65,0x30,0x3e,0x31,
+0x36,0x3c,0x30,0x32,0x65,0x33,0x69,0x32,
+0x33,0x62,0x32,0x33,0x32,0x36,0x4c,0x30,
+0x65,0x34,0x69,0x32,0x30,0x69,0x32,0x31,
+0x5e,0x69,0x32,0x33,0x5c,0x78,0x38,0x34,
+0x33,0x34,0x32,0x65,0x35,0x69,0x32,0x30,
+0x63,0x30,0x34,0x32,0x3b,0x7c,0x37,0x41,
+0x30,0x65,0x34,0x69,0x32,0x30,0x69,0x32,
+0x31,0x5e,0x7e,0x33,0x34,0x35,0x33,0x30,
+0x5d,0x32,0x63,0x36,0x71,0x65,0x37,0x69,
+0x32,0x30,0x69,0x32,0x31,0x69,0x32,0x33,
+0x4e,0x33,0x33,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x63,0x61,0x64,0x72,0x20,0x69,0x6e,
+0x2d,0x65,0x6e,0x76,0x3f,0x20,0x23,0x66,
+0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,
+0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x29,0x20,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x3d,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,0x6d,
+0x69,0x74,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3d,0x30,0x30,0x30,0x72,0x31,0x7e,0x36,
+0x48,0x30,0x65,0x30,0x69,0x33,0x30,0x69,
+0x33,0x31,0x69,0x33,0x32,0x69,0x33,0x33,
+0x69,0x31,0x30,0x7e,0x7c,0x34,0x37,0x3b,
+0x65,0x31,0x69,0x33,0x30,0x69,0x33,0x32,
+0x36,0x37,0x30,0x63,0x32,0x35,0x34,0x30,
+0x63,0x33,0x7c,0x34,0x33,0x3b,0x22,0x20,
+0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x2d,0x62,0x75,0x69,0x6c,0x74,0x69,0x6e,
+0x2d,0x63,0x61,0x6c,0x6c,0x20,0x65,0x6d,
+0x69,0x74,0x20,0x74,0x63,0x61,0x6c,0x6c,
+0x20,0x63,0x61,0x6c,0x6c,0x5d,0x29,0x20,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x61,0x72,0x67,0x6c,0x69,0x73,0x74,0x5d,
+0x29,0x20,0x62,0x75,0x69,0x6c,0x74,0x69,
+0x6e,0x2d,0x3e,0x69,0x6e,0x73,0x74,0x72,
+0x75,0x63,0x74,0x69,0x6f,0x6e,0x5d,0x29,
+0x20,0x69,0x6e,0x2d,0x65,0x6e,0x76,0x3f,
+0x20,0x23,0x66,0x6e,0x28,0x63,0x6f,0x6e,
+0x73,0x74,0x61,0x6e,0x74,0x3f,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x74,0x6f,0x70,0x2d,
+0x6c,0x65,0x76,0x65,0x6c,0x2d,0x76,0x61,
+0x6c,0x75,0x65,0x29,0x5d,0x29,0x5d,0x20,
 0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x69,0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x69,0x32,0x30,0x69,0x32,0x32,0x36,0x37,
-0x30,0x63,0x31,0x35,0x34,0x30,0x63,0x32,
-0x7c,0x34,0x33,0x3b,0x22,0x20,0x5b,0x65,
-0x6d,0x69,0x74,0x20,0x74,0x63,0x61,0x6c,
-0x6c,0x2e,0x6c,0x20,0x63,0x61,0x6c,0x6c,
-0x2e,0x6c,0x5d,0x29,0x20,0x63,0x6f,0x6d,
+0x61,0x70,0x70,0x29,0x20,0x63,0x6f,0x6d,
 0x70,0x69,0x6c,0x65,0x2d,0x61,0x72,0x67,
 0x6c,0x69,0x73,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x31,
-0x7e,0x63,0x30,0x3c,0x31,0x36,0x58,0x30,
-0x32,0x65,0x31,0x7e,0x69,0x32,0x31,0x33,
-0x32,0x40,0x31,0x36,0x4a,0x30,0x32,0x63,
-0x32,0x63,0x30,0x33,0x31,0x65,0x30,0x3e,
-0x31,0x36,0x3c,0x30,0x32,0x65,0x33,0x69,
-0x32,0x33,0x62,0x32,0x33,0x32,0x36,0x4c,
-0x30,0x65,0x34,0x69,0x32,0x30,0x69,0x32,
-0x31,0x5e,0x69,0x32,0x33,0x5c,0x78,0x38,
-0x34,0x33,0x34,0x32,0x65,0x35,0x69,0x32,
-0x30,0x63,0x30,0x34,0x32,0x3b,0x7c,0x37,
-0x41,0x30,0x65,0x34,0x69,0x32,0x30,0x69,
-0x32,0x31,0x5e,0x7e,0x33,0x34,0x35,0x33,
-0x30,0x5d,0x32,0x63,0x36,0x71,0x65,0x37,
-0x69,0x32,0x30,0x69,0x32,0x31,0x69,0x32,
-0x33,0x4e,0x33,0x33,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x63,0x61,0x64,0x72,0x20,0x69,
-0x6e,0x2d,0x65,0x6e,0x76,0x3f,0x20,0x23,
-0x66,0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,
-0x65,0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,
-0x75,0x65,0x29,0x20,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3d,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,
-0x6d,0x69,0x74,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3d,0x30,0x30,0x30,0x72,0x31,0x7e,
-0x36,0x48,0x30,0x65,0x30,0x69,0x33,0x30,
-0x69,0x33,0x31,0x69,0x33,0x32,0x69,0x33,
-0x33,0x69,0x31,0x30,0x7e,0x7c,0x34,0x37,
-0x3b,0x65,0x31,0x69,0x33,0x30,0x69,0x33,
-0x32,0x36,0x37,0x30,0x63,0x32,0x35,0x34,
-0x30,0x63,0x33,0x7c,0x34,0x33,0x3b,0x22,
-0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x62,0x75,0x69,0x6c,0x74,0x69,
-0x6e,0x2d,0x63,0x61,0x6c,0x6c,0x20,0x65,
-0x6d,0x69,0x74,0x20,0x74,0x63,0x61,0x6c,
-0x6c,0x20,0x63,0x61,0x6c,0x6c,0x5d,0x29,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x33,
+0x65,0x30,0x63,0x31,0x71,0x67,0x32,0x33,
+0x32,0x32,0x63,0x32,0x67,0x32,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x66,0x6f,0x72,0x2d,
+0x65,0x61,0x63,0x68,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x31,
+0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,0x5e,
+0x7c,0x34,0x34,0x3b,0x22,0x20,0x5b,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,
+0x6e,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,
 0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
 0x2d,0x61,0x72,0x67,0x6c,0x69,0x73,0x74,
-0x5d,0x29,0x20,0x62,0x75,0x69,0x6c,0x74,
-0x69,0x6e,0x2d,0x3e,0x69,0x6e,0x73,0x74,
-0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,0x5d,
-0x29,0x20,0x69,0x6e,0x2d,0x65,0x6e,0x76,
-0x3f,0x20,0x23,0x66,0x6e,0x28,0x63,0x6f,
-0x6e,0x73,0x74,0x61,0x6e,0x74,0x3f,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x74,0x6f,0x70,
-0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2d,0x76,
-0x61,0x6c,0x75,0x65,0x29,0x5d,0x29,0x5d,
-0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x61,0x70,0x70,0x29,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x72,
-0x67,0x6c,0x69,0x73,0x74,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x33,0x65,0x30,0x63,0x31,0x71,0x67,0x32,
-0x33,0x32,0x32,0x63,0x32,0x67,0x32,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x66,0x6f,0x72,
-0x2d,0x65,0x61,0x63,0x68,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
-0x31,0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,
-0x5e,0x7c,0x34,0x34,0x3b,0x22,0x20,0x5b,
-0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x69,0x6e,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,
-0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x61,0x72,0x67,0x6c,0x69,0x73,
-0x74,0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,
-0x6c,0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x34,0x67,0x33,0x3f,0x36,
-0x3f,0x30,0x65,0x30,0x7c,0x7d,0x67,0x32,
-0x65,0x31,0x33,0x30,0x34,0x34,0x3b,0x67,
-0x33,0x4e,0x3f,0x36,0x3e,0x30,0x65,0x30,
-0x7c,0x7d,0x67,0x32,0x67,0x33,0x4d,0x34,
-0x34,0x3b,0x65,0x30,0x7c,0x7d,0x5e,0x67,
-0x33,0x4d,0x33,0x34,0x32,0x65,0x32,0x7c,
-0x63,0x33,0x33,0x32,0x32,0x65,0x34,0x7c,
-0x7d,0x67,0x32,0x67,0x33,0x4e,0x34,0x34,
-0x3b,0x22,0x20,0x5b,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x76,
-0x6f,0x69,0x64,0x20,0x65,0x6d,0x69,0x74,
-0x20,0x70,0x6f,0x70,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x2d,0x62,0x65,0x67,
-0x69,0x6e,0x5d,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x62,0x65,0x67,0x69,
-0x6e,0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,
-0x6c,0x65,0x2d,0x62,0x75,0x69,0x6c,0x74,
-0x69,0x6e,0x2d,0x63,0x61,0x6c,0x6c,0x20,
+0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
-0x30,0x72,0x37,0x63,0x30,0x71,0x63,0x31,
-0x65,0x32,0x67,0x34,0x5e,0x33,0x33,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x31,0x36,0x3d,0x30,0x32,0x65,0x30,
-0x69,0x30,0x33,0x4e,0x7c,0x33,0x32,0x40,
-0x36,0x3d,0x30,0x65,0x31,0x69,0x30,0x35,
-0x7c,0x33,0x32,0x35,0x33,0x30,0x5d,0x32,
-0x63,0x32,0x71,0x69,0x30,0x35,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3d,0x20,0x61,0x72,0x67,0x63,
-0x2d,0x65,0x72,0x72,0x6f,0x72,0x20,0x23,
+0x30,0x72,0x34,0x67,0x33,0x3f,0x36,0x3f,
+0x30,0x65,0x30,0x7c,0x7d,0x67,0x32,0x65,
+0x31,0x33,0x30,0x34,0x34,0x3b,0x67,0x33,
+0x4e,0x3f,0x36,0x3e,0x30,0x65,0x30,0x7c,
+0x7d,0x67,0x32,0x67,0x33,0x4d,0x34,0x34,
+0x3b,0x65,0x30,0x7c,0x7d,0x5e,0x67,0x33,
+0x4d,0x33,0x34,0x32,0x65,0x32,0x7c,0x63,
+0x33,0x33,0x32,0x32,0x65,0x34,0x7c,0x7d,
+0x67,0x32,0x67,0x33,0x4e,0x34,0x34,0x3b,
+0x22,0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x20,0x76,0x6f,
+0x69,0x64,0x20,0x65,0x6d,0x69,0x74,0x20,
+0x70,0x6f,0x70,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x2d,0x62,0x65,0x67,0x69,
+0x6e,0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,
+0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x2d,0x62,0x75,0x69,0x6c,0x74,0x69,
+0x6e,0x2d,0x63,0x61,0x6c,0x6c,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x63,0x30,0x5c,0x78,0x38,
-0x32,0x52,0x30,0x69,0x31,0x36,0x60,0x57,
+0x72,0x37,0x63,0x30,0x71,0x63,0x31,0x65,
+0x32,0x67,0x34,0x5e,0x33,0x33,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x31,0x36,0x3d,0x30,0x32,0x65,0x30,0x69,
+0x30,0x33,0x4e,0x7c,0x33,0x32,0x40,0x36,
+0x3d,0x30,0x65,0x31,0x69,0x30,0x35,0x7c,
+0x33,0x32,0x35,0x33,0x30,0x5d,0x32,0x63,
+0x32,0x71,0x69,0x30,0x35,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x3d,0x20,0x61,0x72,0x67,0x63,0x2d,
+0x65,0x72,0x72,0x6f,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x63,0x30,0x5c,0x78,0x38,0x32,
+0x52,0x30,0x69,0x31,0x36,0x60,0x57,0x36,
+0x3c,0x30,0x65,0x31,0x69,0x31,0x30,0x63,
+0x32,0x34,0x32,0x3b,0x65,0x31,0x69,0x31,
+0x30,0x69,0x31,0x35,0x69,0x31,0x36,0x34,
+0x33,0x3b,0x7c,0x63,0x33,0x5c,0x78,0x38,
+0x32,0x65,0x30,0x69,0x31,0x36,0x60,0x57,
+0x36,0x3c,0x30,0x65,0x31,0x69,0x31,0x30,
+0x63,0x34,0x34,0x32,0x3b,0x69,0x31,0x36,
+0x62,0x32,0x57,0x36,0x3c,0x30,0x65,0x31,
+0x69,0x31,0x30,0x63,0x35,0x34,0x32,0x3b,
+0x65,0x31,0x69,0x31,0x30,0x69,0x31,0x35,
+0x69,0x31,0x36,0x34,0x33,0x3b,0x7c,0x63,
+0x36,0x5c,0x78,0x38,0x32,0x76,0x30,0x69,
+0x31,0x36,0x60,0x57,0x36,0x3b,0x30,0x65,
+0x37,0x69,0x31,0x35,0x61,0x34,0x32,0x3b,
+0x69,0x31,0x36,0x61,0x57,0x36,0x3c,0x30,
+0x65,0x31,0x69,0x31,0x30,0x63,0x38,0x34,
+0x32,0x3b,0x69,0x31,0x36,0x62,0x32,0x57,
 0x36,0x3c,0x30,0x65,0x31,0x69,0x31,0x30,
-0x63,0x32,0x34,0x32,0x3b,0x65,0x31,0x69,
+0x63,0x39,0x34,0x32,0x3b,0x65,0x31,0x69,
 0x31,0x30,0x69,0x31,0x35,0x69,0x31,0x36,
-0x34,0x33,0x3b,0x7c,0x63,0x33,0x5c,0x78,
-0x38,0x32,0x65,0x30,0x69,0x31,0x36,0x60,
+0x34,0x33,0x3b,0x7c,0x63,0x3a,0x5c,0x78,
+0x38,0x32,0x52,0x30,0x69,0x31,0x36,0x60,
 0x57,0x36,0x3c,0x30,0x65,0x31,0x69,0x31,
-0x30,0x63,0x34,0x34,0x32,0x3b,0x69,0x31,
-0x36,0x62,0x32,0x57,0x36,0x3c,0x30,0x65,
-0x31,0x69,0x31,0x30,0x63,0x35,0x34,0x32,
+0x30,0x63,0x3b,0x34,0x32,0x3b,0x65,0x31,
+0x69,0x31,0x30,0x69,0x31,0x35,0x69,0x31,
+0x36,0x34,0x33,0x3b,0x7c,0x63,0x3c,0x5c,
+0x78,0x38,0x32,0x51,0x30,0x69,0x31,0x36,
+0x60,0x57,0x36,0x3b,0x30,0x65,0x37,0x69,
+0x31,0x35,0x61,0x34,0x32,0x3b,0x65,0x31,
+0x69,0x31,0x30,0x69,0x31,0x35,0x69,0x31,
+0x36,0x34,0x33,0x3b,0x7c,0x63,0x3d,0x5c,
+0x78,0x38,0x32,0x54,0x30,0x69,0x31,0x36,
+0x60,0x57,0x36,0x3e,0x30,0x65,0x31,0x69,
+0x31,0x30,0x63,0x3e,0x63,0x3f,0x34,0x33,
 0x3b,0x65,0x31,0x69,0x31,0x30,0x69,0x31,
 0x35,0x69,0x31,0x36,0x34,0x33,0x3b,0x7c,
-0x63,0x36,0x5c,0x78,0x38,0x32,0x76,0x30,
-0x69,0x31,0x36,0x60,0x57,0x36,0x3b,0x30,
-0x65,0x37,0x69,0x31,0x35,0x61,0x34,0x32,
-0x3b,0x69,0x31,0x36,0x61,0x57,0x36,0x3c,
-0x30,0x65,0x31,0x69,0x31,0x30,0x63,0x38,
-0x34,0x32,0x3b,0x69,0x31,0x36,0x62,0x32,
-0x57,0x36,0x3c,0x30,0x65,0x31,0x69,0x31,
-0x30,0x63,0x39,0x34,0x32,0x3b,0x65,0x31,
-0x69,0x31,0x30,0x69,0x31,0x35,0x69,0x31,
-0x36,0x34,0x33,0x3b,0x7c,0x63,0x3a,0x5c,
-0x78,0x38,0x32,0x52,0x30,0x69,0x31,0x36,
-0x60,0x57,0x36,0x3c,0x30,0x65,0x31,0x69,
-0x31,0x30,0x63,0x3b,0x34,0x32,0x3b,0x65,
-0x31,0x69,0x31,0x30,0x69,0x31,0x35,0x69,
-0x31,0x36,0x34,0x33,0x3b,0x7c,0x63,0x3c,
-0x5c,0x78,0x38,0x32,0x51,0x30,0x69,0x31,
-0x36,0x60,0x57,0x36,0x3b,0x30,0x65,0x37,
-0x69,0x31,0x35,0x61,0x34,0x32,0x3b,0x65,
-0x31,0x69,0x31,0x30,0x69,0x31,0x35,0x69,
-0x31,0x36,0x34,0x33,0x3b,0x7c,0x63,0x3d,
-0x5c,0x78,0x38,0x32,0x54,0x30,0x69,0x31,
-0x36,0x60,0x57,0x36,0x3e,0x30,0x65,0x31,
-0x69,0x31,0x30,0x63,0x3e,0x63,0x3f,0x34,
-0x33,0x3b,0x65,0x31,0x69,0x31,0x30,0x69,
-0x31,0x35,0x69,0x31,0x36,0x34,0x33,0x3b,
-0x7c,0x63,0x40,0x5c,0x78,0x38,0x32,0x5d,
-0x30,0x69,0x31,0x36,0x62,0x32,0x58,0x36,
-0x3c,0x30,0x65,0x37,0x69,0x31,0x35,0x62,
-0x32,0x34,0x32,0x3b,0x65,0x31,0x69,0x31,
-0x30,0x69,0x31,0x32,0x36,0x37,0x30,0x63,
-0x41,0x35,0x34,0x30,0x63,0x40,0x69,0x31,
-0x36,0x34,0x33,0x3b,0x65,0x31,0x69,0x31,
-0x30,0x69,0x31,0x35,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x6c,0x69,0x73,0x74,0x20,0x65,
-0x6d,0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,
-0x6e,0x69,0x6c,0x20,0x2b,0x20,0x6c,0x6f,
-0x61,0x64,0x30,0x20,0x61,0x64,0x64,0x32,
-0x20,0x2d,0x20,0x61,0x72,0x67,0x63,0x2d,
-0x65,0x72,0x72,0x6f,0x72,0x20,0x6e,0x65,
-0x67,0x20,0x73,0x75,0x62,0x32,0x20,0x2a,
-0x20,0x6c,0x6f,0x61,0x64,0x31,0x20,0x2f,
-0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0x20,
-0x6c,0x6f,0x61,0x64,0x76,0x20,0x5b,0x5d,
-0x20,0x61,0x70,0x70,0x6c,0x79,0x20,0x74,
-0x61,0x70,0x70,0x6c,0x79,0x5d,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x67,0x65,
-0x74,0x29,0x20,0x61,0x72,0x67,0x2d,0x63,
-0x6f,0x75,0x6e,0x74,0x73,0x5d,0x20,0x63,
-0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x62,
-0x75,0x69,0x6c,0x74,0x69,0x6e,0x2d,0x63,
-0x61,0x6c,0x6c,0x29,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x2d,0x66,0x20,0x23,
+0x63,0x40,0x5c,0x78,0x38,0x32,0x5d,0x30,
+0x69,0x31,0x36,0x62,0x32,0x58,0x36,0x3c,
+0x30,0x65,0x37,0x69,0x31,0x35,0x62,0x32,
+0x34,0x32,0x3b,0x65,0x31,0x69,0x31,0x30,
+0x69,0x31,0x32,0x36,0x37,0x30,0x63,0x41,
+0x35,0x34,0x30,0x63,0x40,0x69,0x31,0x36,
+0x34,0x33,0x3b,0x65,0x31,0x69,0x31,0x30,
+0x69,0x31,0x35,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x6c,0x69,0x73,0x74,0x20,0x65,0x6d,
+0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,0x6e,
+0x69,0x6c,0x20,0x2b,0x20,0x6c,0x6f,0x61,
+0x64,0x30,0x20,0x61,0x64,0x64,0x32,0x20,
+0x2d,0x20,0x61,0x72,0x67,0x63,0x2d,0x65,
+0x72,0x72,0x6f,0x72,0x20,0x6e,0x65,0x67,
+0x20,0x73,0x75,0x62,0x32,0x20,0x2a,0x20,
+0x6c,0x6f,0x61,0x64,0x31,0x20,0x2f,0x20,
+0x76,0x65,0x63,0x74,0x6f,0x72,0x20,0x6c,
+0x6f,0x61,0x64,0x76,0x20,0x5b,0x5d,0x20,
+0x61,0x70,0x70,0x6c,0x79,0x20,0x74,0x61,
+0x70,0x70,0x6c,0x79,0x5d,0x29,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x67,0x65,0x74,
+0x29,0x20,0x61,0x72,0x67,0x2d,0x63,0x6f,
+0x75,0x6e,0x74,0x73,0x5d,0x20,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x2d,0x62,0x75,
+0x69,0x6c,0x74,0x69,0x6e,0x2d,0x63,0x61,
+0x6c,0x6c,0x29,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x2d,0x66,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x32,0x65,0x30,0x63,0x31,0x71,0x63,0x32,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,0x61,
+0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,
+0x76,0x61,0x6c,0x75,0x65,0x73,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x32,0x65,0x30,0x63,0x31,0x71,0x63,
-0x32,0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,
-0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,
-0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x30,0x65,0x30,0x7e,0x5c,0x78,
-0x37,0x66,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x72,0x30,0x65,0x30,0x7e,0x5c,0x78,0x37,
+0x66,0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x66,
+0x2d,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x32,0x7c,
+0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,
 0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x66,0x2d,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x32,
-0x7c,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,
-0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x66,0x29,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x66,0x2d,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x71,0x5d,0x5d,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3e,0x30,0x30,0x30,0x72,0x32,
-0x63,0x30,0x71,0x6d,0x30,0x32,0x63,0x31,
-0x71,0x6d,0x31,0x32,0x63,0x32,0x71,0x65,
-0x33,0x33,0x30,0x5c,0x78,0x37,0x66,0x5c,
-0x78,0x38,0x34,0x65,0x34,0x5c,0x78,0x37,
-0x66,0x5c,0x78,0x38,0x34,0x33,0x31,0x65,
-0x35,0x5c,0x78,0x37,0x66,0x5c,0x78,0x38,
-0x34,0x33,0x31,0x65,0x36,0x63,0x37,0x5c,
-0x78,0x37,0x66,0x5c,0x78,0x38,0x34,0x33,
-0x32,0x65,0x34,0x5c,0x78,0x37,0x66,0x33,
-0x31,0x69,0x31,0x30,0x5c,0x78,0x38,0x32,
-0x37,0x30,0x63,0x38,0x35,0x37,0x30,0x65,
-0x34,0x5c,0x78,0x37,0x66,0x33,0x31,0x34,
-0x36,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x65,0x31,0x7c,0x33,0x31,
-0x46,0x36,0x4e,0x30,0x65,0x32,0x7c,0x33,
-0x31,0x46,0x36,0x3d,0x30,0x63,0x33,0x65,
-0x31,0x7c,0x33,0x31,0x4b,0x35,0x37,0x30,
-0x65,0x34,0x7c,0x33,0x31,0x35,0x36,0x30,
-0x65,0x35,0x33,0x30,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x65,0x31,0x7c,0x33,0x31,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x31,0x7c,0x5c,
-0x78,0x38,0x35,0x34,0x30,0x7e,0x3b,0x63,
-0x30,0x63,0x31,0x7c,0x7e,0x69,0x34,0x30,
-0x33,0x34,0x63,0x32,0x63,0x33,0x7c,0x33,
-0x32,0x4b,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x6c,0x69,0x73,0x74,0x2a,0x29,
-0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,0x20,
-0x23,0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
-0x30,0x30,0x72,0x31,0x65,0x30,0x34,0x30,
-0x3b,0x22,0x20,0x5b,0x76,0x6f,0x69,0x64,
-0x5d,0x29,0x5d,0x29,0x20,0x67,0x65,0x74,
-0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,
-0x2d,0x76,0x61,0x72,0x73,0x5d,0x29,0x20,
-0x63,0x64,0x64,0x72,0x20,0x63,0x64,0x64,
-0x64,0x72,0x20,0x62,0x65,0x67,0x69,0x6e,
-0x20,0x63,0x61,0x64,0x64,0x72,0x20,0x76,
-0x6f,0x69,0x64,0x5d,0x20,0x6c,0x61,0x6d,
-0x62,0x64,0x61,0x2d,0x62,0x6f,0x64,0x79,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x7c,
-0x33,0x31,0x69,0x32,0x30,0x5c,0x78,0x38,
-0x32,0x38,0x30,0x65,0x31,0x7c,0x34,0x31,
-0x3b,0x7e,0x7c,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x6c,0x61,0x73,0x74,0x63,0x64,0x72,
-0x20,0x63,0x61,0x64,0x64,0x72,0x5d,0x20,
-0x6c,0x61,0x6d,0x3a,0x62,0x6f,0x64,0x79,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x72,0x36,0x63,0x30,0x71,
-0x7d,0x3f,0x36,0x36,0x30,0x60,0x35,0x37,
-0x30,0x63,0x31,0x7d,0x33,0x31,0x34,0x31,
+0x66,0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x66,0x2d,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x32,0x63,0x30,0x71,0x5d,0x5d,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3e,0x30,0x30,0x30,0x72,0x32,0x63,
+0x30,0x71,0x6d,0x30,0x32,0x63,0x31,0x71,
+0x6d,0x31,0x32,0x63,0x32,0x71,0x65,0x33,
+0x33,0x30,0x5c,0x78,0x37,0x66,0x5c,0x78,
+0x38,0x34,0x65,0x34,0x5c,0x78,0x37,0x66,
+0x5c,0x78,0x38,0x34,0x33,0x31,0x65,0x35,
+0x5c,0x78,0x37,0x66,0x5c,0x78,0x38,0x34,
+0x33,0x31,0x65,0x36,0x63,0x37,0x5c,0x78,
+0x37,0x66,0x5c,0x78,0x38,0x34,0x33,0x32,
+0x65,0x34,0x5c,0x78,0x37,0x66,0x33,0x31,
+0x69,0x31,0x30,0x5c,0x78,0x38,0x32,0x37,
+0x30,0x63,0x38,0x35,0x37,0x30,0x65,0x34,
+0x5c,0x78,0x37,0x66,0x33,0x31,0x34,0x36,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
 0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x7c,0x63,0x31,0x69,0x30,0x34,
-0x33,0x31,0x78,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x71,0x65,0x31,0x7c,0x33,0x31,0x46,
+0x36,0x4e,0x30,0x65,0x32,0x7c,0x33,0x31,
+0x46,0x36,0x3d,0x30,0x63,0x33,0x65,0x31,
+0x7c,0x33,0x31,0x4b,0x35,0x37,0x30,0x65,
+0x34,0x7c,0x33,0x31,0x35,0x36,0x30,0x65,
+0x35,0x33,0x30,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
 0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x65,
-0x31,0x65,0x32,0x69,0x31,0x34,0x33,0x32,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x43,0x30,0x30,0x30,0x72,
-0x31,0x69,0x32,0x34,0x5c,0x78,0x38,0x37,
-0x5c,0x78,0x61,0x39,0x30,0x7c,0x5c,0x78,
-0x38,0x35,0x4f,0x30,0x65,0x30,0x69,0x32,
-0x30,0x63,0x31,0x7e,0x69,0x32,0x32,0x5c,
-0x78,0x38,0x35,0x38,0x30,0x69,0x31,0x30,
-0x35,0x36,0x30,0x69,0x31,0x30,0x79,0x33,
-0x34,0x35,0x73,0x30,0x65,0x32,0x69,0x32,
-0x30,0x65,0x33,0x63,0x34,0x63,0x35,0x63,
-0x34,0x63,0x36,0x7c,0x33,0x32,0x65,0x37,
-0x63,0x38,0x7c,0x33,0x31,0x33,0x31,0x33,
-0x33,0x33,0x31,0x33,0x32,0x32,0x65,0x30,
-0x69,0x32,0x30,0x63,0x39,0x7e,0x63,0x38,
-0x7c,0x33,0x31,0x69,0x32,0x32,0x5c,0x78,
-0x38,0x35,0x38,0x30,0x69,0x31,0x30,0x35,
-0x36,0x30,0x69,0x31,0x30,0x79,0x33,0x35,
-0x32,0x65,0x3a,0x69,0x32,0x30,0x69,0x34,
-0x30,0x69,0x32,0x34,0x69,0x32,0x33,0x7e,
-0x33,0x35,0x35,0x33,0x30,0x5d,0x32,0x65,
-0x3b,0x69,0x31,0x30,0x63,0x3c,0x33,0x32,
-0x36,0x4c,0x30,0x65,0x30,0x69,0x32,0x30,
-0x69,0x32,0x32,0x5c,0x78,0x38,0x35,0x37,
-0x30,0x63,0x3d,0x35,0x34,0x30,0x63,0x3e,
-0x69,0x31,0x30,0x33,0x33,0x35,0x5d,0x30,
-0x69,0x32,0x32,0x5c,0x78,0x38,0x37,0x41,
-0x30,0x65,0x30,0x69,0x32,0x30,0x63,0x3f,
-0x69,0x31,0x30,0x33,0x33,0x35,0x48,0x30,
-0x69,0x32,0x34,0x5c,0x78,0x38,0x35,0x41,
-0x30,0x65,0x30,0x69,0x32,0x30,0x63,0x40,
-0x69,0x31,0x30,0x33,0x33,0x35,0x33,0x30,
-0x5e,0x32,0x65,0x41,0x69,0x32,0x30,0x69,
-0x32,0x33,0x69,0x34,0x30,0x4b,0x5d,0x69,
-0x33,0x31,0x69,0x34,0x31,0x33,0x31,0x33,
-0x34,0x32,0x65,0x30,0x69,0x32,0x30,0x63,
-0x42,0x33,0x32,0x32,0x65,0x43,0x63,0x44,
-0x65,0x45,0x65,0x46,0x69,0x32,0x30,0x33,
-0x31,0x33,0x31,0x65,0x47,0x69,0x32,0x30,
-0x33,0x31,0x69,0x32,0x35,0x33,0x33,0x69,
-0x32,0x30,0x62,0x33,0x5b,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x65,0x6d,0x69,0x74,0x20,
-0x6f,0x70,0x74,0x61,0x72,0x67,0x73,0x20,
-0x62,0x63,0x6f,0x64,0x65,0x3a,0x69,0x6e,
-0x64,0x65,0x78,0x66,0x6f,0x72,0x20,0x6d,
-0x61,0x6b,0x65,0x2d,0x70,0x65,0x72,0x66,
-0x65,0x63,0x74,0x2d,0x68,0x61,0x73,0x68,
-0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x23,
+0x31,0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x5c,0x78,
+0x38,0x35,0x34,0x30,0x7e,0x3b,0x63,0x30,
+0x63,0x31,0x7c,0x7e,0x69,0x34,0x30,0x33,
+0x34,0x63,0x32,0x63,0x33,0x7c,0x33,0x32,
+0x4b,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x6c,0x69,0x73,0x74,0x2a,0x29,0x20,
+0x6c,0x61,0x6d,0x62,0x64,0x61,0x20,0x23,
 0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
-0x23,0x2e,0x63,0x6f,0x6e,0x73,0x20,0x23,
-0x2e,0x63,0x61,0x72,0x20,0x69,0x6f,0x74,
-0x61,0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,
-0x6e,0x67,0x74,0x68,0x29,0x20,0x6b,0x65,
-0x79,0x61,0x72,0x67,0x73,0x20,0x65,0x6d,
-0x69,0x74,0x2d,0x6f,0x70,0x74,0x69,0x6f,
-0x6e,0x61,0x6c,0x2d,0x61,0x72,0x67,0x2d,
-0x69,0x6e,0x69,0x74,0x73,0x20,0x3e,0x20,
-0x32,0x35,0x35,0x20,0x6c,0x61,0x72,0x67,
-0x63,0x20,0x6c,0x76,0x61,0x72,0x67,0x63,
-0x20,0x76,0x61,0x72,0x67,0x63,0x20,0x61,
-0x72,0x67,0x63,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x72,
-0x65,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,
-0x73,0x20,0x23,0x66,0x6e,0x28,0x66,0x75,
-0x6e,0x63,0x74,0x69,0x6f,0x6e,0x29,0x20,
-0x65,0x6e,0x63,0x6f,0x64,0x65,0x2d,0x62,
-0x79,0x74,0x65,0x2d,0x63,0x6f,0x64,0x65,
-0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,
-0x6f,0x64,0x65,0x20,0x63,0x6f,0x6e,0x73,
-0x74,0x2d,0x74,0x6f,0x2d,0x69,0x64,0x78,
-0x2d,0x76,0x65,0x63,0x5d,0x29,0x20,0x66,
-0x69,0x6c,0x74,0x65,0x72,0x20,0x6b,0x65,
-0x79,0x77,0x6f,0x72,0x64,0x2d,0x61,0x72,
-0x67,0x3f,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x6c,
-0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,0x29,
-0x20,0x6d,0x61,0x6b,0x65,0x2d,0x63,0x6f,
-0x64,0x65,0x2d,0x65,0x6d,0x69,0x74,0x74,
-0x65,0x72,0x20,0x6c,0x61,0x73,0x74,0x63,
-0x64,0x72,0x20,0x6c,0x61,0x6d,0x62,0x64,
-0x61,0x2d,0x76,0x61,0x72,0x73,0x20,0x66,
-0x69,0x6c,0x74,0x65,0x72,0x20,0x23,0x2e,
-0x70,0x61,0x69,0x72,0x3f,0x20,0x6c,0x61,
-0x6d,0x62,0x64,0x61,0x5d,0x29,0x5d,0x20,
-0x23,0x33,0x3d,0x5b,0x23,0x3a,0x67,0x38,
-0x32,0x38,0x20,0x28,0x29,0x5d,0x29,0x20,
-0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x66,0x6f,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x72,0x35,0x65,
-0x30,0x67,0x34,0x33,0x31,0x36,0x58,0x30,
-0x65,0x31,0x7c,0x7d,0x5e,0x67,0x32,0x33,
-0x34,0x32,0x65,0x31,0x7c,0x7d,0x5e,0x67,
-0x33,0x33,0x34,0x32,0x65,0x31,0x7c,0x7d,
-0x5e,0x67,0x34,0x33,0x34,0x32,0x65,0x32,
-0x7c,0x63,0x33,0x34,0x32,0x3b,0x65,0x34,
-0x63,0x35,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x31,0x61,0x72,0x67,0x2d,0x6c,0x61,0x6d,
-0x62,0x64,0x61,0x3f,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,
-0x65,0x6d,0x69,0x74,0x20,0x66,0x6f,0x72,
-0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,
-0x66,0x6f,0x72,0x3a,0x20,0x74,0x68,0x69,
-0x72,0x64,0x20,0x66,0x6f,0x72,0x6d,0x20,
-0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,
-0x61,0x20,0x31,0x2d,0x61,0x72,0x67,0x75,
-0x6d,0x65,0x6e,0x74,0x20,0x6c,0x61,0x6d,
-0x62,0x64,0x61,0x22,0x5d,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x66,0x6f,
-0x72,0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,
-0x6c,0x65,0x2d,0x69,0x66,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3e,0x30,0x30,0x30,0x72,
-0x34,0x63,0x30,0x71,0x65,0x31,0x7c,0x33,
-0x31,0x65,0x31,0x7c,0x33,0x31,0x67,0x33,
-0x5c,0x78,0x38,0x34,0x65,0x32,0x67,0x33,
-0x33,0x31,0x65,0x33,0x67,0x33,0x33,0x31,
-0x5c,0x78,0x38,0x35,0x39,0x30,0x65,0x34,
-0x33,0x30,0x35,0x4a,0x30,0x65,0x35,0x67,
-0x33,0x33,0x31,0x5c,0x78,0x38,0x35,0x3b,
-0x30,0x65,0x36,0x67,0x33,0x33,0x31,0x35,
-0x38,0x30,0x65,0x37,0x63,0x38,0x33,0x31,
-0x34,0x35,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
-0x35,0x67,0x32,0x5d,0x5c,0x78,0x38,0x32,
-0x3e,0x30,0x65,0x30,0x7e,0x5c,0x78,0x37,
-0x66,0x69,0x30,0x32,0x67,0x33,0x34,0x34,
-0x3b,0x67,0x32,0x5e,0x5c,0x78,0x38,0x32,
-0x3e,0x30,0x65,0x30,0x7e,0x5c,0x78,0x37,
-0x66,0x69,0x30,0x32,0x67,0x34,0x34,0x34,
-0x3b,0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,
-0x5e,0x67,0x32,0x33,0x34,0x32,0x65,0x31,
-0x7e,0x63,0x32,0x7c,0x33,0x33,0x32,0x65,
-0x30,0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,
-0x32,0x67,0x33,0x33,0x34,0x32,0x69,0x30,
-0x32,0x36,0x3c,0x30,0x65,0x31,0x7e,0x63,
-0x33,0x33,0x32,0x35,0x3a,0x30,0x65,0x31,
-0x7e,0x63,0x34,0x7d,0x33,0x33,0x32,0x65,
-0x35,0x7e,0x7c,0x33,0x32,0x32,0x65,0x30,
+0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
+0x30,0x72,0x31,0x65,0x30,0x34,0x30,0x3b,
+0x22,0x20,0x5b,0x76,0x6f,0x69,0x64,0x5d,
+0x29,0x5d,0x29,0x20,0x67,0x65,0x74,0x2d,
+0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2d,
+0x76,0x61,0x72,0x73,0x5d,0x29,0x20,0x63,
+0x64,0x64,0x72,0x20,0x63,0x64,0x64,0x64,
+0x72,0x20,0x62,0x65,0x67,0x69,0x6e,0x20,
+0x63,0x61,0x64,0x64,0x72,0x20,0x76,0x6f,
+0x69,0x64,0x5d,0x20,0x6c,0x61,0x6d,0x62,
+0x64,0x61,0x2d,0x62,0x6f,0x64,0x79,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x65,0x30,0x7c,0x33,
+0x31,0x69,0x32,0x30,0x5c,0x78,0x38,0x32,
+0x38,0x30,0x65,0x31,0x7c,0x34,0x31,0x3b,
+0x7e,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x6c,0x61,0x73,0x74,0x63,0x64,0x72,0x20,
+0x63,0x61,0x64,0x64,0x72,0x5d,0x20,0x6c,
+0x61,0x6d,0x3a,0x62,0x6f,0x64,0x79,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x36,0x63,0x30,0x71,0x7d,
+0x3f,0x36,0x36,0x30,0x60,0x35,0x37,0x30,
+0x63,0x31,0x7d,0x33,0x31,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x7c,0x63,0x31,0x69,0x30,0x34,0x33,
+0x31,0x78,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x71,0x65,0x31,
+0x65,0x32,0x69,0x31,0x34,0x33,0x32,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x43,0x30,0x30,0x30,0x72,0x31,
+0x69,0x32,0x34,0x5c,0x78,0x38,0x37,0x5c,
+0x78,0x61,0x39,0x30,0x7c,0x5c,0x78,0x38,
+0x35,0x4f,0x30,0x65,0x30,0x69,0x32,0x30,
+0x63,0x31,0x7e,0x69,0x32,0x32,0x5c,0x78,
+0x38,0x35,0x38,0x30,0x69,0x31,0x30,0x35,
+0x36,0x30,0x69,0x31,0x30,0x79,0x33,0x34,
+0x35,0x73,0x30,0x65,0x32,0x69,0x32,0x30,
+0x65,0x33,0x63,0x34,0x63,0x35,0x63,0x34,
+0x63,0x36,0x7c,0x33,0x32,0x65,0x37,0x63,
+0x38,0x7c,0x33,0x31,0x33,0x31,0x33,0x33,
+0x33,0x31,0x33,0x32,0x32,0x65,0x30,0x69,
+0x32,0x30,0x63,0x39,0x7e,0x63,0x38,0x7c,
+0x33,0x31,0x69,0x32,0x32,0x5c,0x78,0x38,
+0x35,0x38,0x30,0x69,0x31,0x30,0x35,0x36,
+0x30,0x69,0x31,0x30,0x79,0x33,0x35,0x32,
+0x65,0x3a,0x69,0x32,0x30,0x69,0x34,0x30,
+0x69,0x32,0x34,0x69,0x32,0x33,0x7e,0x33,
+0x35,0x35,0x33,0x30,0x5d,0x32,0x65,0x3b,
+0x69,0x31,0x30,0x63,0x3c,0x33,0x32,0x36,
+0x4c,0x30,0x65,0x30,0x69,0x32,0x30,0x69,
+0x32,0x32,0x5c,0x78,0x38,0x35,0x37,0x30,
+0x63,0x3d,0x35,0x34,0x30,0x63,0x3e,0x69,
+0x31,0x30,0x33,0x33,0x35,0x5d,0x30,0x69,
+0x32,0x32,0x5c,0x78,0x38,0x37,0x41,0x30,
+0x65,0x30,0x69,0x32,0x30,0x63,0x3f,0x69,
+0x31,0x30,0x33,0x33,0x35,0x48,0x30,0x69,
+0x32,0x34,0x5c,0x78,0x38,0x35,0x41,0x30,
+0x65,0x30,0x69,0x32,0x30,0x63,0x40,0x69,
+0x31,0x30,0x33,0x33,0x35,0x33,0x30,0x5e,
+0x32,0x65,0x41,0x69,0x32,0x30,0x69,0x32,
+0x33,0x69,0x34,0x30,0x4b,0x5d,0x69,0x33,
+0x31,0x69,0x34,0x31,0x33,0x31,0x33,0x34,
+0x32,0x65,0x30,0x69,0x32,0x30,0x63,0x42,
+0x33,0x32,0x32,0x65,0x43,0x63,0x44,0x65,
+0x45,0x65,0x46,0x69,0x32,0x30,0x33,0x31,
+0x33,0x31,0x65,0x47,0x69,0x32,0x30,0x33,
+0x31,0x69,0x32,0x35,0x33,0x33,0x69,0x32,
+0x30,0x62,0x33,0x5b,0x34,0x32,0x3b,0x22,
+0x20,0x5b,0x65,0x6d,0x69,0x74,0x20,0x6f,
+0x70,0x74,0x61,0x72,0x67,0x73,0x20,0x62,
+0x63,0x6f,0x64,0x65,0x3a,0x69,0x6e,0x64,
+0x65,0x78,0x66,0x6f,0x72,0x20,0x6d,0x61,
+0x6b,0x65,0x2d,0x70,0x65,0x72,0x66,0x65,
+0x63,0x74,0x2d,0x68,0x61,0x73,0x68,0x2d,
+0x74,0x61,0x62,0x6c,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,0x23,
+0x2e,0x63,0x6f,0x6e,0x73,0x20,0x23,0x2e,
+0x63,0x61,0x72,0x20,0x69,0x6f,0x74,0x61,
+0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,
+0x67,0x74,0x68,0x29,0x20,0x6b,0x65,0x79,
+0x61,0x72,0x67,0x73,0x20,0x65,0x6d,0x69,
+0x74,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,
+0x61,0x6c,0x2d,0x61,0x72,0x67,0x2d,0x69,
+0x6e,0x69,0x74,0x73,0x20,0x3e,0x20,0x32,
+0x35,0x35,0x20,0x6c,0x61,0x72,0x67,0x63,
+0x20,0x6c,0x76,0x61,0x72,0x67,0x63,0x20,
+0x76,0x61,0x72,0x67,0x63,0x20,0x61,0x72,
+0x67,0x63,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x20,0x72,0x65,
+0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x73,
+0x20,0x23,0x66,0x6e,0x28,0x66,0x75,0x6e,
+0x63,0x74,0x69,0x6f,0x6e,0x29,0x20,0x65,
+0x6e,0x63,0x6f,0x64,0x65,0x2d,0x62,0x79,
+0x74,0x65,0x2d,0x63,0x6f,0x64,0x65,0x20,
+0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,0x6f,
+0x64,0x65,0x20,0x63,0x6f,0x6e,0x73,0x74,
+0x2d,0x74,0x6f,0x2d,0x69,0x64,0x78,0x2d,
+0x76,0x65,0x63,0x5d,0x29,0x20,0x66,0x69,
+0x6c,0x74,0x65,0x72,0x20,0x6b,0x65,0x79,
+0x77,0x6f,0x72,0x64,0x2d,0x61,0x72,0x67,
+0x3f,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x29,0x5d,0x29,0x20,
+0x6d,0x61,0x6b,0x65,0x2d,0x63,0x6f,0x64,
+0x65,0x2d,0x65,0x6d,0x69,0x74,0x74,0x65,
+0x72,0x20,0x6c,0x61,0x73,0x74,0x63,0x64,
+0x72,0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,
+0x2d,0x76,0x61,0x72,0x73,0x20,0x66,0x69,
+0x6c,0x74,0x65,0x72,0x20,0x23,0x2e,0x70,
+0x61,0x69,0x72,0x3f,0x20,0x6c,0x61,0x6d,
+0x62,0x64,0x61,0x5d,0x29,0x5d,0x20,0x23,
+0x33,0x3d,0x5b,0x23,0x3a,0x67,0x38,0x32,
+0x38,0x20,0x28,0x29,0x5d,0x29,0x20,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x66,
+0x6f,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3a,0x30,0x30,0x30,0x72,0x35,0x65,0x30,
+0x67,0x34,0x33,0x31,0x36,0x58,0x30,0x65,
+0x31,0x7c,0x7d,0x5e,0x67,0x32,0x33,0x34,
+0x32,0x65,0x31,0x7c,0x7d,0x5e,0x67,0x33,
+0x33,0x34,0x32,0x65,0x31,0x7c,0x7d,0x5e,
+0x67,0x34,0x33,0x34,0x32,0x65,0x32,0x7c,
+0x63,0x33,0x34,0x32,0x3b,0x65,0x34,0x63,
+0x35,0x34,0x31,0x3b,0x22,0x20,0x5b,0x31,
+0x61,0x72,0x67,0x2d,0x6c,0x61,0x6d,0x62,
+0x64,0x61,0x3f,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,
+0x6d,0x69,0x74,0x20,0x66,0x6f,0x72,0x20,
+0x65,0x72,0x72,0x6f,0x72,0x20,0x22,0x66,
+0x6f,0x72,0x3a,0x20,0x74,0x68,0x69,0x72,
+0x64,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,
+0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x61,
+0x20,0x31,0x2d,0x61,0x72,0x67,0x75,0x6d,
+0x65,0x6e,0x74,0x20,0x6c,0x61,0x6d,0x62,
+0x64,0x61,0x22,0x5d,0x20,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x66,0x6f,0x72,
+0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x2d,0x69,0x66,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3e,0x30,0x30,0x30,0x72,0x34,
+0x63,0x30,0x71,0x65,0x31,0x7c,0x33,0x31,
+0x65,0x31,0x7c,0x33,0x31,0x67,0x33,0x5c,
+0x78,0x38,0x34,0x65,0x32,0x67,0x33,0x33,
+0x31,0x65,0x33,0x67,0x33,0x33,0x31,0x5c,
+0x78,0x38,0x35,0x39,0x30,0x65,0x34,0x33,
+0x30,0x35,0x4a,0x30,0x65,0x35,0x67,0x33,
+0x33,0x31,0x5c,0x78,0x38,0x35,0x3b,0x30,
+0x65,0x36,0x67,0x33,0x33,0x31,0x35,0x38,
+0x30,0x65,0x37,0x63,0x38,0x33,0x31,0x34,
+0x35,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x35,
+0x67,0x32,0x5d,0x5c,0x78,0x38,0x32,0x3e,
+0x30,0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,
+0x69,0x30,0x32,0x67,0x33,0x34,0x34,0x3b,
+0x67,0x32,0x5e,0x5c,0x78,0x38,0x32,0x3e,
+0x30,0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,
+0x69,0x30,0x32,0x67,0x34,0x34,0x34,0x3b,
+0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,0x5e,
+0x67,0x32,0x33,0x34,0x32,0x65,0x31,0x7e,
+0x63,0x32,0x7c,0x33,0x33,0x32,0x65,0x30,
 0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,0x32,
-0x67,0x34,0x33,0x34,0x32,0x65,0x35,0x7e,
-0x7d,0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,
+0x67,0x33,0x33,0x34,0x32,0x69,0x30,0x32,
+0x36,0x3c,0x30,0x65,0x31,0x7e,0x63,0x33,
+0x33,0x32,0x35,0x3a,0x30,0x65,0x31,0x7e,
+0x63,0x34,0x7d,0x33,0x33,0x32,0x65,0x35,
+0x7e,0x7c,0x33,0x32,0x32,0x65,0x30,0x7e,
+0x5c,0x78,0x37,0x66,0x69,0x30,0x32,0x67,
+0x34,0x33,0x34,0x32,0x65,0x35,0x7e,0x7d,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,
+0x20,0x65,0x6d,0x69,0x74,0x20,0x62,0x72,
+0x66,0x20,0x72,0x65,0x74,0x20,0x6a,0x6d,
+0x70,0x20,0x6d,0x61,0x72,0x6b,0x2d,0x6c,
+0x61,0x62,0x65,0x6c,0x5d,0x29,0x20,0x6d,
+0x61,0x6b,0x65,0x2d,0x6c,0x61,0x62,0x65,
+0x6c,0x20,0x63,0x61,0x64,0x64,0x72,0x20,
+0x63,0x64,0x64,0x64,0x72,0x20,0x76,0x6f,
+0x69,0x64,0x20,0x63,0x64,0x64,0x64,0x64,
+0x72,0x20,0x63,0x61,0x64,0x64,0x64,0x72,
+0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,
+0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x69,
+0x66,0x20,0x65,0x78,0x70,0x65,0x63,0x74,
+0x73,0x20,0x32,0x2d,0x33,0x20,0x61,0x72,
+0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,0x2e,
+0x22,0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x66,0x29,0x20,0x63,
 0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,
-0x6e,0x20,0x65,0x6d,0x69,0x74,0x20,0x62,
-0x72,0x66,0x20,0x72,0x65,0x74,0x20,0x6a,
-0x6d,0x70,0x20,0x6d,0x61,0x72,0x6b,0x2d,
-0x6c,0x61,0x62,0x65,0x6c,0x5d,0x29,0x20,
-0x6d,0x61,0x6b,0x65,0x2d,0x6c,0x61,0x62,
-0x65,0x6c,0x20,0x63,0x61,0x64,0x64,0x72,
-0x20,0x63,0x64,0x64,0x64,0x72,0x20,0x76,
-0x6f,0x69,0x64,0x20,0x63,0x64,0x64,0x64,
-0x64,0x72,0x20,0x63,0x61,0x64,0x64,0x64,
-0x72,0x20,0x65,0x72,0x72,0x6f,0x72,0x20,
-0x22,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,
-0x69,0x66,0x20,0x65,0x78,0x70,0x65,0x63,
-0x74,0x73,0x20,0x32,0x2d,0x33,0x20,0x61,
-0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x73,
-0x2e,0x22,0x5d,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x66,0x29,0x20,
-0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x69,0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3b,0x30,0x30,0x30,0x72,0x34,0x67,0x33,
-0x43,0x36,0x3d,0x30,0x65,0x30,0x7c,0x7d,
-0x67,0x33,0x63,0x31,0x34,0x34,0x3b,0x67,
-0x33,0x3f,0x36,0x5c,0x78,0x61,0x66,0x30,
-0x67,0x33,0x60,0x5c,0x78,0x38,0x32,0x3a,
-0x30,0x65,0x32,0x7c,0x63,0x33,0x34,0x32,
-0x3b,0x67,0x33,0x61,0x5c,0x78,0x38,0x32,
-0x3a,0x30,0x65,0x32,0x7c,0x63,0x34,0x34,
-0x32,0x3b,0x67,0x33,0x5d,0x5c,0x78,0x38,
-0x32,0x3a,0x30,0x65,0x32,0x7c,0x63,0x35,
-0x34,0x32,0x3b,0x67,0x33,0x5e,0x5c,0x78,
+0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,0x3b,
+0x30,0x30,0x30,0x72,0x34,0x67,0x33,0x43,
+0x36,0x3d,0x30,0x65,0x30,0x7c,0x7d,0x67,
+0x33,0x63,0x31,0x34,0x34,0x3b,0x67,0x33,
+0x3f,0x36,0x5c,0x78,0x61,0x66,0x30,0x67,
+0x33,0x60,0x5c,0x78,0x38,0x32,0x3a,0x30,
+0x65,0x32,0x7c,0x63,0x33,0x34,0x32,0x3b,
+0x67,0x33,0x61,0x5c,0x78,0x38,0x32,0x3a,
+0x30,0x65,0x32,0x7c,0x63,0x34,0x34,0x32,
+0x3b,0x67,0x33,0x5d,0x5c,0x78,0x38,0x32,
+0x3a,0x30,0x65,0x32,0x7c,0x63,0x35,0x34,
+0x32,0x3b,0x67,0x33,0x5e,0x5c,0x78,0x38,
+0x32,0x3a,0x30,0x65,0x32,0x7c,0x63,0x36,
+0x34,0x32,0x3b,0x67,0x33,0x5f,0x5c,0x78,
 0x38,0x32,0x3a,0x30,0x65,0x32,0x7c,0x63,
-0x36,0x34,0x32,0x3b,0x67,0x33,0x5f,0x5c,
-0x78,0x38,0x32,0x3a,0x30,0x65,0x32,0x7c,
-0x63,0x37,0x34,0x32,0x3b,0x65,0x38,0x67,
-0x33,0x33,0x31,0x36,0x3c,0x30,0x65,0x32,
-0x7c,0x63,0x39,0x67,0x33,0x34,0x33,0x3b,
-0x63,0x3a,0x67,0x33,0x33,0x31,0x36,0x43,
-0x30,0x65,0x3b,0x7c,0x7d,0x67,0x32,0x63,
-0x3c,0x63,0x3d,0x33,0x31,0x4c,0x31,0x34,
-0x34,0x3b,0x65,0x32,0x7c,0x63,0x3e,0x67,
-0x33,0x34,0x33,0x3b,0x67,0x33,0x4d,0x43,
-0x40,0x31,0x37,0x44,0x30,0x32,0x67,0x33,
-0x4d,0x45,0x31,0x37,0x3b,0x30,0x32,0x65,
-0x3f,0x67,0x33,0x4d,0x7d,0x33,0x32,0x36,
-0x3d,0x30,0x65,0x40,0x7c,0x7d,0x67,0x32,
-0x67,0x33,0x34,0x34,0x3b,0x63,0x41,0x71,
-0x67,0x33,0x4d,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x73,0x79,0x6d,0x20,0x5b,0x6c,0x6f,
-0x61,0x64,0x61,0x20,0x6c,0x6f,0x61,0x64,
-0x63,0x20,0x6c,0x6f,0x61,0x64,0x67,0x5d,
-0x20,0x65,0x6d,0x69,0x74,0x20,0x6c,0x6f,
-0x61,0x64,0x30,0x20,0x6c,0x6f,0x61,0x64,
-0x31,0x20,0x6c,0x6f,0x61,0x64,0x74,0x20,
-0x6c,0x6f,0x61,0x64,0x66,0x20,0x6c,0x6f,
-0x61,0x64,0x6e,0x69,0x6c,0x20,0x66,0x69,
-0x74,0x73,0x2d,0x69,0x38,0x20,0x6c,0x6f,
-0x61,0x64,0x69,0x38,0x20,0x23,0x66,0x6e,
-0x28,0x65,0x6f,0x66,0x2d,0x6f,0x62,0x6a,
-0x65,0x63,0x74,0x3f,0x29,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,
-0x20,0x23,0x66,0x6e,0x28,0x74,0x6f,0x70,
-0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2d,0x76,
-0x61,0x6c,0x75,0x65,0x29,0x20,0x65,0x6f,
-0x66,0x2d,0x6f,0x62,0x6a,0x65,0x63,0x74,
-0x20,0x6c,0x6f,0x61,0x64,0x76,0x20,0x69,
-0x6e,0x2d,0x65,0x6e,0x76,0x3f,0x20,0x63,
-0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,
-0x70,0x70,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3c,0x30,0x30,0x30,0x72,0x31,0x7c,0x63,
-0x30,0x5c,0x78,0x38,0x32,0x57,0x30,0x65,
-0x31,0x69,0x30,0x33,0x5c,0x78,0x38,0x34,
-0x33,0x31,0x36,0x40,0x30,0x65,0x32,0x7e,
+0x37,0x34,0x32,0x3b,0x65,0x38,0x67,0x33,
+0x33,0x31,0x36,0x3c,0x30,0x65,0x32,0x7c,
+0x63,0x39,0x67,0x33,0x34,0x33,0x3b,0x63,
+0x3a,0x67,0x33,0x33,0x31,0x36,0x43,0x30,
+0x65,0x3b,0x7c,0x7d,0x67,0x32,0x63,0x3c,
+0x63,0x3d,0x33,0x31,0x4c,0x31,0x34,0x34,
+0x3b,0x65,0x32,0x7c,0x63,0x3e,0x67,0x33,
+0x34,0x33,0x3b,0x67,0x33,0x4d,0x43,0x40,
+0x31,0x37,0x44,0x30,0x32,0x67,0x33,0x4d,
+0x45,0x31,0x37,0x3b,0x30,0x32,0x65,0x3f,
+0x67,0x33,0x4d,0x7d,0x33,0x32,0x36,0x3d,
+0x30,0x65,0x40,0x7c,0x7d,0x67,0x32,0x67,
+0x33,0x34,0x34,0x3b,0x63,0x41,0x71,0x67,
+0x33,0x4d,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x73,0x79,0x6d,0x20,0x5b,0x6c,0x6f,0x61,
+0x64,0x61,0x20,0x6c,0x6f,0x61,0x64,0x63,
+0x20,0x6c,0x6f,0x61,0x64,0x67,0x5d,0x20,
+0x65,0x6d,0x69,0x74,0x20,0x6c,0x6f,0x61,
+0x64,0x30,0x20,0x6c,0x6f,0x61,0x64,0x31,
+0x20,0x6c,0x6f,0x61,0x64,0x74,0x20,0x6c,
+0x6f,0x61,0x64,0x66,0x20,0x6c,0x6f,0x61,
+0x64,0x6e,0x69,0x6c,0x20,0x66,0x69,0x74,
+0x73,0x2d,0x69,0x38,0x20,0x6c,0x6f,0x61,
+0x64,0x69,0x38,0x20,0x23,0x66,0x6e,0x28,
+0x65,0x6f,0x66,0x2d,0x6f,0x62,0x6a,0x65,
+0x63,0x74,0x3f,0x29,0x20,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,
+0x23,0x66,0x6e,0x28,0x74,0x6f,0x70,0x2d,
+0x6c,0x65,0x76,0x65,0x6c,0x2d,0x76,0x61,
+0x6c,0x75,0x65,0x29,0x20,0x65,0x6f,0x66,
+0x2d,0x6f,0x62,0x6a,0x65,0x63,0x74,0x20,
+0x6c,0x6f,0x61,0x64,0x76,0x20,0x69,0x6e,
+0x2d,0x65,0x6e,0x76,0x3f,0x20,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,
+0x70,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x63,0x30,
+0x5c,0x78,0x38,0x32,0x57,0x30,0x65,0x31,
+0x69,0x30,0x33,0x5c,0x78,0x38,0x34,0x33,
+0x31,0x36,0x40,0x30,0x65,0x32,0x7e,0x5c,
+0x78,0x37,0x66,0x69,0x30,0x32,0x69,0x30,
+0x33,0x5c,0x78,0x38,0x34,0x34,0x34,0x3b,
+0x65,0x33,0x7e,0x63,0x34,0x69,0x30,0x33,
+0x5c,0x78,0x38,0x34,0x34,0x33,0x3b,0x7c,
+0x63,0x35,0x5c,0x78,0x38,0x32,0x3f,0x30,
+0x65,0x36,0x7e,0x5c,0x78,0x37,0x66,0x69,
+0x30,0x32,0x69,0x30,0x33,0x34,0x34,0x3b,
+0x7c,0x63,0x37,0x5c,0x78,0x38,0x32,0x40,
+0x30,0x65,0x38,0x7e,0x5c,0x78,0x37,0x66,
+0x69,0x30,0x32,0x69,0x30,0x33,0x4e,0x34,
+0x34,0x3b,0x7c,0x63,0x39,0x5c,0x78,0x38,
+0x32,0x3c,0x30,0x65,0x3a,0x7e,0x5c,0x78,
+0x37,0x66,0x69,0x30,0x33,0x34,0x33,0x3b,
+0x7c,0x63,0x3b,0x5c,0x78,0x38,0x32,0x3d,
+0x30,0x65,0x3c,0x63,0x3d,0x71,0x63,0x3e,
+0x71,0x34,0x32,0x3b,0x7c,0x63,0x3f,0x5c,
+0x78,0x38,0x32,0x40,0x30,0x65,0x40,0x7e,
 0x5c,0x78,0x37,0x66,0x69,0x30,0x32,0x69,
-0x30,0x33,0x5c,0x78,0x38,0x34,0x34,0x34,
-0x3b,0x65,0x33,0x7e,0x63,0x34,0x69,0x30,
-0x33,0x5c,0x78,0x38,0x34,0x34,0x33,0x3b,
-0x7c,0x63,0x35,0x5c,0x78,0x38,0x32,0x3f,
-0x30,0x65,0x36,0x7e,0x5c,0x78,0x37,0x66,
-0x69,0x30,0x32,0x69,0x30,0x33,0x34,0x34,
-0x3b,0x7c,0x63,0x37,0x5c,0x78,0x38,0x32,
-0x40,0x30,0x65,0x38,0x7e,0x5c,0x78,0x37,
-0x66,0x69,0x30,0x32,0x69,0x30,0x33,0x4e,
-0x34,0x34,0x3b,0x7c,0x63,0x39,0x5c,0x78,
-0x38,0x32,0x3c,0x30,0x65,0x3a,0x7e,0x5c,
-0x78,0x37,0x66,0x69,0x30,0x33,0x34,0x33,
-0x3b,0x7c,0x63,0x3b,0x5c,0x78,0x38,0x32,
-0x3d,0x30,0x65,0x3c,0x63,0x3d,0x71,0x63,
-0x3e,0x71,0x34,0x32,0x3b,0x7c,0x63,0x3f,
-0x5c,0x78,0x38,0x32,0x40,0x30,0x65,0x40,
-0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,0x32,
-0x69,0x30,0x33,0x4e,0x34,0x34,0x3b,0x7c,
-0x63,0x41,0x5c,0x78,0x38,0x32,0x40,0x30,
-0x65,0x42,0x7e,0x5c,0x78,0x37,0x66,0x69,
-0x30,0x32,0x69,0x30,0x33,0x4e,0x34,0x34,
-0x3b,0x7c,0x63,0x43,0x5c,0x78,0x38,0x32,
-0x47,0x30,0x65,0x44,0x7e,0x5c,0x78,0x37,
-0x66,0x69,0x30,0x33,0x5c,0x78,0x38,0x34,
-0x63,0x37,0x65,0x45,0x69,0x30,0x33,0x33,
-0x31,0x4b,0x34,0x34,0x3b,0x7c,0x63,0x46,
-0x5c,0x78,0x38,0x32,0x4b,0x30,0x65,0x47,
-0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,0x33,
-0x5c,0x78,0x38,0x34,0x65,0x48,0x69,0x30,
-0x33,0x33,0x31,0x65,0x49,0x69,0x30,0x33,
-0x33,0x31,0x34,0x35,0x3b,0x7c,0x63,0x4a,
-0x5c,0x78,0x38,0x32,0x46,0x30,0x65,0x32,
-0x7e,0x5c,0x78,0x37,0x66,0x5d,0x69,0x30,
-0x33,0x5c,0x78,0x38,0x34,0x33,0x34,0x32,
-0x65,0x33,0x7e,0x63,0x4b,0x34,0x32,0x3b,
-0x7c,0x63,0x4c,0x5c,0x78,0x38,0x32,0x5f,
-0x30,0x65,0x32,0x7e,0x5c,0x78,0x37,0x66,
-0x5e,0x65,0x48,0x69,0x30,0x33,0x33,0x31,
-0x33,0x34,0x32,0x69,0x30,0x33,0x5c,0x78,
-0x38,0x34,0x43,0x31,0x37,0x39,0x30,0x32,
-0x65,0x4d,0x63,0x4e,0x33,0x31,0x32,0x65,
-0x4f,0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,
-0x33,0x5c,0x78,0x38,0x34,0x63,0x50,0x34,
-0x34,0x3b,0x7c,0x63,0x51,0x5c,0x78,0x38,
-0x32,0x43,0x30,0x65,0x32,0x7e,0x5c,0x78,
-0x37,0x66,0x69,0x30,0x32,0x65,0x52,0x69,
-0x30,0x33,0x33,0x31,0x34,0x34,0x3b,0x7c,
-0x63,0x53,0x5c,0x78,0x38,0x32,0x73,0x30,
-0x65,0x32,0x7e,0x5c,0x78,0x37,0x66,0x5e,
-0x63,0x3b,0x5f,0x69,0x30,0x33,0x5c,0x78,
-0x38,0x34,0x4c,0x33,0x33,0x34,0x32,0x65,
-0x54,0x65,0x48,0x69,0x30,0x33,0x33,0x31,
-0x33,0x31,0x36,0x36,0x30,0x5e,0x35,0x38,
-0x30,0x65,0x4d,0x63,0x55,0x33,0x31,0x32,
+0x30,0x33,0x4e,0x34,0x34,0x3b,0x7c,0x63,
+0x41,0x5c,0x78,0x38,0x32,0x40,0x30,0x65,
+0x42,0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,
+0x32,0x69,0x30,0x33,0x4e,0x34,0x34,0x3b,
+0x7c,0x63,0x43,0x5c,0x78,0x38,0x32,0x47,
+0x30,0x65,0x44,0x7e,0x5c,0x78,0x37,0x66,
+0x69,0x30,0x33,0x5c,0x78,0x38,0x34,0x63,
+0x37,0x65,0x45,0x69,0x30,0x33,0x33,0x31,
+0x4b,0x34,0x34,0x3b,0x7c,0x63,0x46,0x5c,
+0x78,0x38,0x32,0x4b,0x30,0x65,0x47,0x7e,
+0x5c,0x78,0x37,0x66,0x69,0x30,0x33,0x5c,
+0x78,0x38,0x34,0x65,0x48,0x69,0x30,0x33,
+0x33,0x31,0x65,0x49,0x69,0x30,0x33,0x33,
+0x31,0x34,0x35,0x3b,0x7c,0x63,0x4a,0x5c,
+0x78,0x38,0x32,0x46,0x30,0x65,0x32,0x7e,
+0x5c,0x78,0x37,0x66,0x5d,0x69,0x30,0x33,
+0x5c,0x78,0x38,0x34,0x33,0x34,0x32,0x65,
+0x33,0x7e,0x63,0x4b,0x34,0x32,0x3b,0x7c,
+0x63,0x4c,0x5c,0x78,0x38,0x32,0x5f,0x30,
 0x65,0x32,0x7e,0x5c,0x78,0x37,0x66,0x5e,
 0x65,0x48,0x69,0x30,0x33,0x33,0x31,0x33,
-0x34,0x32,0x65,0x33,0x7e,0x63,0x53,0x34,
-0x32,0x3b,0x65,0x56,0x7e,0x5c,0x78,0x37,
-0x66,0x69,0x30,0x32,0x69,0x30,0x33,0x34,
-0x34,0x3b,0x22,0x20,0x5b,0x71,0x75,0x6f,
-0x74,0x65,0x20,0x73,0x65,0x6c,0x66,0x2d,
-0x65,0x76,0x61,0x6c,0x75,0x61,0x74,0x69,
-0x6e,0x67,0x3f,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,
-0x6d,0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,
-0x76,0x20,0x69,0x66,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x2d,0x69,0x66,0x20,
-0x62,0x65,0x67,0x69,0x6e,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x62,0x65,
-0x67,0x69,0x6e,0x20,0x70,0x72,0x6f,0x67,
-0x31,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x70,0x72,0x6f,0x67,0x31,0x20,
-0x6c,0x61,0x6d,0x62,0x64,0x61,0x20,0x63,
-0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,
-0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x30,0x65,0x30,0x69,0x31,0x31,
-0x69,0x31,0x33,0x34,0x32,0x3b,0x22,0x20,
-0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x66,0x2d,0x5d,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x32,0x65,0x30,0x69,0x31,0x30,0x63,0x31,
-0x7c,0x33,0x33,0x32,0x65,0x32,0x69,0x31,
-0x30,0x7d,0x33,0x32,0x32,0x7d,0x65,0x33,
-0x69,0x31,0x31,0x33,0x31,0x58,0x36,0x3c,
-0x30,0x65,0x30,0x69,0x31,0x30,0x63,0x34,
-0x34,0x32,0x3b,0x5d,0x3b,0x22,0x20,0x5b,
-0x65,0x6d,0x69,0x74,0x20,0x6c,0x6f,0x61,
-0x64,0x76,0x20,0x62,0x63,0x6f,0x64,0x65,
-0x3a,0x63,0x64,0x65,0x70,0x74,0x68,0x20,
-0x6e,0x6e,0x6e,0x20,0x63,0x6c,0x6f,0x73,
-0x75,0x72,0x65,0x5d,0x29,0x20,0x61,0x6e,
-0x64,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x61,0x6e,0x64,0x20,0x6f,0x72,
+0x34,0x32,0x69,0x30,0x33,0x5c,0x78,0x38,
+0x34,0x43,0x31,0x37,0x39,0x30,0x32,0x65,
+0x4d,0x63,0x4e,0x33,0x31,0x32,0x65,0x4f,
+0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,0x33,
+0x5c,0x78,0x38,0x34,0x63,0x50,0x34,0x34,
+0x3b,0x7c,0x63,0x51,0x5c,0x78,0x38,0x32,
+0x43,0x30,0x65,0x32,0x7e,0x5c,0x78,0x37,
+0x66,0x69,0x30,0x32,0x65,0x52,0x69,0x30,
+0x33,0x33,0x31,0x34,0x34,0x3b,0x7c,0x63,
+0x53,0x5c,0x78,0x38,0x32,0x73,0x30,0x65,
+0x32,0x7e,0x5c,0x78,0x37,0x66,0x5e,0x63,
+0x3b,0x5f,0x69,0x30,0x33,0x5c,0x78,0x38,
+0x34,0x4c,0x33,0x33,0x34,0x32,0x65,0x54,
+0x65,0x48,0x69,0x30,0x33,0x33,0x31,0x33,
+0x31,0x36,0x36,0x30,0x5e,0x35,0x38,0x30,
+0x65,0x4d,0x63,0x55,0x33,0x31,0x32,0x65,
+0x32,0x7e,0x5c,0x78,0x37,0x66,0x5e,0x65,
+0x48,0x69,0x30,0x33,0x33,0x31,0x33,0x34,
+0x32,0x65,0x33,0x7e,0x63,0x53,0x34,0x32,
+0x3b,0x65,0x56,0x7e,0x5c,0x78,0x37,0x66,
+0x69,0x30,0x32,0x69,0x30,0x33,0x34,0x34,
+0x3b,0x22,0x20,0x5b,0x71,0x75,0x6f,0x74,
+0x65,0x20,0x73,0x65,0x6c,0x66,0x2d,0x65,
+0x76,0x61,0x6c,0x75,0x61,0x74,0x69,0x6e,
+0x67,0x3f,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,0x6d,
+0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,0x76,
+0x20,0x69,0x66,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x2d,0x69,0x66,0x20,0x62,
+0x65,0x67,0x69,0x6e,0x20,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x62,0x65,0x67,
+0x69,0x6e,0x20,0x70,0x72,0x6f,0x67,0x31,
 0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x6f,0x72,0x20,0x77,0x68,0x69,0x6c,
-0x65,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x77,0x68,0x69,0x6c,0x65,0x20,
-0x63,0x64,0x64,0x72,0x20,0x66,0x6f,0x72,
+0x2d,0x70,0x72,0x6f,0x67,0x31,0x20,0x6c,
+0x61,0x6d,0x62,0x64,0x61,0x20,0x63,0x61,
+0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,0x2d,
+0x76,0x61,0x6c,0x75,0x65,0x73,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x30,0x65,0x30,0x69,0x31,0x31,0x69,
+0x31,0x33,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x66,0x2d,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x32,
+0x65,0x30,0x69,0x31,0x30,0x63,0x31,0x7c,
+0x33,0x33,0x32,0x65,0x32,0x69,0x31,0x30,
+0x7d,0x33,0x32,0x32,0x7d,0x65,0x33,0x69,
+0x31,0x31,0x33,0x31,0x58,0x36,0x3c,0x30,
+0x65,0x30,0x69,0x31,0x30,0x63,0x34,0x34,
+0x32,0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x65,
+0x6d,0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,
+0x76,0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,
+0x63,0x64,0x65,0x70,0x74,0x68,0x20,0x6e,
+0x6e,0x6e,0x20,0x63,0x6c,0x6f,0x73,0x75,
+0x72,0x65,0x5d,0x29,0x20,0x61,0x6e,0x64,
 0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x66,0x6f,0x72,0x20,0x63,0x61,0x64,
-0x64,0x72,0x20,0x63,0x61,0x64,0x64,0x64,
-0x72,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
-0x20,0x72,0x65,0x74,0x20,0x73,0x65,0x74,
-0x21,0x20,0x65,0x72,0x72,0x6f,0x72,0x20,
-0x22,0x73,0x65,0x74,0x21,0x3a,0x20,0x73,
-0x65,0x63,0x6f,0x6e,0x64,0x20,0x61,0x72,
-0x67,0x75,0x6d,0x65,0x6e,0x74,0x20,0x6d,
-0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x61,
-0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x22,
+0x2d,0x61,0x6e,0x64,0x20,0x6f,0x72,0x20,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x6f,0x72,0x20,0x77,0x68,0x69,0x6c,0x65,
 0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x73,0x79,0x6d,0x20,0x5b,0x73,0x65,
-0x74,0x61,0x20,0x73,0x65,0x74,0x63,0x20,
-0x73,0x65,0x74,0x67,0x5d,0x20,0x64,0x65,
-0x66,0x69,0x6e,0x65,0x20,0x65,0x78,0x70,
-0x61,0x6e,0x64,0x2d,0x64,0x65,0x66,0x69,
-0x6e,0x65,0x20,0x74,0x72,0x79,0x63,0x61,
-0x74,0x63,0x68,0x20,0x31,0x61,0x72,0x67,
-0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,
-0x20,0x22,0x74,0x72,0x79,0x63,0x61,0x74,
-0x63,0x68,0x3a,0x20,0x73,0x65,0x63,0x6f,
-0x6e,0x64,0x20,0x66,0x6f,0x72,0x6d,0x20,
-0x6d,0x75,0x73,0x74,0x20,0x62,0x65,0x20,
-0x61,0x20,0x31,0x2d,0x61,0x72,0x67,0x75,
-0x6d,0x65,0x6e,0x74,0x20,0x6c,0x61,0x6d,
-0x62,0x64,0x61,0x22,0x20,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,
-0x5d,0x29,0x5d,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x29,0x20,
+0x2d,0x77,0x68,0x69,0x6c,0x65,0x20,0x63,
+0x64,0x64,0x72,0x20,0x66,0x6f,0x72,0x20,
 0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x6f,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3c,0x30,0x30,0x30,0x72,0x34,0x65,0x30,
-0x7c,0x7d,0x67,0x32,0x67,0x33,0x5e,0x63,
-0x31,0x34,0x36,0x3b,0x22,0x20,0x5b,0x63,
-0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,
-0x68,0x6f,0x72,0x74,0x2d,0x63,0x69,0x72,
-0x63,0x75,0x69,0x74,0x20,0x62,0x72,0x74,
-0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x6f,0x72,0x29,0x20,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x70,0x72,
-0x6f,0x67,0x31,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3b,0x30,0x30,0x30,0x72,0x33,0x65,
-0x30,0x7c,0x7d,0x5e,0x67,0x32,0x5c,0x78,
-0x38,0x34,0x33,0x34,0x32,0x65,0x31,0x67,
-0x32,0x33,0x31,0x46,0x36,0x48,0x30,0x65,
-0x32,0x7c,0x7d,0x5e,0x65,0x31,0x67,0x32,
-0x33,0x31,0x33,0x34,0x32,0x65,0x33,0x7c,
-0x63,0x34,0x34,0x32,0x3b,0x5d,0x3b,0x22,
-0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x69,0x6e,0x20,0x63,0x64,0x64,
-0x72,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,0x20,
-0x65,0x6d,0x69,0x74,0x20,0x70,0x6f,0x70,
-0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x70,0x72,0x6f,0x67,0x31,0x29,
+0x66,0x6f,0x72,0x20,0x63,0x61,0x64,0x64,
+0x72,0x20,0x63,0x61,0x64,0x64,0x64,0x72,
+0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+0x72,0x65,0x74,0x20,0x73,0x65,0x74,0x21,
+0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,
+0x73,0x65,0x74,0x21,0x3a,0x20,0x73,0x65,
+0x63,0x6f,0x6e,0x64,0x20,0x61,0x72,0x67,
+0x75,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x75,
+0x73,0x74,0x20,0x62,0x65,0x20,0x61,0x20,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x22,0x20,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x73,0x79,0x6d,0x20,0x5b,0x73,0x65,0x74,
+0x61,0x20,0x73,0x65,0x74,0x63,0x20,0x73,
+0x65,0x74,0x67,0x5d,0x20,0x64,0x65,0x66,
+0x69,0x6e,0x65,0x20,0x65,0x78,0x70,0x61,
+0x6e,0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,
+0x65,0x20,0x74,0x72,0x79,0x63,0x61,0x74,
+0x63,0x68,0x20,0x31,0x61,0x72,0x67,0x2d,
+0x6c,0x61,0x6d,0x62,0x64,0x61,0x3f,0x20,
+0x22,0x74,0x72,0x79,0x63,0x61,0x74,0x63,
+0x68,0x3a,0x20,0x73,0x65,0x63,0x6f,0x6e,
+0x64,0x20,0x66,0x6f,0x72,0x6d,0x20,0x6d,
+0x75,0x73,0x74,0x20,0x62,0x65,0x20,0x61,
+0x20,0x31,0x2d,0x61,0x72,0x67,0x75,0x6d,
+0x65,0x6e,0x74,0x20,0x6c,0x61,0x6d,0x62,
+0x64,0x61,0x22,0x20,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x2d,0x61,0x70,0x70,0x5d,
+0x29,0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x29,0x20,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x6f,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
+0x30,0x30,0x30,0x72,0x34,0x65,0x30,0x7c,
+0x7d,0x67,0x32,0x67,0x33,0x5e,0x63,0x31,
+0x34,0x36,0x3b,0x22,0x20,0x5b,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x2d,0x73,0x68,
+0x6f,0x72,0x74,0x2d,0x63,0x69,0x72,0x63,
+0x75,0x69,0x74,0x20,0x62,0x72,0x74,0x5d,
 0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x73,0x68,0x6f,0x72,0x74,0x2d,0x63,
-0x69,0x72,0x63,0x75,0x69,0x74,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x36,0x67,0x33,0x3f,0x36,0x3d,0x30,
-0x65,0x30,0x7c,0x7d,0x67,0x32,0x67,0x34,
-0x34,0x34,0x3b,0x67,0x33,0x4e,0x3f,0x36,
-0x3e,0x30,0x65,0x30,0x7c,0x7d,0x67,0x32,
-0x67,0x33,0x4d,0x34,0x34,0x3b,0x63,0x31,
-0x71,0x65,0x32,0x7c,0x33,0x31,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x7e,0x5c,0x78,0x37,
-0x66,0x5e,0x69,0x30,0x33,0x4d,0x33,0x34,
-0x32,0x65,0x31,0x7e,0x63,0x32,0x33,0x32,
-0x32,0x65,0x31,0x7e,0x69,0x30,0x35,0x7c,
-0x33,0x33,0x32,0x65,0x31,0x7e,0x63,0x33,
-0x33,0x32,0x32,0x65,0x34,0x7e,0x5c,0x78,
-0x37,0x66,0x69,0x30,0x32,0x69,0x30,0x33,
-0x4e,0x69,0x30,0x34,0x69,0x30,0x35,0x33,
-0x36,0x32,0x65,0x35,0x7e,0x7c,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,
-0x6d,0x69,0x74,0x20,0x64,0x75,0x70,0x20,
-0x70,0x6f,0x70,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x73,0x68,0x6f,0x72,
-0x74,0x2d,0x63,0x69,0x72,0x63,0x75,0x69,
-0x74,0x20,0x6d,0x61,0x72,0x6b,0x2d,0x6c,
-0x61,0x62,0x65,0x6c,0x5d,0x29,0x20,0x6d,
-0x61,0x6b,0x65,0x2d,0x6c,0x61,0x62,0x65,
-0x6c,0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x2d,0x6f,0x72,0x29,0x20,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x70,0x72,0x6f,
+0x67,0x31,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3b,0x30,0x30,0x30,0x72,0x33,0x65,0x30,
+0x7c,0x7d,0x5e,0x67,0x32,0x5c,0x78,0x38,
+0x34,0x33,0x34,0x32,0x65,0x31,0x67,0x32,
+0x33,0x31,0x46,0x36,0x48,0x30,0x65,0x32,
+0x7c,0x7d,0x5e,0x65,0x31,0x67,0x32,0x33,
+0x31,0x33,0x34,0x32,0x65,0x33,0x7c,0x63,
+0x34,0x34,0x32,0x3b,0x5d,0x3b,0x22,0x20,
+0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x2d,0x69,0x6e,0x20,0x63,0x64,0x64,0x72,
+0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x2d,0x62,0x65,0x67,0x69,0x6e,0x20,0x65,
+0x6d,0x69,0x74,0x20,0x70,0x6f,0x70,0x5d,
+0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x2d,0x70,0x72,0x6f,0x67,0x31,0x29,0x20,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x73,0x68,0x6f,0x72,0x74,0x2d,0x63,0x69,
+0x72,0x63,0x75,0x69,0x74,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x36,0x67,0x33,0x3f,0x36,0x3d,0x30,0x65,
+0x30,0x7c,0x7d,0x67,0x32,0x67,0x34,0x34,
+0x34,0x3b,0x67,0x33,0x4e,0x3f,0x36,0x3e,
+0x30,0x65,0x30,0x7c,0x7d,0x67,0x32,0x67,
+0x33,0x4d,0x34,0x34,0x3b,0x63,0x31,0x71,
+0x65,0x32,0x7c,0x33,0x31,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,
+0x5e,0x69,0x30,0x33,0x4d,0x33,0x34,0x32,
+0x65,0x31,0x7e,0x63,0x32,0x33,0x32,0x32,
+0x65,0x31,0x7e,0x69,0x30,0x35,0x7c,0x33,
+0x33,0x32,0x65,0x31,0x7e,0x63,0x33,0x33,
+0x32,0x32,0x65,0x34,0x7e,0x5c,0x78,0x37,
+0x66,0x69,0x30,0x32,0x69,0x30,0x33,0x4e,
+0x69,0x30,0x34,0x69,0x30,0x35,0x33,0x36,
+0x32,0x65,0x35,0x7e,0x7c,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x69,0x6e,0x20,0x65,0x6d,
+0x69,0x74,0x20,0x64,0x75,0x70,0x20,0x70,
+0x6f,0x70,0x20,0x63,0x6f,0x6d,0x70,0x69,
 0x6c,0x65,0x2d,0x73,0x68,0x6f,0x72,0x74,
 0x2d,0x63,0x69,0x72,0x63,0x75,0x69,0x74,
-0x29,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x73,0x79,0x6d,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
-0x34,0x63,0x30,0x71,0x65,0x31,0x67,0x32,
-0x7d,0x60,0x5d,0x33,0x34,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x31,0x7c,0x44,
-0x36,0x3e,0x30,0x65,0x30,0x7e,0x69,0x30,
-0x33,0x60,0x5b,0x7c,0x34,0x33,0x3b,0x7c,
-0x4d,0x44,0x36,0x52,0x30,0x65,0x30,0x7e,
-0x69,0x30,0x33,0x61,0x5b,0x7c,0x4d,0x7c,
-0x4e,0x33,0x34,0x32,0x65,0x31,0x7e,0x65,
-0x32,0x5c,0x78,0x37,0x66,0x4e,0x33,0x31,
-0x61,0x7c,0x4d,0x53,0x33,0x34,0x32,0x3b,
-0x63,0x33,0x69,0x30,0x32,0x33,0x31,0x31,
-0x36,0x3e,0x30,0x32,0x65,0x34,0x63,0x35,
-0x69,0x30,0x32,0x33,0x31,0x33,0x31,0x36,
-0x41,0x30,0x65,0x30,0x7e,0x63,0x36,0x63,
-0x35,0x69,0x30,0x32,0x33,0x31,0x34,0x33,
-0x3b,0x65,0x30,0x7e,0x69,0x30,0x33,0x62,
-0x32,0x5b,0x69,0x30,0x32,0x34,0x33,0x3b,
-0x22,0x20,0x5b,0x65,0x6d,0x69,0x74,0x20,
-0x62,0x63,0x6f,0x64,0x65,0x3a,0x63,0x64,
-0x65,0x70,0x74,0x68,0x20,0x6e,0x6e,0x6e,
-0x20,0x23,0x66,0x6e,0x28,0x63,0x6f,0x6e,
-0x73,0x74,0x61,0x6e,0x74,0x3f,0x29,0x20,
-0x70,0x72,0x69,0x6e,0x74,0x61,0x62,0x6c,
-0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,0x74,
-0x6f,0x70,0x2d,0x6c,0x65,0x76,0x65,0x6c,
-0x2d,0x76,0x61,0x6c,0x75,0x65,0x29,0x20,
-0x6c,0x6f,0x61,0x64,0x76,0x5d,0x29,0x20,
-0x6c,0x6f,0x6f,0x6b,0x75,0x70,0x2d,0x73,
-0x79,0x6d,0x5d,0x20,0x63,0x6f,0x6d,0x70,
-0x69,0x6c,0x65,0x2d,0x73,0x79,0x6d,0x29,
-0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x74,0x68,0x75,0x6e,0x6b,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x63,0x31,0x63,0x32,
-0x4c,0x31,0x5f,0x4c,0x31,0x7c,0x4c,0x31,
-0x7e,0x33,0x34,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x20,0x23,0x66,0x6e,0x28,0x6e,0x63,0x6f,
-0x6e,0x63,0x29,0x20,0x6c,0x61,0x6d,0x62,
-0x64,0x61,0x5d,0x20,0x23,0x33,0x23,0x29,
+0x20,0x6d,0x61,0x72,0x6b,0x2d,0x6c,0x61,
+0x62,0x65,0x6c,0x5d,0x29,0x20,0x6d,0x61,
+0x6b,0x65,0x2d,0x6c,0x61,0x62,0x65,0x6c,
+0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x2d,0x73,0x68,0x6f,0x72,0x74,0x2d,
+0x63,0x69,0x72,0x63,0x75,0x69,0x74,0x29,
 0x20,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x2d,0x77,0x68,0x69,0x6c,0x65,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x34,0x63,0x30,0x71,0x65,0x31,0x7c,
-0x33,0x31,0x65,0x31,0x7c,0x33,0x31,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x32,
-0x65,0x30,0x7e,0x5c,0x78,0x37,0x66,0x5e,
-0x65,0x31,0x33,0x30,0x33,0x34,0x32,0x65,
-0x32,0x7e,0x7c,0x33,0x32,0x32,0x65,0x30,
-0x7e,0x5c,0x78,0x37,0x66,0x5e,0x69,0x30,
-0x32,0x33,0x34,0x32,0x65,0x33,0x7e,0x63,
-0x34,0x7d,0x33,0x33,0x32,0x65,0x33,0x7e,
-0x63,0x35,0x33,0x32,0x32,0x65,0x30,0x7e,
-0x5c,0x78,0x37,0x66,0x5e,0x69,0x30,0x33,
-0x33,0x34,0x32,0x65,0x33,0x7e,0x63,0x36,
-0x7c,0x33,0x33,0x32,0x65,0x32,0x7e,0x7d,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,0x6f,
-0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,
-0x20,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
-0x72,0x6b,0x2d,0x6c,0x61,0x62,0x65,0x6c,
-0x20,0x65,0x6d,0x69,0x74,0x20,0x62,0x72,
-0x66,0x20,0x70,0x6f,0x70,0x20,0x6a,0x6d,
-0x70,0x5d,0x29,0x20,0x6d,0x61,0x6b,0x65,
-0x2d,0x6c,0x61,0x62,0x65,0x6c,0x5d,0x20,
+0x2d,0x73,0x79,0x6d,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x34,
+0x63,0x30,0x71,0x65,0x31,0x67,0x32,0x7d,
+0x60,0x5d,0x33,0x34,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x44,0x36,
+0x3e,0x30,0x65,0x30,0x7e,0x69,0x30,0x33,
+0x60,0x5b,0x7c,0x34,0x33,0x3b,0x7c,0x4d,
+0x44,0x36,0x52,0x30,0x65,0x30,0x7e,0x69,
+0x30,0x33,0x61,0x5b,0x7c,0x4d,0x7c,0x4e,
+0x33,0x34,0x32,0x65,0x31,0x7e,0x65,0x32,
+0x5c,0x78,0x37,0x66,0x4e,0x33,0x31,0x61,
+0x7c,0x4d,0x53,0x33,0x34,0x32,0x3b,0x63,
+0x33,0x69,0x30,0x32,0x33,0x31,0x31,0x36,
+0x3e,0x30,0x32,0x65,0x34,0x63,0x35,0x69,
+0x30,0x32,0x33,0x31,0x33,0x31,0x36,0x41,
+0x30,0x65,0x30,0x7e,0x63,0x36,0x63,0x35,
+0x69,0x30,0x32,0x33,0x31,0x34,0x33,0x3b,
+0x65,0x30,0x7e,0x69,0x30,0x33,0x62,0x32,
+0x5b,0x69,0x30,0x32,0x34,0x33,0x3b,0x22,
+0x20,0x5b,0x65,0x6d,0x69,0x74,0x20,0x62,
+0x63,0x6f,0x64,0x65,0x3a,0x63,0x64,0x65,
+0x70,0x74,0x68,0x20,0x6e,0x6e,0x6e,0x20,
+0x23,0x66,0x6e,0x28,0x63,0x6f,0x6e,0x73,
+0x74,0x61,0x6e,0x74,0x3f,0x29,0x20,0x70,
+0x72,0x69,0x6e,0x74,0x61,0x62,0x6c,0x65,
+0x3f,0x20,0x23,0x66,0x6e,0x28,0x74,0x6f,
+0x70,0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2d,
+0x76,0x61,0x6c,0x75,0x65,0x29,0x20,0x6c,
+0x6f,0x61,0x64,0x76,0x5d,0x29,0x20,0x6c,
+0x6f,0x6f,0x6b,0x75,0x70,0x2d,0x73,0x79,
+0x6d,0x5d,0x20,0x63,0x6f,0x6d,0x70,0x69,
+0x6c,0x65,0x2d,0x73,0x79,0x6d,0x29,0x20,
 0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x77,0x68,0x69,0x6c,0x65,0x29,0x20,0x63,
-0x6f,0x6d,0x70,0x6c,0x65,0x78,0x3f,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x5e,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x63,0x6f,0x6d,0x70,0x6c,0x65,
-0x78,0x3f,0x29,0x20,0x63,0x6f,0x6e,0x73,
-0x2a,0x20,0x23,0x66,0x6e,0x28,0x6c,0x69,
-0x73,0x74,0x2a,0x29,0x20,0x63,0x6f,0x6e,
-0x73,0x74,0x2d,0x74,0x6f,0x2d,0x69,0x64,
-0x78,0x2d,0x76,0x65,0x63,0x20,0x23,0x66,
+0x74,0x68,0x75,0x6e,0x6b,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x63,0x31,0x63,0x32,0x4c,
+0x31,0x5f,0x4c,0x31,0x7c,0x4c,0x31,0x7e,
+0x33,0x34,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,
+0x23,0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,
+0x63,0x29,0x20,0x6c,0x61,0x6d,0x62,0x64,
+0x61,0x5d,0x20,0x23,0x33,0x23,0x29,0x20,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
+0x77,0x68,0x69,0x6c,0x65,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x63,0x31,0x65,0x32,
-0x7c,0x33,0x31,0x33,0x31,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x63,0x31,0x71,0x65,0x32,0x7e,0x33,0x31,
-0x33,0x32,0x32,0x7c,0x3b,0x22,0x20,0x5b,
-0x74,0x61,0x62,0x6c,0x65,0x2e,0x66,0x6f,
-0x72,0x65,0x61,0x63,0x68,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x7e,0x7d,0x7c,0x5c,0x5c,0x3b,0x22,
-0x20,0x5b,0x5d,0x29,0x20,0x62,0x63,0x6f,
-0x64,0x65,0x3a,0x63,0x74,0x61,0x62,0x6c,
-0x65,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x76,0x65,0x63,0x74,0x6f,0x72,0x2e,0x61,
-0x6c,0x6c,0x6f,0x63,0x29,0x20,0x62,0x63,
-0x6f,0x64,0x65,0x3a,0x6e,0x63,0x6f,0x6e,
-0x73,0x74,0x5d,0x20,0x63,0x6f,0x6e,0x73,
+0x34,0x63,0x30,0x71,0x65,0x31,0x7c,0x33,
+0x31,0x65,0x31,0x7c,0x33,0x31,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3a,0x30,0x30,0x30,0x72,0x32,0x65,
+0x30,0x7e,0x5c,0x78,0x37,0x66,0x5e,0x65,
+0x31,0x33,0x30,0x33,0x34,0x32,0x65,0x32,
+0x7e,0x7c,0x33,0x32,0x32,0x65,0x30,0x7e,
+0x5c,0x78,0x37,0x66,0x5e,0x69,0x30,0x32,
+0x33,0x34,0x32,0x65,0x33,0x7e,0x63,0x34,
+0x7d,0x33,0x33,0x32,0x65,0x33,0x7e,0x63,
+0x35,0x33,0x32,0x32,0x65,0x30,0x7e,0x5c,
+0x78,0x37,0x66,0x5e,0x69,0x30,0x33,0x33,
+0x34,0x32,0x65,0x33,0x7e,0x63,0x36,0x7c,
+0x33,0x33,0x32,0x65,0x32,0x7e,0x7d,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x63,0x6f,0x6d,
+0x70,0x69,0x6c,0x65,0x2d,0x69,0x6e,0x20,
+0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x72,
+0x6b,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x20,
+0x65,0x6d,0x69,0x74,0x20,0x62,0x72,0x66,
+0x20,0x70,0x6f,0x70,0x20,0x6a,0x6d,0x70,
+0x5d,0x29,0x20,0x6d,0x61,0x6b,0x65,0x2d,
+0x6c,0x61,0x62,0x65,0x6c,0x5d,0x20,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x77,
+0x68,0x69,0x6c,0x65,0x29,0x20,0x63,0x6f,
+0x6d,0x70,0x6c,0x65,0x78,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x5e,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x63,0x6f,0x6d,0x70,0x6c,0x65,0x78,
+0x3f,0x29,0x20,0x63,0x6f,0x6e,0x73,0x2a,
+0x20,0x23,0x66,0x6e,0x28,0x6c,0x69,0x73,
+0x74,0x2a,0x29,0x20,0x63,0x6f,0x6e,0x73,
 0x74,0x2d,0x74,0x6f,0x2d,0x69,0x64,0x78,
-0x2d,0x76,0x65,0x63,0x29,0x20,0x63,0x6f,
-0x70,0x79,0x2d,0x74,0x72,0x65,0x65,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x3f,0x36,0x34,0x30,
-0x7c,0x3b,0x65,0x30,0x7c,0x4d,0x33,0x31,
-0x65,0x30,0x7c,0x4e,0x33,0x31,0x4b,0x3b,
-0x22,0x20,0x5b,0x63,0x6f,0x70,0x79,0x2d,
-0x74,0x72,0x65,0x65,0x5d,0x20,0x63,0x6f,
-0x70,0x79,0x2d,0x74,0x72,0x65,0x65,0x29,
-0x20,0x63,0x6f,0x75,0x6e,0x74,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x71,0x5d,0x34,0x31,
+0x2d,0x76,0x65,0x63,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x71,0x63,0x31,0x65,0x32,0x7c,
+0x33,0x31,0x33,0x31,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x63,
+0x31,0x71,0x65,0x32,0x7e,0x33,0x31,0x33,
+0x32,0x32,0x7c,0x3b,0x22,0x20,0x5b,0x74,
+0x61,0x62,0x6c,0x65,0x2e,0x66,0x6f,0x72,
+0x65,0x61,0x63,0x68,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
+0x7e,0x7d,0x7c,0x5c,0x5c,0x3b,0x22,0x20,
+0x5b,0x5d,0x29,0x20,0x62,0x63,0x6f,0x64,
+0x65,0x3a,0x63,0x74,0x61,0x62,0x6c,0x65,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x76,
+0x65,0x63,0x74,0x6f,0x72,0x2e,0x61,0x6c,
+0x6c,0x6f,0x63,0x29,0x20,0x62,0x63,0x6f,
+0x64,0x65,0x3a,0x6e,0x63,0x6f,0x6e,0x73,
+0x74,0x5d,0x20,0x63,0x6f,0x6e,0x73,0x74,
+0x2d,0x74,0x6f,0x2d,0x69,0x64,0x78,0x2d,
+0x76,0x65,0x63,0x29,0x20,0x63,0x6f,0x70,
+0x79,0x2d,0x74,0x72,0x65,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x3f,0x36,0x34,0x30,0x7c,
+0x3b,0x65,0x30,0x7c,0x4d,0x33,0x31,0x65,
+0x30,0x7c,0x4e,0x33,0x31,0x4b,0x3b,0x22,
+0x20,0x5b,0x63,0x6f,0x70,0x79,0x2d,0x74,
+0x72,0x65,0x65,0x5d,0x20,0x63,0x6f,0x70,
+0x79,0x2d,0x74,0x72,0x65,0x65,0x29,0x20,
+0x63,0x6f,0x75,0x6e,0x74,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x32,0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x6d,0x30,0x32,0x7c,0x7e,0x5c,0x78,
+0x37,0x66,0x60,0x34,0x33,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x33,0x7d,0x5c,0x78,0x38,
+0x35,0x35,0x30,0x67,0x32,0x3b,0x7e,0x7c,
+0x7d,0x4e,0x7c,0x7d,0x4d,0x33,0x31,0x36,
+0x39,0x30,0x67,0x32,0x61,0x77,0x35,0x34,
+0x30,0x67,0x32,0x34,0x33,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x63,0x6f,0x75,0x6e,0x74,
+0x2d,0x29,0x5d,0x29,0x5d,0x20,0x63,0x6f,
+0x75,0x6e,0x74,0x29,0x20,0x63,0x75,0x72,
+0x72,0x65,0x6e,0x74,0x2d,0x65,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x68,
+0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x30,0x63,0x30,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x7c,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x6d,0x30,0x32,0x7c,0x7e,0x5c,
-0x78,0x37,0x66,0x60,0x34,0x33,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x33,0x7d,0x5c,0x78,
-0x38,0x35,0x35,0x30,0x67,0x32,0x3b,0x7e,
-0x7c,0x7d,0x4e,0x7c,0x7d,0x4d,0x33,0x31,
-0x36,0x39,0x30,0x67,0x32,0x61,0x77,0x35,
-0x34,0x30,0x67,0x32,0x34,0x33,0x3b,0x22,
-0x20,0x5b,0x5d,0x20,0x63,0x6f,0x75,0x6e,
-0x74,0x2d,0x29,0x5d,0x29,0x5d,0x20,0x63,
-0x6f,0x75,0x6e,0x74,0x29,0x20,0x63,0x75,
-0x72,0x72,0x65,0x6e,0x74,0x2d,0x65,0x78,
-0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,
-0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x30,0x63,0x30,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x72,0x61,0x69,0x73,0x65,0x29,0x5d,
-0x29,0x5d,0x20,0x63,0x75,0x72,0x72,0x65,
-0x6e,0x74,0x2d,0x65,0x78,0x63,0x65,0x70,
-0x74,0x69,0x6f,0x6e,0x2d,0x68,0x61,0x6e,
-0x64,0x6c,0x65,0x72,0x29,0x20,0x63,0x75,
-0x72,0x72,0x65,0x6e,0x74,0x2d,0x69,0x6e,
-0x70,0x75,0x74,0x2d,0x70,0x6f,0x72,0x74,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x5c,0x78,0x38,0x39,0x30,0x30,
-0x30,0x30,0x31,0x30,0x30,0x30,0x5c,0x78,
-0x38,0x61,0x30,0x30,0x30,0x30,0x37,0x37,
-0x30,0x65,0x30,0x6d,0x30,0x32,0x7c,0x6b,
-0x30,0x3b,0x22,0x20,0x5b,0x2a,0x69,0x6e,
-0x70,0x75,0x74,0x2d,0x73,0x74,0x72,0x65,
-0x61,0x6d,0x2a,0x5d,0x20,0x63,0x75,0x72,
+0x72,0x61,0x69,0x73,0x65,0x29,0x5d,0x29,
+0x5d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,
+0x74,0x2d,0x65,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x2d,0x68,0x61,0x6e,0x64,
+0x6c,0x65,0x72,0x29,0x20,0x63,0x75,0x72,
 0x72,0x65,0x6e,0x74,0x2d,0x69,0x6e,0x70,
-0x75,0x74,0x2d,0x70,0x6f,0x72,0x74,0x29,
+0x75,0x74,0x2d,0x70,0x6f,0x72,0x74,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x5c,0x78,0x38,0x39,0x30,0x30,0x30,
+0x30,0x31,0x30,0x30,0x30,0x5c,0x78,0x38,
+0x61,0x30,0x30,0x30,0x30,0x37,0x37,0x30,
+0x65,0x30,0x6d,0x30,0x32,0x7c,0x6b,0x30,
+0x3b,0x22,0x20,0x5b,0x2a,0x69,0x6e,0x70,
+0x75,0x74,0x2d,0x73,0x74,0x72,0x65,0x61,
+0x6d,0x2a,0x5d,0x20,0x63,0x75,0x72,0x72,
+0x65,0x6e,0x74,0x2d,0x69,0x6e,0x70,0x75,
+0x74,0x2d,0x70,0x6f,0x72,0x74,0x29,0x20,
+0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x2d,
+0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x70,
+0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x5c,0x78,0x38,
+0x39,0x30,0x30,0x30,0x30,0x31,0x30,0x30,
+0x30,0x5c,0x78,0x38,0x61,0x30,0x30,0x30,
+0x30,0x37,0x37,0x30,0x65,0x30,0x6d,0x30,
+0x32,0x7c,0x6b,0x30,0x3b,0x22,0x20,0x5b,
+0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x5d,
 0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,
 0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
-0x70,0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x5c,0x78,
-0x38,0x39,0x30,0x30,0x30,0x30,0x31,0x30,
-0x30,0x30,0x5c,0x78,0x38,0x61,0x30,0x30,
-0x30,0x30,0x37,0x37,0x30,0x65,0x30,0x6d,
-0x30,0x32,0x7c,0x6b,0x30,0x3b,0x22,0x20,
-0x5b,0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
-0x5d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,
-0x74,0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,
-0x2d,0x70,0x6f,0x72,0x74,0x29,0x20,0x63,
-0x79,0x61,0x6e,0x20,0x36,0x20,0x64,0x65,
-0x66,0x61,0x75,0x6c,0x74,0x2d,0x63,0x6f,
-0x6c,0x6f,0x72,0x20,0x38,0x20,0x64,0x65,
-0x6c,0x65,0x74,0x65,0x2d,0x64,0x75,0x70,
-0x6c,0x69,0x63,0x61,0x74,0x65,0x73,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x7c,0x62,0x44,
-0x33,0x32,0x36,0x3c,0x30,0x63,0x31,0x71,
-0x63,0x32,0x33,0x30,0x34,0x31,0x3b,0x7c,
-0x3f,0x36,0x34,0x30,0x7c,0x3b,0x63,0x33,
-0x7c,0x4d,0x7c,0x4e,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x3e,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x70,0x6f,0x72,0x74,0x29,0x20,0x63,0x79,
+0x61,0x6e,0x20,0x36,0x20,0x64,0x65,0x66,
+0x61,0x75,0x6c,0x74,0x2d,0x63,0x6f,0x6c,
+0x6f,0x72,0x20,0x38,0x20,0x64,0x65,0x6c,
+0x65,0x74,0x65,0x2d,0x64,0x75,0x70,0x6c,
+0x69,0x63,0x61,0x74,0x65,0x73,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x7c,0x62,0x44,0x33,
+0x32,0x36,0x3c,0x30,0x63,0x31,0x71,0x63,
+0x32,0x33,0x30,0x34,0x31,0x3b,0x7c,0x3f,
+0x36,0x34,0x30,0x7c,0x3b,0x63,0x33,0x7c,
+0x4d,0x7c,0x4e,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3e,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x5d,
+0x33,0x31,0x7e,0x5f,0x34,0x32,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x36,
 0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x5d,0x33,0x31,0x7e,0x5f,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x36,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x6d,0x30,0x32,0x7c,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x32,0x7c,0x3f,0x36,0x38,
-0x30,0x65,0x30,0x7d,0x34,0x31,0x3b,0x63,
-0x31,0x69,0x31,0x30,0x7c,0x4d,0x33,0x32,
-0x36,0x39,0x30,0x7e,0x7c,0x4e,0x7d,0x34,
-0x32,0x3b,0x63,0x32,0x69,0x31,0x30,0x7c,
-0x4d,0x5d,0x33,0x33,0x32,0x7e,0x7c,0x4e,
-0x7c,0x4d,0x7d,0x4b,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x72,0x65,0x76,0x65,0x72,0x73,
-0x65,0x21,0x20,0x23,0x66,0x6e,0x28,0x68,
-0x61,0x73,0x3f,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x70,0x75,0x74,0x21,0x29,0x5d,0x29,
-0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x74,0x61,0x62,0x6c,0x65,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x32,0x65,0x30,0x7c,0x7d,0x33,
-0x32,0x36,0x38,0x30,0x65,0x31,0x7d,0x34,
-0x31,0x3b,0x7c,0x65,0x31,0x7d,0x33,0x31,
-0x4b,0x3b,0x22,0x20,0x5b,0x6d,0x65,0x6d,
-0x62,0x65,0x72,0x20,0x64,0x65,0x6c,0x65,
-0x74,0x65,0x2d,0x64,0x75,0x70,0x6c,0x69,
-0x63,0x61,0x74,0x65,0x73,0x5d,0x29,0x5d,
-0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x2d,
-0x64,0x75,0x70,0x6c,0x69,0x63,0x61,0x74,
-0x65,0x73,0x29,0x20,0x64,0x65,0x6c,0x65,
-0x74,0x65,0x2d,0x66,0x69,0x6c,0x65,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x34,0x30,0x3b,
-0x22,0x20,0x5b,0x76,0x6f,0x69,0x64,0x5d,
-0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x2d,
-0x66,0x69,0x6c,0x65,0x29,0x20,0x64,0x69,
-0x72,0x65,0x63,0x74,0x6f,0x72,0x79,0x2d,
-0x6e,0x61,0x6d,0x65,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x65,0x31,0x7c,0x33,0x31,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x63,0x31,0x71,0x34,
+0x6d,0x30,0x32,0x7c,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x32,0x7c,0x3f,0x36,0x38,0x30,
+0x65,0x30,0x7d,0x34,0x31,0x3b,0x63,0x31,
+0x69,0x31,0x30,0x7c,0x4d,0x33,0x32,0x36,
+0x39,0x30,0x7e,0x7c,0x4e,0x7d,0x34,0x32,
+0x3b,0x63,0x32,0x69,0x31,0x30,0x7c,0x4d,
+0x5d,0x33,0x33,0x32,0x7e,0x7c,0x4e,0x7c,
+0x4d,0x7d,0x4b,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x72,0x65,0x76,0x65,0x72,0x73,0x65,
+0x21,0x20,0x23,0x66,0x6e,0x28,0x68,0x61,
+0x73,0x3f,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x70,0x75,0x74,0x21,0x29,0x5d,0x29,0x5d,
+0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x74,0x61,0x62,0x6c,0x65,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x32,0x65,0x30,0x7c,0x7d,0x33,0x32,
+0x36,0x38,0x30,0x65,0x31,0x7d,0x34,0x31,
+0x3b,0x7c,0x65,0x31,0x7d,0x33,0x31,0x4b,
+0x3b,0x22,0x20,0x5b,0x6d,0x65,0x6d,0x62,
+0x65,0x72,0x20,0x64,0x65,0x6c,0x65,0x74,
+0x65,0x2d,0x64,0x75,0x70,0x6c,0x69,0x63,
+0x61,0x74,0x65,0x73,0x5d,0x29,0x5d,0x20,
+0x64,0x65,0x6c,0x65,0x74,0x65,0x2d,0x64,
+0x75,0x70,0x6c,0x69,0x63,0x61,0x74,0x65,
+0x73,0x29,0x20,0x64,0x65,0x6c,0x65,0x74,
+0x65,0x2d,0x66,0x69,0x6c,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x34,0x30,0x3b,0x22,
+0x20,0x5b,0x76,0x6f,0x69,0x64,0x5d,0x20,
+0x64,0x65,0x6c,0x65,0x74,0x65,0x2d,0x66,
+0x69,0x6c,0x65,0x29,0x20,0x64,0x69,0x72,
+0x65,0x63,0x74,0x6f,0x72,0x79,0x2d,0x6e,
+0x61,0x6d,0x65,0x73,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x65,0x31,0x7c,0x33,0x31,0x34,
 0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
 0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x63,0x31,0x71,0x74,0x7c,
-0x33,0x30,0x32,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x30,0x65,0x30,0x63,0x31,0x5f,0x63,
-0x32,0x71,0x34,0x33,0x3b,0x22,0x20,0x5b,
-0x66,0x6f,0x6c,0x64,0x2d,0x70,0x72,0x6f,
-0x63,0x20,0x23,0x2e,0x63,0x6f,0x6e,0x73,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x30,0x65,0x30,0x69,0x31,
-0x30,0x34,0x31,0x3b,0x22,0x20,0x5b,0x72,
-0x65,0x61,0x64,0x2d,0x64,0x69,0x72,0x65,
-0x63,0x74,0x6f,0x72,0x79,0x5d,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x7e,0x33,0x30,
-0x32,0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x72,0x61,
-0x69,0x73,0x65,0x29,0x5d,0x29,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x30,0x65,0x30,0x7e,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x63,0x6c,0x6f,
-0x73,0x65,0x2d,0x64,0x69,0x72,0x65,0x63,
+0x63,0x30,0x71,0x63,0x31,0x71,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x63,0x31,0x71,0x74,0x7c,0x33,
+0x30,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x30,0x65,0x30,0x63,0x31,0x5f,0x63,0x32,
+0x71,0x34,0x33,0x3b,0x22,0x20,0x5b,0x66,
+0x6f,0x6c,0x64,0x2d,0x70,0x72,0x6f,0x63,
+0x20,0x23,0x2e,0x63,0x6f,0x6e,0x73,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x30,0x65,0x30,0x69,0x31,0x30,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x72,0x65,
+0x61,0x64,0x2d,0x64,0x69,0x72,0x65,0x63,
 0x74,0x6f,0x72,0x79,0x5d,0x29,0x5d,0x29,
-0x20,0x6f,0x70,0x65,0x6e,0x2d,0x64,0x69,
-0x72,0x65,0x63,0x74,0x6f,0x72,0x79,0x5d,
-0x20,0x64,0x69,0x72,0x65,0x63,0x74,0x6f,
-0x72,0x79,0x2d,0x6e,0x61,0x6d,0x65,0x73,
-0x29,0x20,0x64,0x69,0x73,0x61,0x73,0x73,
-0x65,0x6d,0x62,0x6c,0x65,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3d,0x30,0x30,0x30,0x73,
-0x31,0x7d,0x5c,0x78,0x38,0x35,0x43,0x30,
-0x65,0x30,0x7c,0x60,0x33,0x32,0x32,0x63,
-0x31,0x33,0x30,0x32,0x5d,0x3b,0x35,0x33,
-0x30,0x5d,0x32,0x63,0x32,0x7d,0x4d,0x63,
-0x33,0x7c,0x33,0x31,0x63,0x34,0x7c,0x33,
-0x31,0x34,0x33,0x3b,0x22,0x20,0x5b,0x64,
-0x69,0x73,0x61,0x73,0x73,0x65,0x6d,0x62,
-0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,0x6e,
-0x65,0x77,0x6c,0x69,0x6e,0x65,0x29,0x20,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x7e,0x33,0x30,0x32,
+0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x72,0x61,0x69,
+0x73,0x65,0x29,0x5d,0x29,0x5d,0x29,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x33,0x63,0x30,0x71,0x5d,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x6d,0x30,0x32,0x60,0x7e,
-0x61,0x78,0x63,0x31,0x75,0x32,0x63,0x32,
-0x63,0x33,0x33,0x31,0x32,0x63,0x32,0x65,
-0x34,0x5c,0x78,0x37,0x66,0x60,0x33,0x32,
-0x33,0x31,0x32,0x63,0x35,0x33,0x30,0x32,
-0x63,0x36,0x71,0x62,0x34,0x63,0x37,0x5c,
-0x78,0x37,0x66,0x33,0x31,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x31,0x7c,0x4a,
-0x31,0x36,0x36,0x30,0x32,0x7c,0x47,0x40,
-0x36,0x44,0x30,0x63,0x30,0x63,0x31,0x33,
-0x31,0x32,0x65,0x32,0x7c,0x69,0x31,0x30,
-0x61,0x77,0x34,0x32,0x3b,0x63,0x33,0x7c,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x29,0x20,0x22,0x5c,0x6e,0x22,0x20,
-0x64,0x69,0x73,0x61,0x73,0x73,0x65,0x6d,
-0x62,0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,
-0x77,0x72,0x69,0x74,0x65,0x29,0x5d,0x20,
-0x77,0x72,0x69,0x74,0x65,0x2d,0x76,0x61,
-0x6c,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x63,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
-0x6c,0x61,0x79,0x29,0x20,0x22,0x20,0x20,
-0x22,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x29,
-0x20,0x22,0x6d,0x61,0x78,0x73,0x74,0x61,
-0x63,0x6b,0x20,0x22,0x20,0x72,0x65,0x66,
-0x2d,0x69,0x6e,0x74,0x33,0x32,0x2d,0x4c,
-0x45,0x20,0x23,0x66,0x6e,0x28,0x6e,0x65,
+0x30,0x72,0x30,0x65,0x30,0x7e,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x63,0x6c,0x6f,0x73,
+0x65,0x2d,0x64,0x69,0x72,0x65,0x63,0x74,
+0x6f,0x72,0x79,0x5d,0x29,0x5d,0x29,0x20,
+0x6f,0x70,0x65,0x6e,0x2d,0x64,0x69,0x72,
+0x65,0x63,0x74,0x6f,0x72,0x79,0x5d,0x20,
+0x64,0x69,0x72,0x65,0x63,0x74,0x6f,0x72,
+0x79,0x2d,0x6e,0x61,0x6d,0x65,0x73,0x29,
+0x20,0x64,0x69,0x73,0x61,0x73,0x73,0x65,
+0x6d,0x62,0x6c,0x65,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3d,0x30,0x30,0x30,0x73,0x31,
+0x7d,0x5c,0x78,0x38,0x35,0x43,0x30,0x65,
+0x30,0x7c,0x60,0x33,0x32,0x32,0x63,0x31,
+0x33,0x30,0x32,0x5d,0x3b,0x35,0x33,0x30,
+0x5d,0x32,0x63,0x32,0x7d,0x4d,0x63,0x33,
+0x7c,0x33,0x31,0x63,0x34,0x7c,0x33,0x31,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x64,0x69,
+0x73,0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,
+0x65,0x20,0x23,0x66,0x6e,0x28,0x6e,0x65,
 0x77,0x6c,0x69,0x6e,0x65,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x32,0x5d,0x7c,0x7d,0x58,0x36,0x45,
-0x30,0x32,0x63,0x30,0x71,0x63,0x31,0x63,
-0x32,0x71,0x5e,0x65,0x33,0x33,0x33,0x33,
-0x31,0x35,0x5c,0x78,0x31,0x39,0x2f,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3b,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x7e,0x62,0x34,0x33,0x32,0x36,0x39,0x30,
-0x63,0x31,0x33,0x30,0x35,0x33,0x30,0x5d,
-0x32,0x60,0x69,0x32,0x30,0x61,0x78,0x63,
-0x32,0x75,0x32,0x63,0x33,0x65,0x34,0x7e,
-0x62,0x34,0x78,0x33,0x31,0x33,0x31,0x32,
-0x63,0x33,0x63,0x35,0x33,0x31,0x32,0x63,
-0x33,0x63,0x36,0x7c,0x33,0x31,0x33,0x31,
-0x32,0x63,0x33,0x63,0x37,0x33,0x31,0x32,
-0x7e,0x61,0x77,0x6f,0x30,0x30,0x32,0x63,
-0x38,0x71,0x7c,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x3e,0x20,0x23,0x66,0x6e,0x28,0x6e,
-0x65,0x77,0x6c,0x69,0x6e,0x65,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x63,0x31,0x34,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x33,0x63,0x30,0x71,0x5d,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3a,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x6d,0x30,0x32,0x60,0x7e,0x61,
+0x78,0x63,0x31,0x75,0x32,0x63,0x32,0x63,
+0x33,0x33,0x31,0x32,0x63,0x32,0x65,0x34,
+0x5c,0x78,0x37,0x66,0x60,0x33,0x32,0x33,
+0x31,0x32,0x63,0x35,0x33,0x30,0x32,0x63,
+0x36,0x71,0x62,0x34,0x63,0x37,0x5c,0x78,
+0x37,0x66,0x33,0x31,0x34,0x32,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x4a,0x31,
+0x36,0x36,0x30,0x32,0x7c,0x47,0x40,0x36,
+0x44,0x30,0x63,0x30,0x63,0x31,0x33,0x31,
+0x32,0x65,0x32,0x7c,0x69,0x31,0x30,0x61,
+0x77,0x34,0x32,0x3b,0x63,0x33,0x7c,0x34,
 0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
 0x28,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-0x29,0x20,0x22,0x20,0x20,0x22,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x64,0x69,0x73,
-0x70,0x6c,0x61,0x79,0x29,0x20,0x68,0x65,
-0x78,0x35,0x20,0x22,0x3a,0x20,0x20,0x22,
-0x20,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x29,0x20,0x22,0x20,0x20,
-0x22,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
-0x63,0x31,0x33,0x32,0x36,0x50,0x30,0x69,
-0x32,0x30,0x69,0x33,0x32,0x65,0x32,0x69,
-0x33,0x31,0x69,0x31,0x30,0x33,0x32,0x5b,
-0x33,0x31,0x32,0x69,0x31,0x30,0x62,0x34,
-0x77,0x6f,0x31,0x30,0x3b,0x63,0x30,0x7c,
-0x63,0x33,0x33,0x32,0x36,0x4c,0x30,0x69,
-0x32,0x30,0x69,0x33,0x32,0x69,0x33,0x31,
-0x69,0x31,0x30,0x5b,0x5b,0x33,0x31,0x32,
-0x69,0x31,0x30,0x61,0x77,0x6f,0x31,0x30,
-0x3b,0x63,0x30,0x7c,0x63,0x34,0x33,0x32,
-0x36,0x4b,0x30,0x63,0x35,0x63,0x36,0x69,
-0x33,0x31,0x69,0x31,0x30,0x5b,0x33,0x31,
-0x33,0x31,0x32,0x69,0x31,0x30,0x61,0x77,
+0x29,0x20,0x22,0x5c,0x6e,0x22,0x20,0x64,
+0x69,0x73,0x61,0x73,0x73,0x65,0x6d,0x62,
+0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,0x77,
+0x72,0x69,0x74,0x65,0x29,0x5d,0x20,0x77,
+0x72,0x69,0x74,0x65,0x2d,0x76,0x61,0x6c,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x63,
+0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,
+0x61,0x79,0x29,0x20,0x22,0x20,0x20,0x22,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x64,
+0x69,0x73,0x70,0x6c,0x61,0x79,0x29,0x20,
+0x22,0x6d,0x61,0x78,0x73,0x74,0x61,0x63,
+0x6b,0x20,0x22,0x20,0x72,0x65,0x66,0x2d,
+0x69,0x6e,0x74,0x33,0x32,0x2d,0x4c,0x45,
+0x20,0x23,0x66,0x6e,0x28,0x6e,0x65,0x77,
+0x6c,0x69,0x6e,0x65,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x32,0x5d,0x7c,0x7d,0x58,0x36,0x45,0x30,
+0x32,0x63,0x30,0x71,0x63,0x31,0x63,0x32,
+0x71,0x5e,0x65,0x33,0x33,0x33,0x33,0x31,
+0x35,0x5c,0x78,0x31,0x39,0x2f,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3b,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x7e,
+0x62,0x34,0x33,0x32,0x36,0x39,0x30,0x63,
+0x31,0x33,0x30,0x35,0x33,0x30,0x5d,0x32,
+0x60,0x69,0x32,0x30,0x61,0x78,0x63,0x32,
+0x75,0x32,0x63,0x33,0x65,0x34,0x7e,0x62,
+0x34,0x78,0x33,0x31,0x33,0x31,0x32,0x63,
+0x33,0x63,0x35,0x33,0x31,0x32,0x63,0x33,
+0x63,0x36,0x7c,0x33,0x31,0x33,0x31,0x32,
+0x63,0x33,0x63,0x37,0x33,0x31,0x32,0x7e,
+0x61,0x77,0x6f,0x30,0x30,0x32,0x63,0x38,
+0x71,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x3e,0x20,0x23,0x66,0x6e,0x28,0x6e,0x65,
+0x77,0x6c,0x69,0x6e,0x65,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x63,0x31,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x29,
+0x20,0x22,0x20,0x20,0x22,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
+0x6c,0x61,0x79,0x29,0x20,0x68,0x65,0x78,
+0x35,0x20,0x22,0x3a,0x20,0x20,0x22,0x20,
+0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x29,0x20,0x22,0x20,0x20,0x22,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x63,
+0x31,0x33,0x32,0x36,0x50,0x30,0x69,0x32,
+0x30,0x69,0x33,0x32,0x65,0x32,0x69,0x33,
+0x31,0x69,0x31,0x30,0x33,0x32,0x5b,0x33,
+0x31,0x32,0x69,0x31,0x30,0x62,0x34,0x77,
 0x6f,0x31,0x30,0x3b,0x63,0x30,0x7c,0x63,
-0x37,0x33,0x32,0x36,0x4f,0x30,0x63,0x35,
+0x33,0x33,0x32,0x36,0x4c,0x30,0x69,0x32,
+0x30,0x69,0x33,0x32,0x69,0x33,0x31,0x69,
+0x31,0x30,0x5b,0x5b,0x33,0x31,0x32,0x69,
+0x31,0x30,0x61,0x77,0x6f,0x31,0x30,0x3b,
+0x63,0x30,0x7c,0x63,0x34,0x33,0x32,0x36,
+0x4b,0x30,0x63,0x35,0x63,0x36,0x69,0x33,
+0x31,0x69,0x31,0x30,0x5b,0x33,0x31,0x33,
+0x31,0x32,0x69,0x31,0x30,0x61,0x77,0x6f,
+0x31,0x30,0x3b,0x63,0x30,0x7c,0x63,0x37,
+0x33,0x32,0x36,0x4f,0x30,0x63,0x35,0x63,
+0x36,0x65,0x32,0x69,0x33,0x31,0x69,0x31,
+0x30,0x33,0x32,0x33,0x31,0x33,0x31,0x32,
+0x69,0x31,0x30,0x62,0x34,0x77,0x6f,0x31,
+0x30,0x3b,0x63,0x30,0x7c,0x63,0x38,0x33,
+0x32,0x36,0x6b,0x30,0x63,0x35,0x63,0x36,
+0x69,0x33,0x31,0x69,0x31,0x30,0x5b,0x33,
+0x31,0x33,0x31,0x32,0x63,0x35,0x63,0x39,
+0x33,0x31,0x32,0x69,0x31,0x30,0x61,0x77,
+0x6f,0x31,0x30,0x32,0x63,0x35,0x63,0x36,
+0x69,0x33,0x31,0x69,0x31,0x30,0x5b,0x33,
+0x31,0x33,0x31,0x32,0x69,0x31,0x30,0x61,
+0x77,0x6f,0x31,0x30,0x3b,0x63,0x30,0x7c,
+0x63,0x3a,0x33,0x32,0x36,0x5c,0x78,0x61,
+0x36,0x30,0x63,0x35,0x63,0x36,0x65,0x32,
+0x69,0x33,0x31,0x69,0x31,0x30,0x33,0x32,
+0x33,0x31,0x33,0x31,0x32,0x63,0x35,0x63,
+0x39,0x33,0x31,0x32,0x69,0x31,0x30,0x62,
+0x34,0x77,0x6f,0x31,0x30,0x32,0x63,0x35,
 0x63,0x36,0x65,0x32,0x69,0x33,0x31,0x69,
 0x31,0x30,0x33,0x32,0x33,0x31,0x33,0x31,
 0x32,0x69,0x31,0x30,0x62,0x34,0x77,0x6f,
-0x31,0x30,0x3b,0x63,0x30,0x7c,0x63,0x38,
-0x33,0x32,0x36,0x6b,0x30,0x63,0x35,0x63,
-0x36,0x69,0x33,0x31,0x69,0x31,0x30,0x5b,
-0x33,0x31,0x33,0x31,0x32,0x63,0x35,0x63,
-0x39,0x33,0x31,0x32,0x69,0x31,0x30,0x61,
-0x77,0x6f,0x31,0x30,0x32,0x63,0x35,0x63,
-0x36,0x69,0x33,0x31,0x69,0x31,0x30,0x5b,
-0x33,0x31,0x33,0x31,0x32,0x69,0x31,0x30,
-0x61,0x77,0x6f,0x31,0x30,0x3b,0x63,0x30,
-0x7c,0x63,0x3a,0x33,0x32,0x36,0x5c,0x78,
-0x61,0x36,0x30,0x63,0x35,0x63,0x36,0x65,
+0x31,0x30,0x32,0x7e,0x63,0x3b,0x5c,0x78,
+0x38,0x32,0x5d,0x30,0x63,0x35,0x63,0x39,
+0x33,0x31,0x32,0x63,0x35,0x63,0x36,0x65,
 0x32,0x69,0x33,0x31,0x69,0x31,0x30,0x33,
 0x32,0x33,0x31,0x33,0x31,0x32,0x63,0x35,
 0x63,0x39,0x33,0x31,0x32,0x69,0x31,0x30,
-0x62,0x34,0x77,0x6f,0x31,0x30,0x32,0x63,
-0x35,0x63,0x36,0x65,0x32,0x69,0x33,0x31,
-0x69,0x31,0x30,0x33,0x32,0x33,0x31,0x33,
+0x62,0x34,0x77,0x6f,0x31,0x30,0x3b,0x5d,
+0x3b,0x7c,0x63,0x3c,0x3d,0x36,0x56,0x30,
+0x63,0x35,0x63,0x36,0x65,0x32,0x69,0x33,
+0x31,0x69,0x31,0x30,0x33,0x32,0x33,0x31,
+0x33,0x31,0x32,0x63,0x35,0x63,0x39,0x33,
 0x31,0x32,0x69,0x31,0x30,0x62,0x34,0x77,
-0x6f,0x31,0x30,0x32,0x7e,0x63,0x3b,0x5c,
-0x78,0x38,0x32,0x5d,0x30,0x63,0x35,0x63,
-0x39,0x33,0x31,0x32,0x63,0x35,0x63,0x36,
-0x65,0x32,0x69,0x33,0x31,0x69,0x31,0x30,
-0x33,0x32,0x33,0x31,0x33,0x31,0x32,0x63,
-0x35,0x63,0x39,0x33,0x31,0x32,0x69,0x31,
-0x30,0x62,0x34,0x77,0x6f,0x31,0x30,0x3b,
-0x5d,0x3b,0x7c,0x63,0x3c,0x3d,0x36,0x56,
-0x30,0x63,0x35,0x63,0x36,0x65,0x32,0x69,
-0x33,0x31,0x69,0x31,0x30,0x33,0x32,0x33,
-0x31,0x33,0x31,0x32,0x63,0x35,0x63,0x39,
-0x33,0x31,0x32,0x69,0x31,0x30,0x62,0x34,
-0x77,0x6f,0x31,0x30,0x3b,0x63,0x30,0x7c,
-0x63,0x3d,0x33,0x32,0x36,0x5d,0x30,0x63,
-0x35,0x63,0x3e,0x33,0x31,0x32,0x63,0x35,
-0x65,0x3f,0x69,0x31,0x30,0x62,0x2c,0x65,
-0x40,0x69,0x33,0x31,0x69,0x31,0x30,0x33,
-0x32,0x52,0x33,0x33,0x31,0x33,0x31,0x32,
-0x69,0x31,0x30,0x62,0x32,0x77,0x6f,0x31,
-0x30,0x3b,0x63,0x30,0x7c,0x63,0x41,0x33,
-0x32,0x36,0x5d,0x30,0x63,0x35,0x63,0x3e,
-0x33,0x31,0x32,0x63,0x35,0x65,0x3f,0x69,
-0x31,0x30,0x62,0x2c,0x65,0x32,0x69,0x33,
-0x31,0x69,0x31,0x30,0x33,0x32,0x52,0x33,
-0x33,0x31,0x33,0x31,0x32,0x69,0x31,0x30,
-0x62,0x34,0x77,0x6f,0x31,0x30,0x3b,0x5e,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x6d,0x65,0x6d,0x71,0x29,0x20,0x28,0x6c,
-0x6f,0x61,0x64,0x76,0x2e,0x6c,0x20,0x6c,
-0x6f,0x61,0x64,0x67,0x2e,0x6c,0x20,0x73,
-0x65,0x74,0x67,0x2e,0x6c,0x29,0x20,0x72,
-0x65,0x66,0x2d,0x69,0x6e,0x74,0x33,0x32,
-0x2d,0x4c,0x45,0x20,0x28,0x6c,0x6f,0x61,
-0x64,0x76,0x20,0x6c,0x6f,0x61,0x64,0x67,
-0x20,0x73,0x65,0x74,0x67,0x29,0x20,0x28,
-0x6c,0x6f,0x61,0x64,0x61,0x20,0x73,0x65,
-0x74,0x61,0x20,0x63,0x61,0x6c,0x6c,0x20,
-0x74,0x63,0x61,0x6c,0x6c,0x20,0x6c,0x69,
-0x73,0x74,0x20,0x2b,0x20,0x2d,0x20,0x2a,
-0x20,0x2f,0x20,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x20,0x61,0x72,0x67,0x63,0x20,0x76,
-0x61,0x72,0x67,0x63,0x20,0x6c,0x6f,0x61,
-0x64,0x69,0x38,0x20,0x61,0x70,0x70,0x6c,
-0x79,0x20,0x74,0x61,0x70,0x70,0x6c,0x79,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x64,0x69,
-0x73,0x70,0x6c,0x61,0x79,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x6e,0x75,0x6d,0x62,0x65,
-0x72,0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x29,0x20,0x28,0x6c,0x6f,0x61,0x64,
-0x61,0x2e,0x6c,0x20,0x73,0x65,0x74,0x61,
-0x2e,0x6c,0x20,0x6c,0x61,0x72,0x67,0x63,
-0x20,0x6c,0x76,0x61,0x72,0x67,0x63,0x20,
-0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,0x74,
-0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x29,0x20,
-0x28,0x6c,0x6f,0x61,0x64,0x63,0x20,0x73,
-0x65,0x74,0x63,0x29,0x20,0x22,0x20,0x22,
-0x20,0x28,0x6c,0x6f,0x61,0x64,0x63,0x2e,
-0x6c,0x20,0x73,0x65,0x74,0x63,0x2e,0x6c,
-0x20,0x6f,0x70,0x74,0x61,0x72,0x67,0x73,
+0x6f,0x31,0x30,0x3b,0x63,0x30,0x7c,0x63,
+0x3d,0x33,0x32,0x36,0x5d,0x30,0x63,0x35,
+0x63,0x3e,0x33,0x31,0x32,0x63,0x35,0x65,
+0x3f,0x69,0x31,0x30,0x62,0x2c,0x65,0x40,
+0x69,0x33,0x31,0x69,0x31,0x30,0x33,0x32,
+0x52,0x33,0x33,0x31,0x33,0x31,0x32,0x69,
+0x31,0x30,0x62,0x32,0x77,0x6f,0x31,0x30,
+0x3b,0x63,0x30,0x7c,0x63,0x41,0x33,0x32,
+0x36,0x5d,0x30,0x63,0x35,0x63,0x3e,0x33,
+0x31,0x32,0x63,0x35,0x65,0x3f,0x69,0x31,
+0x30,0x62,0x2c,0x65,0x32,0x69,0x33,0x31,
+0x69,0x31,0x30,0x33,0x32,0x52,0x33,0x33,
+0x31,0x33,0x31,0x32,0x69,0x31,0x30,0x62,
+0x34,0x77,0x6f,0x31,0x30,0x3b,0x5e,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x6d,
+0x65,0x6d,0x71,0x29,0x20,0x28,0x6c,0x6f,
+0x61,0x64,0x76,0x2e,0x6c,0x20,0x6c,0x6f,
+0x61,0x64,0x67,0x2e,0x6c,0x20,0x73,0x65,
+0x74,0x67,0x2e,0x6c,0x29,0x20,0x72,0x65,
+0x66,0x2d,0x69,0x6e,0x74,0x33,0x32,0x2d,
+0x4c,0x45,0x20,0x28,0x6c,0x6f,0x61,0x64,
+0x76,0x20,0x6c,0x6f,0x61,0x64,0x67,0x20,
+0x73,0x65,0x74,0x67,0x29,0x20,0x28,0x6c,
+0x6f,0x61,0x64,0x61,0x20,0x73,0x65,0x74,
+0x61,0x20,0x63,0x61,0x6c,0x6c,0x20,0x74,
+0x63,0x61,0x6c,0x6c,0x20,0x6c,0x69,0x73,
+0x74,0x20,0x2b,0x20,0x2d,0x20,0x2a,0x20,
+0x2f,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,
+0x20,0x61,0x72,0x67,0x63,0x20,0x76,0x61,
+0x72,0x67,0x63,0x20,0x6c,0x6f,0x61,0x64,
+0x69,0x38,0x20,0x61,0x70,0x70,0x6c,0x79,
+0x20,0x74,0x61,0x70,0x70,0x6c,0x79,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x64,0x69,0x73,
+0x70,0x6c,0x61,0x79,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x6e,0x75,0x6d,0x62,0x65,0x72,
+0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x29,0x20,0x28,0x6c,0x6f,0x61,0x64,0x61,
+0x2e,0x6c,0x20,0x73,0x65,0x74,0x61,0x2e,
+0x6c,0x20,0x6c,0x61,0x72,0x67,0x63,0x20,
+0x6c,0x76,0x61,0x72,0x67,0x63,0x20,0x63,
+0x61,0x6c,0x6c,0x2e,0x6c,0x20,0x74,0x63,
+0x61,0x6c,0x6c,0x2e,0x6c,0x29,0x20,0x28,
+0x6c,0x6f,0x61,0x64,0x63,0x20,0x73,0x65,
+0x74,0x63,0x29,0x20,0x22,0x20,0x22,0x20,
+0x28,0x6c,0x6f,0x61,0x64,0x63,0x2e,0x6c,
+0x20,0x73,0x65,0x74,0x63,0x2e,0x6c,0x20,
+0x6f,0x70,0x74,0x61,0x72,0x67,0x73,0x20,
+0x6b,0x65,0x79,0x61,0x72,0x67,0x73,0x29,
 0x20,0x6b,0x65,0x79,0x61,0x72,0x67,0x73,
-0x29,0x20,0x6b,0x65,0x79,0x61,0x72,0x67,
-0x73,0x20,0x62,0x72,0x62,0x6f,0x75,0x6e,
-0x64,0x20,0x28,0x6a,0x6d,0x70,0x20,0x62,
-0x72,0x66,0x20,0x62,0x72,0x74,0x20,0x62,
-0x72,0x6e,0x65,0x20,0x62,0x72,0x6e,0x6e,
-0x20,0x62,0x72,0x6e,0x29,0x20,0x22,0x40,
-0x22,0x20,0x68,0x65,0x78,0x35,0x20,0x72,
-0x65,0x66,0x2d,0x69,0x6e,0x74,0x31,0x36,
-0x2d,0x4c,0x45,0x20,0x28,0x6a,0x6d,0x70,
-0x2e,0x6c,0x20,0x62,0x72,0x66,0x2e,0x6c,
-0x20,0x62,0x72,0x74,0x2e,0x6c,0x20,0x62,
-0x72,0x6e,0x65,0x2e,0x6c,0x20,0x62,0x72,
-0x6e,0x6e,0x2e,0x6c,0x20,0x62,0x72,0x6e,
-0x2e,0x6c,0x29,0x5d,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,
-0x65,0x2e,0x66,0x6f,0x6c,0x64,0x6c,0x29,
+0x20,0x62,0x72,0x62,0x6f,0x75,0x6e,0x64,
+0x20,0x28,0x6a,0x6d,0x70,0x20,0x62,0x72,
+0x66,0x20,0x62,0x72,0x74,0x20,0x62,0x72,
+0x6e,0x65,0x20,0x62,0x72,0x6e,0x6e,0x20,
+0x62,0x72,0x6e,0x29,0x20,0x22,0x40,0x22,
+0x20,0x68,0x65,0x78,0x35,0x20,0x72,0x65,
+0x66,0x2d,0x69,0x6e,0x74,0x31,0x36,0x2d,
+0x4c,0x45,0x20,0x28,0x6a,0x6d,0x70,0x2e,
+0x6c,0x20,0x62,0x72,0x66,0x2e,0x6c,0x20,
+0x62,0x72,0x74,0x2e,0x6c,0x20,0x62,0x72,
+0x6e,0x65,0x2e,0x6c,0x20,0x62,0x72,0x6e,
+0x6e,0x2e,0x6c,0x20,0x62,0x72,0x6e,0x2e,
+0x6c,0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,
+0x2e,0x66,0x6f,0x6c,0x64,0x6c,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x33,0x67,0x32,0x31,0x37,0x40,
+0x30,0x32,0x7d,0x69,0x32,0x31,0x7e,0x5b,
+0x3c,0x31,0x36,0x34,0x30,0x32,0x7c,0x3b,
+0x22,0x20,0x5b,0x5d,0x29,0x20,0x49,0x6e,
+0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,
+0x6e,0x73,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,
+0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+0x6e,0x3a,0x63,0x6f,0x64,0x65,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x66,0x75,0x6e,0x63,
+0x74,0x69,0x6f,0x6e,0x3a,0x76,0x61,0x6c,
+0x73,0x29,0x5d,0x20,0x64,0x69,0x73,0x61,
+0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,0x29,
+0x20,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
+0x2d,0x62,0x61,0x6e,0x6e,0x65,0x72,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
+0x30,0x72,0x30,0x63,0x30,0x65,0x31,0x65,
+0x32,0x65,0x33,0x65,0x34,0x33,0x31,0x33,
+0x31,0x63,0x35,0x65,0x32,0x33,0x30,0x33,
+0x33,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,
+0x61,0x79,0x6c,0x6e,0x29,0x20,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x2d,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x20,0x73,0x67,0x72,0x20,
+0x66,0x67,0x20,0x63,0x79,0x61,0x6e,0x20,
+0x22,0x55,0x70,0x20,0x53,0x63,0x68,0x65,
+0x6d,0x65,0x22,0x5d,0x20,0x64,0x69,0x73,
+0x70,0x6c,0x61,0x79,0x2d,0x62,0x61,0x6e,
+0x6e,0x65,0x72,0x29,0x20,0x64,0x69,0x76,
 0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x33,0x67,0x32,0x31,0x37,
-0x40,0x30,0x32,0x7d,0x69,0x32,0x31,0x7e,
-0x5b,0x3c,0x31,0x36,0x34,0x30,0x32,0x7c,
-0x3b,0x22,0x20,0x5b,0x5d,0x29,0x20,0x49,
-0x6e,0x73,0x74,0x72,0x75,0x63,0x74,0x69,
-0x6f,0x6e,0x73,0x5d,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,0x69,
-0x6f,0x6e,0x3a,0x63,0x6f,0x64,0x65,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x66,0x75,0x6e,
-0x63,0x74,0x69,0x6f,0x6e,0x3a,0x76,0x61,
-0x6c,0x73,0x29,0x5d,0x20,0x64,0x69,0x73,
-0x61,0x73,0x73,0x65,0x6d,0x62,0x6c,0x65,
-0x29,0x20,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x2d,0x62,0x61,0x6e,0x6e,0x65,0x72,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x30,0x63,0x30,0x65,0x31,
-0x65,0x32,0x65,0x33,0x65,0x34,0x33,0x31,
-0x33,0x31,0x63,0x35,0x65,0x32,0x33,0x30,
-0x33,0x33,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
-0x6c,0x61,0x79,0x6c,0x6e,0x29,0x20,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2d,0x61,0x70,
-0x70,0x65,0x6e,0x64,0x20,0x73,0x67,0x72,
-0x20,0x66,0x67,0x20,0x63,0x79,0x61,0x6e,
-0x20,0x22,0x55,0x70,0x20,0x53,0x63,0x68,
-0x65,0x6d,0x65,0x22,0x5d,0x20,0x64,0x69,
-0x73,0x70,0x6c,0x61,0x79,0x2d,0x62,0x61,
-0x6e,0x6e,0x65,0x72,0x29,0x20,0x64,0x69,
-0x76,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x32,0x7c,0x7d,0x56,
-0x7c,0x60,0x58,0x31,0x36,0x43,0x30,0x32,
-0x7d,0x60,0x58,0x31,0x36,0x34,0x30,0x32,
-0x61,0x31,0x37,0x35,0x30,0x32,0x62,0x2f,
-0x31,0x37,0x34,0x30,0x32,0x60,0x77,0x3b,
-0x22,0x20,0x5b,0x5d,0x20,0x64,0x69,0x76,
-0x29,0x20,0x64,0x75,0x6d,0x70,0x2d,0x62,
-0x75,0x66,0x66,0x65,0x72,0x73,0x2d,0x61,
-0x73,0x2d,0x63,0x2d,0x6c,0x69,0x74,0x65,
-0x72,0x61,0x6c,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x73,0x30,0x63,
-0x30,0x63,0x31,0x33,0x31,0x32,0x63,0x32,
-0x5d,0x33,0x31,0x7c,0x5e,0x33,0x32,0x32,
-0x63,0x30,0x63,0x33,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x64,0x69,
-0x73,0x70,0x6c,0x61,0x79,0x29,0x20,0x22,
-0x75,0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,
-0x20,0x63,0x68,0x61,0x72,0x20,0x62,0x6f,
-0x6f,0x74,0x5f,0x69,0x6d,0x61,0x67,0x65,
-0x5b,0x5d,0x20,0x3d,0x20,0x7b,0x22,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x71,0x6d,0x30,
-0x32,0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x7c,0x5c,0x78,0x38,0x37,0x41,0x30,
-0x63,0x30,0x71,0x7c,0x4d,0x33,0x31,0x32,
-0x7e,0x7c,0x4e,0x5d,0x34,0x32,0x3b,0x5d,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x5d,0x33,0x31,0x60,0x5c,0x78,
-0x37,0x66,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x71,0x6d,0x30,
-0x32,0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x63,0x31,0x69,0x31,
-0x30,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x69,0x32,
-0x30,0x33,0x31,0x37,0x3b,0x30,0x63,0x31,
-0x71,0x7c,0x60,0x77,0x34,0x31,0x3b,0x5d,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x69,0x6f,0x2e,0x65,0x6f,0x66,0x3f,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,
-0x30,0x30,0x72,0x31,0x69,0x31,0x31,0x36,
-0x3b,0x30,0x63,0x30,0x63,0x31,0x33,0x31,
-0x35,0x33,0x30,0x5d,0x32,0x60,0x65,0x32,
-0x69,0x31,0x30,0x62,0x38,0x33,0x32,0x57,
-0x36,0x3b,0x30,0x63,0x30,0x63,0x33,0x33,
-0x31,0x35,0x33,0x30,0x5d,0x32,0x63,0x30,
-0x63,0x34,0x33,0x31,0x32,0x7c,0x62,0x40,
-0x58,0x36,0x3b,0x30,0x63,0x30,0x63,0x35,
-0x33,0x31,0x35,0x33,0x30,0x5d,0x32,0x63,
-0x30,0x63,0x36,0x7c,0x62,0x40,0x33,0x32,
-0x33,0x31,0x32,0x69,0x32,0x30,0x69,0x31,
-0x30,0x61,0x77,0x5d,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x64,0x69,
-0x73,0x70,0x6c,0x61,0x79,0x29,0x20,0x22,
-0x2c,0x22,0x20,0x6d,0x6f,0x64,0x20,0x22,
-0x5c,0x6e,0x22,0x20,0x22,0x30,0x78,0x22,
-0x20,0x22,0x30,0x22,0x20,0x23,0x66,0x6e,
-0x28,0x6e,0x75,0x6d,0x62,0x65,0x72,0x2d,
-0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,0x29,
-0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x72,0x65,0x61,0x64,0x2d,0x75,0x38,
-0x29,0x5d,0x29,0x5d,0x29,0x5d,0x29,0x5d,
-0x29,0x5d,0x29,0x20,0x22,0x7d,0x3b,0x5c,
-0x6e,0x22,0x5d,0x20,0x64,0x75,0x6d,0x70,
-0x2d,0x62,0x75,0x66,0x66,0x65,0x72,0x73,
-0x2d,0x61,0x73,0x2d,0x63,0x2d,0x6c,0x69,
-0x74,0x65,0x72,0x61,0x6c,0x29,0x20,0x64,
-0x79,0x6e,0x61,0x6d,0x69,0x63,0x2d,0x77,
-0x69,0x6e,0x64,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x33,0x7c,
-0x33,0x30,0x32,0x63,0x30,0x71,0x63,0x31,
-0x71,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x71,
-0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
-0x30,0x30,0x72,0x30,0x69,0x31,0x31,0x34,
-0x30,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x7e,0x33,0x30,0x32,0x63,
-0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x72,0x61,0x69,0x73,
-0x65,0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,
+0x30,0x30,0x72,0x32,0x7c,0x7d,0x56,0x7c,
+0x60,0x58,0x31,0x36,0x43,0x30,0x32,0x7d,
+0x60,0x58,0x31,0x36,0x34,0x30,0x32,0x61,
+0x31,0x37,0x35,0x30,0x32,0x62,0x2f,0x31,
+0x37,0x34,0x30,0x32,0x60,0x77,0x3b,0x22,
+0x20,0x5b,0x5d,0x20,0x64,0x69,0x76,0x29,
+0x20,0x64,0x75,0x6d,0x70,0x2d,0x62,0x75,
+0x66,0x66,0x65,0x72,0x73,0x2d,0x61,0x73,
+0x2d,0x63,0x2d,0x6c,0x69,0x74,0x65,0x72,
+0x61,0x6c,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3a,0x30,0x30,0x30,0x73,0x30,0x63,0x30,
+0x63,0x31,0x33,0x31,0x32,0x63,0x32,0x5d,
+0x33,0x31,0x7c,0x5e,0x33,0x32,0x32,0x63,
+0x30,0x63,0x33,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x64,0x69,0x73,
+0x70,0x6c,0x61,0x79,0x29,0x20,0x22,0x75,
+0x6e,0x73,0x69,0x67,0x6e,0x65,0x64,0x20,
+0x63,0x68,0x61,0x72,0x20,0x62,0x6f,0x6f,
+0x74,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5b,
+0x5d,0x20,0x3d,0x20,0x7b,0x22,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x30,0x69,0x30,0x32,0x34,0x30,0x3b,
-0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,0x64,
-0x79,0x6e,0x61,0x6d,0x69,0x63,0x2d,0x77,
-0x69,0x6e,0x64,0x29,0x20,0x65,0x6d,0x69,
-0x74,0x20,0x23,0x66,0x6e,0x28,0x22,0x47,
-0x30,0x30,0x30,0x73,0x32,0x67,0x32,0x5c,
-0x78,0x38,0x35,0x62,0x30,0x7d,0x63,0x30,
-0x3c,0x31,0x36,0x43,0x30,0x32,0x7c,0x60,
-0x5b,0x46,0x31,0x36,0x3a,0x30,0x32,0x7c,
-0x60,0x5b,0x4d,0x63,0x31,0x3c,0x36,0x3b,
-0x30,0x7c,0x60,0x5b,0x63,0x32,0x4f,0x35,
-0x3a,0x30,0x7c,0x60,0x7d,0x7c,0x60,0x5b,
-0x4b,0x5c,0x5c,0x35,0x5c,0x78,0x65,0x32,
-0x30,0x63,0x33,0x7d,0x63,0x34,0x33,0x32,
-0x36,0x41,0x30,0x65,0x35,0x7c,0x67,0x32,
-0x4d,0x33,0x32,0x4c,0x31,0x6d,0x32,0x35,
-0x33,0x30,0x5d,0x32,0x63,0x36,0x71,0x63,
-0x37,0x7d,0x63,0x38,0x33,0x32,0x33,0x31,
-0x32,0x63,0x39,0x71,0x63,0x37,0x7d,0x63,
-0x3a,0x33,0x32,0x33,0x31,0x32,0x7d,0x63,
-0x3b,0x5c,0x78,0x38,0x32,0x5c,0x5c,0x30,
-0x67,0x32,0x63,0x3c,0x3e,0x36,0x3d,0x30,
-0x63,0x3d,0x6d,0x31,0x32,0x5f,0x6d,0x32,
-0x35,0x46,0x30,0x67,0x32,0x63,0x3e,0x3e,
-0x36,0x3d,0x30,0x63,0x3f,0x6d,0x31,0x32,
-0x5f,0x6d,0x32,0x35,0x33,0x30,0x5e,0x35,
-0x33,0x30,0x5d,0x32,0x7d,0x63,0x40,0x5c,
-0x78,0x38,0x32,0x5c,0x5c,0x30,0x67,0x32,
-0x63,0x41,0x3e,0x36,0x3d,0x30,0x63,0x42,
-0x6d,0x31,0x32,0x5f,0x6d,0x32,0x35,0x46,
-0x30,0x67,0x32,0x63,0x43,0x3e,0x36,0x3d,
-0x30,0x63,0x44,0x6d,0x31,0x32,0x5f,0x6d,
-0x32,0x35,0x33,0x30,0x5e,0x35,0x33,0x30,
-0x5d,0x32,0x63,0x45,0x71,0x7c,0x60,0x5b,
-0x46,0x36,0x39,0x30,0x7c,0x60,0x5b,0x4d,
-0x35,0x33,0x30,0x5f,0x7c,0x60,0x5b,0x33,
-0x32,0x32,0x7c,0x3b,0x22,0x20,0x5b,0x63,
-0x61,0x72,0x20,0x63,0x64,0x72,0x20,0x63,
-0x61,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x6d,0x65,0x6d,0x71,0x29,0x20,0x28,0x6c,
-0x6f,0x61,0x64,0x76,0x20,0x6c,0x6f,0x61,
-0x64,0x67,0x20,0x73,0x65,0x74,0x67,0x29,
-0x20,0x62,0x63,0x6f,0x64,0x65,0x3a,0x69,
-0x6e,0x64,0x65,0x78,0x66,0x6f,0x72,0x20,
+0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
+0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
+0x7c,0x5c,0x78,0x38,0x37,0x41,0x30,0x63,
+0x30,0x71,0x7c,0x4d,0x33,0x31,0x32,0x7e,
+0x7c,0x4e,0x5d,0x34,0x32,0x3b,0x5d,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x5d,0x33,0x31,0x60,0x5c,0x78,0x37,
+0x66,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
+0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x71,0x63,0x31,0x69,0x31,0x30,
+0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x31,0x36,0x3d,0x30,
-0x32,0x65,0x30,0x69,0x30,0x32,0x4d,0x63,
-0x31,0x33,0x32,0x36,0x38,0x30,0x7c,0x5c,
-0x78,0x38,0x34,0x6f,0x30,0x31,0x3b,0x5d,
-0x3b,0x22,0x20,0x5b,0x3e,0x20,0x32,0x35,
-0x35,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x61,0x73,0x73,0x71,0x29,0x20,0x28,0x28,
-0x6c,0x6f,0x61,0x64,0x76,0x20,0x6c,0x6f,
-0x61,0x64,0x76,0x2e,0x6c,0x29,0x20,0x28,
-0x6c,0x6f,0x61,0x64,0x67,0x20,0x6c,0x6f,
-0x61,0x64,0x67,0x2e,0x6c,0x29,0x20,0x28,
-0x73,0x65,0x74,0x67,0x20,0x73,0x65,0x74,
-0x67,0x2e,0x6c,0x29,0x20,0x28,0x6c,0x6f,
-0x61,0x64,0x61,0x20,0x6c,0x6f,0x61,0x64,
-0x61,0x2e,0x6c,0x29,0x20,0x28,0x73,0x65,
-0x74,0x61,0x20,0x73,0x65,0x74,0x61,0x2e,
-0x6c,0x29,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x31,0x36,0x4c,0x30,0x32,0x65,0x30,0x69,
-0x30,0x32,0x4d,0x63,0x31,0x33,0x32,0x31,
-0x37,0x3d,0x30,0x32,0x65,0x30,0x69,0x30,
-0x32,0x5c,0x78,0x38,0x34,0x63,0x31,0x33,
-0x32,0x36,0x38,0x30,0x7c,0x5c,0x78,0x38,
-0x34,0x6f,0x30,0x31,0x3b,0x5d,0x3b,0x22,
-0x20,0x5b,0x3e,0x20,0x32,0x35,0x35,0x5d,
-0x29,0x20,0x28,0x28,0x6c,0x6f,0x61,0x64,
-0x63,0x20,0x6c,0x6f,0x61,0x64,0x63,0x2e,
-0x6c,0x29,0x20,0x28,0x73,0x65,0x74,0x63,
-0x20,0x73,0x65,0x74,0x63,0x2e,0x6c,0x29,
-0x29,0x20,0x6c,0x6f,0x61,0x64,0x61,0x20,
-0x28,0x30,0x29,0x20,0x6c,0x6f,0x61,0x64,
-0x61,0x30,0x20,0x28,0x31,0x29,0x20,0x6c,
-0x6f,0x61,0x64,0x61,0x31,0x20,0x6c,0x6f,
-0x61,0x64,0x63,0x20,0x28,0x30,0x20,0x30,
-0x29,0x20,0x6c,0x6f,0x61,0x64,0x63,0x30,
-0x30,0x20,0x28,0x30,0x20,0x31,0x29,0x20,
-0x6c,0x6f,0x61,0x64,0x63,0x30,0x31,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x3e,0x30,0x30,
-0x30,0x72,0x32,0x5c,0x78,0x37,0x66,0x63,
-0x30,0x3c,0x31,0x36,0x5c,0x78,0x39,0x61,
-0x30,0x32,0x7c,0x63,0x31,0x3c,0x31,0x36,
-0x38,0x30,0x32,0x7d,0x5c,0x78,0x38,0x34,
-0x63,0x32,0x3c,0x36,0x45,0x30,0x7e,0x60,
-0x69,0x30,0x32,0x4d,0x63,0x33,0x65,0x34,
-0x7d,0x33,0x31,0x4b,0x4b,0x5c,0x5c,0x35,
-0x75,0x30,0x7c,0x63,0x31,0x5c,0x78,0x38,
-0x32,0x42,0x30,0x7e,0x60,0x69,0x30,0x32,
-0x4d,0x63,0x35,0x7d,0x4e,0x4b,0x4b,0x5c,
-0x5c,0x35,0x5f,0x30,0x7c,0x63,0x36,0x5c,
-0x78,0x38,0x32,0x42,0x30,0x7e,0x60,0x69,
-0x30,0x32,0x4d,0x63,0x37,0x7d,0x4e,0x4b,
-0x4b,0x5c,0x5c,0x35,0x49,0x30,0x7c,0x63,
-0x32,0x5c,0x78,0x38,0x32,0x42,0x30,0x7e,
-0x60,0x69,0x30,0x32,0x4d,0x63,0x38,0x7d,
-0x4e,0x4b,0x4b,0x5c,0x5c,0x35,0x33,0x30,
-0x5e,0x31,0x37,0x5e,0x30,0x32,0x5c,0x78,
-0x37,0x66,0x63,0x35,0x3c,0x31,0x36,0x37,
-0x30,0x32,0x7c,0x63,0x32,0x3c,0x36,0x40,
-0x30,0x7e,0x60,0x69,0x30,0x32,0x4d,0x63,
-0x33,0x7d,0x4e,0x4b,0x4b,0x5c,0x5c,0x3b,
-0x7e,0x60,0x65,0x39,0x5c,0x78,0x37,0x66,
-0x69,0x30,0x32,0x4b,0x7d,0x33,0x32,0x5c,
-0x5c,0x3b,0x22,0x20,0x5b,0x62,0x72,0x66,
-0x20,0x6e,0x6f,0x74,0x20,0x6e,0x75,0x6c,
-0x6c,0x3f,0x20,0x62,0x72,0x6e,0x20,0x63,
-0x64,0x64,0x72,0x20,0x62,0x72,0x74,0x20,
-0x65,0x71,0x3f,0x20,0x62,0x72,0x6e,0x65,
-0x20,0x62,0x72,0x6e,0x6e,0x20,0x6e,0x72,
-0x65,0x63,0x6f,0x6e,0x63,0x5d,0x29,0x5d,
-0x20,0x65,0x6d,0x69,0x74,0x29,0x20,0x65,
-0x6d,0x69,0x74,0x2d,0x6f,0x70,0x74,0x69,
-0x6f,0x6e,0x61,0x6c,0x2d,0x61,0x72,0x67,
-0x2d,0x69,0x6e,0x69,0x74,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x35,0x67,0x32,0x46,0x36,0x3d,0x30,
-0x63,0x30,0x71,0x65,0x31,0x7c,0x33,0x31,
-0x34,0x31,0x3b,0x5d,0x3b,0x22,0x20,0x5b,
+0x30,0x72,0x31,0x63,0x30,0x69,0x32,0x30,
+0x33,0x31,0x37,0x3b,0x30,0x63,0x31,0x71,
+0x7c,0x60,0x77,0x34,0x31,0x3b,0x5d,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
+0x6f,0x2e,0x65,0x6f,0x66,0x3f,0x29,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x7e,0x63,0x31,
-0x69,0x30,0x34,0x33,0x33,0x32,0x65,0x30,
-0x7e,0x63,0x32,0x7c,0x33,0x33,0x32,0x65,
-0x33,0x7e,0x65,0x34,0x69,0x30,0x33,0x69,
-0x30,0x34,0x33,0x32,0x5c,0x78,0x37,0x66,
-0x4b,0x5e,0x65,0x35,0x69,0x30,0x32,0x33,
-0x31,0x33,0x34,0x32,0x65,0x30,0x7e,0x63,
-0x36,0x69,0x30,0x34,0x33,0x33,0x32,0x65,
-0x30,0x7e,0x63,0x37,0x33,0x32,0x32,0x65,
-0x38,0x7e,0x7c,0x33,0x32,0x32,0x65,0x39,
-0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,0x32,
-0x4e,0x69,0x30,0x33,0x69,0x30,0x34,0x61,
-0x77,0x34,0x35,0x3b,0x22,0x20,0x5b,0x65,
-0x6d,0x69,0x74,0x20,0x62,0x72,0x62,0x6f,
-0x75,0x6e,0x64,0x20,0x62,0x72,0x74,0x20,
-0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x69,0x6e,0x20,0x6c,0x69,0x73,0x74,0x2d,
-0x68,0x65,0x61,0x64,0x20,0x63,0x61,0x64,
-0x61,0x72,0x20,0x73,0x65,0x74,0x61,0x20,
-0x70,0x6f,0x70,0x20,0x6d,0x61,0x72,0x6b,
-0x2d,0x6c,0x61,0x62,0x65,0x6c,0x20,0x65,
-0x6d,0x69,0x74,0x2d,0x6f,0x70,0x74,0x69,
-0x6f,0x6e,0x61,0x6c,0x2d,0x61,0x72,0x67,
-0x2d,0x69,0x6e,0x69,0x74,0x73,0x5d,0x29,
-0x20,0x6d,0x61,0x6b,0x65,0x2d,0x6c,0x61,
-0x62,0x65,0x6c,0x5d,0x20,0x65,0x6d,0x69,
-0x74,0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,
-0x61,0x6c,0x2d,0x61,0x72,0x67,0x2d,0x69,
-0x6e,0x69,0x74,0x73,0x29,0x20,0x65,0x6e,
-0x63,0x6f,0x64,0x65,0x2d,0x62,0x79,0x74,
-0x65,0x2d,0x63,0x6f,0x64,0x65,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x65,0x31,0x7c,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x30,0x72,0x31,0x69,0x31,0x31,0x36,0x3b,
+0x30,0x63,0x30,0x63,0x31,0x33,0x31,0x35,
+0x33,0x30,0x5d,0x32,0x60,0x65,0x32,0x69,
+0x31,0x30,0x62,0x38,0x33,0x32,0x57,0x36,
+0x3b,0x30,0x63,0x30,0x63,0x33,0x33,0x31,
+0x35,0x33,0x30,0x5d,0x32,0x63,0x30,0x63,
+0x34,0x33,0x31,0x32,0x7c,0x62,0x40,0x58,
+0x36,0x3b,0x30,0x63,0x30,0x63,0x35,0x33,
+0x31,0x35,0x33,0x30,0x5d,0x32,0x63,0x30,
+0x63,0x36,0x7c,0x62,0x40,0x33,0x32,0x33,
+0x31,0x32,0x69,0x32,0x30,0x69,0x31,0x30,
+0x61,0x77,0x5d,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x64,0x69,0x73,
+0x70,0x6c,0x61,0x79,0x29,0x20,0x22,0x2c,
+0x22,0x20,0x6d,0x6f,0x64,0x20,0x22,0x5c,
+0x6e,0x22,0x20,0x22,0x30,0x78,0x22,0x20,
+0x22,0x30,0x22,0x20,0x23,0x66,0x6e,0x28,
+0x6e,0x75,0x6d,0x62,0x65,0x72,0x2d,0x3e,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x29,0x5d,
+0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x72,0x65,0x61,0x64,0x2d,0x75,0x38,0x29,
+0x5d,0x29,0x5d,0x29,0x5d,0x29,0x5d,0x29,
+0x5d,0x29,0x20,0x22,0x7d,0x3b,0x5c,0x6e,
+0x22,0x5d,0x20,0x64,0x75,0x6d,0x70,0x2d,
+0x62,0x75,0x66,0x66,0x65,0x72,0x73,0x2d,
+0x61,0x73,0x2d,0x63,0x2d,0x6c,0x69,0x74,
+0x65,0x72,0x61,0x6c,0x29,0x20,0x64,0x79,
+0x6e,0x61,0x6d,0x69,0x63,0x2d,0x77,0x69,
+0x6e,0x64,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x33,0x7c,0x33,
+0x30,0x32,0x63,0x30,0x71,0x63,0x31,0x71,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x63,0x31,0x71,0x74,
+0x7c,0x33,0x30,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
+0x30,0x72,0x30,0x69,0x31,0x31,0x34,0x30,
+0x3b,0x22,0x20,0x5b,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x7e,0x33,0x30,0x32,0x63,0x30,
+0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x72,0x61,0x69,0x73,0x65,
+0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x30,0x69,0x30,0x32,0x34,0x30,0x3b,0x22,
+0x20,0x5b,0x5d,0x29,0x5d,0x20,0x64,0x79,
+0x6e,0x61,0x6d,0x69,0x63,0x2d,0x77,0x69,
+0x6e,0x64,0x29,0x20,0x65,0x6d,0x69,0x74,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x47,0x30,
+0x30,0x30,0x73,0x32,0x67,0x32,0x5c,0x78,
+0x38,0x35,0x62,0x30,0x7d,0x63,0x30,0x3c,
+0x31,0x36,0x43,0x30,0x32,0x7c,0x60,0x5b,
+0x46,0x31,0x36,0x3a,0x30,0x32,0x7c,0x60,
+0x5b,0x4d,0x63,0x31,0x3c,0x36,0x3b,0x30,
+0x7c,0x60,0x5b,0x63,0x32,0x4f,0x35,0x3a,
+0x30,0x7c,0x60,0x7d,0x7c,0x60,0x5b,0x4b,
+0x5c,0x5c,0x35,0x5c,0x78,0x65,0x32,0x30,
+0x63,0x33,0x7d,0x63,0x34,0x33,0x32,0x36,
+0x41,0x30,0x65,0x35,0x7c,0x67,0x32,0x4d,
+0x33,0x32,0x4c,0x31,0x6d,0x32,0x35,0x33,
+0x30,0x5d,0x32,0x63,0x36,0x71,0x63,0x37,
+0x7d,0x63,0x38,0x33,0x32,0x33,0x31,0x32,
+0x63,0x39,0x71,0x63,0x37,0x7d,0x63,0x3a,
+0x33,0x32,0x33,0x31,0x32,0x7d,0x63,0x3b,
+0x5c,0x78,0x38,0x32,0x5c,0x5c,0x30,0x67,
+0x32,0x63,0x3c,0x3e,0x36,0x3d,0x30,0x63,
+0x3d,0x6d,0x31,0x32,0x5f,0x6d,0x32,0x35,
+0x46,0x30,0x67,0x32,0x63,0x3e,0x3e,0x36,
+0x3d,0x30,0x63,0x3f,0x6d,0x31,0x32,0x5f,
+0x6d,0x32,0x35,0x33,0x30,0x5e,0x35,0x33,
+0x30,0x5d,0x32,0x7d,0x63,0x40,0x5c,0x78,
+0x38,0x32,0x5c,0x5c,0x30,0x67,0x32,0x63,
+0x41,0x3e,0x36,0x3d,0x30,0x63,0x42,0x6d,
+0x31,0x32,0x5f,0x6d,0x32,0x35,0x46,0x30,
+0x67,0x32,0x63,0x43,0x3e,0x36,0x3d,0x30,
+0x63,0x44,0x6d,0x31,0x32,0x5f,0x6d,0x32,
+0x35,0x33,0x30,0x5e,0x35,0x33,0x30,0x5d,
+0x32,0x63,0x45,0x71,0x7c,0x60,0x5b,0x46,
+0x36,0x39,0x30,0x7c,0x60,0x5b,0x4d,0x35,
+0x33,0x30,0x5f,0x7c,0x60,0x5b,0x33,0x32,
+0x32,0x7c,0x3b,0x22,0x20,0x5b,0x63,0x61,
+0x72,0x20,0x63,0x64,0x72,0x20,0x63,0x61,
+0x64,0x72,0x20,0x23,0x66,0x6e,0x28,0x6d,
+0x65,0x6d,0x71,0x29,0x20,0x28,0x6c,0x6f,
+0x61,0x64,0x76,0x20,0x6c,0x6f,0x61,0x64,
+0x67,0x20,0x73,0x65,0x74,0x67,0x29,0x20,
+0x62,0x63,0x6f,0x64,0x65,0x3a,0x69,0x6e,
+0x64,0x65,0x78,0x66,0x6f,0x72,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x65,0x31,0x7c,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x65,0x31,0x63,
-0x32,0x7c,0x33,0x31,0x62,0x33,0x63,0x32,
-0x7c,0x33,0x31,0x62,0x32,0x56,0x54,0x32,
-0x77,0x63,0x33,0x33,0x32,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3d,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x63,0x31,0x7e,0x33,0x31,0x60,0x63,
-0x32,0x33,0x30,0x63,0x32,0x33,0x30,0x63,
-0x33,0x33,0x30,0x5e,0x5e,0x34,0x37,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3f,0x30,0x30,0x30,0x72,0x37,0x63,0x30,
-0x67,0x34,0x63,0x31,0x33,0x32,0x32,0x5d,
-0x7d,0x7c,0x58,0x36,0x5c,0x78,0x66,0x66,
-0x30,0x32,0x69,0x31,0x30,0x7d,0x5b,0x6d,
-0x35,0x32,0x67,0x35,0x63,0x32,0x5c,0x78,
-0x38,0x32,0x4f,0x30,0x63,0x33,0x67,0x32,
-0x69,0x31,0x30,0x7d,0x61,0x77,0x5b,0x63,
-0x34,0x67,0x34,0x33,0x31,0x33,0x33,0x32,
-0x7d,0x62,0x32,0x77,0x6d,0x31,0x35,0x5c,
-0x78,0x63,0x66,0x30,0x63,0x30,0x67,0x34,
-0x65,0x35,0x63,0x36,0x65,0x37,0x7e,0x36,
-0x3c,0x30,0x63,0x38,0x71,0x67,0x35,0x33,
-0x31,0x35,0x34,0x30,0x67,0x35,0x33,0x32,
-0x33,0x31,0x33,0x32,0x32,0x7d,0x61,0x77,
-0x6d,0x31,0x32,0x7d,0x7c,0x58,0x36,0x3a,
-0x30,0x69,0x31,0x30,0x7d,0x5b,0x35,0x33,
-0x30,0x5e,0x6d,0x36,0x32,0x63,0x39,0x67,
-0x35,0x63,0x3a,0x33,0x32,0x36,0x5e,0x30,
-0x63,0x33,0x67,0x33,0x63,0x34,0x67,0x34,
-0x33,0x31,0x67,0x36,0x33,0x33,0x32,0x63,
-0x30,0x67,0x34,0x7e,0x36,0x37,0x30,0x65,
-0x3b,0x35,0x34,0x30,0x65,0x3c,0x60,0x33,
+0x72,0x31,0x7c,0x31,0x36,0x3d,0x30,0x32,
+0x65,0x30,0x69,0x30,0x32,0x4d,0x63,0x31,
+0x33,0x32,0x36,0x38,0x30,0x7c,0x5c,0x78,
+0x38,0x34,0x6f,0x30,0x31,0x3b,0x5d,0x3b,
+0x22,0x20,0x5b,0x3e,0x20,0x32,0x35,0x35,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x61,
+0x73,0x73,0x71,0x29,0x20,0x28,0x28,0x6c,
+0x6f,0x61,0x64,0x76,0x20,0x6c,0x6f,0x61,
+0x64,0x76,0x2e,0x6c,0x29,0x20,0x28,0x6c,
+0x6f,0x61,0x64,0x67,0x20,0x6c,0x6f,0x61,
+0x64,0x67,0x2e,0x6c,0x29,0x20,0x28,0x73,
+0x65,0x74,0x67,0x20,0x73,0x65,0x74,0x67,
+0x2e,0x6c,0x29,0x20,0x28,0x6c,0x6f,0x61,
+0x64,0x61,0x20,0x6c,0x6f,0x61,0x64,0x61,
+0x2e,0x6c,0x29,0x20,0x28,0x73,0x65,0x74,
+0x61,0x20,0x73,0x65,0x74,0x61,0x2e,0x6c,
+0x29,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x7c,0x31,
+0x36,0x4c,0x30,0x32,0x65,0x30,0x69,0x30,
+0x32,0x4d,0x63,0x31,0x33,0x32,0x31,0x37,
+0x3d,0x30,0x32,0x65,0x30,0x69,0x30,0x32,
+0x5c,0x78,0x38,0x34,0x63,0x31,0x33,0x32,
+0x36,0x38,0x30,0x7c,0x5c,0x78,0x38,0x34,
+0x6f,0x30,0x31,0x3b,0x5d,0x3b,0x22,0x20,
+0x5b,0x3e,0x20,0x32,0x35,0x35,0x5d,0x29,
+0x20,0x28,0x28,0x6c,0x6f,0x61,0x64,0x63,
+0x20,0x6c,0x6f,0x61,0x64,0x63,0x2e,0x6c,
+0x29,0x20,0x28,0x73,0x65,0x74,0x63,0x20,
+0x73,0x65,0x74,0x63,0x2e,0x6c,0x29,0x29,
+0x20,0x6c,0x6f,0x61,0x64,0x61,0x20,0x28,
+0x30,0x29,0x20,0x6c,0x6f,0x61,0x64,0x61,
+0x30,0x20,0x28,0x31,0x29,0x20,0x6c,0x6f,
+0x61,0x64,0x61,0x31,0x20,0x6c,0x6f,0x61,
+0x64,0x63,0x20,0x28,0x30,0x20,0x30,0x29,
+0x20,0x6c,0x6f,0x61,0x64,0x63,0x30,0x30,
+0x20,0x28,0x30,0x20,0x31,0x29,0x20,0x6c,
+0x6f,0x61,0x64,0x63,0x30,0x31,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x3e,0x30,0x30,0x30,
+0x72,0x32,0x5c,0x78,0x37,0x66,0x63,0x30,
+0x3c,0x31,0x36,0x5c,0x78,0x39,0x61,0x30,
+0x32,0x7c,0x63,0x31,0x3c,0x31,0x36,0x38,
+0x30,0x32,0x7d,0x5c,0x78,0x38,0x34,0x63,
+0x32,0x3c,0x36,0x45,0x30,0x7e,0x60,0x69,
+0x30,0x32,0x4d,0x63,0x33,0x65,0x34,0x7d,
+0x33,0x31,0x4b,0x4b,0x5c,0x5c,0x35,0x75,
+0x30,0x7c,0x63,0x31,0x5c,0x78,0x38,0x32,
+0x42,0x30,0x7e,0x60,0x69,0x30,0x32,0x4d,
+0x63,0x35,0x7d,0x4e,0x4b,0x4b,0x5c,0x5c,
+0x35,0x5f,0x30,0x7c,0x63,0x36,0x5c,0x78,
+0x38,0x32,0x42,0x30,0x7e,0x60,0x69,0x30,
+0x32,0x4d,0x63,0x37,0x7d,0x4e,0x4b,0x4b,
+0x5c,0x5c,0x35,0x49,0x30,0x7c,0x63,0x32,
+0x5c,0x78,0x38,0x32,0x42,0x30,0x7e,0x60,
+0x69,0x30,0x32,0x4d,0x63,0x38,0x7d,0x4e,
+0x4b,0x4b,0x5c,0x5c,0x35,0x33,0x30,0x5e,
+0x31,0x37,0x5e,0x30,0x32,0x5c,0x78,0x37,
+0x66,0x63,0x35,0x3c,0x31,0x36,0x37,0x30,
+0x32,0x7c,0x63,0x32,0x3c,0x36,0x40,0x30,
+0x7e,0x60,0x69,0x30,0x32,0x4d,0x63,0x33,
+0x7d,0x4e,0x4b,0x4b,0x5c,0x5c,0x3b,0x7e,
+0x60,0x65,0x39,0x5c,0x78,0x37,0x66,0x69,
+0x30,0x32,0x4b,0x7d,0x33,0x32,0x5c,0x5c,
+0x3b,0x22,0x20,0x5b,0x62,0x72,0x66,0x20,
+0x6e,0x6f,0x74,0x20,0x6e,0x75,0x6c,0x6c,
+0x3f,0x20,0x62,0x72,0x6e,0x20,0x63,0x64,
+0x64,0x72,0x20,0x62,0x72,0x74,0x20,0x65,
+0x71,0x3f,0x20,0x62,0x72,0x6e,0x65,0x20,
+0x62,0x72,0x6e,0x6e,0x20,0x6e,0x72,0x65,
+0x63,0x6f,0x6e,0x63,0x5d,0x29,0x5d,0x20,
+0x65,0x6d,0x69,0x74,0x29,0x20,0x65,0x6d,
+0x69,0x74,0x2d,0x6f,0x70,0x74,0x69,0x6f,
+0x6e,0x61,0x6c,0x2d,0x61,0x72,0x67,0x2d,
+0x69,0x6e,0x69,0x74,0x73,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x35,0x67,0x32,0x46,0x36,0x3d,0x30,0x63,
+0x30,0x71,0x65,0x31,0x7c,0x33,0x31,0x34,
+0x31,0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x7e,0x63,0x31,0x69,
+0x30,0x34,0x33,0x33,0x32,0x65,0x30,0x7e,
+0x63,0x32,0x7c,0x33,0x33,0x32,0x65,0x33,
+0x7e,0x65,0x34,0x69,0x30,0x33,0x69,0x30,
+0x34,0x33,0x32,0x5c,0x78,0x37,0x66,0x4b,
+0x5e,0x65,0x35,0x69,0x30,0x32,0x33,0x31,
+0x33,0x34,0x32,0x65,0x30,0x7e,0x63,0x36,
+0x69,0x30,0x34,0x33,0x33,0x32,0x65,0x30,
+0x7e,0x63,0x37,0x33,0x32,0x32,0x65,0x38,
+0x7e,0x7c,0x33,0x32,0x32,0x65,0x39,0x7e,
+0x5c,0x78,0x37,0x66,0x69,0x30,0x32,0x4e,
+0x69,0x30,0x33,0x69,0x30,0x34,0x61,0x77,
+0x34,0x35,0x3b,0x22,0x20,0x5b,0x65,0x6d,
+0x69,0x74,0x20,0x62,0x72,0x62,0x6f,0x75,
+0x6e,0x64,0x20,0x62,0x72,0x74,0x20,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x69,
+0x6e,0x20,0x6c,0x69,0x73,0x74,0x2d,0x68,
+0x65,0x61,0x64,0x20,0x63,0x61,0x64,0x61,
+0x72,0x20,0x73,0x65,0x74,0x61,0x20,0x70,
+0x6f,0x70,0x20,0x6d,0x61,0x72,0x6b,0x2d,
+0x6c,0x61,0x62,0x65,0x6c,0x20,0x65,0x6d,
+0x69,0x74,0x2d,0x6f,0x70,0x74,0x69,0x6f,
+0x6e,0x61,0x6c,0x2d,0x61,0x72,0x67,0x2d,
+0x69,0x6e,0x69,0x74,0x73,0x5d,0x29,0x20,
+0x6d,0x61,0x6b,0x65,0x2d,0x6c,0x61,0x62,
+0x65,0x6c,0x5d,0x20,0x65,0x6d,0x69,0x74,
+0x2d,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x61,
+0x6c,0x2d,0x61,0x72,0x67,0x2d,0x69,0x6e,
+0x69,0x74,0x73,0x29,0x20,0x65,0x6e,0x63,
+0x6f,0x64,0x65,0x2d,0x62,0x79,0x74,0x65,
+0x2d,0x63,0x6f,0x64,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x65,0x31,0x7c,0x33,0x31,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x65,0x31,0x7c,0x33,0x31,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x65,0x31,0x63,0x32,
+0x7c,0x33,0x31,0x62,0x33,0x63,0x32,0x7c,
+0x33,0x31,0x62,0x32,0x56,0x54,0x32,0x77,
+0x63,0x33,0x33,0x32,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3d,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x63,0x31,0x7e,0x33,0x31,0x60,0x63,0x32,
+0x33,0x30,0x63,0x32,0x33,0x30,0x63,0x33,
+0x33,0x30,0x5e,0x5e,0x34,0x37,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3f,
+0x30,0x30,0x30,0x72,0x37,0x63,0x30,0x67,
+0x34,0x63,0x31,0x33,0x32,0x32,0x5d,0x7d,
+0x7c,0x58,0x36,0x5c,0x78,0x66,0x66,0x30,
+0x32,0x69,0x31,0x30,0x7d,0x5b,0x6d,0x35,
+0x32,0x67,0x35,0x63,0x32,0x5c,0x78,0x38,
+0x32,0x4f,0x30,0x63,0x33,0x67,0x32,0x69,
+0x31,0x30,0x7d,0x61,0x77,0x5b,0x63,0x34,
+0x67,0x34,0x33,0x31,0x33,0x33,0x32,0x7d,
+0x62,0x32,0x77,0x6d,0x31,0x35,0x5c,0x78,
+0x63,0x66,0x30,0x63,0x30,0x67,0x34,0x65,
+0x35,0x63,0x36,0x65,0x37,0x7e,0x36,0x3c,
+0x30,0x63,0x38,0x71,0x67,0x35,0x33,0x31,
+0x35,0x34,0x30,0x67,0x35,0x33,0x32,0x33,
 0x31,0x33,0x32,0x32,0x7d,0x61,0x77,0x6d,
-0x31,0x35,0x5f,0x30,0x67,0x35,0x63,0x3d,
-0x5c,0x78,0x38,0x32,0x47,0x30,0x63,0x30,
-0x67,0x34,0x65,0x3b,0x67,0x36,0x33,0x31,
+0x31,0x32,0x7d,0x7c,0x58,0x36,0x3a,0x30,
+0x69,0x31,0x30,0x7d,0x5b,0x35,0x33,0x30,
+0x5e,0x6d,0x36,0x32,0x63,0x39,0x67,0x35,
+0x63,0x3a,0x33,0x32,0x36,0x5e,0x30,0x63,
+0x33,0x67,0x33,0x63,0x34,0x67,0x34,0x33,
+0x31,0x67,0x36,0x33,0x33,0x32,0x63,0x30,
+0x67,0x34,0x7e,0x36,0x37,0x30,0x65,0x3b,
+0x35,0x34,0x30,0x65,0x3c,0x60,0x33,0x31,
 0x33,0x32,0x32,0x7d,0x61,0x77,0x6d,0x31,
-0x35,0x43,0x30,0x67,0x36,0x44,0x36,0x3c,
-0x30,0x63,0x3e,0x71,0x67,0x35,0x33,0x31,
-0x35,0x33,0x30,0x5e,0x35,0x5f,0x2f,0x32,
-0x65,0x3f,0x63,0x40,0x71,0x67,0x33,0x33,
-0x32,0x32,0x63,0x41,0x67,0x34,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x69,0x6f,0x2e,0x77,0x72,0x69,0x74,0x65,
-0x29,0x20,0x23,0x69,0x6e,0x74,0x33,0x32,
-0x28,0x30,0x29,0x20,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x23,0x66,0x6e,0x28,0x70,0x75,
-0x74,0x21,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x73,0x69,0x7a,0x65,0x6f,0x66,0x29,0x20,
-0x62,0x79,0x74,0x65,0x20,0x23,0x66,0x6e,
-0x28,0x67,0x65,0x74,0x29,0x20,0x49,0x6e,
-0x73,0x74,0x72,0x75,0x63,0x74,0x69,0x6f,
-0x6e,0x73,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x63,
-0x30,0x5c,0x78,0x38,0x32,0x35,0x30,0x63,
-0x31,0x3b,0x7c,0x63,0x32,0x5c,0x78,0x38,
-0x32,0x35,0x30,0x63,0x33,0x3b,0x7c,0x63,
-0x34,0x5c,0x78,0x38,0x32,0x35,0x30,0x63,
-0x35,0x3b,0x7c,0x63,0x36,0x5c,0x78,0x38,
-0x32,0x35,0x30,0x63,0x37,0x3b,0x7c,0x63,
-0x38,0x5c,0x78,0x38,0x32,0x35,0x30,0x63,
-0x39,0x3b,0x7c,0x63,0x3a,0x5c,0x78,0x38,
-0x32,0x35,0x30,0x63,0x3b,0x3b,0x69,0x30,
-0x35,0x3b,0x22,0x20,0x5b,0x6a,0x6d,0x70,
-0x20,0x6a,0x6d,0x70,0x2e,0x6c,0x20,0x62,
-0x72,0x74,0x20,0x62,0x72,0x74,0x2e,0x6c,
-0x20,0x62,0x72,0x66,0x20,0x62,0x72,0x66,
-0x2e,0x6c,0x20,0x62,0x72,0x6e,0x65,0x20,
-0x62,0x72,0x6e,0x65,0x2e,0x6c,0x20,0x62,
-0x72,0x6e,0x6e,0x20,0x62,0x72,0x6e,0x6e,
-0x2e,0x6c,0x20,0x62,0x72,0x6e,0x20,0x62,
-0x72,0x6e,0x2e,0x6c,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x6d,0x65,0x6d,0x71,0x29,
-0x20,0x28,0x6a,0x6d,0x70,0x20,0x62,0x72,
-0x66,0x20,0x62,0x72,0x74,0x20,0x62,0x72,
-0x6e,0x65,0x20,0x62,0x72,0x6e,0x6e,0x20,
-0x62,0x72,0x6e,0x29,0x20,0x69,0x6e,0x74,
-0x33,0x32,0x20,0x69,0x6e,0x74,0x31,0x36,
-0x20,0x62,0x72,0x62,0x6f,0x75,0x6e,0x64,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x63,
-0x31,0x33,0x32,0x36,0x48,0x30,0x63,0x32,
-0x69,0x30,0x34,0x65,0x33,0x69,0x30,0x36,
-0x33,0x31,0x33,0x32,0x32,0x5c,0x78,0x37,
-0x66,0x61,0x77,0x6f,0x30,0x31,0x3b,0x63,
-0x30,0x7c,0x63,0x34,0x33,0x32,0x36,0x60,
-0x30,0x63,0x32,0x69,0x30,0x34,0x65,0x35,
-0x69,0x30,0x36,0x33,0x31,0x33,0x32,0x32,
-0x5c,0x78,0x37,0x66,0x61,0x77,0x6f,0x30,
-0x31,0x32,0x63,0x32,0x69,0x30,0x34,0x65,
-0x35,0x69,0x32,0x30,0x5c,0x78,0x37,0x66,
-0x5b,0x33,0x31,0x33,0x32,0x32,0x5c,0x78,
-0x37,0x66,0x61,0x77,0x6f,0x30,0x31,0x3b,
-0x63,0x30,0x7c,0x63,0x36,0x33,0x32,0x36,
-0x5c,0x78,0x38,0x32,0x30,0x63,0x32,0x69,
+0x35,0x5f,0x30,0x67,0x35,0x63,0x3d,0x5c,
+0x78,0x38,0x32,0x47,0x30,0x63,0x30,0x67,
+0x34,0x65,0x3b,0x67,0x36,0x33,0x31,0x33,
+0x32,0x32,0x7d,0x61,0x77,0x6d,0x31,0x35,
+0x43,0x30,0x67,0x36,0x44,0x36,0x3c,0x30,
+0x63,0x3e,0x71,0x67,0x35,0x33,0x31,0x35,
+0x33,0x30,0x5e,0x35,0x5f,0x2f,0x32,0x65,
+0x3f,0x63,0x40,0x71,0x67,0x33,0x33,0x32,
+0x32,0x63,0x41,0x67,0x34,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
+0x6f,0x2e,0x77,0x72,0x69,0x74,0x65,0x29,
+0x20,0x23,0x69,0x6e,0x74,0x33,0x32,0x28,
+0x30,0x29,0x20,0x6c,0x61,0x62,0x65,0x6c,
+0x20,0x23,0x66,0x6e,0x28,0x70,0x75,0x74,
+0x21,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
+0x69,0x7a,0x65,0x6f,0x66,0x29,0x20,0x62,
+0x79,0x74,0x65,0x20,0x23,0x66,0x6e,0x28,
+0x67,0x65,0x74,0x29,0x20,0x49,0x6e,0x73,
+0x74,0x72,0x75,0x63,0x74,0x69,0x6f,0x6e,
+0x73,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x63,0x30,
+0x5c,0x78,0x38,0x32,0x35,0x30,0x63,0x31,
+0x3b,0x7c,0x63,0x32,0x5c,0x78,0x38,0x32,
+0x35,0x30,0x63,0x33,0x3b,0x7c,0x63,0x34,
+0x5c,0x78,0x38,0x32,0x35,0x30,0x63,0x35,
+0x3b,0x7c,0x63,0x36,0x5c,0x78,0x38,0x32,
+0x35,0x30,0x63,0x37,0x3b,0x7c,0x63,0x38,
+0x5c,0x78,0x38,0x32,0x35,0x30,0x63,0x39,
+0x3b,0x7c,0x63,0x3a,0x5c,0x78,0x38,0x32,
+0x35,0x30,0x63,0x3b,0x3b,0x69,0x30,0x35,
+0x3b,0x22,0x20,0x5b,0x6a,0x6d,0x70,0x20,
+0x6a,0x6d,0x70,0x2e,0x6c,0x20,0x62,0x72,
+0x74,0x20,0x62,0x72,0x74,0x2e,0x6c,0x20,
+0x62,0x72,0x66,0x20,0x62,0x72,0x66,0x2e,
+0x6c,0x20,0x62,0x72,0x6e,0x65,0x20,0x62,
+0x72,0x6e,0x65,0x2e,0x6c,0x20,0x62,0x72,
+0x6e,0x6e,0x20,0x62,0x72,0x6e,0x6e,0x2e,
+0x6c,0x20,0x62,0x72,0x6e,0x20,0x62,0x72,
+0x6e,0x2e,0x6c,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x6d,0x65,0x6d,0x71,0x29,0x20,
+0x28,0x6a,0x6d,0x70,0x20,0x62,0x72,0x66,
+0x20,0x62,0x72,0x74,0x20,0x62,0x72,0x6e,
+0x65,0x20,0x62,0x72,0x6e,0x6e,0x20,0x62,
+0x72,0x6e,0x29,0x20,0x69,0x6e,0x74,0x33,
+0x32,0x20,0x69,0x6e,0x74,0x31,0x36,0x20,
+0x62,0x72,0x62,0x6f,0x75,0x6e,0x64,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x7c,0x63,0x31,
+0x33,0x32,0x36,0x48,0x30,0x63,0x32,0x69,
 0x30,0x34,0x65,0x33,0x69,0x30,0x36,0x33,
 0x31,0x33,0x32,0x32,0x5c,0x78,0x37,0x66,
-0x61,0x77,0x6f,0x30,0x31,0x32,0x63,0x32,
+0x61,0x77,0x6f,0x30,0x31,0x3b,0x63,0x30,
+0x7c,0x63,0x34,0x33,0x32,0x36,0x60,0x30,
+0x63,0x32,0x69,0x30,0x34,0x65,0x35,0x69,
+0x30,0x36,0x33,0x31,0x33,0x32,0x32,0x5c,
+0x78,0x37,0x66,0x61,0x77,0x6f,0x30,0x31,
+0x32,0x63,0x32,0x69,0x30,0x34,0x65,0x35,
+0x69,0x32,0x30,0x5c,0x78,0x37,0x66,0x5b,
+0x33,0x31,0x33,0x32,0x32,0x5c,0x78,0x37,
+0x66,0x61,0x77,0x6f,0x30,0x31,0x3b,0x63,
+0x30,0x7c,0x63,0x36,0x33,0x32,0x36,0x5c,
+0x78,0x38,0x32,0x30,0x63,0x32,0x69,0x30,
+0x34,0x65,0x33,0x69,0x30,0x36,0x33,0x31,
+0x33,0x32,0x32,0x5c,0x78,0x37,0x66,0x61,
+0x77,0x6f,0x30,0x31,0x32,0x63,0x32,0x69,
+0x30,0x34,0x65,0x33,0x69,0x32,0x30,0x5c,
+0x78,0x37,0x66,0x5b,0x33,0x31,0x33,0x32,
+0x32,0x5c,0x78,0x37,0x66,0x61,0x77,0x6f,
+0x30,0x31,0x32,0x69,0x30,0x35,0x63,0x37,
+0x5c,0x78,0x38,0x32,0x4a,0x30,0x63,0x32,
 0x69,0x30,0x34,0x65,0x33,0x69,0x32,0x30,
 0x5c,0x78,0x37,0x66,0x5b,0x33,0x31,0x33,
 0x32,0x32,0x5c,0x78,0x37,0x66,0x61,0x77,
-0x6f,0x30,0x31,0x32,0x69,0x30,0x35,0x63,
-0x37,0x5c,0x78,0x38,0x32,0x4a,0x30,0x63,
-0x32,0x69,0x30,0x34,0x65,0x33,0x69,0x32,
-0x30,0x5c,0x78,0x37,0x66,0x5b,0x33,0x31,
-0x33,0x32,0x32,0x5c,0x78,0x37,0x66,0x61,
-0x77,0x6f,0x30,0x31,0x3b,0x5d,0x3b,0x63,
-0x32,0x69,0x30,0x34,0x65,0x35,0x69,0x30,
-0x36,0x33,0x31,0x33,0x32,0x32,0x5c,0x78,
-0x37,0x66,0x61,0x77,0x6f,0x30,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x6d,
-0x65,0x6d,0x71,0x29,0x20,0x28,0x6c,0x6f,
-0x61,0x64,0x76,0x2e,0x6c,0x20,0x6c,0x6f,
-0x61,0x64,0x67,0x2e,0x6c,0x20,0x73,0x65,
-0x74,0x67,0x2e,0x6c,0x20,0x6c,0x6f,0x61,
-0x64,0x61,0x2e,0x6c,0x20,0x73,0x65,0x74,
-0x61,0x2e,0x6c,0x20,0x6c,0x61,0x72,0x67,
-0x63,0x20,0x6c,0x76,0x61,0x72,0x67,0x63,
-0x20,0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,
-0x74,0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x77,0x72,0x69,0x74,0x65,0x29,0x20,0x69,
-0x6e,0x74,0x33,0x32,0x20,0x28,0x6c,0x6f,
-0x61,0x64,0x63,0x20,0x73,0x65,0x74,0x63,
-0x29,0x20,0x75,0x69,0x6e,0x74,0x38,0x20,
-0x28,0x6c,0x6f,0x61,0x64,0x63,0x2e,0x6c,
-0x20,0x73,0x65,0x74,0x63,0x2e,0x6c,0x20,
-0x6f,0x70,0x74,0x61,0x72,0x67,0x73,0x20,
-0x6b,0x65,0x79,0x61,0x72,0x67,0x73,0x29,
-0x20,0x6b,0x65,0x79,0x61,0x72,0x67,0x73,
-0x5d,0x29,0x20,0x74,0x61,0x62,0x6c,0x65,
-0x2e,0x66,0x6f,0x72,0x65,0x61,0x63,0x68,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,
-0x30,0x30,0x72,0x32,0x63,0x30,0x69,0x30,
-0x34,0x7c,0x33,0x32,0x32,0x63,0x31,0x69,
-0x30,0x34,0x69,0x31,0x30,0x36,0x37,0x30,
-0x65,0x32,0x35,0x34,0x30,0x65,0x33,0x63,
-0x34,0x69,0x30,0x32,0x7d,0x33,0x32,0x7c,
-0x78,0x33,0x31,0x34,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x73,0x65,0x65,0x6b,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x69,0x6f,0x2e,0x77,0x72,0x69,
-0x74,0x65,0x29,0x20,0x69,0x6e,0x74,0x33,
-0x32,0x20,0x69,0x6e,0x74,0x31,0x36,0x20,
-0x23,0x66,0x6e,0x28,0x67,0x65,0x74,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x74,0x6f,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x21,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
-0x68,0x29,0x20,0x23,0x66,0x6e,0x28,0x74,
-0x61,0x62,0x6c,0x65,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x62,0x75,0x66,0x66,0x65,0x72,
-0x29,0x5d,0x29,0x20,0x3e,0x3d,0x20,0x23,
-0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
-0x68,0x29,0x20,0x36,0x35,0x35,0x33,0x36,
-0x5d,0x29,0x20,0x6c,0x69,0x73,0x74,0x2d,
-0x3e,0x76,0x65,0x63,0x74,0x6f,0x72,0x5d,
-0x29,0x20,0x72,0x65,0x76,0x65,0x72,0x73,
-0x65,0x21,0x5d,0x20,0x65,0x6e,0x63,0x6f,
-0x64,0x65,0x2d,0x62,0x79,0x74,0x65,0x2d,
-0x63,0x6f,0x64,0x65,0x29,0x20,0x65,0x72,
-0x72,0x6f,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x73,0x30,0x63,
-0x30,0x63,0x31,0x7c,0x4b,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x72,
-0x61,0x69,0x73,0x65,0x29,0x20,0x65,0x72,
-0x72,0x6f,0x72,0x5d,0x20,0x65,0x72,0x72,
-0x6f,0x72,0x29,0x20,0x65,0x72,0x72,0x6f,
-0x72,0x2d,0x65,0x78,0x63,0x65,0x70,0x74,
-0x69,0x6f,0x6e,0x2d,0x6d,0x65,0x73,0x73,
-0x61,0x67,0x65,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x5c,0x78,0x38,0x34,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x65,0x72,0x72,0x6f,0x72,0x2d,
-0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,
-0x6e,0x2d,0x6d,0x65,0x73,0x73,0x61,0x67,
-0x65,0x29,0x20,0x65,0x72,0x72,0x6f,0x72,
+0x6f,0x30,0x31,0x3b,0x5d,0x3b,0x63,0x32,
+0x69,0x30,0x34,0x65,0x35,0x69,0x30,0x36,
+0x33,0x31,0x33,0x32,0x32,0x5c,0x78,0x37,
+0x66,0x61,0x77,0x6f,0x30,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x6d,0x65,
+0x6d,0x71,0x29,0x20,0x28,0x6c,0x6f,0x61,
+0x64,0x76,0x2e,0x6c,0x20,0x6c,0x6f,0x61,
+0x64,0x67,0x2e,0x6c,0x20,0x73,0x65,0x74,
+0x67,0x2e,0x6c,0x20,0x6c,0x6f,0x61,0x64,
+0x61,0x2e,0x6c,0x20,0x73,0x65,0x74,0x61,
+0x2e,0x6c,0x20,0x6c,0x61,0x72,0x67,0x63,
+0x20,0x6c,0x76,0x61,0x72,0x67,0x63,0x20,
+0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x20,0x74,
+0x63,0x61,0x6c,0x6c,0x2e,0x6c,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x77,
+0x72,0x69,0x74,0x65,0x29,0x20,0x69,0x6e,
+0x74,0x33,0x32,0x20,0x28,0x6c,0x6f,0x61,
+0x64,0x63,0x20,0x73,0x65,0x74,0x63,0x29,
+0x20,0x75,0x69,0x6e,0x74,0x38,0x20,0x28,
+0x6c,0x6f,0x61,0x64,0x63,0x2e,0x6c,0x20,
+0x73,0x65,0x74,0x63,0x2e,0x6c,0x20,0x6f,
+0x70,0x74,0x61,0x72,0x67,0x73,0x20,0x6b,
+0x65,0x79,0x61,0x72,0x67,0x73,0x29,0x20,
+0x6b,0x65,0x79,0x61,0x72,0x67,0x73,0x5d,
+0x29,0x20,0x74,0x61,0x62,0x6c,0x65,0x2e,
+0x66,0x6f,0x72,0x65,0x61,0x63,0x68,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,
+0x30,0x72,0x32,0x63,0x30,0x69,0x30,0x34,
+0x7c,0x33,0x32,0x32,0x63,0x31,0x69,0x30,
+0x34,0x69,0x31,0x30,0x36,0x37,0x30,0x65,
+0x32,0x35,0x34,0x30,0x65,0x33,0x63,0x34,
+0x69,0x30,0x32,0x7d,0x33,0x32,0x7c,0x78,
+0x33,0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x73,
+0x65,0x65,0x6b,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x69,0x6f,0x2e,0x77,0x72,0x69,0x74,
+0x65,0x29,0x20,0x69,0x6e,0x74,0x33,0x32,
+0x20,0x69,0x6e,0x74,0x31,0x36,0x20,0x23,
+0x66,0x6e,0x28,0x67,0x65,0x74,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,
+0x2e,0x74,0x6f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x21,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x74,0x61,
+0x62,0x6c,0x65,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
+0x5d,0x29,0x20,0x3e,0x3d,0x20,0x23,0x66,
+0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,
+0x29,0x20,0x36,0x35,0x35,0x33,0x36,0x5d,
+0x29,0x20,0x6c,0x69,0x73,0x74,0x2d,0x3e,
+0x76,0x65,0x63,0x74,0x6f,0x72,0x5d,0x29,
+0x20,0x72,0x65,0x76,0x65,0x72,0x73,0x65,
+0x21,0x5d,0x20,0x65,0x6e,0x63,0x6f,0x64,
+0x65,0x2d,0x62,0x79,0x74,0x65,0x2d,0x63,
+0x6f,0x64,0x65,0x29,0x20,0x65,0x72,0x72,
+0x6f,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3a,0x30,0x30,0x30,0x73,0x30,0x63,0x30,
+0x63,0x31,0x7c,0x4b,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x72,0x61,
+0x69,0x73,0x65,0x29,0x20,0x65,0x72,0x72,
+0x6f,0x72,0x5d,0x20,0x65,0x72,0x72,0x6f,
+0x72,0x29,0x20,0x65,0x72,0x72,0x6f,0x72,
 0x2d,0x65,0x78,0x63,0x65,0x70,0x74,0x69,
-0x6f,0x6e,0x2d,0x70,0x61,0x72,0x61,0x6d,
-0x65,0x74,0x65,0x72,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x65,0x30,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x63,0x64,0x64,0x72,0x5d,0x20,
-0x65,0x72,0x72,0x6f,0x72,0x2d,0x65,0x78,
-0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,
-0x70,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,
-0x72,0x73,0x29,0x20,0x65,0x76,0x61,0x6c,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x31,0x65,0x30,0x65,0x31,
-0x7c,0x46,0x31,0x36,0x38,0x30,0x32,0x7c,
-0x4d,0x63,0x32,0x3e,0x36,0x37,0x30,0x7c,
-0x5c,0x78,0x38,0x34,0x35,0x33,0x30,0x7c,
-0x33,0x31,0x33,0x31,0x34,0x30,0x3b,0x22,
-0x20,0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,
-0x65,0x2d,0x74,0x68,0x75,0x6e,0x6b,0x20,
-0x65,0x78,0x70,0x61,0x6e,0x64,0x20,0x22,
-0x6e,0x6f,0x65,0x78,0x70,0x61,0x6e,0x64,
-0x22,0x5d,0x20,0x65,0x76,0x61,0x6c,0x29,
-0x20,0x65,0x76,0x61,0x6c,0x2d,0x63,0x6f,
-0x72,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x65,
-0x76,0x61,0x6c,0x5d,0x20,0x65,0x76,0x61,
-0x6c,0x2d,0x63,0x6f,0x72,0x65,0x29,0x20,
-0x65,0x76,0x65,0x6e,0x3f,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7c,0x61,0x33,0x32,0x60,
-0x57,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x6c,0x6f,0x67,0x61,0x6e,0x64,0x29,
-0x5d,0x20,0x65,0x76,0x65,0x6e,0x3f,0x29,
-0x20,0x65,0x76,0x65,0x72,0x79,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x32,0x7d,0x3f,0x31,0x37,0x44,0x30,
-0x32,0x7c,0x7d,0x4d,0x33,0x31,0x31,0x36,
-0x3a,0x30,0x32,0x65,0x30,0x7c,0x7d,0x4e,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x65,0x76,
-0x65,0x72,0x79,0x5d,0x20,0x65,0x76,0x65,
-0x72,0x79,0x29,0x20,0x65,0x78,0x61,0x63,
-0x74,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x6f,0x6e,0x2d,0x6d,0x65,0x73,0x73,0x61,
+0x67,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x36,0x30,0x30,0x30,0x72,0x31,0x7c,0x5c,
+0x78,0x38,0x34,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x65,0x72,0x72,0x6f,0x72,0x2d,0x65,
+0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
+0x2d,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,
+0x29,0x20,0x65,0x72,0x72,0x6f,0x72,0x2d,
+0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,
+0x6e,0x2d,0x70,0x61,0x72,0x61,0x6d,0x65,
+0x74,0x65,0x72,0x73,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x65,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x63,0x64,0x64,0x72,0x5d,0x20,0x65,
+0x72,0x72,0x6f,0x72,0x2d,0x65,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x70,
+0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,
+0x73,0x29,0x20,0x65,0x76,0x61,0x6c,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x31,0x65,0x30,0x65,0x31,0x7c,
+0x46,0x31,0x36,0x38,0x30,0x32,0x7c,0x4d,
+0x63,0x32,0x3e,0x36,0x37,0x30,0x7c,0x5c,
+0x78,0x38,0x34,0x35,0x33,0x30,0x7c,0x33,
+0x31,0x33,0x31,0x34,0x30,0x3b,0x22,0x20,
+0x5b,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
+0x2d,0x74,0x68,0x75,0x6e,0x6b,0x20,0x65,
+0x78,0x70,0x61,0x6e,0x64,0x20,0x22,0x6e,
+0x6f,0x65,0x78,0x70,0x61,0x6e,0x64,0x22,
+0x5d,0x20,0x65,0x76,0x61,0x6c,0x29,0x20,
+0x65,0x76,0x61,0x6c,0x2d,0x63,0x6f,0x72,
+0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
 0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x7c,
-0x33,0x31,0x36,0x34,0x30,0x7c,0x3b,0x65,
-0x31,0x63,0x32,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x65,0x78,0x61,0x63,0x74,0x3f,0x20,
-0x65,0x72,0x72,0x6f,0x72,0x20,0x22,0x65,
-0x78,0x61,0x63,0x74,0x20,0x72,0x65,0x61,
-0x6c,0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,
-0x73,0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,
-0x70,0x70,0x6f,0x72,0x74,0x65,0x64,0x22,
-0x5d,0x20,0x65,0x78,0x61,0x63,0x74,0x29,
-0x20,0x65,0x78,0x61,0x63,0x74,0x2d,0x3e,
-0x69,0x6e,0x65,0x78,0x61,0x63,0x74,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x7c,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x64,0x6f,0x75,0x62,
-0x6c,0x65,0x5d,0x20,0x65,0x78,0x61,0x63,
-0x74,0x2d,0x3e,0x69,0x6e,0x65,0x78,0x61,
-0x63,0x74,0x29,0x20,0x65,0x78,0x61,0x63,
-0x74,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x69,0x6e,0x74,0x65,0x67,
-0x65,0x72,0x3f,0x29,0x5d,0x20,0x65,0x78,
-0x61,0x63,0x74,0x3f,0x29,0x20,0x65,0x78,
-0x69,0x73,0x74,0x73,0x20,0x23,0x38,0x3d,
-0x23,0x66,0x6e,0x28,0x22,0x3f,0x30,0x30,
-0x30,0x73,0x32,0x7d,0x41,0x40,0x31,0x36,
-0x54,0x30,0x32,0x7c,0x7d,0x4d,0x63,0x30,
-0x63,0x31,0x67,0x32,0x33,0x32,0x51,0x33,
-0x31,0x37,0x42,0x30,0x32,0x65,0x32,0x7c,
-0x7d,0x4e,0x63,0x30,0x63,0x33,0x67,0x32,
-0x33,0x32,0x76,0x34,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,
-0x20,0x23,0x2e,0x63,0x61,0x72,0x20,0x65,
-0x78,0x69,0x73,0x74,0x73,0x20,0x23,0x2e,
-0x63,0x64,0x72,0x5d,0x20,0x65,0x78,0x69,
-0x73,0x74,0x73,0x29,0x20,0x65,0x78,0x70,
-0x61,0x6e,0x64,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x41,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,
-0x5d,0x5d,0x5d,0x5d,0x5d,0x34,0x3b,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x3b,0x63,0x30,
-0x6d,0x30,0x32,0x63,0x31,0x71,0x6d,0x31,
-0x32,0x63,0x32,0x4c,0x31,0x6d,0x32,0x32,
-0x63,0x33,0x71,0x6d,0x33,0x32,0x63,0x34,
-0x71,0x6d,0x34,0x32,0x63,0x35,0x71,0x6d,
-0x35,0x32,0x63,0x36,0x71,0x6d,0x36,0x32,
-0x63,0x37,0x71,0x6d,0x37,0x32,0x63,0x38,
-0x71,0x6d,0x38,0x32,0x63,0x39,0x6d,0x39,
-0x32,0x63,0x3a,0x71,0x6d,0x3a,0x32,0x67,
-0x3a,0x7e,0x5f,0x34,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x32,0x7c,0x45,0x31,0x37,
-0x39,0x30,0x32,0x63,0x30,0x7c,0x7d,0x33,
-0x32,0x40,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x61,0x73,0x73,0x71,0x29,0x5d,
-0x20,0x74,0x6f,0x70,0x3f,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x3f,0x36,0x34,0x30,0x7c,
-0x3b,0x7c,0x63,0x30,0x3e,0x36,0x34,0x30,
-0x7c,0x3b,0x7c,0x4d,0x46,0x31,0x36,0x3b,
-0x30,0x32,0x65,0x31,0x7c,0x33,0x31,0x63,
-0x32,0x3c,0x36,0x44,0x30,0x63,0x33,0x5c,
-0x78,0x37,0x66,0x65,0x34,0x7c,0x33,0x31,
-0x33,0x31,0x5c,0x78,0x37,0x66,0x7c,0x4e,
-0x33,0x31,0x34,0x32,0x3b,0x7c,0x4d,0x5c,
-0x78,0x37,0x66,0x7c,0x4e,0x33,0x31,0x4b,
-0x3b,0x22,0x20,0x5b,0x28,0x28,0x62,0x65,
-0x67,0x69,0x6e,0x29,0x29,0x20,0x63,0x61,
-0x61,0x72,0x20,0x62,0x65,0x67,0x69,0x6e,
-0x20,0x23,0x66,0x6e,0x28,0x61,0x70,0x70,
-0x65,0x6e,0x64,0x29,0x20,0x63,0x64,0x61,
-0x72,0x5d,0x20,0x73,0x70,0x6c,0x69,0x63,
-0x65,0x2d,0x62,0x65,0x67,0x69,0x6e,0x29,
-0x20,0x2a,0x65,0x78,0x70,0x61,0x6e,0x64,
-0x65,0x64,0x2a,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x7c,
-0x3f,0x36,0x34,0x30,0x7c,0x3b,0x63,0x30,
-0x71,0x7e,0x63,0x31,0x7d,0x33,0x32,0x36,
-0x39,0x30,0x5c,0x78,0x37,0x66,0x7c,0x33,
-0x31,0x35,0x33,0x30,0x7c,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x69,0x31,0x30,0x63,0x31,0x5c,0x78,
-0x37,0x66,0x33,0x32,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x7c,0x36,0x3a,0x30,0x65,0x31,0x7e,0x33,
-0x31,0x35,0x33,0x30,0x5f,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x63,0x31,0x63,0x32,0x63,0x33,0x7c,
-0x33,0x32,0x69,0x32,0x31,0x33,0x32,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x65,0x76,
+0x61,0x6c,0x5d,0x20,0x65,0x76,0x61,0x6c,
+0x2d,0x63,0x6f,0x72,0x65,0x29,0x20,0x65,
+0x76,0x65,0x6e,0x3f,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x69,0x31,0x30,0x37,0x3d,0x30,0x63,0x30,
-0x63,0x31,0x71,0x69,0x32,0x30,0x34,0x32,
-0x3b,0x63,0x32,0x71,0x63,0x33,0x71,0x5d,
-0x33,0x31,0x69,0x32,0x30,0x33,0x31,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x6d,0x61,0x70,0x29,0x20,0x23,0x66,
+0x63,0x30,0x7c,0x61,0x33,0x32,0x60,0x57,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x6c,0x6f,0x67,0x61,0x6e,0x64,0x29,0x5d,
+0x20,0x65,0x76,0x65,0x6e,0x3f,0x29,0x20,
+0x65,0x76,0x65,0x72,0x79,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x69,0x35,0x3a,0x7c,0x7e,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x5d,0x29,0x20,0x23,
+0x32,0x7d,0x3f,0x31,0x37,0x44,0x30,0x32,
+0x7c,0x7d,0x4d,0x33,0x31,0x31,0x36,0x3a,
+0x30,0x32,0x65,0x30,0x7c,0x7d,0x4e,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x65,0x76,0x65,
+0x72,0x79,0x5d,0x20,0x65,0x76,0x65,0x72,
+0x79,0x29,0x20,0x65,0x78,0x61,0x63,0x74,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x65,0x30,0x7c,0x33,
+0x31,0x36,0x34,0x30,0x7c,0x3b,0x65,0x31,
+0x63,0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x65,0x78,0x61,0x63,0x74,0x3f,0x20,0x65,
+0x72,0x72,0x6f,0x72,0x20,0x22,0x65,0x78,
+0x61,0x63,0x74,0x20,0x72,0x65,0x61,0x6c,
+0x20,0x6e,0x75,0x6d,0x62,0x65,0x72,0x73,
+0x20,0x6e,0x6f,0x74,0x20,0x73,0x75,0x70,
+0x70,0x6f,0x72,0x74,0x65,0x64,0x22,0x5d,
+0x20,0x65,0x78,0x61,0x63,0x74,0x29,0x20,
+0x65,0x78,0x61,0x63,0x74,0x2d,0x3e,0x69,
+0x6e,0x65,0x78,0x61,0x63,0x74,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x7c,0x34,0x31,
+0x72,0x31,0x65,0x30,0x7c,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x64,0x6f,0x75,0x62,0x6c,
+0x65,0x5d,0x20,0x65,0x78,0x61,0x63,0x74,
+0x2d,0x3e,0x69,0x6e,0x65,0x78,0x61,0x63,
+0x74,0x29,0x20,0x65,0x78,0x61,0x63,0x74,
+0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x69,0x6e,0x74,0x65,0x67,0x65,
+0x72,0x3f,0x29,0x5d,0x20,0x65,0x78,0x61,
+0x63,0x74,0x3f,0x29,0x20,0x65,0x78,0x69,
+0x73,0x74,0x73,0x20,0x23,0x38,0x3d,0x23,
+0x66,0x6e,0x28,0x22,0x3f,0x30,0x30,0x30,
+0x73,0x32,0x7d,0x41,0x40,0x31,0x36,0x54,
+0x30,0x32,0x7c,0x7d,0x4d,0x63,0x30,0x63,
+0x31,0x67,0x32,0x33,0x32,0x51,0x33,0x31,
+0x37,0x42,0x30,0x32,0x65,0x32,0x7c,0x7d,
+0x4e,0x63,0x30,0x63,0x33,0x67,0x32,0x33,
+0x32,0x76,0x34,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
+0x23,0x2e,0x63,0x61,0x72,0x20,0x65,0x78,
+0x69,0x73,0x74,0x73,0x20,0x23,0x2e,0x63,
+0x64,0x72,0x5d,0x20,0x65,0x78,0x69,0x73,
+0x74,0x73,0x29,0x20,0x65,0x78,0x70,0x61,
+0x6e,0x64,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x41,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,0x5d,
+0x5d,0x5d,0x5d,0x5d,0x34,0x3b,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x3b,0x63,0x30,0x6d,
+0x30,0x32,0x63,0x31,0x71,0x6d,0x31,0x32,
+0x63,0x32,0x4c,0x31,0x6d,0x32,0x32,0x63,
+0x33,0x71,0x6d,0x33,0x32,0x63,0x34,0x71,
+0x6d,0x34,0x32,0x63,0x35,0x71,0x6d,0x35,
+0x32,0x63,0x36,0x71,0x6d,0x36,0x32,0x63,
+0x37,0x71,0x6d,0x37,0x32,0x63,0x38,0x71,
+0x6d,0x38,0x32,0x63,0x39,0x6d,0x39,0x32,
+0x63,0x3a,0x71,0x6d,0x3a,0x32,0x67,0x3a,
+0x7e,0x5f,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x32,0x7c,0x45,0x31,0x37,0x39,
+0x30,0x32,0x63,0x30,0x7c,0x7d,0x33,0x32,
+0x40,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x61,0x73,0x73,0x71,0x29,0x5d,0x20,
+0x74,0x6f,0x70,0x3f,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x3f,0x36,0x34,0x30,0x7c,0x3b,
+0x7c,0x63,0x30,0x3e,0x36,0x34,0x30,0x7c,
+0x3b,0x7c,0x4d,0x46,0x31,0x36,0x3b,0x30,
+0x32,0x65,0x31,0x7c,0x33,0x31,0x63,0x32,
+0x3c,0x36,0x44,0x30,0x63,0x33,0x5c,0x78,
+0x37,0x66,0x65,0x34,0x7c,0x33,0x31,0x33,
+0x31,0x5c,0x78,0x37,0x66,0x7c,0x4e,0x33,
+0x31,0x34,0x32,0x3b,0x7c,0x4d,0x5c,0x78,
+0x37,0x66,0x7c,0x4e,0x33,0x31,0x4b,0x3b,
+0x22,0x20,0x5b,0x28,0x28,0x62,0x65,0x67,
+0x69,0x6e,0x29,0x29,0x20,0x63,0x61,0x61,
+0x72,0x20,0x62,0x65,0x67,0x69,0x6e,0x20,
+0x23,0x66,0x6e,0x28,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x29,0x20,0x63,0x64,0x61,0x72,
+0x5d,0x20,0x73,0x70,0x6c,0x69,0x63,0x65,
+0x2d,0x62,0x65,0x67,0x69,0x6e,0x29,0x20,
+0x2a,0x65,0x78,0x70,0x61,0x6e,0x64,0x65,
+0x64,0x2a,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x32,0x7c,0x3f,
+0x36,0x34,0x30,0x7c,0x3b,0x63,0x30,0x71,
+0x7e,0x63,0x31,0x7d,0x33,0x32,0x36,0x39,
+0x30,0x5c,0x78,0x37,0x66,0x7c,0x33,0x31,
+0x35,0x33,0x30,0x7c,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x69,0x31,0x30,0x63,0x31,0x5c,0x78,0x37,
+0x66,0x33,0x32,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x7c,
+0x36,0x3a,0x30,0x65,0x31,0x7e,0x33,0x31,
+0x35,0x33,0x30,0x5f,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x63,0x31,0x63,0x32,0x63,0x33,0x7c,0x33,
+0x32,0x69,0x32,0x31,0x33,0x32,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x5d,
-0x7c,0x46,0x36,0x5d,0x30,0x32,0x69,0x36,
-0x32,0x65,0x30,0x7c,0x33,0x31,0x3c,0x37,
-0x41,0x30,0x7c,0x69,0x36,0x3a,0x7c,0x4d,
-0x69,0x31,0x30,0x33,0x32,0x4f,0x35,0x39,
-0x30,0x7c,0x65,0x31,0x7c,0x33,0x31,0x4f,
-0x32,0x7c,0x4e,0x6d,0x30,0x35,0x5c,0x78,
-0x30,0x32,0x2f,0x32,0x7e,0x3b,0x22,0x20,
-0x5b,0x63,0x61,0x61,0x72,0x20,0x63,0x64,
-0x61,0x72,0x5d,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
-0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x3f,0x36,0x34,0x30,0x7c,0x3b,0x7c,
-0x4d,0x46,0x31,0x36,0x3b,0x30,0x32,0x63,
-0x30,0x65,0x31,0x7c,0x33,0x31,0x3c,0x36,
-0x3b,0x30,0x7c,0x4d,0x7e,0x7c,0x4e,0x33,
-0x31,0x4b,0x3b,0x63,0x32,0x71,0x69,0x36,
-0x3a,0x7c,0x4d,0x69,0x31,0x30,0x33,0x32,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x64,0x65,
-0x66,0x69,0x6e,0x65,0x20,0x63,0x61,0x61,
-0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x63,
-0x31,0x63,0x32,0x65,0x33,0x7c,0x33,0x31,
-0x33,0x32,0x69,0x32,0x30,0x33,0x32,0x6f,
-0x32,0x30,0x32,0x69,0x37,0x32,0x7c,0x4b,
-0x69,0x31,0x30,0x7e,0x4e,0x33,0x31,0x4b,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x69,
+0x31,0x30,0x37,0x3d,0x30,0x63,0x30,0x63,
+0x31,0x71,0x69,0x32,0x30,0x34,0x32,0x3b,
+0x63,0x32,0x71,0x63,0x33,0x71,0x5d,0x33,
+0x31,0x69,0x32,0x30,0x33,0x31,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x6e,0x63,0x6f,0x6e,0x63,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
-0x23,0x2e,0x6c,0x69,0x73,0x74,0x20,0x67,
-0x65,0x74,0x2d,0x64,0x65,0x66,0x69,0x6e,
-0x65,0x64,0x2d,0x76,0x61,0x72,0x73,0x5d,
-0x29,0x5d,0x29,0x5d,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,
-0x63,0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,
-0x61,0x70,0x29,0x20,0x23,0x2e,0x6c,0x69,
-0x73,0x74,0x5d,0x29,0x20,0x67,0x65,0x74,
-0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,
-0x2d,0x76,0x61,0x72,0x73,0x5d,0x29,0x20,
-0x64,0x65,0x66,0x69,0x6e,0x65,0x5d,0x29,
-0x20,0x62,0x65,0x67,0x69,0x6e,0x5d,0x20,
-0x65,0x78,0x70,0x61,0x6e,0x64,0x2d,0x62,
-0x6f,0x64,0x79,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x32,
-0x7c,0x3f,0x36,0x34,0x30,0x7c,0x3b,0x7c,
-0x4d,0x46,0x31,0x36,0x37,0x30,0x32,0x7c,
-0x4d,0x4e,0x46,0x36,0x47,0x30,0x65,0x30,
-0x7c,0x33,0x31,0x69,0x30,0x3a,0x65,0x31,
-0x7c,0x33,0x31,0x7d,0x33,0x32,0x4c,0x32,
-0x35,0x34,0x30,0x7c,0x4d,0x69,0x30,0x34,
-0x7c,0x4e,0x7d,0x33,0x32,0x4b,0x3b,0x22,
-0x20,0x5b,0x63,0x61,0x61,0x72,0x20,0x63,
-0x61,0x64,0x61,0x72,0x5d,0x20,0x65,0x78,
-0x70,0x61,0x6e,0x64,0x2d,0x6c,0x61,0x6d,
-0x62,0x64,0x61,0x2d,0x6c,0x69,0x73,0x74,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x3f,0x36,
-0x36,0x30,0x7c,0x4c,0x31,0x3b,0x7c,0x4d,
-0x46,0x36,0x40,0x30,0x65,0x30,0x7c,0x33,
-0x31,0x69,0x30,0x35,0x7c,0x4e,0x33,0x31,
-0x4b,0x3b,0x7c,0x4d,0x69,0x30,0x35,0x7c,
-0x4e,0x33,0x31,0x4b,0x3b,0x22,0x20,0x5b,
-0x63,0x61,0x61,0x72,0x5d,0x20,0x6c,0x2d,
-0x76,0x61,0x72,0x73,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x7c,0x5c,0x78,0x38,
-0x34,0x65,0x31,0x7c,0x33,0x31,0x65,0x32,
-0x7c,0x33,0x31,0x69,0x30,0x35,0x7c,0x5c,
-0x78,0x38,0x34,0x33,0x31,0x34,0x34,0x3b,
+0x6d,0x61,0x70,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
+0x69,0x35,0x3a,0x7c,0x7e,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x7c,0x34,0x31,0x3b,
 0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x5d,0x7c,
+0x46,0x36,0x5d,0x30,0x32,0x69,0x36,0x32,
+0x65,0x30,0x7c,0x33,0x31,0x3c,0x37,0x41,
+0x30,0x7c,0x69,0x36,0x3a,0x7c,0x4d,0x69,
+0x31,0x30,0x33,0x32,0x4f,0x35,0x39,0x30,
+0x7c,0x65,0x31,0x7c,0x33,0x31,0x4f,0x32,
+0x7c,0x4e,0x6d,0x30,0x35,0x5c,0x78,0x30,
+0x32,0x2f,0x32,0x7e,0x3b,0x22,0x20,0x5b,
+0x63,0x61,0x61,0x72,0x20,0x63,0x64,0x61,
+0x72,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x3f,0x36,0x34,0x30,0x7c,0x3b,0x7c,0x4d,
+0x46,0x31,0x36,0x3b,0x30,0x32,0x63,0x30,
+0x65,0x31,0x7c,0x33,0x31,0x3c,0x36,0x3b,
+0x30,0x7c,0x4d,0x7e,0x7c,0x4e,0x33,0x31,
+0x4b,0x3b,0x63,0x32,0x71,0x69,0x36,0x3a,
+0x7c,0x4d,0x69,0x31,0x30,0x33,0x32,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x64,0x65,0x66,
+0x69,0x6e,0x65,0x20,0x63,0x61,0x61,0x72,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x63,0x31,
+0x63,0x32,0x65,0x33,0x7c,0x33,0x31,0x33,
+0x32,0x69,0x32,0x30,0x33,0x32,0x6f,0x32,
+0x30,0x32,0x69,0x37,0x32,0x7c,0x4b,0x69,
+0x31,0x30,0x7e,0x4e,0x33,0x31,0x4b,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x6e,
+0x63,0x6f,0x6e,0x63,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,0x23,
+0x2e,0x6c,0x69,0x73,0x74,0x20,0x67,0x65,
+0x74,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,
+0x64,0x2d,0x76,0x61,0x72,0x73,0x5d,0x29,
+0x5d,0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,0x61,
+0x70,0x29,0x20,0x23,0x2e,0x6c,0x69,0x73,
+0x74,0x5d,0x29,0x20,0x67,0x65,0x74,0x2d,
+0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x2d,
+0x76,0x61,0x72,0x73,0x5d,0x29,0x20,0x64,
+0x65,0x66,0x69,0x6e,0x65,0x5d,0x29,0x20,
+0x62,0x65,0x67,0x69,0x6e,0x5d,0x20,0x65,
+0x78,0x70,0x61,0x6e,0x64,0x2d,0x62,0x6f,
+0x64,0x79,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3a,0x30,0x30,0x30,0x72,0x32,0x7c,
+0x3f,0x36,0x34,0x30,0x7c,0x3b,0x7c,0x4d,
+0x46,0x31,0x36,0x37,0x30,0x32,0x7c,0x4d,
+0x4e,0x46,0x36,0x47,0x30,0x65,0x30,0x7c,
+0x33,0x31,0x69,0x30,0x3a,0x65,0x31,0x7c,
+0x33,0x31,0x7d,0x33,0x32,0x4c,0x32,0x35,
+0x34,0x30,0x7c,0x4d,0x69,0x30,0x34,0x7c,
+0x4e,0x7d,0x33,0x32,0x4b,0x3b,0x22,0x20,
+0x5b,0x63,0x61,0x61,0x72,0x20,0x63,0x61,
+0x64,0x61,0x72,0x5d,0x20,0x65,0x78,0x70,
+0x61,0x6e,0x64,0x2d,0x6c,0x61,0x6d,0x62,
+0x64,0x61,0x2d,0x6c,0x69,0x73,0x74,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x3f,0x36,0x36,
+0x30,0x7c,0x4c,0x31,0x3b,0x7c,0x4d,0x46,
+0x36,0x40,0x30,0x65,0x30,0x7c,0x33,0x31,
+0x69,0x30,0x35,0x7c,0x4e,0x33,0x31,0x4b,
+0x3b,0x7c,0x4d,0x69,0x30,0x35,0x7c,0x4e,
+0x33,0x31,0x4b,0x3b,0x22,0x20,0x5b,0x63,
+0x61,0x61,0x72,0x5d,0x20,0x6c,0x2d,0x76,
+0x61,0x72,0x73,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x71,0x7c,0x5c,0x78,0x38,0x34,
+0x65,0x31,0x7c,0x33,0x31,0x65,0x32,0x7c,
+0x33,0x31,0x69,0x30,0x35,0x7c,0x5c,0x78,
+0x38,0x34,0x33,0x31,0x34,0x34,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x34,0x63,0x30,0x71,
+0x63,0x31,0x63,0x32,0x63,0x33,0x67,0x33,
+0x33,0x32,0x5c,0x78,0x37,0x66,0x33,0x32,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x63,0x31,0x4c,0x31,0x69,
+0x32,0x34,0x7e,0x7c,0x33,0x32,0x4c,0x31,
+0x69,0x32,0x33,0x69,0x30,0x32,0x7c,0x33,
+0x32,0x5c,0x78,0x37,0x66,0x34,0x34,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x6e,
+0x63,0x6f,0x6e,0x63,0x29,0x20,0x6c,0x61,
+0x6d,0x62,0x64,0x61,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,0x61,
+0x70,0x29,0x20,0x23,0x2e,0x6c,0x69,0x73,
+0x74,0x5d,0x29,0x20,0x6c,0x61,0x73,0x74,
+0x63,0x64,0x72,0x20,0x63,0x64,0x64,0x72,
+0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,0x64,
+0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,
+0x30,0x30,0x72,0x32,0x7c,0x4e,0x41,0x31,
+0x37,0x36,0x30,0x32,0x7c,0x5c,0x78,0x38,
+0x34,0x3f,0x36,0x4e,0x30,0x65,0x30,0x7c,
+0x33,0x31,0x5c,0x78,0x38,0x35,0x34,0x30,
+0x7c,0x3b,0x63,0x31,0x7c,0x5c,0x78,0x38,
+0x34,0x69,0x30,0x3a,0x65,0x32,0x7c,0x33,
+0x31,0x7d,0x33,0x32,0x4c,0x33,0x3b,0x63,
+0x33,0x71,0x65,0x34,0x7c,0x33,0x31,0x65,
+0x35,0x7c,0x33,0x31,0x65,0x30,0x7c,0x33,
+0x31,0x69,0x30,0x35,0x65,0x34,0x7c,0x33,
+0x31,0x33,0x31,0x34,0x34,0x3b,0x22,0x20,
+0x5b,0x63,0x64,0x64,0x72,0x20,0x64,0x65,
+0x66,0x69,0x6e,0x65,0x20,0x63,0x61,0x64,
+0x64,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
 0x3a,0x30,0x30,0x30,0x72,0x34,0x63,0x30,
 0x71,0x63,0x31,0x63,0x32,0x63,0x33,0x67,
 0x33,0x33,0x32,0x5c,0x78,0x37,0x66,0x33,
 0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
 0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
 0x72,0x31,0x63,0x30,0x63,0x31,0x4c,0x31,
-0x69,0x32,0x34,0x7e,0x7c,0x33,0x32,0x4c,
-0x31,0x69,0x32,0x33,0x69,0x30,0x32,0x7c,
-0x33,0x32,0x5c,0x78,0x37,0x66,0x34,0x34,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x6e,0x63,0x6f,0x6e,0x63,0x29,0x20,0x6c,
-0x61,0x6d,0x62,0x64,0x61,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,
-0x63,0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,
-0x61,0x70,0x29,0x20,0x23,0x2e,0x6c,0x69,
-0x73,0x74,0x5d,0x29,0x20,0x6c,0x61,0x73,
-0x74,0x63,0x64,0x72,0x20,0x63,0x64,0x64,
+0x5c,0x78,0x37,0x66,0x69,0x32,0x34,0x7e,
+0x7c,0x33,0x32,0x4b,0x4c,0x31,0x69,0x32,
+0x33,0x69,0x30,0x32,0x7c,0x33,0x32,0x34,
+0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x6e,0x63,0x6f,0x6e,0x63,0x29,0x20,
+0x64,0x65,0x66,0x69,0x6e,0x65,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x6e,0x63,0x6f,
+0x6e,0x63,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6d,0x61,0x70,0x29,0x20,0x23,0x2e,0x6c,
+0x69,0x73,0x74,0x5d,0x29,0x20,0x63,0x64,
+0x61,0x64,0x72,0x20,0x63,0x61,0x61,0x64,
 0x72,0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,
-0x64,0x2d,0x6c,0x61,0x6d,0x62,0x64,0x61,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
-0x30,0x30,0x30,0x72,0x32,0x7c,0x4e,0x41,
-0x31,0x37,0x36,0x30,0x32,0x7c,0x5c,0x78,
-0x38,0x34,0x3f,0x36,0x4e,0x30,0x65,0x30,
-0x7c,0x33,0x31,0x5c,0x78,0x38,0x35,0x34,
-0x30,0x7c,0x3b,0x63,0x31,0x7c,0x5c,0x78,
-0x38,0x34,0x69,0x30,0x3a,0x65,0x32,0x7c,
-0x33,0x31,0x7d,0x33,0x32,0x4c,0x33,0x3b,
-0x63,0x33,0x71,0x65,0x34,0x7c,0x33,0x31,
-0x65,0x35,0x7c,0x33,0x31,0x65,0x30,0x7c,
-0x33,0x31,0x69,0x30,0x35,0x65,0x34,0x7c,
-0x33,0x31,0x33,0x31,0x34,0x34,0x3b,0x22,
-0x20,0x5b,0x63,0x64,0x64,0x72,0x20,0x64,
-0x65,0x66,0x69,0x6e,0x65,0x20,0x63,0x61,
-0x64,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x72,0x34,0x63,
-0x30,0x71,0x63,0x31,0x63,0x32,0x63,0x33,
-0x67,0x33,0x33,0x32,0x5c,0x78,0x37,0x66,
-0x33,0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x63,0x31,0x4c,
-0x31,0x5c,0x78,0x37,0x66,0x69,0x32,0x34,
-0x7e,0x7c,0x33,0x32,0x4b,0x4c,0x31,0x69,
-0x32,0x33,0x69,0x30,0x32,0x7c,0x33,0x32,
-0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,0x29,
-0x20,0x64,0x65,0x66,0x69,0x6e,0x65,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x6e,0x63,
+0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x32,0x63,0x30,0x71,
+0x7c,0x5c,0x78,0x38,0x34,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x3c,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x69,0x31,0x33,0x65,0x31,0x7e,0x33,0x31,
+0x63,0x32,0x63,0x33,0x63,0x34,0x71,0x7c,
+0x33,0x32,0x5c,0x78,0x37,0x66,0x33,0x32,
+0x33,0x32,0x4b,0x3b,0x22,0x20,0x5b,0x62,
+0x65,0x67,0x69,0x6e,0x20,0x63,0x64,0x64,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x6e,0x63,
 0x6f,0x6e,0x63,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x6d,0x61,0x70,0x29,0x20,0x23,0x2e,
-0x6c,0x69,0x73,0x74,0x5d,0x29,0x20,0x63,
-0x64,0x61,0x64,0x72,0x20,0x63,0x61,0x61,
-0x64,0x72,0x5d,0x20,0x65,0x78,0x70,0x61,
-0x6e,0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,
-0x65,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
-0x71,0x7c,0x5c,0x78,0x38,0x34,0x34,0x31,
+0x28,0x6d,0x61,0x70,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x4d,0x65,0x30,0x69,0x32,0x3a,
+0x7c,0x5c,0x78,0x38,0x34,0x69,0x31,0x31,
+0x33,0x32,0x33,0x31,0x33,0x30,0x69,0x31,
+0x31,0x4c,0x33,0x3b,0x22,0x20,0x5b,0x63,
+0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,0x74,
+0x68,0x75,0x6e,0x6b,0x5d,0x29,0x5d,0x29,
+0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,0x64,
+0x2d,0x6c,0x65,0x74,0x2d,0x73,0x79,0x6e,
+0x74,0x61,0x78,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x32,
+0x7c,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x6c,
+0x6f,0x63,0x61,0x6c,0x2d,0x65,0x78,0x70,
+0x61,0x6e,0x73,0x69,0x6f,0x6e,0x2d,0x65,
+0x6e,0x76,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x32,0x7c,
+0x3f,0x36,0x34,0x30,0x7c,0x3b,0x63,0x30,
+0x71,0x7c,0x4d,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
+0x31,0x7c,0x5c,0x78,0x37,0x66,0x33,0x32,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x63,0x31,0x71,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x31,
+0x7e,0x31,0x36,0x36,0x30,0x32,0x7e,0x4e,
+0x46,0x36,0x4d,0x30,0x69,0x33,0x3a,0x7e,
+0x5c,0x78,0x38,0x34,0x69,0x32,0x30,0x4e,
+0x51,0x32,0x69,0x33,0x39,0x65,0x30,0x7e,
+0x33,0x31,0x69,0x32,0x31,0x33,0x32,0x34,
+0x32,0x3b,0x7e,0x31,0x37,0x41,0x30,0x32,
+0x69,0x31,0x30,0x43,0x40,0x31,0x37,0x37,
+0x30,0x32,0x69,0x31,0x30,0x45,0x36,0x36,
+0x30,0x7c,0x34,0x30,0x3b,0x63,0x31,0x71,
+0x65,0x32,0x69,0x32,0x30,0x33,0x31,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x63,0x61,0x64,
+0x64,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x7c,0x36,
+0x42,0x30,0x69,0x34,0x3a,0x7c,0x69,0x33,
+0x30,0x4e,0x51,0x32,0x69,0x33,0x31,0x34,
+0x32,0x3b,0x69,0x32,0x30,0x63,0x30,0x5c,
+0x78,0x38,0x32,0x36,0x30,0x69,0x33,0x30,
+0x3b,0x69,0x32,0x30,0x63,0x31,0x5c,0x78,
+0x38,0x32,0x3e,0x30,0x69,0x34,0x36,0x69,
+0x33,0x30,0x69,0x33,0x31,0x34,0x32,0x3b,
+0x69,0x32,0x30,0x63,0x32,0x5c,0x78,0x38,
+0x32,0x3e,0x30,0x69,0x34,0x37,0x69,0x33,
+0x30,0x69,0x33,0x31,0x34,0x32,0x3b,0x69,
+0x32,0x30,0x63,0x33,0x5c,0x78,0x38,0x32,
+0x3e,0x30,0x69,0x34,0x38,0x69,0x33,0x30,
+0x69,0x33,0x31,0x34,0x32,0x3b,0x7e,0x34,
+0x30,0x3b,0x22,0x20,0x5b,0x71,0x75,0x6f,
+0x74,0x65,0x20,0x6c,0x61,0x6d,0x62,0x64,
+0x61,0x20,0x64,0x65,0x66,0x69,0x6e,0x65,
+0x20,0x6c,0x65,0x74,0x2d,0x73,0x79,0x6e,
+0x74,0x61,0x78,0x5d,0x29,0x20,0x6d,0x61,
+0x63,0x72,0x6f,0x63,0x61,0x6c,0x6c,0x3f,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x30,0x63,0x30,
+0x71,0x5d,0x33,0x31,0x69,0x32,0x30,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x7c,0x3f,
+0x36,0x34,0x30,0x7c,0x3b,0x7c,0x4d,0x3f,
+0x36,0x37,0x30,0x7c,0x4d,0x35,0x3c,0x30,
+0x69,0x34,0x3a,0x7c,0x4d,0x69,0x33,0x31,
+0x33,0x32,0x7e,0x7c,0x4e,0x33,0x31,0x4b,
+0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x29,
+0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x61,0x73,0x73,0x71,0x29,0x5d,0x29,
+0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,0x64,
+0x2d,0x69,0x6e,0x29,0x5d,0x29,0x5d,0x20,
+0x65,0x78,0x70,0x61,0x6e,0x64,0x29,0x20,
+0x65,0x78,0x70,0x61,0x6e,0x64,0x2d,0x64,
+0x65,0x66,0x69,0x6e,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3d,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x7c,0x5c,0x78,0x38,0x34,
+0x65,0x31,0x7c,0x33,0x31,0x46,0x36,0x3a,
+0x30,0x65,0x31,0x7c,0x33,0x31,0x35,0x4c,
+0x30,0x7c,0x5c,0x78,0x38,0x34,0x43,0x36,
+0x3b,0x30,0x65,0x32,0x33,0x30,0x4c,0x31,
+0x35,0x3d,0x30,0x65,0x33,0x63,0x34,0x65,
+0x35,0x7c,0x33,0x31,0x33,0x32,0x34,0x32,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x3c,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x69,0x31,0x33,0x65,0x31,0x7e,0x33,
-0x31,0x63,0x32,0x63,0x33,0x63,0x34,0x71,
-0x7c,0x33,0x32,0x5c,0x78,0x37,0x66,0x33,
-0x32,0x33,0x32,0x4b,0x3b,0x22,0x20,0x5b,
-0x62,0x65,0x67,0x69,0x6e,0x20,0x63,0x64,
-0x64,0x72,0x20,0x23,0x66,0x6e,0x28,0x6e,
-0x63,0x6f,0x6e,0x63,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x4d,0x65,0x30,0x69,0x32,
-0x3a,0x7c,0x5c,0x78,0x38,0x34,0x69,0x31,
-0x31,0x33,0x32,0x33,0x31,0x33,0x30,0x69,
-0x31,0x31,0x4c,0x33,0x3b,0x22,0x20,0x5b,
-0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2d,
-0x74,0x68,0x75,0x6e,0x6b,0x5d,0x29,0x5d,
-0x29,0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,
-0x64,0x2d,0x6c,0x65,0x74,0x2d,0x73,0x79,
-0x6e,0x74,0x61,0x78,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
-0x32,0x7c,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x6c,0x6f,0x63,0x61,0x6c,0x2d,0x65,0x78,
-0x70,0x61,0x6e,0x73,0x69,0x6f,0x6e,0x2d,
-0x65,0x6e,0x76,0x29,0x20,0x23,0x66,0x6e,
+0x22,0x3c,0x30,0x30,0x30,0x72,0x32,0x7c,
+0x43,0x36,0x3a,0x30,0x63,0x30,0x7c,0x7d,
+0x4d,0x4c,0x33,0x3b,0x63,0x30,0x7c,0x4d,
+0x63,0x31,0x63,0x32,0x4c,0x31,0x7c,0x4e,
+0x4c,0x31,0x63,0x33,0x7d,0x33,0x31,0x7c,
+0x4d,0x33,0x34,0x4c,0x33,0x3b,0x22,0x20,
+0x5b,0x73,0x65,0x74,0x21,0x20,0x23,0x66,
+0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,0x29,
+0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,0x20,
+0x23,0x66,0x6e,0x28,0x63,0x6f,0x70,0x79,
+0x2d,0x6c,0x69,0x73,0x74,0x29,0x5d,0x29,
+0x20,0x63,0x64,0x64,0x72,0x20,0x76,0x6f,
+0x69,0x64,0x20,0x65,0x72,0x72,0x6f,0x72,
+0x20,0x22,0x63,0x6f,0x6d,0x70,0x69,0x6c,
+0x65,0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,
+0x20,0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,
+0x20,0x73,0x79,0x6e,0x74,0x61,0x78,0x20,
+0x22,0x20,0x77,0x72,0x69,0x74,0x65,0x2d,
+0x74,0x6f,0x2d,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,
+0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,
+0x29,0x20,0x66,0x67,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x62,0x4e,0x7c,0x77,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x66,0x67,0x29,0x20,0x66,0x69,
+0x6c,0x74,0x65,0x72,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x32,
-0x7c,0x3f,0x36,0x34,0x30,0x7c,0x3b,0x63,
-0x30,0x71,0x7c,0x4d,0x34,0x31,0x3b,0x22,
+0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,0x22,
 0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
 0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x63,0x31,0x7c,0x5c,0x78,0x37,0x66,0x33,
-0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x71,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
-0x31,0x7e,0x31,0x36,0x36,0x30,0x32,0x7e,
-0x4e,0x46,0x36,0x4d,0x30,0x69,0x33,0x3a,
-0x7e,0x5c,0x78,0x38,0x34,0x69,0x32,0x30,
-0x4e,0x51,0x32,0x69,0x33,0x39,0x65,0x30,
-0x7e,0x33,0x31,0x69,0x32,0x31,0x33,0x32,
-0x34,0x32,0x3b,0x7e,0x31,0x37,0x41,0x30,
-0x32,0x69,0x31,0x30,0x43,0x40,0x31,0x37,
-0x37,0x30,0x32,0x69,0x31,0x30,0x45,0x36,
-0x36,0x30,0x7c,0x34,0x30,0x3b,0x63,0x31,
-0x71,0x65,0x32,0x69,0x32,0x30,0x33,0x31,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x63,0x61,
-0x64,0x64,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x6d,0x30,0x32,0x7c,0x7e,0x5c,0x78,0x37,
+0x66,0x5f,0x4c,0x31,0x34,0x33,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x33,0x67,0x32,0x5d,
+0x7d,0x46,0x36,0x53,0x30,0x32,0x69,0x31,
+0x30,0x7d,0x4d,0x33,0x31,0x36,0x3f,0x30,
+0x67,0x32,0x7d,0x4d,0x5f,0x4b,0x50,0x4e,
+0x6d,0x32,0x35,0x33,0x30,0x5d,0x32,0x7d,
+0x4e,0x6d,0x31,0x35,0x5c,0x66,0x2f,0x32,
+0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x66,
+0x69,0x6c,0x74,0x65,0x72,0x2d,0x29,0x5d,
+0x29,0x5d,0x20,0x66,0x69,0x6c,0x74,0x65,
+0x72,0x29,0x20,0x66,0x69,0x6e,0x69,0x74,
+0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x7c,0x63,
+0x30,0x58,0x31,0x36,0x3a,0x30,0x32,0x65,
+0x31,0x7c,0x63,0x32,0x34,0x32,0x3b,0x22,
+0x20,0x5b,0x2b,0x69,0x6e,0x66,0x2e,0x30,
+0x20,0x3e,0x20,0x2d,0x69,0x6e,0x66,0x2e,
+0x30,0x5d,0x20,0x66,0x69,0x6e,0x69,0x74,
+0x65,0x3f,0x29,0x20,0x66,0x69,0x74,0x73,
+0x2d,0x69,0x38,0x20,0x23,0x66,0x6e,0x28,
 0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x36,0x42,0x30,0x69,0x34,0x3a,0x7c,0x69,
-0x33,0x30,0x4e,0x51,0x32,0x69,0x33,0x31,
-0x34,0x32,0x3b,0x69,0x32,0x30,0x63,0x30,
-0x5c,0x78,0x38,0x32,0x36,0x30,0x69,0x33,
-0x30,0x3b,0x69,0x32,0x30,0x63,0x31,0x5c,
-0x78,0x38,0x32,0x3e,0x30,0x69,0x34,0x36,
-0x69,0x33,0x30,0x69,0x33,0x31,0x34,0x32,
-0x3b,0x69,0x32,0x30,0x63,0x32,0x5c,0x78,
-0x38,0x32,0x3e,0x30,0x69,0x34,0x37,0x69,
-0x33,0x30,0x69,0x33,0x31,0x34,0x32,0x3b,
-0x69,0x32,0x30,0x63,0x33,0x5c,0x78,0x38,
-0x32,0x3e,0x30,0x69,0x34,0x38,0x69,0x33,
-0x30,0x69,0x33,0x31,0x34,0x32,0x3b,0x7e,
-0x34,0x30,0x3b,0x22,0x20,0x5b,0x71,0x75,
-0x6f,0x74,0x65,0x20,0x6c,0x61,0x6d,0x62,
-0x64,0x61,0x20,0x64,0x65,0x66,0x69,0x6e,
-0x65,0x20,0x6c,0x65,0x74,0x2d,0x73,0x79,
-0x6e,0x74,0x61,0x78,0x5d,0x29,0x20,0x6d,
-0x61,0x63,0x72,0x6f,0x63,0x61,0x6c,0x6c,
-0x3f,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x30,0x63,
-0x30,0x71,0x5d,0x33,0x31,0x69,0x32,0x30,
+0x49,0x31,0x36,0x46,0x30,0x32,0x65,0x30,
+0x7c,0x62,0x5c,0x78,0x62,0x30,0x33,0x32,
+0x31,0x36,0x3a,0x30,0x32,0x65,0x31,0x7c,
+0x62,0x5c,0x78,0x61,0x66,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x3e,0x3d,0x20,0x3c,0x3d,
+0x5d,0x20,0x66,0x69,0x74,0x73,0x2d,0x69,
+0x38,0x29,0x20,0x66,0x6c,0x6f,0x6e,0x75,
+0x6d,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
+0x7c,0x33,0x31,0x40,0x3b,0x22,0x20,0x5b,
+0x65,0x78,0x61,0x63,0x74,0x3f,0x5d,0x20,
+0x66,0x6c,0x6f,0x6e,0x75,0x6d,0x3f,0x29,
+0x20,0x66,0x6c,0x6f,0x6f,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x60,0x58,0x36,0x3b,0x30,
+0x63,0x30,0x7c,0x63,0x31,0x78,0x34,0x31,
+0x3b,0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x74,0x72,
+0x75,0x6e,0x63,0x61,0x74,0x65,0x29,0x20,
+0x30,0x2e,0x35,0x5d,0x20,0x66,0x6c,0x6f,
+0x6f,0x72,0x29,0x20,0x66,0x6f,0x6c,0x64,
+0x2d,0x6c,0x65,0x66,0x74,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x33,0x67,0x32,0x5c,0x78,0x38,0x35,0x34,
+0x30,0x7d,0x3b,0x65,0x30,0x7c,0x7c,0x7d,
+0x67,0x32,0x4d,0x33,0x32,0x67,0x32,0x4e,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x66,0x6f,
+0x6c,0x64,0x2d,0x6c,0x65,0x66,0x74,0x5d,
+0x20,0x66,0x6f,0x6c,0x64,0x2d,0x6c,0x65,
+0x66,0x74,0x29,0x20,0x66,0x6f,0x6c,0x64,
+0x2d,0x70,0x72,0x6f,0x63,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x33,0x63,0x30,0x71,0x5d,0x33,0x31,0x7d,
 0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
 0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
 0x31,0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x3f,0x36,0x34,0x30,0x7c,0x3b,0x7c,0x4d,
-0x3f,0x36,0x37,0x30,0x7c,0x4d,0x35,0x3c,
-0x30,0x69,0x34,0x3a,0x7c,0x4d,0x69,0x33,
-0x31,0x33,0x32,0x7e,0x7c,0x4e,0x33,0x31,
-0x4b,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,
-0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x61,0x73,0x73,0x71,0x29,0x5d,
-0x29,0x5d,0x20,0x65,0x78,0x70,0x61,0x6e,
-0x64,0x2d,0x69,0x6e,0x29,0x5d,0x29,0x5d,
-0x20,0x65,0x78,0x70,0x61,0x6e,0x64,0x29,
-0x20,0x65,0x78,0x70,0x61,0x6e,0x64,0x2d,
-0x64,0x65,0x66,0x69,0x6e,0x65,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3d,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x7c,0x5c,0x78,0x38,
-0x34,0x65,0x31,0x7c,0x33,0x31,0x46,0x36,
-0x3a,0x30,0x65,0x31,0x7c,0x33,0x31,0x35,
-0x4c,0x30,0x7c,0x5c,0x78,0x38,0x34,0x43,
-0x36,0x3b,0x30,0x65,0x32,0x33,0x30,0x4c,
-0x31,0x35,0x3d,0x30,0x65,0x33,0x63,0x34,
-0x65,0x35,0x7c,0x33,0x31,0x33,0x32,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3c,0x30,0x30,0x30,0x72,0x32,
-0x7c,0x43,0x36,0x3a,0x30,0x63,0x30,0x7c,
-0x7d,0x4d,0x4c,0x33,0x3b,0x63,0x30,0x7c,
-0x4d,0x63,0x31,0x63,0x32,0x4c,0x31,0x7c,
-0x4e,0x4c,0x31,0x63,0x33,0x7d,0x33,0x31,
-0x7c,0x4d,0x33,0x34,0x4c,0x33,0x3b,0x22,
-0x20,0x5b,0x73,0x65,0x74,0x21,0x20,0x23,
-0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,
-0x29,0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,
-0x20,0x23,0x66,0x6e,0x28,0x63,0x6f,0x70,
-0x79,0x2d,0x6c,0x69,0x73,0x74,0x29,0x5d,
-0x29,0x20,0x63,0x64,0x64,0x72,0x20,0x76,
-0x6f,0x69,0x64,0x20,0x65,0x72,0x72,0x6f,
-0x72,0x20,0x22,0x63,0x6f,0x6d,0x70,0x69,
-0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,
-0x3a,0x20,0x69,0x6e,0x76,0x61,0x6c,0x69,
-0x64,0x20,0x73,0x79,0x6e,0x74,0x61,0x78,
-0x20,0x22,0x20,0x77,0x72,0x69,0x74,0x65,
-0x2d,0x74,0x6f,0x2d,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x5d,0x20,0x65,0x78,0x70,0x61,
-0x6e,0x64,0x2d,0x64,0x65,0x66,0x69,0x6e,
-0x65,0x29,0x20,0x66,0x67,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x62,0x4e,0x7c,0x77,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x66,0x67,0x29,0x20,0x66,
-0x69,0x6c,0x74,0x65,0x72,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x6d,0x30,0x32,0x7c,0x7e,0x5c,0x78,
-0x37,0x66,0x5f,0x4c,0x31,0x34,0x33,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x33,0x67,0x32,
-0x5d,0x7d,0x46,0x36,0x53,0x30,0x32,0x69,
-0x31,0x30,0x7d,0x4d,0x33,0x31,0x36,0x3f,
-0x30,0x67,0x32,0x7d,0x4d,0x5f,0x4b,0x50,
-0x4e,0x6d,0x32,0x35,0x33,0x30,0x5d,0x32,
-0x7d,0x4e,0x6d,0x31,0x35,0x5c,0x66,0x2f,
-0x32,0x4e,0x3b,0x22,0x20,0x5b,0x5d,0x20,
-0x66,0x69,0x6c,0x74,0x65,0x72,0x2d,0x29,
-0x5d,0x29,0x5d,0x20,0x66,0x69,0x6c,0x74,
-0x65,0x72,0x29,0x20,0x66,0x69,0x6e,0x69,
-0x74,0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x63,0x30,0x58,0x31,0x36,0x3a,0x30,0x32,
-0x65,0x31,0x7c,0x63,0x32,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x2b,0x69,0x6e,0x66,0x2e,
-0x30,0x20,0x3e,0x20,0x2d,0x69,0x6e,0x66,
-0x2e,0x30,0x5d,0x20,0x66,0x69,0x6e,0x69,
-0x74,0x65,0x3f,0x29,0x20,0x66,0x69,0x74,
-0x73,0x2d,0x69,0x38,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x49,0x31,0x36,0x46,0x30,0x32,0x65,
-0x30,0x7c,0x62,0x5c,0x78,0x62,0x30,0x33,
-0x32,0x31,0x36,0x3a,0x30,0x32,0x65,0x31,
-0x7c,0x62,0x5c,0x78,0x61,0x66,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x3e,0x3d,0x20,0x3c,
-0x3d,0x5d,0x20,0x66,0x69,0x74,0x73,0x2d,
-0x69,0x38,0x29,0x20,0x66,0x6c,0x6f,0x6e,
-0x75,0x6d,0x3f,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x65,
-0x30,0x7c,0x33,0x31,0x40,0x3b,0x22,0x20,
-0x5b,0x65,0x78,0x61,0x63,0x74,0x3f,0x5d,
-0x20,0x66,0x6c,0x6f,0x6e,0x75,0x6d,0x3f,
-0x29,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x60,0x58,0x36,0x3b,
-0x30,0x63,0x30,0x7c,0x63,0x31,0x78,0x34,
-0x31,0x3b,0x63,0x30,0x7c,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x74,
-0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x29,
-0x20,0x30,0x2e,0x35,0x5d,0x20,0x66,0x6c,
-0x6f,0x6f,0x72,0x29,0x20,0x66,0x6f,0x6c,
-0x64,0x2d,0x6c,0x65,0x66,0x74,0x20,0x23,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x69,0x31,0x32,0x33,0x30,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x7c,0x33,0x31,0x36,0x34,0x30,
+0x7e,0x3b,0x69,0x31,0x30,0x69,0x32,0x30,
+0x7c,0x7e,0x33,0x32,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x65,0x6f,
+0x66,0x2d,0x6f,0x62,0x6a,0x65,0x63,0x74,
+0x3f,0x29,0x5d,0x29,0x5d,0x29,0x5d,0x29,
+0x5d,0x20,0x66,0x6f,0x6c,0x64,0x2d,0x70,
+0x72,0x6f,0x63,0x29,0x20,0x66,0x6f,0x6c,
+0x64,0x2d,0x72,0x69,0x67,0x68,0x74,0x20,
+0x23,0x34,0x3d,0x23,0x66,0x6e,0x28,0x22,
+0x3b,0x30,0x30,0x30,0x72,0x33,0x67,0x32,
+0x5c,0x78,0x38,0x35,0x34,0x30,0x7d,0x3b,
+0x7c,0x67,0x32,0x4d,0x65,0x30,0x7c,0x7d,
+0x67,0x32,0x4e,0x33,0x33,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x66,0x6f,0x6c,0x64,0x72,
+0x5d,0x20,0x66,0x6f,0x6c,0x64,0x72,0x29,
+0x20,0x66,0x6f,0x6c,0x64,0x6c,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
 0x72,0x33,0x67,0x32,0x5c,0x78,0x38,0x35,
 0x34,0x30,0x7d,0x3b,0x65,0x30,0x7c,0x7c,
-0x7d,0x67,0x32,0x4d,0x33,0x32,0x67,0x32,
+0x67,0x32,0x4d,0x7d,0x33,0x32,0x67,0x32,
 0x4e,0x34,0x33,0x3b,0x22,0x20,0x5b,0x66,
-0x6f,0x6c,0x64,0x2d,0x6c,0x65,0x66,0x74,
-0x5d,0x20,0x66,0x6f,0x6c,0x64,0x2d,0x6c,
-0x65,0x66,0x74,0x29,0x20,0x66,0x6f,0x6c,
-0x64,0x2d,0x70,0x72,0x6f,0x63,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x33,0x63,0x30,0x71,0x5d,0x33,0x31,
-0x7d,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
-0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x69,0x31,0x32,0x33,0x30,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7c,0x33,0x31,0x36,0x34,
-0x30,0x7e,0x3b,0x69,0x31,0x30,0x69,0x32,
-0x30,0x7c,0x7e,0x33,0x32,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x65,
-0x6f,0x66,0x2d,0x6f,0x62,0x6a,0x65,0x63,
-0x74,0x3f,0x29,0x5d,0x29,0x5d,0x29,0x5d,
-0x29,0x5d,0x20,0x66,0x6f,0x6c,0x64,0x2d,
-0x70,0x72,0x6f,0x63,0x29,0x20,0x66,0x6f,
-0x6c,0x64,0x2d,0x72,0x69,0x67,0x68,0x74,
-0x20,0x23,0x34,0x3d,0x23,0x66,0x6e,0x28,
-0x22,0x3b,0x30,0x30,0x30,0x72,0x33,0x67,
-0x32,0x5c,0x78,0x38,0x35,0x34,0x30,0x7d,
-0x3b,0x7c,0x67,0x32,0x4d,0x65,0x30,0x7c,
-0x7d,0x67,0x32,0x4e,0x33,0x33,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x66,0x6f,0x6c,0x64,
-0x72,0x5d,0x20,0x66,0x6f,0x6c,0x64,0x72,
-0x29,0x20,0x66,0x6f,0x6c,0x64,0x6c,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
-0x30,0x72,0x33,0x67,0x32,0x5c,0x78,0x38,
-0x35,0x34,0x30,0x7d,0x3b,0x65,0x30,0x7c,
-0x7c,0x67,0x32,0x4d,0x7d,0x33,0x32,0x67,
-0x32,0x4e,0x34,0x33,0x3b,0x22,0x20,0x5b,
-0x66,0x6f,0x6c,0x64,0x6c,0x5d,0x20,0x66,
-0x6f,0x6c,0x64,0x6c,0x29,0x20,0x66,0x6f,
-0x6c,0x64,0x72,0x20,0x23,0x34,0x23,0x20,
-0x66,0x6f,0x72,0x2d,0x61,0x6c,0x6c,0x20,
-0x23,0x35,0x23,0x20,0x66,0x6f,0x72,0x2d,
-0x65,0x61,0x63,0x68,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3b,0x30,0x30,0x30,0x73,0x32,
-0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x6d,0x30,0x32,0x69,0x30,0x32,0x5c,0x78,
-0x38,0x35,0x4a,0x30,0x5d,0x5c,0x78,0x37,
-0x66,0x46,0x36,0x41,0x30,0x32,0x7e,0x5c,
-0x78,0x37,0x66,0x4d,0x33,0x31,0x32,0x5c,
-0x78,0x37,0x66,0x4e,0x6f,0x30,0x31,0x35,
-0x5c,0x78,0x31,0x65,0x2f,0x35,0x3b,0x30,
-0x7c,0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,
-0x32,0x4b,0x33,0x32,0x32,0x5d,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x32,0x7d,0x4d,0x46,
-0x36,0x49,0x30,0x7c,0x63,0x30,0x63,0x31,
-0x7d,0x33,0x32,0x51,0x32,0x32,0x7e,0x7c,
-0x63,0x30,0x63,0x32,0x7d,0x33,0x32,0x34,
-0x32,0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
-0x23,0x2e,0x63,0x61,0x72,0x20,0x23,0x2e,
-0x63,0x64,0x72,0x5d,0x20,0x66,0x6f,0x72,
-0x2d,0x65,0x61,0x63,0x68,0x2d,0x6e,0x29,
-0x5d,0x29,0x5d,0x20,0x66,0x6f,0x72,0x2d,
-0x65,0x61,0x63,0x68,0x29,0x20,0x67,0x65,
-0x74,0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,
-0x64,0x2d,0x76,0x61,0x72,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x7e,0x7c,0x33,0x31,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x64,0x65,
-0x6c,0x65,0x74,0x65,0x2d,0x64,0x75,0x70,
-0x6c,0x69,0x63,0x61,0x74,0x65,0x73,0x5d,
-0x20,0x23,0x36,0x3d,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x3f,0x36,0x34,0x30,0x5f,0x3b,0x7c,
-0x4d,0x63,0x30,0x3c,0x31,0x36,0x36,0x30,
-0x32,0x7c,0x4e,0x46,0x36,0x64,0x30,0x7c,
-0x5c,0x78,0x38,0x34,0x43,0x31,0x36,0x37,
-0x30,0x32,0x7c,0x5c,0x78,0x38,0x34,0x4c,
-0x31,0x31,0x37,0x53,0x30,0x32,0x7c,0x5c,
-0x78,0x38,0x34,0x46,0x31,0x36,0x45,0x30,
-0x32,0x65,0x31,0x7c,0x33,0x31,0x43,0x31,
-0x36,0x3a,0x30,0x32,0x65,0x31,0x7c,0x33,
-0x31,0x4c,0x31,0x31,0x37,0x34,0x30,0x32,
-0x5f,0x3b,0x7c,0x4d,0x63,0x32,0x5c,0x78,
-0x38,0x32,0x3e,0x30,0x63,0x33,0x63,0x34,
-0x7e,0x7c,0x4e,0x33,0x32,0x76,0x32,0x3b,
-0x5f,0x3b,0x22,0x20,0x5b,0x64,0x65,0x66,
-0x69,0x6e,0x65,0x20,0x63,0x61,0x61,0x64,
-0x72,0x20,0x62,0x65,0x67,0x69,0x6e,0x20,
-0x23,0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,
-0x63,0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,
-0x61,0x70,0x29,0x5d,0x20,0x23,0x36,0x23,
-0x29,0x20,0x28,0x29,0x5d,0x29,0x20,0x67,
-0x65,0x74,0x2d,0x6f,0x75,0x74,0x70,0x75,
-0x74,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
-0x31,0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7e,
-0x60,0x33,0x32,0x32,0x63,0x31,0x71,0x65,
-0x32,0x7e,0x33,0x31,0x34,0x31,0x3b,0x22,
+0x6f,0x6c,0x64,0x6c,0x5d,0x20,0x66,0x6f,
+0x6c,0x64,0x6c,0x29,0x20,0x66,0x6f,0x6c,
+0x64,0x72,0x20,0x23,0x34,0x23,0x20,0x66,
+0x6f,0x72,0x2d,0x61,0x6c,0x6c,0x20,0x23,
+0x35,0x23,0x20,0x66,0x6f,0x72,0x2d,0x65,
+0x61,0x63,0x68,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3b,0x30,0x30,0x30,0x73,0x32,0x63,
+0x30,0x71,0x5d,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x6d,
+0x30,0x32,0x69,0x30,0x32,0x5c,0x78,0x38,
+0x35,0x4a,0x30,0x5d,0x5c,0x78,0x37,0x66,
+0x46,0x36,0x41,0x30,0x32,0x7e,0x5c,0x78,
+0x37,0x66,0x4d,0x33,0x31,0x32,0x5c,0x78,
+0x37,0x66,0x4e,0x6f,0x30,0x31,0x35,0x5c,
+0x78,0x31,0x65,0x2f,0x35,0x3b,0x30,0x7c,
+0x7e,0x5c,0x78,0x37,0x66,0x69,0x30,0x32,
+0x4b,0x33,0x32,0x32,0x5d,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x32,0x7d,0x4d,0x46,0x36,
+0x49,0x30,0x7c,0x63,0x30,0x63,0x31,0x7d,
+0x33,0x32,0x51,0x32,0x32,0x7e,0x7c,0x63,
+0x30,0x63,0x32,0x7d,0x33,0x32,0x34,0x32,
+0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,0x23,
+0x2e,0x63,0x61,0x72,0x20,0x23,0x2e,0x63,
+0x64,0x72,0x5d,0x20,0x66,0x6f,0x72,0x2d,
+0x65,0x61,0x63,0x68,0x2d,0x6e,0x29,0x5d,
+0x29,0x5d,0x20,0x66,0x6f,0x72,0x2d,0x65,
+0x61,0x63,0x68,0x29,0x20,0x67,0x65,0x74,
+0x2d,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,
+0x2d,0x76,0x61,0x72,0x73,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x7e,0x7c,0x33,0x31,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x64,0x65,0x6c,
+0x65,0x74,0x65,0x2d,0x64,0x75,0x70,0x6c,
+0x69,0x63,0x61,0x74,0x65,0x73,0x5d,0x20,
+0x23,0x36,0x3d,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x3f,0x36,0x34,0x30,0x5f,0x3b,0x7c,0x4d,
+0x63,0x30,0x3c,0x31,0x36,0x36,0x30,0x32,
+0x7c,0x4e,0x46,0x36,0x64,0x30,0x7c,0x5c,
+0x78,0x38,0x34,0x43,0x31,0x36,0x37,0x30,
+0x32,0x7c,0x5c,0x78,0x38,0x34,0x4c,0x31,
+0x31,0x37,0x53,0x30,0x32,0x7c,0x5c,0x78,
+0x38,0x34,0x46,0x31,0x36,0x45,0x30,0x32,
+0x65,0x31,0x7c,0x33,0x31,0x43,0x31,0x36,
+0x3a,0x30,0x32,0x65,0x31,0x7c,0x33,0x31,
+0x4c,0x31,0x31,0x37,0x34,0x30,0x32,0x5f,
+0x3b,0x7c,0x4d,0x63,0x32,0x5c,0x78,0x38,
+0x32,0x3e,0x30,0x63,0x33,0x63,0x34,0x7e,
+0x7c,0x4e,0x33,0x32,0x76,0x32,0x3b,0x5f,
+0x3b,0x22,0x20,0x5b,0x64,0x65,0x66,0x69,
+0x6e,0x65,0x20,0x63,0x61,0x61,0x64,0x72,
+0x20,0x62,0x65,0x67,0x69,0x6e,0x20,0x23,
+0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,0x61,
+0x70,0x29,0x5d,0x20,0x23,0x36,0x23,0x29,
+0x20,0x28,0x29,0x5d,0x29,0x20,0x67,0x65,
+0x74,0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,
+0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x71,0x63,0x31,
+0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x7e,0x60,
+0x33,0x32,0x32,0x63,0x31,0x71,0x65,0x32,
+0x7e,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x73,0x65,0x65,0x6b,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x69,0x31,0x30,0x7e,0x33,
+0x32,0x32,0x63,0x31,0x7c,0x33,0x31,0x36,
+0x35,0x30,0x63,0x32,0x3b,0x7c,0x3b,0x22,
 0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
 0x2e,0x73,0x65,0x65,0x6b,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x69,0x31,0x30,0x7e,
-0x33,0x32,0x32,0x63,0x31,0x7c,0x33,0x31,
-0x36,0x35,0x30,0x63,0x32,0x3b,0x7c,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x73,0x65,0x65,0x6b,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x65,0x6f,0x66,0x2d,
-0x6f,0x62,0x6a,0x65,0x63,0x74,0x3f,0x29,
-0x20,0x22,0x22,0x5d,0x29,0x20,0x69,0x6f,
-0x2e,0x72,0x65,0x61,0x64,0x61,0x6c,0x6c,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x70,0x6f,0x73,0x29,0x5d,0x20,
-0x67,0x65,0x74,0x2d,0x6f,0x75,0x74,0x70,
-0x75,0x74,0x2d,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x29,0x20,0x67,0x65,0x74,0x70,0x72,
-0x6f,0x70,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
-0x71,0x63,0x31,0x7e,0x7c,0x5e,0x33,0x33,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x31,0x36,0x3a,0x30,0x32,0x63,
-0x30,0x7c,0x5c,0x78,0x37,0x66,0x5e,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x67,0x65,0x74,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x67,0x65,0x74,0x29,
-0x5d,0x20,0x23,0x39,0x3d,0x5b,0x23,0x74,
-0x61,0x62,0x6c,0x65,0x28,0x29,0x20,0x28,
-0x29,0x5d,0x29,0x20,0x67,0x72,0x65,0x65,
-0x6e,0x20,0x32,0x20,0x68,0x65,0x78,0x35,
+0x66,0x6e,0x28,0x65,0x6f,0x66,0x2d,0x6f,
+0x62,0x6a,0x65,0x63,0x74,0x3f,0x29,0x20,
+0x22,0x22,0x5d,0x29,0x20,0x69,0x6f,0x2e,
+0x72,0x65,0x61,0x64,0x61,0x6c,0x6c,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,
+0x2e,0x70,0x6f,0x73,0x29,0x5d,0x20,0x67,
+0x65,0x74,0x2d,0x6f,0x75,0x74,0x70,0x75,
+0x74,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x29,0x20,0x67,0x65,0x74,0x70,0x72,0x6f,
+0x70,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x32,0x63,0x30,0x71,
+0x63,0x31,0x7e,0x7c,0x5e,0x33,0x33,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x31,0x36,0x3a,0x30,0x32,0x63,0x30,
+0x7c,0x5c,0x78,0x37,0x66,0x5e,0x34,0x33,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x67,0x65,0x74,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x67,0x65,0x74,0x29,0x5d,
+0x20,0x23,0x39,0x3d,0x5b,0x23,0x74,0x61,
+0x62,0x6c,0x65,0x28,0x29,0x20,0x28,0x29,
+0x5d,0x29,0x20,0x67,0x72,0x65,0x65,0x6e,
+0x20,0x32,0x20,0x68,0x65,0x78,0x35,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x31,0x65,0x30,0x63,0x31,0x7c,
+0x62,0x40,0x33,0x32,0x62,0x35,0x63,0x32,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x2e,0x6c,0x70,0x61,
+0x64,0x20,0x23,0x66,0x6e,0x28,0x6e,0x75,
+0x6d,0x62,0x65,0x72,0x2d,0x3e,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x29,0x20,0x23,0x5c,
+0x30,0x5d,0x20,0x68,0x65,0x78,0x35,0x29,
+0x20,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
+0x20,0x28,0x29,0x20,0x68,0x69,0x73,0x74,
+0x6f,0x72,0x79,0x2d,0x65,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x5c,
+0x78,0x38,0x39,0x30,0x30,0x30,0x30,0x31,
+0x30,0x30,0x30,0x5c,0x78,0x38,0x61,0x30,
+0x30,0x30,0x30,0x37,0x36,0x30,0x5e,0x6d,
+0x30,0x32,0x5e,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
+0x2d,0x65,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x29,0x20,0x68,0x69,0x73,0x74,
+0x6f,0x72,0x79,0x2d,0x66,0x6f,0x72,0x6d,
 0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x31,0x65,0x30,0x63,0x31,
-0x7c,0x62,0x40,0x33,0x32,0x62,0x35,0x63,
-0x32,0x34,0x33,0x3b,0x22,0x20,0x5b,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2e,0x6c,0x70,
-0x61,0x64,0x20,0x23,0x66,0x6e,0x28,0x6e,
-0x75,0x6d,0x62,0x65,0x72,0x2d,0x3e,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x29,0x20,0x23,
-0x5c,0x30,0x5d,0x20,0x68,0x65,0x78,0x35,
-0x29,0x20,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x20,0x28,0x29,0x20,0x68,0x69,0x73,
-0x74,0x6f,0x72,0x79,0x2d,0x65,0x78,0x63,
-0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x5c,0x78,0x38,0x39,0x30,0x30,0x30,0x30,
-0x31,0x30,0x30,0x30,0x5c,0x78,0x38,0x61,
-0x30,0x30,0x30,0x30,0x37,0x36,0x30,0x5e,
-0x6d,0x30,0x32,0x5e,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x2d,0x65,0x78,0x63,0x65,0x70,0x74,
-0x69,0x6f,0x6e,0x29,0x20,0x68,0x69,0x73,
-0x74,0x6f,0x72,0x79,0x2d,0x66,0x6f,0x72,
-0x6d,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x5c,0x78,0x38,0x39,0x30,
-0x30,0x30,0x30,0x31,0x30,0x30,0x30,0x5c,
-0x78,0x38,0x61,0x30,0x30,0x30,0x30,0x37,
-0x36,0x30,0x5e,0x6d,0x30,0x32,0x65,0x30,
-0x7c,0x63,0x31,0x34,0x32,0x3b,0x22,0x20,
+0x30,0x30,0x5c,0x78,0x38,0x39,0x30,0x30,
+0x30,0x30,0x31,0x30,0x30,0x30,0x5c,0x78,
+0x38,0x61,0x30,0x30,0x30,0x30,0x37,0x36,
+0x30,0x5e,0x6d,0x30,0x32,0x65,0x30,0x7c,
+0x63,0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x68,0x69,0x73,0x74,0x6f,0x72,0x79,0x2d,
+0x67,0x65,0x74,0x20,0x23,0x2e,0x63,0x61,
+0x72,0x5d,0x20,0x68,0x69,0x73,0x74,0x6f,
+0x72,0x79,0x2d,0x66,0x6f,0x72,0x6d,0x29,
+0x20,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
+0x2d,0x67,0x65,0x74,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x32,
+0x7c,0x46,0x36,0x37,0x30,0x7d,0x7c,0x34,
+0x31,0x3b,0x5e,0x7c,0x3d,0x36,0x39,0x30,
+0x65,0x30,0x60,0x7d,0x34,0x32,0x3b,0x63,
+0x31,0x7c,0x33,0x31,0x31,0x36,0x46,0x30,
+0x32,0x65,0x32,0x7c,0x60,0x33,0x32,0x31,
+0x36,0x3b,0x30,0x32,0x7c,0x63,0x33,0x65,
+0x34,0x33,0x31,0x58,0x36,0x3f,0x30,0x65,
+0x30,0x65,0x35,0x65,0x34,0x7c,0x33,0x32,
+0x7d,0x34,0x32,0x3b,0x5e,0x3b,0x22,0x20,
 0x5b,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
-0x2d,0x67,0x65,0x74,0x20,0x23,0x2e,0x63,
-0x61,0x72,0x5d,0x20,0x68,0x69,0x73,0x74,
-0x6f,0x72,0x79,0x2d,0x66,0x6f,0x72,0x6d,
-0x29,0x20,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x2d,0x67,0x65,0x74,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x32,0x7c,0x46,0x36,0x37,0x30,0x7d,0x7c,
-0x34,0x31,0x3b,0x5e,0x7c,0x3d,0x36,0x39,
-0x30,0x65,0x30,0x60,0x7d,0x34,0x32,0x3b,
-0x63,0x31,0x7c,0x33,0x31,0x31,0x36,0x46,
-0x30,0x32,0x65,0x32,0x7c,0x60,0x33,0x32,
-0x31,0x36,0x3b,0x30,0x32,0x7c,0x63,0x33,
-0x65,0x34,0x33,0x31,0x58,0x36,0x3f,0x30,
-0x65,0x30,0x65,0x35,0x65,0x34,0x7c,0x33,
-0x32,0x7d,0x34,0x32,0x3b,0x5e,0x3b,0x22,
-0x20,0x5b,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x2d,0x67,0x65,0x74,0x20,0x23,0x66,
-0x6e,0x28,0x69,0x6e,0x74,0x65,0x67,0x65,
-0x72,0x3f,0x29,0x20,0x3e,0x3d,0x20,0x23,
-0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
-0x68,0x29,0x20,0x68,0x69,0x73,0x74,0x6f,
-0x72,0x79,0x20,0x6c,0x69,0x73,0x74,0x2d,
-0x72,0x65,0x66,0x5d,0x20,0x68,0x69,0x73,
-0x74,0x6f,0x72,0x79,0x2d,0x67,0x65,0x74,
+0x2d,0x67,0x65,0x74,0x20,0x23,0x66,0x6e,
+0x28,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x3f,0x29,0x20,0x3e,0x3d,0x20,0x23,0x66,
+0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,
 0x29,0x20,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x2d,0x70,0x75,0x73,0x68,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x32,0x7c,0x7d,0x4b,0x65,0x30,0x4b,
-0x6b,0x30,0x3b,0x22,0x20,0x5b,0x68,0x69,
-0x73,0x74,0x6f,0x72,0x79,0x5d,0x20,0x68,
-0x69,0x73,0x74,0x6f,0x72,0x79,0x2d,0x70,
-0x75,0x73,0x68,0x29,0x20,0x68,0x69,0x73,
-0x74,0x6f,0x72,0x79,0x2d,0x76,0x61,0x6c,
-0x75,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x5c,0x78,0x38,0x39,
-0x30,0x30,0x30,0x30,0x31,0x30,0x30,0x30,
-0x5c,0x78,0x38,0x61,0x30,0x30,0x30,0x30,
-0x37,0x36,0x30,0x5e,0x6d,0x30,0x32,0x65,
-0x30,0x7c,0x65,0x31,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x2d,0x67,0x65,0x74,0x20,0x63,0x61,
-0x64,0x72,0x5d,0x20,0x68,0x69,0x73,0x74,
+0x79,0x20,0x6c,0x69,0x73,0x74,0x2d,0x72,
+0x65,0x66,0x5d,0x20,0x68,0x69,0x73,0x74,
+0x6f,0x72,0x79,0x2d,0x67,0x65,0x74,0x29,
+0x20,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
+0x2d,0x70,0x75,0x73,0x68,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x32,0x7c,0x7d,0x4b,0x65,0x30,0x4b,0x6b,
+0x30,0x3b,0x22,0x20,0x5b,0x68,0x69,0x73,
+0x74,0x6f,0x72,0x79,0x5d,0x20,0x68,0x69,
+0x73,0x74,0x6f,0x72,0x79,0x2d,0x70,0x75,
+0x73,0x68,0x29,0x20,0x68,0x69,0x73,0x74,
 0x6f,0x72,0x79,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x29,0x20,0x68,0x69,0x73,0x74,0x6f,
-0x72,0x79,0x2d,0x76,0x61,0x6c,0x75,0x65,
-0x73,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
 0x30,0x30,0x30,0x5c,0x78,0x38,0x39,0x30,
 0x30,0x30,0x30,0x31,0x30,0x30,0x30,0x5c,
 0x78,0x38,0x61,0x30,0x30,0x30,0x30,0x37,
 0x36,0x30,0x5e,0x6d,0x30,0x32,0x65,0x30,
-0x7c,0x63,0x31,0x34,0x32,0x3b,0x22,0x20,
+0x7c,0x65,0x31,0x34,0x32,0x3b,0x22,0x20,
 0x5b,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
-0x2d,0x67,0x65,0x74,0x20,0x23,0x2e,0x63,
-0x64,0x72,0x5d,0x20,0x68,0x69,0x73,0x74,
-0x6f,0x72,0x79,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x73,0x29,0x20,0x69,0x64,0x65,0x6e,
-0x74,0x69,0x74,0x79,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x69,
-0x64,0x65,0x6e,0x74,0x69,0x74,0x79,0x29,
-0x20,0x69,0x6e,0x2d,0x65,0x6e,0x76,0x3f,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x32,0x7d,0x46,0x31,0x36,
-0x46,0x30,0x32,0x63,0x30,0x7c,0x7d,0x4d,
-0x33,0x32,0x31,0x37,0x3a,0x30,0x32,0x65,
-0x31,0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x6d,0x65,
-0x6d,0x71,0x29,0x20,0x69,0x6e,0x2d,0x65,
-0x6e,0x76,0x3f,0x5d,0x20,0x69,0x6e,0x2d,
-0x65,0x6e,0x76,0x3f,0x29,0x20,0x69,0x6e,
-0x63,0x6c,0x75,0x64,0x65,0x20,0x23,0x66,
+0x2d,0x67,0x65,0x74,0x20,0x63,0x61,0x64,
+0x72,0x5d,0x20,0x68,0x69,0x73,0x74,0x6f,
+0x72,0x79,0x2d,0x76,0x61,0x6c,0x75,0x65,
+0x29,0x20,0x68,0x69,0x73,0x74,0x6f,0x72,
+0x79,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x5c,0x78,0x38,0x39,0x30,0x30,
+0x30,0x30,0x31,0x30,0x30,0x30,0x5c,0x78,
+0x38,0x61,0x30,0x30,0x30,0x30,0x37,0x36,
+0x30,0x5e,0x6d,0x30,0x32,0x65,0x30,0x7c,
+0x63,0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x68,0x69,0x73,0x74,0x6f,0x72,0x79,0x2d,
+0x67,0x65,0x74,0x20,0x23,0x2e,0x63,0x64,
+0x72,0x5d,0x20,0x68,0x69,0x73,0x74,0x6f,
+0x72,0x79,0x2d,0x76,0x61,0x6c,0x75,0x65,
+0x73,0x29,0x20,0x69,0x64,0x65,0x6e,0x74,
+0x69,0x74,0x79,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x69,0x64,
+0x65,0x6e,0x74,0x69,0x74,0x79,0x29,0x20,
+0x69,0x6e,0x2d,0x65,0x6e,0x76,0x3f,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x32,0x7d,0x46,0x31,0x36,0x46,
+0x30,0x32,0x63,0x30,0x7c,0x7d,0x4d,0x33,
+0x32,0x31,0x37,0x3a,0x30,0x32,0x65,0x31,
+0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x6d,0x65,0x6d,
+0x71,0x29,0x20,0x69,0x6e,0x2d,0x65,0x6e,
+0x76,0x3f,0x5d,0x20,0x69,0x6e,0x2d,0x65,
+0x6e,0x76,0x3f,0x29,0x20,0x69,0x6e,0x63,
+0x6c,0x75,0x64,0x65,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x65,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x6c,0x6f,0x61,0x64,0x5d,0x20,0x69,
+0x6e,0x63,0x6c,0x75,0x64,0x65,0x29,0x20,
+0x69,0x6e,0x64,0x65,0x78,0x2d,0x6f,0x66,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x33,0x7d,0x5c,0x78,0x38,
+0x35,0x34,0x30,0x5e,0x3b,0x7c,0x7d,0x4d,
+0x5c,0x78,0x38,0x32,0x35,0x30,0x67,0x32,
+0x3b,0x65,0x30,0x7c,0x7d,0x4e,0x67,0x32,
+0x61,0x77,0x34,0x33,0x3b,0x22,0x20,0x5b,
+0x69,0x6e,0x64,0x65,0x78,0x2d,0x6f,0x66,
+0x5d,0x20,0x69,0x6e,0x64,0x65,0x78,0x2d,
+0x6f,0x66,0x29,0x20,0x69,0x6e,0x65,0x78,
+0x61,0x63,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x3b,0x22,0x20,0x5b,0x5d,0x20,0x69,0x6e,
+0x65,0x78,0x61,0x63,0x74,0x29,0x20,0x69,
+0x6e,0x65,0x78,0x61,0x63,0x74,0x2d,0x3e,
+0x65,0x78,0x61,0x63,0x74,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x65,0x30,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x6c,0x6f,0x61,0x64,0x5d,0x20,
-0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x29,
-0x20,0x69,0x6e,0x64,0x65,0x78,0x2d,0x6f,
-0x66,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x33,0x7d,0x5c,0x78,
-0x38,0x35,0x34,0x30,0x5e,0x3b,0x7c,0x7d,
-0x4d,0x5c,0x78,0x38,0x32,0x35,0x30,0x67,
-0x32,0x3b,0x65,0x30,0x7c,0x7d,0x4e,0x67,
-0x32,0x61,0x77,0x34,0x33,0x3b,0x22,0x20,
-0x5b,0x69,0x6e,0x64,0x65,0x78,0x2d,0x6f,
-0x66,0x5d,0x20,0x69,0x6e,0x64,0x65,0x78,
-0x2d,0x6f,0x66,0x29,0x20,0x69,0x6e,0x65,
-0x78,0x61,0x63,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x69,
-0x6e,0x65,0x78,0x61,0x63,0x74,0x29,0x20,
-0x69,0x6e,0x65,0x78,0x61,0x63,0x74,0x2d,
-0x3e,0x65,0x78,0x61,0x63,0x74,0x20,0x23,
+0x31,0x63,0x30,0x7c,0x33,0x31,0x36,0x38,
+0x30,0x63,0x31,0x7c,0x34,0x31,0x3b,0x65,
+0x32,0x63,0x33,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6e,0x74,
+0x65,0x67,0x65,0x72,0x2d,0x76,0x61,0x6c,
+0x75,0x65,0x64,0x3f,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x74,0x72,0x75,0x6e,0x63,0x61,
+0x74,0x65,0x29,0x20,0x65,0x72,0x72,0x6f,
+0x72,0x20,0x22,0x65,0x78,0x61,0x63,0x74,
+0x20,0x72,0x65,0x61,0x6c,0x20,0x6e,0x75,
+0x6d,0x62,0x65,0x72,0x73,0x20,0x6e,0x6f,
+0x74,0x20,0x73,0x75,0x70,0x70,0x6f,0x72,
+0x74,0x65,0x64,0x22,0x5d,0x20,0x69,0x6e,
+0x65,0x78,0x61,0x63,0x74,0x2d,0x3e,0x65,
+0x78,0x61,0x63,0x74,0x29,0x20,0x69,0x6e,
+0x65,0x78,0x61,0x63,0x74,0x3f,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x7c,0x33,0x31,0x36,
-0x38,0x30,0x63,0x31,0x7c,0x34,0x31,0x3b,
-0x65,0x32,0x63,0x33,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6e,
-0x74,0x65,0x67,0x65,0x72,0x2d,0x76,0x61,
-0x6c,0x75,0x65,0x64,0x3f,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x74,0x72,0x75,0x6e,0x63,
-0x61,0x74,0x65,0x29,0x20,0x65,0x72,0x72,
-0x6f,0x72,0x20,0x22,0x65,0x78,0x61,0x63,
-0x74,0x20,0x72,0x65,0x61,0x6c,0x20,0x6e,
-0x75,0x6d,0x62,0x65,0x72,0x73,0x20,0x6e,
-0x6f,0x74,0x20,0x73,0x75,0x70,0x70,0x6f,
-0x72,0x74,0x65,0x64,0x22,0x5d,0x20,0x69,
-0x6e,0x65,0x78,0x61,0x63,0x74,0x2d,0x3e,
-0x65,0x78,0x61,0x63,0x74,0x29,0x20,0x69,
-0x6e,0x65,0x78,0x61,0x63,0x74,0x3f,0x20,
+0x72,0x31,0x65,0x30,0x7c,0x33,0x31,0x40,
+0x3b,0x22,0x20,0x5b,0x65,0x78,0x61,0x63,
+0x74,0x3f,0x5d,0x20,0x69,0x6e,0x65,0x78,
+0x61,0x63,0x74,0x3f,0x29,0x20,0x69,0x6e,
+0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x7c,0x33,0x31,
-0x40,0x3b,0x22,0x20,0x5b,0x65,0x78,0x61,
-0x63,0x74,0x3f,0x5d,0x20,0x69,0x6e,0x65,
-0x78,0x61,0x63,0x74,0x3f,0x29,0x20,0x69,
-0x6e,0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x63,0x30,0x3e,
-0x31,0x37,0x37,0x30,0x32,0x7c,0x63,0x31,
-0x3e,0x3b,0x22,0x20,0x5b,0x2b,0x69,0x6e,
-0x66,0x2e,0x30,0x20,0x2d,0x69,0x6e,0x66,
-0x2e,0x30,0x5d,0x20,0x69,0x6e,0x66,0x69,
-0x6e,0x69,0x74,0x65,0x3f,0x29,0x20,0x69,
-0x6e,0x70,0x75,0x74,0x2d,0x70,0x6f,0x72,
-0x74,0x2d,0x6c,0x69,0x6e,0x65,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x61,0x3b,0x22,0x20,0x5b,0x5d,
+0x30,0x72,0x31,0x7c,0x63,0x30,0x3e,0x31,
+0x37,0x37,0x30,0x32,0x7c,0x63,0x31,0x3e,
+0x3b,0x22,0x20,0x5b,0x2b,0x69,0x6e,0x66,
+0x2e,0x30,0x20,0x2d,0x69,0x6e,0x66,0x2e,
+0x30,0x5d,0x20,0x69,0x6e,0x66,0x69,0x6e,
+0x69,0x74,0x65,0x3f,0x29,0x20,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x70,0x6f,0x72,0x74,
+0x2d,0x6c,0x69,0x6e,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x61,0x3b,0x22,0x20,0x5b,0x5d,0x20,
+0x69,0x6e,0x70,0x75,0x74,0x2d,0x70,0x6f,
+0x72,0x74,0x2d,0x6c,0x69,0x6e,0x65,0x29,
 0x20,0x69,0x6e,0x70,0x75,0x74,0x2d,0x70,
-0x6f,0x72,0x74,0x2d,0x6c,0x69,0x6e,0x65,
-0x29,0x20,0x69,0x6e,0x70,0x75,0x74,0x2d,
-0x70,0x6f,0x72,0x74,0x3f,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x73,0x74,0x72,0x65,0x61,0x6d,0x3f,0x29,
-0x5d,0x20,0x69,0x6e,0x70,0x75,0x74,0x2d,
-0x70,0x6f,0x72,0x74,0x3f,0x29,0x20,0x69,
-0x6e,0x74,0x65,0x67,0x65,0x72,0x2d,0x3e,
-0x63,0x68,0x61,0x72,0x20,0x23,0x66,0x6e,
+0x6f,0x72,0x74,0x3f,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x65,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x77,0x63,0x68,0x61,0x72,0x5d,0x20,
-0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x2d,
-0x3e,0x63,0x68,0x61,0x72,0x29,0x20,0x69,
-0x6f,0x2e,0x72,0x65,0x61,0x64,0x61,0x6c,
-0x6c,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x63,0x31,0x33,0x30,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
-0x7e,0x33,0x32,0x32,0x63,0x31,0x71,0x63,
-0x32,0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x63,0x6f,0x70,0x79,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x63,0x30,0x3e,0x31,0x36,
-0x3a,0x30,0x32,0x63,0x31,0x69,0x31,0x30,
-0x33,0x31,0x36,0x37,0x30,0x63,0x32,0x34,
-0x30,0x3b,0x7c,0x3b,0x22,0x20,0x5b,0x22,
-0x22,0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x65,0x6f,0x66,0x3f,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x65,0x6f,0x66,0x2d,0x6f,
-0x62,0x6a,0x65,0x63,0x74,0x29,0x5d,0x29,
+0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x73,
+0x74,0x72,0x65,0x61,0x6d,0x3f,0x29,0x5d,
+0x20,0x69,0x6e,0x70,0x75,0x74,0x2d,0x70,
+0x6f,0x72,0x74,0x3f,0x29,0x20,0x69,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x2d,0x3e,0x63,
+0x68,0x61,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x77,0x63,0x68,0x61,0x72,0x5d,0x20,0x69,
+0x6e,0x74,0x65,0x67,0x65,0x72,0x2d,0x3e,
+0x63,0x68,0x61,0x72,0x29,0x20,0x69,0x6f,
+0x2e,0x72,0x65,0x61,0x64,0x61,0x6c,0x6c,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
+0x31,0x33,0x30,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x7e,
+0x33,0x32,0x32,0x63,0x31,0x71,0x63,0x32,
+0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x63,0x6f,0x70,0x79,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x63,0x30,0x3e,0x31,0x36,0x3a,
+0x30,0x32,0x63,0x31,0x69,0x31,0x30,0x33,
+0x31,0x36,0x37,0x30,0x63,0x32,0x34,0x30,
+0x3b,0x7c,0x3b,0x22,0x20,0x5b,0x22,0x22,
 0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x74,0x6f,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x21,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
-0x5d,0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,
-0x64,0x61,0x6c,0x6c,0x29,0x20,0x69,0x6f,
-0x2e,0x72,0x65,0x61,0x64,0x6c,0x69,0x6e,
-0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
-0x63,0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x72,
-0x65,0x61,0x64,0x75,0x6e,0x74,0x69,0x6c,
-0x29,0x20,0x23,0x5c,0x6e,0x65,0x77,0x6c,
+0x65,0x6f,0x66,0x3f,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x65,0x6f,0x66,0x2d,0x6f,0x62,
+0x6a,0x65,0x63,0x74,0x29,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x74,
+0x6f,0x73,0x74,0x72,0x69,0x6e,0x67,0x21,
+0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x5d,
+0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,0x64,
+0x61,0x6c,0x6c,0x29,0x20,0x69,0x6f,0x2e,
+0x72,0x65,0x61,0x64,0x6c,0x69,0x6e,0x65,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x63,
+0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x69,0x6f,0x2e,0x72,0x65,
+0x61,0x64,0x75,0x6e,0x74,0x69,0x6c,0x29,
+0x20,0x23,0x5c,0x6e,0x65,0x77,0x6c,0x69,
+0x6e,0x65,0x5d,0x20,0x69,0x6f,0x2e,0x72,
+0x65,0x61,0x64,0x6c,0x69,0x6e,0x65,0x29,
+0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,0x64,
+0x6c,0x69,0x6e,0x65,0x73,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x65,0x31,0x7c,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x72,0x65,0x61,0x64,
+0x2d,0x61,0x6c,0x6c,0x2d,0x6f,0x66,0x20,
+0x69,0x6f,0x2e,0x72,0x65,0x61,0x64,0x6c,
 0x69,0x6e,0x65,0x5d,0x20,0x69,0x6f,0x2e,
 0x72,0x65,0x61,0x64,0x6c,0x69,0x6e,0x65,
-0x29,0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,
-0x64,0x6c,0x69,0x6e,0x65,0x73,0x20,0x23,
+0x73,0x29,0x20,0x69,0x6f,0x2e,0x73,0x6b,
+0x69,0x70,0x77,0x73,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x71,0x63,0x31,0x7c,0x33,0x31,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x7c,0x33,0x31,0x40,0x31,
+0x36,0x38,0x30,0x32,0x65,0x31,0x7c,0x33,
+0x31,0x36,0x3e,0x30,0x63,0x32,0x7e,0x33,
+0x31,0x32,0x65,0x33,0x7e,0x34,0x31,0x3b,
+0x5d,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x65,0x6f,0x66,0x2d,0x6f,0x62,0x6a,
+0x65,0x63,0x74,0x3f,0x29,0x20,0x63,0x68,
+0x61,0x72,0x2d,0x77,0x68,0x69,0x74,0x65,
+0x73,0x70,0x61,0x63,0x65,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x69,0x6f,0x2e,0x67,0x65,
+0x74,0x63,0x29,0x20,0x69,0x6f,0x2e,0x73,
+0x6b,0x69,0x70,0x77,0x73,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x70,
+0x65,0x65,0x6b,0x63,0x29,0x5d,0x20,0x69,
+0x6f,0x2e,0x73,0x6b,0x69,0x70,0x77,0x73,
+0x29,0x20,0x69,0x6f,0x74,0x61,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
 0x72,0x31,0x65,0x30,0x65,0x31,0x7c,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x72,0x65,0x61,
-0x64,0x2d,0x61,0x6c,0x6c,0x2d,0x6f,0x66,
-0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,0x64,
-0x6c,0x69,0x6e,0x65,0x5d,0x20,0x69,0x6f,
-0x2e,0x72,0x65,0x61,0x64,0x6c,0x69,0x6e,
-0x65,0x73,0x29,0x20,0x69,0x6f,0x2e,0x73,
-0x6b,0x69,0x70,0x77,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x63,0x31,0x7c,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x7c,0x33,0x31,0x40,
-0x31,0x36,0x38,0x30,0x32,0x65,0x31,0x7c,
-0x33,0x31,0x36,0x3e,0x30,0x63,0x32,0x7e,
-0x33,0x31,0x32,0x65,0x33,0x7e,0x34,0x31,
-0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x65,0x6f,0x66,0x2d,0x6f,0x62,
-0x6a,0x65,0x63,0x74,0x3f,0x29,0x20,0x63,
-0x68,0x61,0x72,0x2d,0x77,0x68,0x69,0x74,
-0x65,0x73,0x70,0x61,0x63,0x65,0x3f,0x20,
-0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x67,
-0x65,0x74,0x63,0x29,0x20,0x69,0x6f,0x2e,
-0x73,0x6b,0x69,0x70,0x77,0x73,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x70,0x65,0x65,0x6b,0x63,0x29,0x5d,0x20,
-0x69,0x6f,0x2e,0x73,0x6b,0x69,0x70,0x77,
-0x73,0x29,0x20,0x69,0x6f,0x74,0x61,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x65,0x31,0x7c,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x6d,0x61,
-0x70,0x2d,0x69,0x6e,0x74,0x20,0x69,0x64,
-0x65,0x6e,0x74,0x69,0x74,0x79,0x5d,0x20,
-0x69,0x6f,0x74,0x61,0x29,0x20,0x6b,0x65,
-0x79,0x77,0x6f,0x72,0x64,0x2d,0x3e,0x73,
-0x79,0x6d,0x62,0x6f,0x6c,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7c,0x33,0x31,0x36,0x40,
-0x30,0x63,0x31,0x63,0x32,0x63,0x33,0x7c,
-0x33,0x31,0x33,0x31,0x34,0x31,0x3b,0x7c,
+0x32,0x3b,0x22,0x20,0x5b,0x6d,0x61,0x70,
+0x2d,0x69,0x6e,0x74,0x20,0x69,0x64,0x65,
+0x6e,0x74,0x69,0x74,0x79,0x5d,0x20,0x69,
+0x6f,0x74,0x61,0x29,0x20,0x6b,0x65,0x79,
+0x77,0x6f,0x72,0x64,0x2d,0x3e,0x73,0x79,
+0x6d,0x62,0x6f,0x6c,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x7c,0x33,0x31,0x36,0x40,0x30,
+0x63,0x31,0x63,0x32,0x63,0x33,0x7c,0x33,
+0x31,0x33,0x31,0x34,0x31,0x3b,0x7c,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x6b,
+0x65,0x79,0x77,0x6f,0x72,0x64,0x3f,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x73,0x79,0x6d,
+0x62,0x6f,0x6c,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3c,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x7c,0x60,0x63,0x31,0x7c,0x63,
+0x32,0x7c,0x33,0x31,0x33,0x32,0x34,0x33,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,0x3f,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x79,
-0x6d,0x62,0x6f,0x6c,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7c,0x60,0x63,0x31,0x7c,
-0x63,0x32,0x7c,0x33,0x31,0x33,0x32,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
-0x73,0x75,0x62,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
-0x64,0x65,0x63,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x29,0x5d,0x20,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x73,
+0x75,0x62,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x64,
+0x65,0x63,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x29,0x5d,0x20,0x6b,
+0x65,0x79,0x77,0x6f,0x72,0x64,0x2d,0x3e,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x29,0x20,
+0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,0x2d,
+0x61,0x72,0x67,0x3f,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x46,0x31,0x36,0x39,0x30,0x32,0x63,
+0x30,0x7c,0x4d,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x6b,0x65,0x79,
+0x77,0x6f,0x72,0x64,0x3f,0x29,0x5d,0x20,
 0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,0x2d,
-0x3e,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x29,
-0x20,0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,
-0x2d,0x61,0x72,0x67,0x3f,0x20,0x23,0x66,
+0x61,0x72,0x67,0x3f,0x29,0x20,0x6c,0x61,
+0x6d,0x62,0x64,0x61,0x2d,0x61,0x72,0x67,
+0x2d,0x6e,0x61,0x6d,0x65,0x73,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x63,0x31,0x65,0x32,
+0x7c,0x33,0x31,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x6d,0x61,0x70,0x21,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x46,0x31,0x36,0x39,0x30,0x32,
-0x63,0x30,0x7c,0x4d,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x6b,0x65,
-0x79,0x77,0x6f,0x72,0x64,0x3f,0x29,0x5d,
-0x20,0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,
-0x2d,0x61,0x72,0x67,0x3f,0x29,0x20,0x6c,
+0x31,0x7c,0x46,0x36,0x39,0x30,0x65,0x30,
+0x7c,0x4d,0x34,0x31,0x3b,0x7c,0x3b,0x22,
+0x20,0x5b,0x6b,0x65,0x79,0x77,0x6f,0x72,
+0x64,0x2d,0x3e,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x5d,0x29,0x20,0x74,0x6f,0x2d,0x70,
+0x72,0x6f,0x70,0x65,0x72,0x5d,0x20,0x6c,
 0x61,0x6d,0x62,0x64,0x61,0x2d,0x61,0x72,
-0x67,0x2d,0x6e,0x61,0x6d,0x65,0x73,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x63,0x31,0x65,
-0x32,0x7c,0x33,0x31,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x6d,0x61,0x70,0x21,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x46,0x36,0x39,0x30,0x65,
-0x30,0x7c,0x4d,0x34,0x31,0x3b,0x7c,0x3b,
-0x22,0x20,0x5b,0x6b,0x65,0x79,0x77,0x6f,
-0x72,0x64,0x2d,0x3e,0x73,0x79,0x6d,0x62,
-0x6f,0x6c,0x5d,0x29,0x20,0x74,0x6f,0x2d,
-0x70,0x72,0x6f,0x70,0x65,0x72,0x5d,0x20,
-0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,0x61,
-0x72,0x67,0x2d,0x6e,0x61,0x6d,0x65,0x73,
-0x29,0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,
-0x2d,0x76,0x61,0x72,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x6d,0x30,0x32,0x7c,0x7e,0x7e,0x5e,
-0x5e,0x33,0x34,0x32,0x65,0x31,0x7e,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x34,
-0x7c,0x41,0x31,0x37,0x35,0x30,0x32,0x7c,
-0x43,0x36,0x34,0x30,0x5d,0x3b,0x7c,0x46,
-0x31,0x36,0x36,0x30,0x32,0x7c,0x4d,0x43,
-0x36,0x53,0x30,0x67,0x32,0x31,0x37,0x35,
-0x30,0x32,0x67,0x33,0x36,0x3c,0x30,0x65,
-0x30,0x63,0x31,0x7d,0x63,0x32,0x34,0x33,
-0x3b,0x7e,0x7c,0x4e,0x7d,0x67,0x32,0x67,
-0x33,0x34,0x34,0x3b,0x7c,0x46,0x31,0x36,
-0x36,0x30,0x32,0x7c,0x4d,0x46,0x36,0x5c,
-0x78,0x38,0x37,0x30,0x65,0x33,0x7c,0x4d,
-0x62,0x32,0x33,0x32,0x31,0x36,0x39,0x30,
-0x32,0x65,0x34,0x7c,0x33,0x31,0x43,0x36,
-0x36,0x30,0x5e,0x35,0x3d,0x30,0x65,0x30,
-0x63,0x35,0x7c,0x4d,0x63,0x36,0x7d,0x33,
-0x34,0x32,0x63,0x37,0x65,0x34,0x7c,0x33,
-0x31,0x33,0x31,0x36,0x3c,0x30,0x7e,0x7c,
-0x4e,0x7d,0x67,0x32,0x5d,0x34,0x34,0x3b,
-0x67,0x33,0x36,0x3c,0x30,0x65,0x30,0x63,
-0x31,0x7d,0x63,0x38,0x34,0x33,0x3b,0x7e,
-0x7c,0x4e,0x7d,0x5d,0x67,0x33,0x34,0x34,
-0x3b,0x7c,0x46,0x36,0x3e,0x30,0x65,0x30,
-0x63,0x39,0x7c,0x4d,0x63,0x36,0x7d,0x34,
-0x34,0x3b,0x7c,0x7d,0x5c,0x78,0x38,0x32,
-0x3a,0x30,0x65,0x30,0x63,0x31,0x7d,0x34,
-0x32,0x3b,0x65,0x30,0x63,0x39,0x7c,0x63,
-0x36,0x7d,0x34,0x34,0x3b,0x22,0x20,0x5b,
-0x65,0x72,0x72,0x6f,0x72,0x20,0x22,0x63,
-0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,
-0x72,0x72,0x6f,0x72,0x3a,0x20,0x69,0x6e,
-0x76,0x61,0x6c,0x69,0x64,0x20,0x61,0x72,
-0x67,0x75,0x6d,0x65,0x6e,0x74,0x20,0x6c,
-0x69,0x73,0x74,0x20,0x22,0x20,0x22,0x2e,
-0x20,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x61,
-0x6c,0x20,0x61,0x72,0x67,0x75,0x6d,0x65,
-0x6e,0x74,0x73,0x20,0x6d,0x75,0x73,0x74,
-0x20,0x63,0x6f,0x6d,0x65,0x20,0x61,0x66,
-0x74,0x65,0x72,0x20,0x72,0x65,0x71,0x75,
-0x69,0x72,0x65,0x64,0x2e,0x22,0x20,0x6c,
-0x65,0x6e,0x67,0x74,0x68,0x3d,0x20,0x63,
-0x61,0x61,0x72,0x20,0x22,0x63,0x6f,0x6d,
-0x70,0x69,0x6c,0x65,0x20,0x65,0x72,0x72,
-0x6f,0x72,0x3a,0x20,0x69,0x6e,0x76,0x61,
-0x6c,0x69,0x64,0x20,0x6f,0x70,0x74,0x69,
-0x6f,0x6e,0x61,0x6c,0x20,0x61,0x72,0x67,
-0x75,0x6d,0x65,0x6e,0x74,0x20,0x22,0x20,
-0x22,0x20,0x69,0x6e,0x20,0x6c,0x69,0x73,
-0x74,0x20,0x22,0x20,0x23,0x66,0x6e,0x28,
-0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,0x3f,
-0x29,0x20,0x22,0x2e,0x20,0x6b,0x65,0x79,
-0x77,0x6f,0x72,0x64,0x20,0x61,0x72,0x67,
-0x75,0x6d,0x65,0x6e,0x74,0x73,0x20,0x6d,
-0x75,0x73,0x74,0x20,0x63,0x6f,0x6d,0x65,
-0x20,0x6c,0x61,0x73,0x74,0x2e,0x22,0x20,
-0x22,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,
-0x20,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,
-0x69,0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,
-0x66,0x6f,0x72,0x6d,0x61,0x6c,0x20,0x61,
-0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x20,
-0x22,0x5d,0x20,0x63,0x68,0x65,0x63,0x6b,
-0x2d,0x66,0x6f,0x72,0x6d,0x61,0x6c,0x73,
-0x29,0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,
-0x2d,0x61,0x72,0x67,0x2d,0x6e,0x61,0x6d,
-0x65,0x73,0x5d,0x29,0x5d,0x20,0x6c,0x61,
-0x6d,0x62,0x64,0x61,0x2d,0x76,0x61,0x72,
-0x73,0x29,0x20,0x6c,0x61,0x73,0x74,0x2d,
-0x70,0x61,0x69,0x72,0x20,0x23,0x66,0x6e,
+0x67,0x2d,0x6e,0x61,0x6d,0x65,0x73,0x29,
+0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,
+0x76,0x61,0x72,0x73,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x4e,0x3f,0x36,0x34,0x30,0x7c,0x3b,
-0x65,0x30,0x7c,0x4e,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x6c,0x61,0x73,0x74,0x2d,0x70,
-0x61,0x69,0x72,0x5d,0x20,0x6c,0x61,0x73,
-0x74,0x2d,0x70,0x61,0x69,0x72,0x29,0x20,
-0x6c,0x61,0x73,0x74,0x63,0x64,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x3f,0x36,0x34,0x30,
-0x7c,0x3b,0x65,0x30,0x7c,0x33,0x31,0x4e,
-0x3b,0x22,0x20,0x5b,0x6c,0x61,0x73,0x74,
-0x2d,0x70,0x61,0x69,0x72,0x5d,0x20,0x6c,
-0x61,0x73,0x74,0x63,0x64,0x72,0x29,0x20,
-0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x32,0x7d,0x60,0x58,0x36,0x34,
-0x30,0x5e,0x3b,0x7d,0x60,0x57,0x36,0x35,
-0x30,0x7c,0x3f,0x3b,0x7c,0x3f,0x36,0x36,
-0x30,0x7d,0x60,0x57,0x3b,0x65,0x30,0x7c,
-0x4e,0x7d,0x61,0x78,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x3d,0x5d,0x20,0x6c,0x65,0x6e,0x67,0x74,
-0x68,0x3d,0x29,0x20,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3e,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x7d,
-0x60,0x58,0x36,0x34,0x30,0x7c,0x3b,0x7d,
-0x60,0x57,0x36,0x3b,0x30,0x7c,0x46,0x31,
-0x36,0x34,0x30,0x32,0x7c,0x3b,0x7c,0x3f,
-0x36,0x36,0x30,0x7d,0x60,0x58,0x3b,0x65,
-0x30,0x7c,0x4e,0x7d,0x61,0x78,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3e,0x5d,0x20,0x6c,0x65,0x6e,
-0x67,0x74,0x68,0x3e,0x29,0x20,0x6c,0x69,
-0x73,0x74,0x2d,0x3e,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x7c,0x76,0x32,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x29,0x5d,0x20,0x6c,0x69,0x73,0x74,
-0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x29,0x20,0x6c,0x69,0x73,0x74,0x2d,0x3e,
-0x76,0x65,0x63,0x74,0x6f,0x72,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x7c,0x76,0x32,0x3b,
-0x22,0x20,0x5b,0x23,0x2e,0x76,0x65,0x63,
-0x74,0x6f,0x72,0x5d,0x20,0x6c,0x69,0x73,
-0x74,0x2d,0x3e,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x29,0x20,0x6c,0x69,0x73,0x74,0x2d,
-0x68,0x65,0x61,0x64,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x32,
-0x65,0x30,0x7d,0x60,0x33,0x32,0x36,0x34,
-0x30,0x5f,0x3b,0x7c,0x4d,0x65,0x31,0x7c,
-0x4e,0x7d,0x61,0x78,0x33,0x32,0x4b,0x3b,
-0x22,0x20,0x5b,0x3c,0x3d,0x20,0x6c,0x69,
-0x73,0x74,0x2d,0x68,0x65,0x61,0x64,0x5d,
-0x20,0x6c,0x69,0x73,0x74,0x2d,0x68,0x65,
-0x61,0x64,0x29,0x20,0x6c,0x69,0x73,0x74,
-0x2d,0x72,0x65,0x66,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
-0x65,0x30,0x7c,0x7d,0x33,0x32,0x4d,0x3b,
-0x22,0x20,0x5b,0x6c,0x69,0x73,0x74,0x2d,
-0x74,0x61,0x69,0x6c,0x5d,0x20,0x6c,0x69,
-0x73,0x74,0x2d,0x72,0x65,0x66,0x29,0x20,
-0x6c,0x69,0x73,0x74,0x2d,0x74,0x61,0x69,
-0x6c,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x72,0x32,0x65,0x30,0x7d,
-0x60,0x33,0x32,0x36,0x34,0x30,0x7c,0x3b,
-0x65,0x31,0x7c,0x4e,0x7d,0x61,0x78,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x3c,0x3d,0x20,
-0x6c,0x69,0x73,0x74,0x2d,0x74,0x61,0x69,
-0x6c,0x5d,0x20,0x6c,0x69,0x73,0x74,0x2d,
-0x74,0x61,0x69,0x6c,0x29,0x20,0x6c,0x69,
-0x73,0x74,0x3f,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x41,0x31,0x37,0x40,0x30,0x32,0x7c,0x46,
-0x31,0x36,0x39,0x30,0x32,0x65,0x30,0x7c,
-0x4e,0x34,0x31,0x3b,0x22,0x20,0x5b,0x6c,
-0x69,0x73,0x74,0x3f,0x5d,0x20,0x6c,0x69,
-0x73,0x74,0x3f,0x29,0x20,0x6c,0x6f,0x61,
-0x64,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
 0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x63,0x31,0x7c,0x63,0x32,0x33,0x32,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x63,0x31,0x71,0x74,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x30,0x63,0x30,
-0x71,0x5d,0x33,0x31,0x5d,0x5d,0x5d,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x33,0x63,0x30,
-0x69,0x31,0x30,0x33,0x31,0x37,0x43,0x30,
-0x7e,0x63,0x31,0x69,0x31,0x30,0x33,0x31,
-0x7c,0x65,0x32,0x7d,0x33,0x31,0x34,0x33,
-0x3b,0x63,0x33,0x69,0x31,0x30,0x33,0x31,
-0x32,0x65,0x32,0x7d,0x34,0x31,0x3b,0x22,
+0x6d,0x30,0x32,0x7c,0x7e,0x7e,0x5e,0x5e,
+0x33,0x34,0x32,0x65,0x31,0x7e,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3b,0x30,0x30,0x30,0x72,0x34,0x7c,
+0x41,0x31,0x37,0x35,0x30,0x32,0x7c,0x43,
+0x36,0x34,0x30,0x5d,0x3b,0x7c,0x46,0x31,
+0x36,0x36,0x30,0x32,0x7c,0x4d,0x43,0x36,
+0x53,0x30,0x67,0x32,0x31,0x37,0x35,0x30,
+0x32,0x67,0x33,0x36,0x3c,0x30,0x65,0x30,
+0x63,0x31,0x7d,0x63,0x32,0x34,0x33,0x3b,
+0x7e,0x7c,0x4e,0x7d,0x67,0x32,0x67,0x33,
+0x34,0x34,0x3b,0x7c,0x46,0x31,0x36,0x36,
+0x30,0x32,0x7c,0x4d,0x46,0x36,0x5c,0x78,
+0x38,0x37,0x30,0x65,0x33,0x7c,0x4d,0x62,
+0x32,0x33,0x32,0x31,0x36,0x39,0x30,0x32,
+0x65,0x34,0x7c,0x33,0x31,0x43,0x36,0x36,
+0x30,0x5e,0x35,0x3d,0x30,0x65,0x30,0x63,
+0x35,0x7c,0x4d,0x63,0x36,0x7d,0x33,0x34,
+0x32,0x63,0x37,0x65,0x34,0x7c,0x33,0x31,
+0x33,0x31,0x36,0x3c,0x30,0x7e,0x7c,0x4e,
+0x7d,0x67,0x32,0x5d,0x34,0x34,0x3b,0x67,
+0x33,0x36,0x3c,0x30,0x65,0x30,0x63,0x31,
+0x7d,0x63,0x38,0x34,0x33,0x3b,0x7e,0x7c,
+0x4e,0x7d,0x5d,0x67,0x33,0x34,0x34,0x3b,
+0x7c,0x46,0x36,0x3e,0x30,0x65,0x30,0x63,
+0x39,0x7c,0x4d,0x63,0x36,0x7d,0x34,0x34,
+0x3b,0x7c,0x7d,0x5c,0x78,0x38,0x32,0x3a,
+0x30,0x65,0x30,0x63,0x31,0x7d,0x34,0x32,
+0x3b,0x65,0x30,0x63,0x39,0x7c,0x63,0x36,
+0x7d,0x34,0x34,0x3b,0x22,0x20,0x5b,0x65,
+0x72,0x72,0x6f,0x72,0x20,0x22,0x63,0x6f,
+0x6d,0x70,0x69,0x6c,0x65,0x20,0x65,0x72,
+0x72,0x6f,0x72,0x3a,0x20,0x69,0x6e,0x76,
+0x61,0x6c,0x69,0x64,0x20,0x61,0x72,0x67,
+0x75,0x6d,0x65,0x6e,0x74,0x20,0x6c,0x69,
+0x73,0x74,0x20,0x22,0x20,0x22,0x2e,0x20,
+0x6f,0x70,0x74,0x69,0x6f,0x6e,0x61,0x6c,
+0x20,0x61,0x72,0x67,0x75,0x6d,0x65,0x6e,
+0x74,0x73,0x20,0x6d,0x75,0x73,0x74,0x20,
+0x63,0x6f,0x6d,0x65,0x20,0x61,0x66,0x74,
+0x65,0x72,0x20,0x72,0x65,0x71,0x75,0x69,
+0x72,0x65,0x64,0x2e,0x22,0x20,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x3d,0x20,0x63,0x61,
+0x61,0x72,0x20,0x22,0x63,0x6f,0x6d,0x70,
+0x69,0x6c,0x65,0x20,0x65,0x72,0x72,0x6f,
+0x72,0x3a,0x20,0x69,0x6e,0x76,0x61,0x6c,
+0x69,0x64,0x20,0x6f,0x70,0x74,0x69,0x6f,
+0x6e,0x61,0x6c,0x20,0x61,0x72,0x67,0x75,
+0x6d,0x65,0x6e,0x74,0x20,0x22,0x20,0x22,
+0x20,0x69,0x6e,0x20,0x6c,0x69,0x73,0x74,
+0x20,0x22,0x20,0x23,0x66,0x6e,0x28,0x6b,
+0x65,0x79,0x77,0x6f,0x72,0x64,0x3f,0x29,
+0x20,0x22,0x2e,0x20,0x6b,0x65,0x79,0x77,
+0x6f,0x72,0x64,0x20,0x61,0x72,0x67,0x75,
+0x6d,0x65,0x6e,0x74,0x73,0x20,0x6d,0x75,
+0x73,0x74,0x20,0x63,0x6f,0x6d,0x65,0x20,
+0x6c,0x61,0x73,0x74,0x2e,0x22,0x20,0x22,
+0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x20,
+0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x69,
+0x6e,0x76,0x61,0x6c,0x69,0x64,0x20,0x66,
+0x6f,0x72,0x6d,0x61,0x6c,0x20,0x61,0x72,
+0x67,0x75,0x6d,0x65,0x6e,0x74,0x20,0x22,
+0x5d,0x20,0x63,0x68,0x65,0x63,0x6b,0x2d,
+0x66,0x6f,0x72,0x6d,0x61,0x6c,0x73,0x29,
+0x20,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2d,
+0x61,0x72,0x67,0x2d,0x6e,0x61,0x6d,0x65,
+0x73,0x5d,0x29,0x5d,0x20,0x6c,0x61,0x6d,
+0x62,0x64,0x61,0x2d,0x76,0x61,0x72,0x73,
+0x29,0x20,0x6c,0x61,0x73,0x74,0x2d,0x70,
+0x61,0x69,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x4e,0x3f,0x36,0x34,0x30,0x7c,0x3b,0x65,
+0x30,0x7c,0x4e,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x6c,0x61,0x73,0x74,0x2d,0x70,0x61,
+0x69,0x72,0x5d,0x20,0x6c,0x61,0x73,0x74,
+0x2d,0x70,0x61,0x69,0x72,0x29,0x20,0x6c,
+0x61,0x73,0x74,0x63,0x64,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x3f,0x36,0x34,0x30,0x7c,
+0x3b,0x65,0x30,0x7c,0x33,0x31,0x4e,0x3b,
+0x22,0x20,0x5b,0x6c,0x61,0x73,0x74,0x2d,
+0x70,0x61,0x69,0x72,0x5d,0x20,0x6c,0x61,
+0x73,0x74,0x63,0x64,0x72,0x29,0x20,0x6c,
+0x65,0x6e,0x67,0x74,0x68,0x3d,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x32,0x7d,0x60,0x58,0x36,0x34,0x30,
+0x5e,0x3b,0x7d,0x60,0x57,0x36,0x35,0x30,
+0x7c,0x3f,0x3b,0x7c,0x3f,0x36,0x36,0x30,
+0x7d,0x60,0x57,0x3b,0x65,0x30,0x7c,0x4e,
+0x7d,0x61,0x78,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,
+0x5d,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,
+0x3d,0x29,0x20,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x3e,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x32,0x7d,0x60,
+0x58,0x36,0x34,0x30,0x7c,0x3b,0x7d,0x60,
+0x57,0x36,0x3b,0x30,0x7c,0x46,0x31,0x36,
+0x34,0x30,0x32,0x7c,0x3b,0x7c,0x3f,0x36,
+0x36,0x30,0x7d,0x60,0x58,0x3b,0x65,0x30,
+0x7c,0x4e,0x7d,0x61,0x78,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x3e,0x5d,0x20,0x6c,0x65,0x6e,0x67,
+0x74,0x68,0x3e,0x29,0x20,0x6c,0x69,0x73,
+0x74,0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
+0x76,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x29,0x5d,0x20,0x6c,0x69,0x73,0x74,0x2d,
+0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,0x29,
+0x20,0x6c,0x69,0x73,0x74,0x2d,0x3e,0x76,
+0x65,0x63,0x74,0x6f,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x7c,0x76,0x32,0x3b,0x22,
+0x20,0x5b,0x23,0x2e,0x76,0x65,0x63,0x74,
+0x6f,0x72,0x5d,0x20,0x6c,0x69,0x73,0x74,
+0x2d,0x3e,0x76,0x65,0x63,0x74,0x6f,0x72,
+0x29,0x20,0x6c,0x69,0x73,0x74,0x2d,0x68,
+0x65,0x61,0x64,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3a,0x30,0x30,0x30,0x72,0x32,0x65,
+0x30,0x7d,0x60,0x33,0x32,0x36,0x34,0x30,
+0x5f,0x3b,0x7c,0x4d,0x65,0x31,0x7c,0x4e,
+0x7d,0x61,0x78,0x33,0x32,0x4b,0x3b,0x22,
+0x20,0x5b,0x3c,0x3d,0x20,0x6c,0x69,0x73,
+0x74,0x2d,0x68,0x65,0x61,0x64,0x5d,0x20,
+0x6c,0x69,0x73,0x74,0x2d,0x68,0x65,0x61,
+0x64,0x29,0x20,0x6c,0x69,0x73,0x74,0x2d,
+0x72,0x65,0x66,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x32,0x65,
+0x30,0x7c,0x7d,0x33,0x32,0x4d,0x3b,0x22,
+0x20,0x5b,0x6c,0x69,0x73,0x74,0x2d,0x74,
+0x61,0x69,0x6c,0x5d,0x20,0x6c,0x69,0x73,
+0x74,0x2d,0x72,0x65,0x66,0x29,0x20,0x6c,
+0x69,0x73,0x74,0x2d,0x74,0x61,0x69,0x6c,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x32,0x65,0x30,0x7d,0x60,
+0x33,0x32,0x36,0x34,0x30,0x7c,0x3b,0x65,
+0x31,0x7c,0x4e,0x7d,0x61,0x78,0x34,0x32,
+0x3b,0x22,0x20,0x5b,0x3c,0x3d,0x20,0x6c,
+0x69,0x73,0x74,0x2d,0x74,0x61,0x69,0x6c,
+0x5d,0x20,0x6c,0x69,0x73,0x74,0x2d,0x74,
+0x61,0x69,0x6c,0x29,0x20,0x6c,0x69,0x73,
+0x74,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x41,
+0x31,0x37,0x40,0x30,0x32,0x7c,0x46,0x31,
+0x36,0x39,0x30,0x32,0x65,0x30,0x7c,0x4e,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x6c,0x69,
+0x73,0x74,0x3f,0x5d,0x20,0x6c,0x69,0x73,
+0x74,0x3f,0x29,0x20,0x6c,0x6f,0x61,0x64,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
+0x31,0x7c,0x63,0x32,0x33,0x32,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x63,0x31,0x71,0x74,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x30,0x63,0x30,0x71,
+0x5d,0x33,0x31,0x5d,0x5d,0x5d,0x34,0x33,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x6d,0x30,0x32,0x7c,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x33,0x63,0x30,0x69,
+0x31,0x30,0x33,0x31,0x37,0x43,0x30,0x7e,
+0x63,0x31,0x69,0x31,0x30,0x33,0x31,0x7c,
+0x65,0x32,0x7d,0x33,0x31,0x34,0x33,0x3b,
+0x63,0x33,0x69,0x31,0x30,0x33,0x31,0x32,
+0x65,0x32,0x7d,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x65,0x6f,0x66,0x3f,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x72,0x65,0x61,0x64,0x29,0x20,
+0x6c,0x6f,0x61,0x64,0x2d,0x70,0x72,0x6f,
+0x63,0x65,0x73,0x73,0x20,0x23,0x66,0x6e,
+0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,
+0x65,0x29,0x5d,0x29,0x5d,0x29,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x7e,0x33,
+0x31,0x32,0x63,0x31,0x63,0x32,0x69,0x31,
+0x30,0x7c,0x4c,0x33,0x34,0x31,0x3b,0x22,
 0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x65,0x6f,0x66,0x3f,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x72,0x65,0x61,0x64,0x29,
+0x2e,0x63,0x6c,0x6f,0x73,0x65,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x72,0x61,0x69,0x73,
+0x65,0x29,0x20,0x6c,0x6f,0x61,0x64,0x2d,
+0x65,0x72,0x72,0x6f,0x72,0x5d,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x66,0x69,
+0x6c,0x65,0x29,0x20,0x3a,0x72,0x65,0x61,
+0x64,0x5d,0x20,0x6c,0x6f,0x61,0x64,0x29,
 0x20,0x6c,0x6f,0x61,0x64,0x2d,0x70,0x72,
 0x6f,0x63,0x65,0x73,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,
-0x73,0x65,0x29,0x5d,0x29,0x5d,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7e,
-0x33,0x31,0x32,0x63,0x31,0x63,0x32,0x69,
-0x31,0x30,0x7c,0x4c,0x33,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x63,0x6c,0x6f,0x73,0x65,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x72,0x61,0x69,
-0x73,0x65,0x29,0x20,0x6c,0x6f,0x61,0x64,
-0x2d,0x65,0x72,0x72,0x6f,0x72,0x5d,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x66,
-0x69,0x6c,0x65,0x29,0x20,0x3a,0x72,0x65,
-0x61,0x64,0x5d,0x20,0x6c,0x6f,0x61,0x64,
-0x29,0x20,0x6c,0x6f,0x61,0x64,0x2d,0x70,
-0x72,0x6f,0x63,0x65,0x73,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x7c,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x65,0x76,0x61,0x6c,0x5d,
-0x20,0x6c,0x6f,0x61,0x64,0x2d,0x70,0x72,
-0x6f,0x63,0x65,0x73,0x73,0x29,0x20,0x6c,
-0x6f,0x6f,0x6b,0x75,0x70,0x2d,0x73,0x79,
-0x6d,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x34,0x7d,0x5c,0x78,
-0x38,0x35,0x35,0x30,0x63,0x30,0x3b,0x63,
-0x31,0x71,0x7d,0x4d,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x28,0x67,0x6c,0x6f,0x62,0x61,
-0x6c,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3a,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x65,0x31,0x7e,0x7c,0x60,0x33,0x33,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x36,0x40,0x30,0x69,0x31,0x33,
-0x36,0x34,0x30,0x7c,0x3b,0x69,0x31,0x32,
-0x7c,0x4b,0x3b,0x65,0x30,0x69,0x31,0x30,
-0x69,0x31,0x31,0x4e,0x69,0x31,0x33,0x31,
-0x37,0x35,0x30,0x32,0x7e,0x41,0x36,0x38,
-0x30,0x69,0x31,0x32,0x35,0x37,0x30,0x69,
-0x31,0x32,0x61,0x77,0x5e,0x34,0x34,0x3b,
-0x22,0x20,0x5b,0x6c,0x6f,0x6f,0x6b,0x75,
-0x70,0x2d,0x73,0x79,0x6d,0x5d,0x29,0x20,
-0x69,0x6e,0x64,0x65,0x78,0x2d,0x6f,0x66,
-0x5d,0x29,0x5d,0x20,0x6c,0x6f,0x6f,0x6b,
-0x75,0x70,0x2d,0x73,0x79,0x6d,0x29,0x20,
-0x6d,0x61,0x63,0x72,0x6f,0x63,0x61,0x6c,
-0x6c,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,
-0x43,0x31,0x36,0x39,0x30,0x32,0x65,0x30,
-0x7c,0x4d,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x73,
-0x79,0x6e,0x74,0x61,0x78,0x5d,0x20,0x6d,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x7c,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x65,0x76,0x61,0x6c,0x5d,0x20,
+0x6c,0x6f,0x61,0x64,0x2d,0x70,0x72,0x6f,
+0x63,0x65,0x73,0x73,0x29,0x20,0x6c,0x6f,
+0x6f,0x6b,0x75,0x70,0x2d,0x73,0x79,0x6d,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x34,0x7d,0x5c,0x78,0x38,
+0x35,0x35,0x30,0x63,0x30,0x3b,0x63,0x31,
+0x71,0x7d,0x4d,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x28,0x67,0x6c,0x6f,0x62,0x61,0x6c,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x65,0x31,0x7e,0x7c,0x60,0x33,0x33,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x31,
+0x7c,0x36,0x40,0x30,0x69,0x31,0x33,0x36,
+0x34,0x30,0x7c,0x3b,0x69,0x31,0x32,0x7c,
+0x4b,0x3b,0x65,0x30,0x69,0x31,0x30,0x69,
+0x31,0x31,0x4e,0x69,0x31,0x33,0x31,0x37,
+0x35,0x30,0x32,0x7e,0x41,0x36,0x38,0x30,
+0x69,0x31,0x32,0x35,0x37,0x30,0x69,0x31,
+0x32,0x61,0x77,0x5e,0x34,0x34,0x3b,0x22,
+0x20,0x5b,0x6c,0x6f,0x6f,0x6b,0x75,0x70,
+0x2d,0x73,0x79,0x6d,0x5d,0x29,0x20,0x69,
+0x6e,0x64,0x65,0x78,0x2d,0x6f,0x66,0x5d,
+0x29,0x5d,0x20,0x6c,0x6f,0x6f,0x6b,0x75,
+0x70,0x2d,0x73,0x79,0x6d,0x29,0x20,0x6d,
 0x61,0x63,0x72,0x6f,0x63,0x61,0x6c,0x6c,
-0x3f,0x29,0x20,0x6d,0x61,0x63,0x72,0x6f,
-0x65,0x78,0x70,0x61,0x6e,0x64,0x2d,0x31,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x3f,0x36,0x34,
-0x30,0x7c,0x3b,0x63,0x30,0x71,0x65,0x31,
-0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x36,0x38,0x30,
-0x7c,0x7e,0x4e,0x76,0x32,0x3b,0x7e,0x3b,
-0x22,0x20,0x5b,0x5d,0x29,0x20,0x6d,0x61,
+0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x4d,0x43,
+0x31,0x36,0x39,0x30,0x32,0x65,0x30,0x7c,
+0x4d,0x34,0x31,0x3b,0x22,0x20,0x5b,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x73,0x79,
+0x6e,0x74,0x61,0x78,0x5d,0x20,0x6d,0x61,
 0x63,0x72,0x6f,0x63,0x61,0x6c,0x6c,0x3f,
-0x5d,0x20,0x6d,0x61,0x63,0x72,0x6f,0x65,
-0x78,0x70,0x61,0x6e,0x64,0x2d,0x31,0x29,
-0x20,0x6d,0x61,0x67,0x65,0x6e,0x74,0x61,
-0x20,0x35,0x20,0x6d,0x61,0x6b,0x65,0x2d,
-0x63,0x6f,0x64,0x65,0x2d,0x65,0x6d,0x69,
-0x74,0x74,0x65,0x72,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x30,
-0x5f,0x63,0x30,0x33,0x30,0x60,0x63,0x31,
-0x5a,0x34,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,0x29,
-0x20,0x2b,0x69,0x6e,0x66,0x2e,0x30,0x5d,
-0x20,0x6d,0x61,0x6b,0x65,0x2d,0x63,0x6f,
-0x64,0x65,0x2d,0x65,0x6d,0x69,0x74,0x74,
-0x65,0x72,0x29,0x20,0x6d,0x61,0x6b,0x65,
-0x2d,0x6c,0x61,0x62,0x65,0x6c,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x34,0x30,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x67,0x65,
-0x6e,0x73,0x79,0x6d,0x29,0x5d,0x20,0x6d,
-0x61,0x6b,0x65,0x2d,0x6c,0x61,0x62,0x65,
-0x6c,0x29,0x20,0x6d,0x61,0x6b,0x65,0x2d,
-0x70,0x65,0x72,0x66,0x65,0x63,0x74,0x2d,
-0x68,0x61,0x73,0x68,0x2d,0x74,0x61,0x62,
-0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x5d,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x29,0x20,0x6d,0x61,0x63,0x72,0x6f,0x65,
+0x78,0x70,0x61,0x6e,0x64,0x2d,0x31,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x6d,0x30,0x32,
-0x63,0x31,0x71,0x5d,0x33,0x31,0x63,0x32,
-0x7e,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x32,0x65,0x30,0x65,0x31,
-0x63,0x32,0x7c,0x33,0x31,0x33,0x31,0x7d,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x6d,0x6f,
-0x64,0x30,0x20,0x61,0x62,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x68,0x61,0x73,0x68,0x29,
-0x5d,0x20,0x24,0x68,0x61,0x73,0x68,0x2d,
-0x6b,0x65,0x79,0x77,0x6f,0x72,0x64,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x6d,
-0x30,0x32,0x7c,0x3b,0x22,0x20,0x5b,0x23,
+0x30,0x72,0x31,0x7c,0x3f,0x36,0x34,0x30,
+0x7c,0x3b,0x63,0x30,0x71,0x65,0x31,0x7c,
+0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x31,0x7c,0x36,0x38,0x30,0x7c,
+0x7e,0x4e,0x76,0x32,0x3b,0x7e,0x3b,0x22,
+0x20,0x5b,0x5d,0x29,0x20,0x6d,0x61,0x63,
+0x72,0x6f,0x63,0x61,0x6c,0x6c,0x3f,0x5d,
+0x20,0x6d,0x61,0x63,0x72,0x6f,0x65,0x78,
+0x70,0x61,0x6e,0x64,0x2d,0x31,0x29,0x20,
+0x6d,0x61,0x67,0x65,0x6e,0x74,0x61,0x20,
+0x35,0x20,0x6d,0x61,0x6b,0x65,0x2d,0x63,
+0x6f,0x64,0x65,0x2d,0x65,0x6d,0x69,0x74,
+0x74,0x65,0x72,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x39,0x30,0x30,0x30,0x72,0x30,0x5f,
+0x63,0x30,0x33,0x30,0x60,0x63,0x31,0x5a,
+0x34,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x74,0x61,0x62,0x6c,0x65,0x29,0x20,
+0x2b,0x69,0x6e,0x66,0x2e,0x30,0x5d,0x20,
+0x6d,0x61,0x6b,0x65,0x2d,0x63,0x6f,0x64,
+0x65,0x2d,0x65,0x6d,0x69,0x74,0x74,0x65,
+0x72,0x29,0x20,0x6d,0x61,0x6b,0x65,0x2d,
+0x6c,0x61,0x62,0x65,0x6c,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x34,0x30,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x67,0x65,0x6e,
+0x73,0x79,0x6d,0x29,0x5d,0x20,0x6d,0x61,
+0x6b,0x65,0x2d,0x6c,0x61,0x62,0x65,0x6c,
+0x29,0x20,0x6d,0x61,0x6b,0x65,0x2d,0x70,
+0x65,0x72,0x66,0x65,0x63,0x74,0x2d,0x68,
+0x61,0x73,0x68,0x2d,0x74,0x61,0x62,0x6c,
+0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x5d,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x6d,0x30,0x32,0x63,
+0x31,0x71,0x5d,0x33,0x31,0x63,0x32,0x7e,
+0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x32,0x65,0x30,0x65,0x31,0x63,
+0x32,0x7c,0x33,0x31,0x33,0x31,0x7d,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x6d,0x6f,0x64,
+0x30,0x20,0x61,0x62,0x73,0x20,0x23,0x66,
+0x6e,0x28,0x68,0x61,0x73,0x68,0x29,0x5d,
+0x20,0x24,0x68,0x61,0x73,0x68,0x2d,0x6b,
+0x65,0x79,0x77,0x6f,0x72,0x64,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x71,0x6d,0x30,
+0x32,0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x63,0x31,0x62,0x32,
+0x7c,0x54,0x32,0x5e,0x33,0x32,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x5d,0x33,0x31,0x69,0x33,0x30,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x46,0x36,0x3d,0x30,0x63,0x30,0x71,0x65,
+0x31,0x7c,0x33,0x31,0x34,0x31,0x3b,0x69,
+0x31,0x30,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x62,0x32,0x69,0x35,
+0x30,0x7c,0x69,0x33,0x30,0x33,0x32,0x54,
+0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
 0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x62,
-0x32,0x7c,0x54,0x32,0x5e,0x33,0x32,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x5d,0x33,0x31,0x69,0x33,
-0x30,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
-0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x46,0x36,0x3d,0x30,0x63,0x30,0x71,
-0x65,0x31,0x7c,0x33,0x31,0x34,0x31,0x3b,
-0x69,0x31,0x30,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x62,0x32,0x69,
-0x35,0x30,0x7c,0x69,0x33,0x30,0x33,0x32,
-0x54,0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x72,0x31,0x69,0x33,0x30,0x7c,0x5b,0x36,
+0x3d,0x30,0x69,0x35,0x30,0x69,0x34,0x30,
+0x61,0x77,0x34,0x31,0x3b,0x69,0x33,0x30,
+0x7c,0x7e,0x5c,0x5c,0x32,0x69,0x33,0x30,
+0x7c,0x61,0x77,0x65,0x30,0x69,0x31,0x30,
+0x33,0x31,0x5c,0x5c,0x32,0x69,0x32,0x30,
+0x69,0x31,0x30,0x4e,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x63,0x64,0x61,0x72,0x5d,0x29,
+0x5d,0x29,0x20,0x63,0x61,0x61,0x72,0x5d,
+0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x76,0x65,0x63,0x74,0x6f,0x72,
+0x2e,0x61,0x6c,0x6c,0x6f,0x63,0x29,0x5d,
+0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,
+0x29,0x5d,0x20,0x6d,0x61,0x6b,0x65,0x2d,
+0x70,0x65,0x72,0x66,0x65,0x63,0x74,0x2d,
+0x68,0x61,0x73,0x68,0x2d,0x74,0x61,0x62,
+0x6c,0x65,0x29,0x20,0x6d,0x61,0x6b,0x65,
+0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x31,0x69,0x33,0x30,0x7c,0x5b,
-0x36,0x3d,0x30,0x69,0x35,0x30,0x69,0x34,
-0x30,0x61,0x77,0x34,0x31,0x3b,0x69,0x33,
-0x30,0x7c,0x7e,0x5c,0x5c,0x32,0x69,0x33,
-0x30,0x7c,0x61,0x77,0x65,0x30,0x69,0x31,
-0x30,0x33,0x31,0x5c,0x5c,0x32,0x69,0x32,
-0x30,0x69,0x31,0x30,0x4e,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x63,0x64,0x61,0x72,0x5d,
-0x29,0x5d,0x29,0x20,0x63,0x61,0x61,0x72,
-0x5d,0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x2e,0x61,0x6c,0x6c,0x6f,0x63,0x29,
-0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,
-0x5d,0x29,0x5d,0x20,0x6d,0x61,0x6b,0x65,
-0x2d,0x70,0x65,0x72,0x66,0x65,0x63,0x74,
-0x2d,0x68,0x61,0x73,0x68,0x2d,0x74,0x61,
-0x62,0x6c,0x65,0x29,0x20,0x6d,0x61,0x6b,
-0x65,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x5c,0x78,0x38,0x39,0x31,0x30,
-0x30,0x30,0x32,0x30,0x30,0x30,0x5c,0x78,
-0x38,0x61,0x31,0x30,0x30,0x30,0x37,0x37,
-0x30,0x63,0x30,0x6d,0x31,0x32,0x65,0x31,
-0x7d,0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x23,0x5c,0x20,0x20,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x72,0x65,0x70,0x5d,0x20,
-0x6d,0x61,0x6b,0x65,0x2d,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x29,0x20,0x6d,0x61,0x6b,
-0x65,0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,
-0x23,0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,
-0x65,0x29,0x20,0x6d,0x61,0x6b,0x65,0x2d,
-0x76,0x65,0x63,0x74,0x6f,0x72,0x20,0x23,
-0x66,0x6e,0x28,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x2e,0x61,0x6c,0x6c,0x6f,0x63,0x29,
-0x20,0x6d,0x61,0x70,0x21,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x32,0x7d,0x5d,0x7d,0x46,0x36,0x42,0x30,
-0x32,0x7d,0x7c,0x7d,0x4d,0x33,0x31,0x4f,
-0x32,0x7d,0x4e,0x6d,0x31,0x35,0x5c,0x78,
-0x31,0x64,0x2f,0x32,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x6d,0x61,0x70,0x21,0x29,0x20,
-0x6d,0x61,0x70,0x2d,0x69,0x6e,0x74,0x20,
+0x30,0x5c,0x78,0x38,0x39,0x31,0x30,0x30,
+0x30,0x32,0x30,0x30,0x30,0x5c,0x78,0x38,
+0x61,0x31,0x30,0x30,0x30,0x37,0x37,0x30,
+0x63,0x30,0x6d,0x31,0x32,0x65,0x31,0x7d,
+0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x5c,0x20,0x20,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x72,0x65,0x70,0x5d,0x20,0x6d,
+0x61,0x6b,0x65,0x2d,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x29,0x20,0x6d,0x61,0x6b,0x65,
+0x2d,0x74,0x61,0x62,0x6c,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,
+0x29,0x20,0x6d,0x61,0x6b,0x65,0x2d,0x76,
+0x65,0x63,0x74,0x6f,0x72,0x20,0x23,0x66,
+0x6e,0x28,0x76,0x65,0x63,0x74,0x6f,0x72,
+0x2e,0x61,0x6c,0x6c,0x6f,0x63,0x29,0x20,
+0x6d,0x61,0x70,0x21,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x32,
+0x7d,0x5d,0x7d,0x46,0x36,0x42,0x30,0x32,
+0x7d,0x7c,0x7d,0x4d,0x33,0x31,0x4f,0x32,
+0x7d,0x4e,0x6d,0x31,0x35,0x5c,0x78,0x31,
+0x64,0x2f,0x32,0x3b,0x22,0x20,0x5b,0x5d,
+0x20,0x6d,0x61,0x70,0x21,0x29,0x20,0x6d,
+0x61,0x70,0x2d,0x69,0x6e,0x74,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x32,0x65,0x30,0x7d,0x60,0x33,0x32,
+0x36,0x34,0x30,0x5f,0x3b,0x63,0x31,0x71,
+0x7c,0x60,0x33,0x31,0x5f,0x4b,0x5f,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x3c,0x3d,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
+0x30,0x72,0x32,0x7c,0x6d,0x31,0x32,0x61,
+0x5c,0x78,0x37,0x66,0x61,0x78,0x63,0x30,
+0x71,0x75,0x32,0x7c,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x32,0x65,0x30,0x7d,0x60,0x33,
-0x32,0x36,0x34,0x30,0x5f,0x3b,0x63,0x31,
-0x71,0x7c,0x60,0x33,0x31,0x5f,0x4b,0x5f,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x3c,0x3d,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x32,0x7c,0x6d,0x31,0x32,
-0x61,0x5c,0x78,0x37,0x66,0x61,0x78,0x63,
-0x30,0x71,0x75,0x32,0x7c,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x5c,0x78,0x37,0x66,
-0x69,0x31,0x30,0x7c,0x33,0x31,0x5f,0x4b,
-0x50,0x32,0x5c,0x78,0x37,0x66,0x4e,0x6f,
-0x30,0x31,0x3b,0x22,0x20,0x5b,0x5d,0x29,
-0x5d,0x29,0x5d,0x20,0x6d,0x61,0x70,0x2d,
-0x69,0x6e,0x74,0x29,0x20,0x6d,0x61,0x72,
-0x6b,0x2d,0x6c,0x61,0x62,0x65,0x6c,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x32,0x65,0x30,0x7c,0x63,0x31,
-0x7d,0x34,0x33,0x3b,0x22,0x20,0x5b,0x65,
-0x6d,0x69,0x74,0x20,0x6c,0x61,0x62,0x65,
-0x6c,0x5d,0x20,0x6d,0x61,0x72,0x6b,0x2d,
-0x6c,0x61,0x62,0x65,0x6c,0x29,0x20,0x6d,
-0x61,0x78,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3c,0x30,0x30,0x30,0x73,0x31,0x7d,0x5c,
-0x78,0x38,0x35,0x34,0x30,0x7c,0x3b,0x65,
-0x30,0x63,0x31,0x7c,0x7d,0x34,0x33,0x3b,
-0x22,0x20,0x5b,0x66,0x6f,0x6c,0x64,0x6c,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x32,0x7c,0x7d,0x58,0x36,
-0x34,0x30,0x7d,0x3b,0x7c,0x3b,0x22,0x20,
-0x5b,0x5d,0x29,0x5d,0x20,0x6d,0x61,0x78,
-0x29,0x20,0x6d,0x65,0x6d,0x62,0x65,0x72,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x32,0x7d,0x3f,0x36,0x34,
-0x30,0x5e,0x3b,0x7d,0x4d,0x7c,0x3e,0x36,
-0x34,0x30,0x7d,0x3b,0x65,0x30,0x7c,0x7d,
-0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,0x6d,
-0x65,0x6d,0x62,0x65,0x72,0x5d,0x20,0x6d,
-0x65,0x6d,0x62,0x65,0x72,0x29,0x20,0x6d,
-0x65,0x6d,0x70,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x7d,
-0x5c,0x78,0x38,0x35,0x34,0x30,0x5e,0x3b,
-0x7d,0x46,0x36,0x44,0x30,0x7c,0x7d,0x4d,
-0x33,0x31,0x36,0x34,0x30,0x7d,0x3b,0x65,
-0x30,0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x65,
-0x31,0x63,0x30,0x63,0x32,0x7d,0x34,0x33,
-0x3b,0x22,0x20,0x5b,0x6d,0x65,0x6d,0x70,
-0x20,0x61,0x73,0x73,0x65,0x72,0x74,0x69,
-0x6f,0x6e,0x2d,0x76,0x69,0x6f,0x6c,0x61,
-0x74,0x69,0x6f,0x6e,0x20,0x22,0x49,0x6e,
-0x76,0x61,0x6c,0x69,0x64,0x20,0x61,0x72,
-0x67,0x75,0x6d,0x65,0x6e,0x74,0x22,0x5d,
-0x20,0x6d,0x65,0x6d,0x70,0x29,0x20,0x6d,
-0x65,0x6d,0x76,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x32,0x7d,
-0x3f,0x36,0x34,0x30,0x5e,0x3b,0x7d,0x4d,
-0x7c,0x3d,0x36,0x34,0x30,0x7d,0x3b,0x65,
-0x30,0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x6d,0x65,0x6d,0x76,0x5d,0x20,
-0x6d,0x65,0x6d,0x76,0x29,0x20,0x6d,0x69,
-0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
+0x30,0x72,0x31,0x5c,0x78,0x37,0x66,0x69,
+0x31,0x30,0x7c,0x33,0x31,0x5f,0x4b,0x50,
+0x32,0x5c,0x78,0x37,0x66,0x4e,0x6f,0x30,
+0x31,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,
+0x29,0x5d,0x20,0x6d,0x61,0x70,0x2d,0x69,
+0x6e,0x74,0x29,0x20,0x6d,0x61,0x72,0x6b,
+0x2d,0x6c,0x61,0x62,0x65,0x6c,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x32,0x65,0x30,0x7c,0x63,0x31,0x7d,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x65,0x6d,
+0x69,0x74,0x20,0x6c,0x61,0x62,0x65,0x6c,
+0x5d,0x20,0x6d,0x61,0x72,0x6b,0x2d,0x6c,
+0x61,0x62,0x65,0x6c,0x29,0x20,0x6d,0x61,
+0x78,0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,
 0x30,0x30,0x30,0x73,0x31,0x7d,0x5c,0x78,
 0x38,0x35,0x34,0x30,0x7c,0x3b,0x65,0x30,
 0x63,0x31,0x7c,0x7d,0x34,0x33,0x3b,0x22,
 0x20,0x5b,0x66,0x6f,0x6c,0x64,0x6c,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
 0x30,0x72,0x32,0x7c,0x7d,0x58,0x36,0x34,
-0x30,0x7c,0x3b,0x7d,0x3b,0x22,0x20,0x5b,
-0x5d,0x29,0x5d,0x20,0x6d,0x69,0x6e,0x29,
-0x20,0x6d,0x6f,0x64,0x20,0x23,0x37,0x3d,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x32,0x7c,0x65,0x30,0x7c,0x7d,
-0x33,0x32,0x7d,0x54,0x32,0x78,0x3b,0x22,
-0x20,0x5b,0x64,0x69,0x76,0x5d,0x20,0x6d,
-0x6f,0x64,0x29,0x20,0x6d,0x6f,0x64,0x30,
-0x20,0x23,0x31,0x30,0x3d,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
-0x7c,0x7c,0x7d,0x56,0x7d,0x54,0x32,0x78,
-0x3b,0x22,0x20,0x5b,0x5d,0x20,0x6d,0x6f,
-0x64,0x30,0x29,0x20,0x6d,0x6f,0x64,0x75,
-0x6c,0x6f,0x20,0x23,0x37,0x23,0x20,0x6e,
-0x61,0x6e,0x3f,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x7c,
-0x63,0x30,0x3e,0x31,0x37,0x37,0x30,0x32,
-0x7c,0x63,0x31,0x3e,0x3b,0x22,0x20,0x5b,
-0x2b,0x6e,0x61,0x6e,0x2e,0x30,0x20,0x2d,
-0x6e,0x61,0x6e,0x2e,0x30,0x5d,0x20,0x6e,
-0x61,0x6e,0x3f,0x29,0x20,0x6e,0x65,0x67,
-0x61,0x74,0x69,0x76,0x65,0x3f,0x20,0x23,
+0x30,0x7d,0x3b,0x7c,0x3b,0x22,0x20,0x5b,
+0x5d,0x29,0x5d,0x20,0x6d,0x61,0x78,0x29,
+0x20,0x6d,0x65,0x6d,0x62,0x65,0x72,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x32,0x7d,0x3f,0x36,0x34,0x30,
+0x5e,0x3b,0x7d,0x4d,0x7c,0x3e,0x36,0x34,
+0x30,0x7d,0x3b,0x65,0x30,0x7c,0x7d,0x4e,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x6d,0x65,
+0x6d,0x62,0x65,0x72,0x5d,0x20,0x6d,0x65,
+0x6d,0x62,0x65,0x72,0x29,0x20,0x6d,0x65,
+0x6d,0x70,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x32,0x7d,0x5c,
+0x78,0x38,0x35,0x34,0x30,0x5e,0x3b,0x7d,
+0x46,0x36,0x44,0x30,0x7c,0x7d,0x4d,0x33,
+0x31,0x36,0x34,0x30,0x7d,0x3b,0x65,0x30,
+0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x65,0x31,
+0x63,0x30,0x63,0x32,0x7d,0x34,0x33,0x3b,
+0x22,0x20,0x5b,0x6d,0x65,0x6d,0x70,0x20,
+0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,
+0x6e,0x2d,0x76,0x69,0x6f,0x6c,0x61,0x74,
+0x69,0x6f,0x6e,0x20,0x22,0x49,0x6e,0x76,
+0x61,0x6c,0x69,0x64,0x20,0x61,0x72,0x67,
+0x75,0x6d,0x65,0x6e,0x74,0x22,0x5d,0x20,
+0x6d,0x65,0x6d,0x70,0x29,0x20,0x6d,0x65,
+0x6d,0x76,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x32,0x7d,0x3f,
+0x36,0x34,0x30,0x5e,0x3b,0x7d,0x4d,0x7c,
+0x3d,0x36,0x34,0x30,0x7d,0x3b,0x65,0x30,
+0x7c,0x7d,0x4e,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x6d,0x65,0x6d,0x76,0x5d,0x20,0x6d,
+0x65,0x6d,0x76,0x29,0x20,0x6d,0x69,0x6e,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,
+0x30,0x30,0x73,0x31,0x7d,0x5c,0x78,0x38,
+0x35,0x34,0x30,0x7c,0x3b,0x65,0x30,0x63,
+0x31,0x7c,0x7d,0x34,0x33,0x3b,0x22,0x20,
+0x5b,0x66,0x6f,0x6c,0x64,0x6c,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x7c,0x60,0x58,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x6e,0x65,0x67,0x61,0x74,
-0x69,0x76,0x65,0x3f,0x29,0x20,0x6e,0x65,
-0x73,0x74,0x6c,0x69,0x73,0x74,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x33,0x65,0x30,0x67,0x32,0x60,0x33,
-0x32,0x36,0x34,0x30,0x5f,0x3b,0x7d,0x65,
-0x31,0x7c,0x7c,0x7d,0x33,0x31,0x67,0x32,
-0x61,0x78,0x33,0x33,0x4b,0x3b,0x22,0x20,
-0x5b,0x3c,0x3d,0x20,0x6e,0x65,0x73,0x74,
-0x6c,0x69,0x73,0x74,0x5d,0x20,0x6e,0x65,
-0x73,0x74,0x6c,0x69,0x73,0x74,0x29,0x20,
-0x6e,0x6e,0x6e,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x65,
-0x30,0x63,0x31,0x7c,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x63,0x6f,0x75,0x6e,0x74,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x41,0x40,0x3b,0x22,
-0x20,0x5b,0x5d,0x29,0x5d,0x20,0x6e,0x6e,
-0x6e,0x29,0x20,0x6e,0x72,0x65,0x63,0x6f,
-0x6e,0x63,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x32,0x65,0x30,
-0x7d,0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x21,
-0x2d,0x5d,0x20,0x6e,0x72,0x65,0x63,0x6f,
-0x6e,0x63,0x29,0x20,0x6f,0x64,0x64,0x3f,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x65,0x30,0x7c,0x33,
-0x31,0x40,0x3b,0x22,0x20,0x5b,0x65,0x76,
-0x65,0x6e,0x3f,0x5d,0x20,0x6f,0x64,0x64,
-0x3f,0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,
-0x69,0x6e,0x70,0x75,0x74,0x2d,0x66,0x69,
-0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x7c,0x63,0x31,0x34,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x66,0x69,0x6c,
-0x65,0x29,0x20,0x3a,0x72,0x65,0x61,0x64,
-0x5d,0x20,0x6f,0x70,0x65,0x6e,0x2d,0x69,
-0x6e,0x70,0x75,0x74,0x2d,0x66,0x69,0x6c,
-0x65,0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,
-0x69,0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x63,0x31,0x33,0x30,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x7c,0x7e,0x33,0x32,0x32,0x63,
-0x31,0x7c,0x60,0x33,0x32,0x32,0x7c,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x77,0x72,0x69,0x74,0x65,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x73,0x65,0x65,0x6b,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x62,0x75,0x66,0x66,
-0x65,0x72,0x29,0x5d,0x20,0x6f,0x70,0x65,
-0x6e,0x2d,0x69,0x6e,0x70,0x75,0x74,0x2d,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x29,0x20,
-0x6f,0x70,0x65,0x6e,0x2d,0x6f,0x75,0x74,
-0x70,0x75,0x74,0x2d,0x66,0x69,0x6c,0x65,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x63,
-0x31,0x63,0x32,0x34,0x33,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x66,0x69,0x6c,
-0x65,0x29,0x20,0x3a,0x77,0x72,0x69,0x74,
-0x65,0x20,0x3a,0x63,0x72,0x65,0x61,0x74,
-0x65,0x5d,0x20,0x6f,0x70,0x65,0x6e,0x2d,
-0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x66,
-0x69,0x6c,0x65,0x29,0x20,0x6f,0x70,0x65,
-0x6e,0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x30,0x63,0x30,0x34,0x30,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x62,
-0x75,0x66,0x66,0x65,0x72,0x29,0x5d,0x20,
-0x6f,0x70,0x65,0x6e,0x2d,0x6f,0x75,0x74,
-0x70,0x75,0x74,0x2d,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x29,0x20,0x6f,0x70,0x65,0x6e,
-0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,
-0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x70,
-0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x30,0x63,
-0x30,0x63,0x31,0x33,0x30,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x72,0x32,0x7c,0x7d,0x58,0x36,0x34,0x30,
+0x7c,0x3b,0x7d,0x3b,0x22,0x20,0x5b,0x5d,
+0x29,0x5d,0x20,0x6d,0x69,0x6e,0x29,0x20,
+0x6d,0x6f,0x64,0x20,0x23,0x37,0x3d,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x32,0x7c,0x65,0x30,0x7c,0x7d,0x33,
+0x32,0x7d,0x54,0x32,0x78,0x3b,0x22,0x20,
+0x5b,0x64,0x69,0x76,0x5d,0x20,0x6d,0x6f,
+0x64,0x29,0x20,0x6d,0x6f,0x64,0x30,0x20,
+0x23,0x31,0x30,0x3d,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x32,0x7c,
+0x7c,0x7d,0x56,0x7d,0x54,0x32,0x78,0x3b,
+0x22,0x20,0x5b,0x5d,0x20,0x6d,0x6f,0x64,
+0x30,0x29,0x20,0x6d,0x6f,0x64,0x75,0x6c,
+0x6f,0x20,0x23,0x37,0x23,0x20,0x6e,0x61,
+0x6e,0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x63,
+0x30,0x3e,0x31,0x37,0x37,0x30,0x32,0x7c,
+0x63,0x31,0x3e,0x3b,0x22,0x20,0x5b,0x2b,
+0x6e,0x61,0x6e,0x2e,0x30,0x20,0x2d,0x6e,
+0x61,0x6e,0x2e,0x30,0x5d,0x20,0x6e,0x61,
+0x6e,0x3f,0x29,0x20,0x6e,0x65,0x67,0x61,
+0x74,0x69,0x76,0x65,0x3f,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x7c,0x60,0x58,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x6e,0x65,0x67,0x61,0x74,0x69,
+0x76,0x65,0x3f,0x29,0x20,0x6e,0x65,0x73,
+0x74,0x6c,0x69,0x73,0x74,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
+0x33,0x65,0x30,0x67,0x32,0x60,0x33,0x32,
+0x36,0x34,0x30,0x5f,0x3b,0x7d,0x65,0x31,
+0x7c,0x7c,0x7d,0x33,0x31,0x67,0x32,0x61,
+0x78,0x33,0x33,0x4b,0x3b,0x22,0x20,0x5b,
+0x3c,0x3d,0x20,0x6e,0x65,0x73,0x74,0x6c,
+0x69,0x73,0x74,0x5d,0x20,0x6e,0x65,0x73,
+0x74,0x6c,0x69,0x73,0x74,0x29,0x20,0x6e,
+0x6e,0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,
 0x38,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x7c,0x63,0x31,0x71,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x76,0x61,0x6c,0x75,0x65,0x73,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x30,0x63,0x30,0x7e,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x74,0x6f,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x21,0x29,0x5d,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x62,
-0x75,0x66,0x66,0x65,0x72,0x29,0x5d,0x20,
-0x6f,0x70,0x65,0x6e,0x2d,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2d,0x6f,0x75,0x74,0x70,
-0x75,0x74,0x2d,0x70,0x6f,0x72,0x74,0x29,
-0x20,0x6f,0x72,0x6d,0x61,0x70,0x20,0x23,
-0x38,0x23,0x20,0x6f,0x75,0x74,0x70,0x75,
-0x74,0x2d,0x70,0x6f,0x72,0x74,0x3f,0x20,
+0x63,0x31,0x7c,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x63,0x6f,0x75,0x6e,0x74,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x41,0x40,0x3b,0x22,0x20,
+0x5b,0x5d,0x29,0x5d,0x20,0x6e,0x6e,0x6e,
+0x29,0x20,0x6e,0x72,0x65,0x63,0x6f,0x6e,
+0x63,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x32,0x65,0x30,0x7d,
+0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,0x72,
+0x65,0x76,0x65,0x72,0x73,0x65,0x21,0x2d,
+0x5d,0x20,0x6e,0x72,0x65,0x63,0x6f,0x6e,
+0x63,0x29,0x20,0x6f,0x64,0x64,0x3f,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x7c,0x34,0x31,
+0x30,0x72,0x31,0x65,0x30,0x7c,0x33,0x31,
+0x40,0x3b,0x22,0x20,0x5b,0x65,0x76,0x65,
+0x6e,0x3f,0x5d,0x20,0x6f,0x64,0x64,0x3f,
+0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x66,0x69,0x6c,
+0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
+0x63,0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x66,0x69,0x6c,0x65,
+0x29,0x20,0x3a,0x72,0x65,0x61,0x64,0x5d,
+0x20,0x6f,0x70,0x65,0x6e,0x2d,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x66,0x69,0x6c,0x65,
+0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x63,0x31,0x33,0x30,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x69,0x6f,0x73,0x74,0x72,0x65,0x61,0x6d,
-0x3f,0x29,0x5d,0x20,0x6f,0x75,0x74,0x70,
-0x75,0x74,0x2d,0x70,0x6f,0x72,0x74,0x3f,
-0x29,0x20,0x70,0x61,0x72,0x74,0x69,0x74,
-0x69,0x6f,0x6e,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x63,
-0x30,0x65,0x31,0x7c,0x7d,0x33,0x32,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x65,0x30,0x7c,0x4d,0x7c,0x4e,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x76,0x61,0x6c,0x75,
-0x65,0x73,0x5d,0x29,0x20,0x73,0x65,0x70,
-0x61,0x72,0x61,0x74,0x65,0x5d,0x20,0x70,
-0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,
-0x29,0x20,0x70,0x65,0x65,0x6b,0x2d,0x63,
-0x68,0x61,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x5c,0x78,0x38,
-0x39,0x30,0x30,0x30,0x30,0x31,0x30,0x30,
-0x30,0x5c,0x78,0x38,0x61,0x30,0x30,0x30,
-0x30,0x37,0x37,0x30,0x65,0x30,0x6d,0x30,
-0x32,0x63,0x31,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x2a,0x69,0x6e,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
-0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x70,0x65,0x65,0x6b,0x63,0x29,0x5d,0x20,
-0x70,0x65,0x65,0x6b,0x2d,0x63,0x68,0x61,
-0x72,0x29,0x20,0x70,0x6f,0x72,0x74,0x2d,
-0x65,0x6f,0x66,0x3f,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x65,0x6f,0x66,0x3f,0x29,0x5d,0x20,0x70,
-0x6f,0x72,0x74,0x2d,0x65,0x6f,0x66,0x3f,
-0x29,0x20,0x70,0x6f,0x72,0x74,0x3f,0x20,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x7c,0x7e,0x33,0x32,0x32,0x63,0x31,
+0x7c,0x60,0x33,0x32,0x32,0x7c,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
+0x2e,0x77,0x72,0x69,0x74,0x65,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x73,
+0x65,0x65,0x6b,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x62,0x75,0x66,0x66,0x65,
+0x72,0x29,0x5d,0x20,0x6f,0x70,0x65,0x6e,
+0x2d,0x69,0x6e,0x70,0x75,0x74,0x2d,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x29,0x20,0x6f,
+0x70,0x65,0x6e,0x2d,0x6f,0x75,0x74,0x70,
+0x75,0x74,0x2d,0x66,0x69,0x6c,0x65,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x7c,0x63,0x31,
+0x63,0x32,0x34,0x33,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x66,0x69,0x6c,0x65,
+0x29,0x20,0x3a,0x77,0x72,0x69,0x74,0x65,
+0x20,0x3a,0x63,0x72,0x65,0x61,0x74,0x65,
+0x5d,0x20,0x6f,0x70,0x65,0x6e,0x2d,0x6f,
+0x75,0x74,0x70,0x75,0x74,0x2d,0x66,0x69,
+0x6c,0x65,0x29,0x20,0x6f,0x70,0x65,0x6e,
+0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x30,0x63,0x30,0x34,0x30,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x62,0x75,
+0x66,0x66,0x65,0x72,0x29,0x5d,0x20,0x6f,
+0x70,0x65,0x6e,0x2d,0x6f,0x75,0x74,0x70,
+0x75,0x74,0x2d,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x6f,
+0x75,0x74,0x70,0x75,0x74,0x2d,0x70,0x6f,
+0x72,0x74,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x30,0x63,0x30,
+0x63,0x31,0x33,0x30,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x7c,
+0x63,0x31,0x71,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x76,0x61,0x6c,0x75,0x65,0x73,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x7c,0x34,0x31,
+0x30,0x72,0x30,0x63,0x30,0x7e,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x69,0x6f,0x73,0x74,0x72,0x65,0x61,0x6d,
-0x3f,0x29,0x5d,0x20,0x70,0x6f,0x72,0x74,
-0x3f,0x29,0x20,0x70,0x6f,0x73,0x69,0x74,
-0x69,0x76,0x65,0x3f,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x65,0x30,0x7c,0x60,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x3e,0x5d,0x20,0x70,0x6f,0x73,
-0x69,0x74,0x69,0x76,0x65,0x3f,0x29,0x20,
-0x70,0x72,0x65,0x74,0x74,0x79,0x2d,0x70,
-0x72,0x69,0x6e,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x77,0x72,0x69,0x74,0x65,0x29,0x20,
-0x70,0x72,0x69,0x6e,0x74,0x2d,0x65,0x78,
-0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x3d,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x46,0x31,0x36,0x44,
-0x30,0x32,0x7c,0x4d,0x63,0x30,0x3c,0x31,
-0x36,0x3a,0x30,0x32,0x65,0x31,0x7c,0x62,
-0x34,0x33,0x32,0x36,0x64,0x30,0x63,0x32,
-0x63,0x33,0x33,0x31,0x32,0x63,0x32,0x7c,
+0x69,0x6f,0x2e,0x74,0x6f,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x21,0x29,0x5d,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x62,0x75,
+0x66,0x66,0x65,0x72,0x29,0x5d,0x20,0x6f,
+0x70,0x65,0x6e,0x2d,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2d,0x6f,0x75,0x74,0x70,0x75,
+0x74,0x2d,0x70,0x6f,0x72,0x74,0x29,0x20,
+0x6f,0x72,0x6d,0x61,0x70,0x20,0x23,0x38,
+0x23,0x20,0x6f,0x75,0x74,0x70,0x75,0x74,
+0x2d,0x70,0x6f,0x72,0x74,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x7c,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
+0x6f,0x73,0x74,0x72,0x65,0x61,0x6d,0x3f,
+0x29,0x5d,0x20,0x6f,0x75,0x74,0x70,0x75,
+0x74,0x2d,0x70,0x6f,0x72,0x74,0x3f,0x29,
+0x20,0x70,0x61,0x72,0x74,0x69,0x74,0x69,
+0x6f,0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
+0x65,0x31,0x7c,0x7d,0x33,0x32,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x7c,0x4d,0x7c,0x4e,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x76,0x61,0x6c,0x75,0x65,
+0x73,0x5d,0x29,0x20,0x73,0x65,0x70,0x61,
+0x72,0x61,0x74,0x65,0x5d,0x20,0x70,0x61,
+0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x29,
+0x20,0x70,0x65,0x65,0x6b,0x2d,0x63,0x68,
+0x61,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x5c,0x78,0x38,0x39,
+0x30,0x30,0x30,0x30,0x31,0x30,0x30,0x30,
+0x5c,0x78,0x38,0x61,0x30,0x30,0x30,0x30,
+0x37,0x37,0x30,0x65,0x30,0x6d,0x30,0x32,
+0x63,0x31,0x7c,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x2a,0x69,0x6e,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x70,
+0x65,0x65,0x6b,0x63,0x29,0x5d,0x20,0x70,
+0x65,0x65,0x6b,0x2d,0x63,0x68,0x61,0x72,
+0x29,0x20,0x70,0x6f,0x72,0x74,0x2d,0x65,
+0x6f,0x66,0x3f,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x65,
+0x6f,0x66,0x3f,0x29,0x5d,0x20,0x70,0x6f,
+0x72,0x74,0x2d,0x65,0x6f,0x66,0x3f,0x29,
+0x20,0x70,0x6f,0x72,0x74,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x7c,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
+0x6f,0x73,0x74,0x72,0x65,0x61,0x6d,0x3f,
+0x29,0x5d,0x20,0x70,0x6f,0x72,0x74,0x3f,
+0x29,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,
+0x76,0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x7c,0x60,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x3e,0x5d,0x20,0x70,0x6f,0x73,0x69,
+0x74,0x69,0x76,0x65,0x3f,0x29,0x20,0x70,
+0x72,0x65,0x74,0x74,0x79,0x2d,0x70,0x72,
+0x69,0x6e,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x77,0x72,0x69,0x74,0x65,0x29,0x20,0x70,
+0x72,0x69,0x6e,0x74,0x2d,0x65,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x3d,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x46,0x31,0x36,0x44,0x30,
+0x32,0x7c,0x4d,0x63,0x30,0x3c,0x31,0x36,
+0x3a,0x30,0x32,0x65,0x31,0x7c,0x62,0x34,
+0x33,0x32,0x36,0x64,0x30,0x63,0x32,0x63,
+0x33,0x33,0x31,0x32,0x63,0x32,0x7c,0x5c,
+0x78,0x38,0x34,0x33,0x31,0x32,0x63,0x32,
+0x63,0x34,0x33,0x31,0x32,0x63,0x32,0x65,
+0x35,0x7c,0x33,0x31,0x33,0x31,0x32,0x63,
+0x32,0x63,0x36,0x33,0x31,0x32,0x63,0x37,
+0x65,0x38,0x7c,0x33,0x31,0x33,0x31,0x35,
+0x27,0x30,0x7c,0x46,0x31,0x36,0x44,0x30,
+0x32,0x7c,0x4d,0x63,0x39,0x3c,0x31,0x36,
+0x3a,0x30,0x32,0x65,0x31,0x7c,0x62,0x34,
+0x33,0x32,0x36,0x5d,0x30,0x63,0x32,0x7c,
 0x5c,0x78,0x38,0x34,0x33,0x31,0x32,0x63,
-0x32,0x63,0x34,0x33,0x31,0x32,0x63,0x32,
-0x65,0x35,0x7c,0x33,0x31,0x33,0x31,0x32,
-0x63,0x32,0x63,0x36,0x33,0x31,0x32,0x63,
-0x37,0x65,0x38,0x7c,0x33,0x31,0x33,0x31,
-0x35,0x27,0x30,0x7c,0x46,0x31,0x36,0x44,
-0x30,0x32,0x7c,0x4d,0x63,0x39,0x3c,0x31,
+0x32,0x63,0x3a,0x33,0x31,0x32,0x63,0x32,
+0x65,0x38,0x7c,0x33,0x31,0x33,0x31,0x32,
+0x63,0x32,0x63,0x3b,0x33,0x31,0x32,0x63,
+0x37,0x65,0x35,0x7c,0x33,0x31,0x33,0x31,
+0x35,0x5c,0x78,0x65,0x31,0x30,0x7c,0x46,
+0x31,0x36,0x40,0x30,0x32,0x7c,0x4d,0x63,
+0x3c,0x3c,0x31,0x36,0x36,0x30,0x32,0x7c,
+0x4e,0x46,0x36,0x49,0x30,0x63,0x32,0x63,
+0x3d,0x33,0x31,0x32,0x63,0x32,0x7c,0x5c,
+0x78,0x38,0x34,0x33,0x31,0x32,0x63,0x32,
+0x63,0x3e,0x33,0x31,0x35,0x5c,0x78,0x62,
+0x33,0x30,0x7c,0x46,0x31,0x36,0x38,0x30,
+0x32,0x7c,0x4d,0x63,0x3f,0x3c,0x36,0x44,
+0x30,0x63,0x32,0x63,0x40,0x33,0x31,0x32,
+0x65,0x41,0x63,0x32,0x7c,0x4e,0x33,0x32,
+0x35,0x5c,0x78,0x39,0x32,0x30,0x7c,0x46,
+0x31,0x36,0x38,0x30,0x32,0x7c,0x4d,0x63,
+0x42,0x3c,0x36,0x4c,0x30,0x65,0x43,0x65,
+0x35,0x7c,0x33,0x31,0x33,0x31,0x32,0x63,
+0x32,0x63,0x44,0x33,0x31,0x32,0x63,0x32,
+0x7c,0x5c,0x78,0x38,0x34,0x33,0x31,0x35,
+0x69,0x30,0x65,0x45,0x7c,0x33,0x31,0x31,
 0x36,0x3a,0x30,0x32,0x65,0x31,0x7c,0x62,
-0x34,0x33,0x32,0x36,0x5d,0x30,0x63,0x32,
-0x7c,0x5c,0x78,0x38,0x34,0x33,0x31,0x32,
-0x63,0x32,0x63,0x3a,0x33,0x31,0x32,0x63,
-0x32,0x65,0x38,0x7c,0x33,0x31,0x33,0x31,
-0x32,0x63,0x32,0x63,0x3b,0x33,0x31,0x32,
-0x63,0x37,0x65,0x35,0x7c,0x33,0x31,0x33,
-0x31,0x35,0x5c,0x78,0x65,0x31,0x30,0x7c,
-0x46,0x31,0x36,0x40,0x30,0x32,0x7c,0x4d,
-0x63,0x3c,0x3c,0x31,0x36,0x36,0x30,0x32,
-0x7c,0x4e,0x46,0x36,0x49,0x30,0x63,0x32,
-0x63,0x3d,0x33,0x31,0x32,0x63,0x32,0x7c,
-0x5c,0x78,0x38,0x34,0x33,0x31,0x32,0x63,
-0x32,0x63,0x3e,0x33,0x31,0x35,0x5c,0x78,
-0x62,0x33,0x30,0x7c,0x46,0x31,0x36,0x38,
-0x30,0x32,0x7c,0x4d,0x63,0x3f,0x3c,0x36,
-0x44,0x30,0x63,0x32,0x63,0x40,0x33,0x31,
-0x32,0x65,0x41,0x63,0x32,0x7c,0x4e,0x33,
-0x32,0x35,0x5c,0x78,0x39,0x32,0x30,0x7c,
-0x46,0x31,0x36,0x38,0x30,0x32,0x7c,0x4d,
-0x63,0x42,0x3c,0x36,0x4c,0x30,0x65,0x43,
-0x65,0x35,0x7c,0x33,0x31,0x33,0x31,0x32,
-0x63,0x32,0x63,0x44,0x33,0x31,0x32,0x63,
-0x32,0x7c,0x5c,0x78,0x38,0x34,0x33,0x31,
-0x35,0x69,0x30,0x65,0x45,0x7c,0x33,0x31,
-0x31,0x36,0x3a,0x30,0x32,0x65,0x31,0x7c,
-0x62,0x32,0x33,0x32,0x36,0x49,0x30,0x63,
-0x37,0x7c,0x4d,0x33,0x31,0x32,0x63,0x32,
-0x63,0x46,0x33,0x31,0x32,0x63,0x47,0x7c,
-0x5c,0x78,0x38,0x34,0x33,0x31,0x35,0x3e,
-0x30,0x63,0x32,0x63,0x48,0x33,0x31,0x32,
-0x63,0x37,0x7c,0x33,0x31,0x32,0x63,0x49,
-0x34,0x30,0x3b,0x22,0x20,0x5b,0x74,0x79,
-0x70,0x65,0x2d,0x65,0x72,0x72,0x6f,0x72,
-0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,
-0x20,0x23,0x66,0x6e,0x28,0x64,0x69,0x73,
-0x70,0x6c,0x61,0x79,0x29,0x20,0x22,0x74,
-0x79,0x70,0x65,0x20,0x65,0x72,0x72,0x6f,
-0x72,0x3a,0x20,0x22,0x20,0x22,0x3a,0x20,
-0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,
-0x20,0x22,0x20,0x63,0x61,0x64,0x64,0x72,
-0x20,0x22,0x2c,0x20,0x67,0x6f,0x74,0x20,
-0x22,0x20,0x23,0x66,0x6e,0x28,0x77,0x72,
-0x69,0x74,0x65,0x29,0x20,0x63,0x61,0x64,
-0x64,0x64,0x72,0x20,0x62,0x6f,0x75,0x6e,
-0x64,0x73,0x2d,0x65,0x72,0x72,0x6f,0x72,
-0x20,0x22,0x3a,0x20,0x69,0x6e,0x64,0x65,
-0x78,0x20,0x22,0x20,0x22,0x20,0x6f,0x75,
-0x74,0x20,0x6f,0x66,0x20,0x62,0x6f,0x75,
-0x6e,0x64,0x73,0x20,0x66,0x6f,0x72,0x20,
-0x22,0x20,0x75,0x6e,0x62,0x6f,0x75,0x6e,
-0x64,0x2d,0x65,0x72,0x72,0x6f,0x72,0x20,
-0x22,0x65,0x76,0x61,0x6c,0x3a,0x20,0x76,
-0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,
-0x22,0x20,0x22,0x20,0x68,0x61,0x73,0x20,
-0x6e,0x6f,0x20,0x76,0x61,0x6c,0x75,0x65,
-0x22,0x20,0x65,0x72,0x72,0x6f,0x72,0x20,
-0x22,0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,
-0x22,0x20,0x66,0x6f,0x72,0x2d,0x65,0x61,
-0x63,0x68,0x20,0x6c,0x6f,0x61,0x64,0x2d,
-0x65,0x72,0x72,0x6f,0x72,0x20,0x70,0x72,
-0x69,0x6e,0x74,0x2d,0x65,0x78,0x63,0x65,
-0x70,0x74,0x69,0x6f,0x6e,0x20,0x22,0x69,
-0x6e,0x20,0x66,0x69,0x6c,0x65,0x20,0x22,
-0x20,0x6c,0x69,0x73,0x74,0x3f,0x20,0x22,
-0x3a,0x20,0x22,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x7c,0x33,0x31,0x31,0x37,0x35,0x30,
-0x32,0x7c,0x43,0x36,0x37,0x30,0x63,0x31,
-0x35,0x34,0x30,0x63,0x32,0x7c,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x3f,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x64,0x69,0x73,
-0x70,0x6c,0x61,0x79,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x77,0x72,0x69,0x74,0x65,0x29,
-0x5d,0x29,0x20,0x22,0x2a,0x2a,0x2a,0x20,
-0x55,0x6e,0x68,0x61,0x6e,0x64,0x6c,0x65,
-0x64,0x20,0x65,0x78,0x63,0x65,0x70,0x74,
-0x69,0x6f,0x6e,0x3a,0x20,0x22,0x20,0x23,
-0x66,0x6e,0x28,0x6e,0x65,0x77,0x6c,0x69,
-0x6e,0x65,0x29,0x5d,0x20,0x70,0x72,0x69,
+0x32,0x33,0x32,0x36,0x49,0x30,0x63,0x37,
+0x7c,0x4d,0x33,0x31,0x32,0x63,0x32,0x63,
+0x46,0x33,0x31,0x32,0x63,0x47,0x7c,0x5c,
+0x78,0x38,0x34,0x33,0x31,0x35,0x3e,0x30,
+0x63,0x32,0x63,0x48,0x33,0x31,0x32,0x63,
+0x37,0x7c,0x33,0x31,0x32,0x63,0x49,0x34,
+0x30,0x3b,0x22,0x20,0x5b,0x74,0x79,0x70,
+0x65,0x2d,0x65,0x72,0x72,0x6f,0x72,0x20,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x3d,0x20,
+0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
+0x6c,0x61,0x79,0x29,0x20,0x22,0x74,0x79,
+0x70,0x65,0x20,0x65,0x72,0x72,0x6f,0x72,
+0x3a,0x20,0x22,0x20,0x22,0x3a,0x20,0x65,
+0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,
+0x22,0x20,0x63,0x61,0x64,0x64,0x72,0x20,
+0x22,0x2c,0x20,0x67,0x6f,0x74,0x20,0x22,
+0x20,0x23,0x66,0x6e,0x28,0x77,0x72,0x69,
+0x74,0x65,0x29,0x20,0x63,0x61,0x64,0x64,
+0x64,0x72,0x20,0x62,0x6f,0x75,0x6e,0x64,
+0x73,0x2d,0x65,0x72,0x72,0x6f,0x72,0x20,
+0x22,0x3a,0x20,0x69,0x6e,0x64,0x65,0x78,
+0x20,0x22,0x20,0x22,0x20,0x6f,0x75,0x74,
+0x20,0x6f,0x66,0x20,0x62,0x6f,0x75,0x6e,
+0x64,0x73,0x20,0x66,0x6f,0x72,0x20,0x22,
+0x20,0x75,0x6e,0x62,0x6f,0x75,0x6e,0x64,
+0x2d,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,
+0x65,0x76,0x61,0x6c,0x3a,0x20,0x76,0x61,
+0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x22,
+0x20,0x22,0x20,0x68,0x61,0x73,0x20,0x6e,
+0x6f,0x20,0x76,0x61,0x6c,0x75,0x65,0x22,
+0x20,0x65,0x72,0x72,0x6f,0x72,0x20,0x22,
+0x65,0x72,0x72,0x6f,0x72,0x3a,0x20,0x22,
+0x20,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,
+0x68,0x20,0x6c,0x6f,0x61,0x64,0x2d,0x65,
+0x72,0x72,0x6f,0x72,0x20,0x70,0x72,0x69,
 0x6e,0x74,0x2d,0x65,0x78,0x63,0x65,0x70,
-0x74,0x69,0x6f,0x6e,0x29,0x20,0x70,0x72,
-0x69,0x6e,0x74,0x2d,0x73,0x74,0x61,0x63,
-0x6b,0x2d,0x74,0x72,0x61,0x63,0x65,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x71,0x5d,0x5d,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x3d,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x6d,0x30,0x32,0x63,
-0x31,0x71,0x6d,0x31,0x32,0x63,0x32,0x71,
-0x65,0x33,0x65,0x34,0x7e,0x65,0x35,0x36,
-0x37,0x30,0x62,0x35,0x35,0x34,0x30,0x62,
-0x34,0x33,0x32,0x33,0x31,0x65,0x36,0x65,
-0x37,0x63,0x38,0x63,0x39,0x63,0x3a,0x33,
-0x30,0x33,0x32,0x33,0x32,0x60,0x34,0x33,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x33,0x63,
-0x30,0x71,0x63,0x31,0x7c,0x33,0x31,0x67,
-0x32,0x4b,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x7e,0x33,0x31,
-0x63,0x30,0x5c,0x78,0x37,0x66,0x33,0x31,
-0x5c,0x78,0x38,0x32,0x3e,0x30,0x63,0x31,
-0x63,0x32,0x63,0x33,0x7c,0x4c,0x33,0x34,
-0x31,0x3b,0x63,0x34,0x71,0x63,0x35,0x7e,
-0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x74,0x69,0x6f,0x6e,0x20,0x22,0x69,0x6e,
+0x20,0x66,0x69,0x6c,0x65,0x20,0x22,0x20,
+0x6c,0x69,0x73,0x74,0x3f,0x20,0x22,0x3a,
+0x20,0x22,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x7c,0x33,0x31,0x31,0x37,0x35,0x30,0x32,
+0x7c,0x43,0x36,0x37,0x30,0x63,0x31,0x35,
+0x34,0x30,0x63,0x32,0x7c,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x3f,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x64,0x69,0x73,0x70,
+0x6c,0x61,0x79,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x77,0x72,0x69,0x74,0x65,0x29,0x5d,
+0x29,0x20,0x22,0x2a,0x2a,0x2a,0x20,0x55,
+0x6e,0x68,0x61,0x6e,0x64,0x6c,0x65,0x64,
+0x20,0x65,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x3a,0x20,0x22,0x20,0x23,0x66,
+0x6e,0x28,0x6e,0x65,0x77,0x6c,0x69,0x6e,
+0x65,0x29,0x5d,0x20,0x70,0x72,0x69,0x6e,
+0x74,0x2d,0x65,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x29,0x20,0x70,0x72,0x69,
+0x6e,0x74,0x2d,0x73,0x74,0x61,0x63,0x6b,
+0x2d,0x74,0x72,0x61,0x63,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x71,0x5d,0x5d,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x3d,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x71,0x6d,0x30,0x32,0x63,0x31,
+0x71,0x6d,0x31,0x32,0x63,0x32,0x71,0x65,
+0x33,0x65,0x34,0x7e,0x65,0x35,0x36,0x37,
+0x30,0x62,0x35,0x35,0x34,0x30,0x62,0x34,
+0x33,0x32,0x33,0x31,0x65,0x36,0x65,0x37,
+0x63,0x38,0x63,0x39,0x63,0x3a,0x33,0x30,
+0x33,0x32,0x33,0x32,0x60,0x34,0x33,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x33,0x63,0x30,
+0x71,0x63,0x31,0x7c,0x33,0x31,0x67,0x32,
+0x4b,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x7e,0x33,0x31,0x63,
+0x30,0x5c,0x78,0x37,0x66,0x33,0x31,0x5c,
+0x78,0x38,0x32,0x3e,0x30,0x63,0x31,0x63,
+0x32,0x63,0x33,0x7c,0x4c,0x33,0x34,0x31,
+0x3b,0x63,0x34,0x71,0x63,0x35,0x7e,0x33,
+0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x3a,0x63,0x6f,0x64,0x65,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x72,0x61,
+0x69,0x73,0x65,0x29,0x20,0x74,0x68,0x72,
+0x6f,0x77,0x6e,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x20,0x66,0x66,0x6f,0x75,0x6e,0x64,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x31,0x60,0x65,0x30,0x63,
+0x31,0x7c,0x33,0x31,0x33,0x31,0x63,0x32,
+0x71,0x75,0x3b,0x22,0x20,0x5b,0x31,0x2d,
+0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,
+0x67,0x74,0x68,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x31,
+0x65,0x30,0x7e,0x7c,0x5b,0x33,0x31,0x36,
+0x41,0x30,0x69,0x33,0x30,0x7e,0x7c,0x5b,
+0x69,0x32,0x31,0x69,0x31,0x30,0x34,0x33,
+0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x63,0x6c,
+0x6f,0x73,0x75,0x72,0x65,0x3f,0x5d,0x29,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x3a,
+0x76,0x61,0x6c,0x73,0x29,0x5d,0x29,0x20,
 0x23,0x66,0x6e,0x28,0x66,0x75,0x6e,0x63,
-0x74,0x69,0x6f,0x6e,0x3a,0x63,0x6f,0x64,
-0x65,0x29,0x20,0x23,0x66,0x6e,0x28,0x72,
-0x61,0x69,0x73,0x65,0x29,0x20,0x74,0x68,
-0x72,0x6f,0x77,0x6e,0x2d,0x76,0x61,0x6c,
-0x75,0x65,0x20,0x66,0x66,0x6f,0x75,0x6e,
-0x64,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x31,0x60,0x65,0x30,
-0x63,0x31,0x7c,0x33,0x31,0x33,0x31,0x63,
-0x32,0x71,0x75,0x3b,0x22,0x20,0x5b,0x31,
-0x2d,0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,
-0x6e,0x67,0x74,0x68,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x65,0x30,0x7e,0x7c,0x5b,0x33,0x31,
-0x36,0x41,0x30,0x69,0x33,0x30,0x7e,0x7c,
-0x5b,0x69,0x32,0x31,0x69,0x31,0x30,0x34,
-0x33,0x3b,0x5d,0x3b,0x22,0x20,0x5b,0x63,
-0x6c,0x6f,0x73,0x75,0x72,0x65,0x3f,0x5d,
-0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-0x3a,0x76,0x61,0x6c,0x73,0x29,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x66,0x75,0x6e,
-0x63,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x61,
-0x6d,0x65,0x29,0x5d,0x20,0x66,0x69,0x6e,
-0x64,0x2d,0x69,0x6e,0x2d,0x66,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x32,0x63,0x30,0x63,0x31,0x71,
-0x63,0x32,0x74,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x36,0x48,0x30,
-0x63,0x30,0x65,0x31,0x63,0x32,0x63,0x33,
-0x65,0x34,0x7c,0x33,0x31,0x33,0x32,0x63,
-0x35,0x33,0x32,0x34,0x31,0x3b,0x63,0x36,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x73,0x79,0x6d,0x62,0x6f,0x6c,0x29,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x6a,
-0x6f,0x69,0x6e,0x20,0x23,0x66,0x6e,0x28,
-0x6d,0x61,0x70,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x29,
-0x20,0x72,0x65,0x76,0x65,0x72,0x73,0x65,
-0x21,0x20,0x22,0x2f,0x22,0x20,0x6c,0x61,
-0x6d,0x62,0x64,0x61,0x5d,0x29,0x20,0x23,
+0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x61,0x6d,
+0x65,0x29,0x5d,0x20,0x66,0x69,0x6e,0x64,
+0x2d,0x69,0x6e,0x2d,0x66,0x29,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x30,0x65,0x30,0x63,0x31,0x71,0x5c,
-0x78,0x37,0x66,0x33,0x32,0x32,0x5e,0x3b,
-0x22,0x20,0x5b,0x66,0x6f,0x72,0x2d,0x65,
-0x61,0x63,0x68,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x69,
-0x31,0x30,0x7c,0x7e,0x5f,0x34,0x33,0x3b,
-0x22,0x20,0x5b,0x5d,0x29,0x5d,0x29,0x20,
+0x72,0x32,0x63,0x30,0x63,0x31,0x71,0x63,
+0x32,0x74,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
+0x30,0x72,0x31,0x7c,0x36,0x48,0x30,0x63,
+0x30,0x65,0x31,0x63,0x32,0x63,0x33,0x65,
+0x34,0x7c,0x33,0x31,0x33,0x32,0x63,0x35,
+0x33,0x32,0x34,0x31,0x3b,0x63,0x36,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x29,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x6a,0x6f,
+0x69,0x6e,0x20,0x23,0x66,0x6e,0x28,0x6d,
+0x61,0x70,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x29,0x20,
+0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x21,
+0x20,0x22,0x2f,0x22,0x20,0x6c,0x61,0x6d,
+0x62,0x64,0x61,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x30,0x65,0x30,0x63,0x31,0x71,0x5c,0x78,
+0x37,0x66,0x33,0x32,0x32,0x5e,0x3b,0x22,
+0x20,0x5b,0x66,0x6f,0x72,0x2d,0x65,0x61,
+0x63,0x68,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x69,0x31,
+0x30,0x7c,0x7e,0x5f,0x34,0x33,0x3b,0x22,
+0x20,0x5b,0x5d,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x46,0x31,0x36,0x42,0x30,
+0x32,0x7c,0x4d,0x63,0x30,0x3c,0x31,0x36,
+0x38,0x30,0x32,0x7c,0x5c,0x78,0x38,0x34,
+0x63,0x31,0x3c,0x36,0x38,0x30,0x65,0x32,
+0x7c,0x34,0x31,0x3b,0x63,0x33,0x7c,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x74,0x68,0x72,
+0x6f,0x77,0x6e,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x20,0x66,0x66,0x6f,0x75,0x6e,0x64,
+0x20,0x63,0x61,0x64,0x64,0x72,0x20,0x23,
+0x66,0x6e,0x28,0x72,0x61,0x69,0x73,0x65,
+0x29,0x5d,0x29,0x5d,0x20,0x66,0x6e,0x2d,
+0x6e,0x61,0x6d,0x65,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x33,0x65,0x30,0x63,0x31,0x71,0x7c,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x66,0x6f,0x72,
+0x2d,0x65,0x61,0x63,0x68,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x63,0x31,0x33,0x31,0x32,
+0x63,0x30,0x69,0x30,0x32,0x33,0x31,0x32,
+0x63,0x30,0x63,0x32,0x33,0x31,0x32,0x63,
+0x33,0x69,0x31,0x31,0x7c,0x60,0x5b,0x5c,
+0x78,0x37,0x66,0x33,0x32,0x65,0x34,0x7c,
+0x33,0x31,0x4e,0x4b,0x33,0x31,0x32,0x69,
+0x30,0x32,0x61,0x77,0x6f,0x30,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x64,
+0x69,0x73,0x70,0x6c,0x61,0x79,0x29,0x20,
+0x22,0x23,0x22,0x20,0x22,0x20,0x22,0x20,
+0x23,0x66,0x6e,0x28,0x77,0x72,0x69,0x74,
+0x65,0x6c,0x6e,0x29,0x20,0x76,0x65,0x63,
+0x74,0x6f,0x72,0x2d,0x3e,0x6c,0x69,0x73,
+0x74,0x5d,0x29,0x5d,0x29,0x20,0x72,0x65,
+0x76,0x65,0x72,0x73,0x65,0x21,0x20,0x6c,
+0x69,0x73,0x74,0x2d,0x74,0x61,0x69,0x6c,
+0x20,0x2a,0x69,0x6e,0x74,0x65,0x72,0x61,
+0x63,0x74,0x69,0x76,0x65,0x2a,0x20,0x66,
+0x69,0x6c,0x74,0x65,0x72,0x20,0x63,0x6c,
+0x6f,0x73,0x75,0x72,0x65,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x46,0x31,0x36,0x42,
-0x30,0x32,0x7c,0x4d,0x63,0x30,0x3c,0x31,
-0x36,0x38,0x30,0x32,0x7c,0x5c,0x78,0x38,
-0x34,0x63,0x31,0x3c,0x36,0x38,0x30,0x65,
-0x32,0x7c,0x34,0x31,0x3b,0x63,0x33,0x7c,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x74,0x68,
-0x72,0x6f,0x77,0x6e,0x2d,0x76,0x61,0x6c,
-0x75,0x65,0x20,0x66,0x66,0x6f,0x75,0x6e,
-0x64,0x20,0x63,0x61,0x64,0x64,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x72,0x61,0x69,0x73,
-0x65,0x29,0x5d,0x29,0x5d,0x20,0x66,0x6e,
-0x2d,0x6e,0x61,0x6d,0x65,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x33,0x65,0x30,0x63,0x31,0x71,0x7c,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x66,0x6f,
-0x72,0x2d,0x65,0x61,0x63,0x68,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x63,0x31,0x33,0x31,
-0x32,0x63,0x30,0x69,0x30,0x32,0x33,0x31,
-0x32,0x63,0x30,0x63,0x32,0x33,0x31,0x32,
-0x63,0x33,0x69,0x31,0x31,0x7c,0x60,0x5b,
-0x5c,0x78,0x37,0x66,0x33,0x32,0x65,0x34,
-0x7c,0x33,0x31,0x4e,0x4b,0x33,0x31,0x32,
-0x69,0x30,0x32,0x61,0x77,0x6f,0x30,0x32,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x29,
-0x20,0x22,0x23,0x22,0x20,0x22,0x20,0x22,
-0x20,0x23,0x66,0x6e,0x28,0x77,0x72,0x69,
-0x74,0x65,0x6c,0x6e,0x29,0x20,0x76,0x65,
-0x63,0x74,0x6f,0x72,0x2d,0x3e,0x6c,0x69,
-0x73,0x74,0x5d,0x29,0x5d,0x29,0x20,0x72,
-0x65,0x76,0x65,0x72,0x73,0x65,0x21,0x20,
-0x6c,0x69,0x73,0x74,0x2d,0x74,0x61,0x69,
-0x6c,0x20,0x2a,0x69,0x6e,0x74,0x65,0x72,
-0x61,0x63,0x74,0x69,0x76,0x65,0x2a,0x20,
-0x66,0x69,0x6c,0x74,0x65,0x72,0x20,0x63,
-0x6c,0x6f,0x73,0x75,0x72,0x65,0x3f,0x20,
-0x23,0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x45,0x31,0x36,
-0x38,0x30,0x32,0x63,0x30,0x7c,0x34,0x31,
+0x30,0x72,0x31,0x7c,0x45,0x31,0x36,0x38,
+0x30,0x32,0x63,0x30,0x7c,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x74,
+0x6f,0x70,0x2d,0x6c,0x65,0x76,0x65,0x6c,
+0x2d,0x76,0x61,0x6c,0x75,0x65,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x65,0x6e,
+0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,
+0x74,0x29,0x5d,0x29,0x5d,0x20,0x70,0x72,
+0x69,0x6e,0x74,0x2d,0x73,0x74,0x61,0x63,
+0x6b,0x2d,0x74,0x72,0x61,0x63,0x65,0x29,
+0x20,0x70,0x72,0x69,0x6e,0x74,0x2d,0x74,
+0x6f,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x20,0x23,0x31,0x32,0x3d,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x71,0x63,0x31,0x33,0x30,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x7e,0x7c,0x33,0x32,0x32,0x63,
+0x31,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x77,0x72,0x69,0x74,
+0x65,0x29,0x20,0x23,0x66,0x6e,0x28,0x69,
+0x6f,0x2e,0x74,0x6f,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x21,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x62,0x75,0x66,0x66,0x65,
+0x72,0x29,0x5d,0x20,0x77,0x72,0x69,0x74,
+0x65,0x2d,0x74,0x6f,0x2d,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x29,0x20,0x70,0x72,0x69,
+0x6e,0x74,0x61,0x62,0x6c,0x65,0x3f,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x7c,0x33,0x31,
+0x31,0x37,0x38,0x30,0x32,0x63,0x31,0x7c,
+0x33,0x31,0x40,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x69,0x6f,0x73,0x74,0x72,
+0x65,0x61,0x6d,0x3f,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x65,0x6f,0x66,0x2d,0x6f,0x62,
+0x6a,0x65,0x63,0x74,0x3f,0x29,0x5d,0x20,
+0x70,0x72,0x69,0x6e,0x74,0x61,0x62,0x6c,
+0x65,0x3f,0x29,0x20,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,
+0x5c,0x78,0x38,0x39,0x32,0x30,0x30,0x30,
+0x34,0x30,0x30,0x30,0x5c,0x78,0x38,0x61,
+0x32,0x30,0x30,0x30,0x37,0x36,0x30,0x60,
+0x6d,0x32,0x32,0x5c,0x78,0x38,0x61,0x33,
+0x30,0x30,0x30,0x37,0x36,0x30,0x5e,0x6d,
+0x33,0x32,0x63,0x30,0x71,0x63,0x31,0x7d,
+0x60,0x67,0x32,0x33,0x33,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x3a,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x69,0x30,0x33,0x36,0x3e,0x30,0x63,
+0x31,0x5c,0x78,0x37,0x66,0x7c,0x69,0x30,
+0x33,0x33,0x33,0x35,0x37,0x30,0x63,0x32,
+0x5c,0x78,0x37,0x66,0x33,0x31,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,0x65,
-0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x65,
-0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,
-0x6e,0x74,0x29,0x5d,0x29,0x5d,0x20,0x70,
-0x72,0x69,0x6e,0x74,0x2d,0x73,0x74,0x61,
-0x63,0x6b,0x2d,0x74,0x72,0x61,0x63,0x65,
-0x29,0x20,0x70,0x72,0x69,0x6e,0x74,0x2d,
-0x74,0x6f,0x2d,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x20,0x23,0x31,0x32,0x3d,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x63,0x31,0x33,0x30,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7e,0x7c,0x33,0x32,0x32,
-0x63,0x31,0x7c,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x77,0x72,0x69,
-0x74,0x65,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x69,0x6f,0x2e,0x74,0x6f,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x21,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x62,0x75,0x66,0x66,
-0x65,0x72,0x29,0x5d,0x20,0x77,0x72,0x69,
-0x74,0x65,0x2d,0x74,0x6f,0x2d,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x29,0x20,0x70,0x72,
-0x69,0x6e,0x74,0x61,0x62,0x6c,0x65,0x3f,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x33,
-0x31,0x31,0x37,0x38,0x30,0x32,0x63,0x31,
-0x7c,0x33,0x31,0x40,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x69,0x6f,0x73,0x74,
-0x72,0x65,0x61,0x6d,0x3f,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x65,0x6f,0x66,0x2d,0x6f,
-0x62,0x6a,0x65,0x63,0x74,0x3f,0x29,0x5d,
-0x20,0x70,0x72,0x69,0x6e,0x74,0x61,0x62,
-0x6c,0x65,0x3f,0x29,0x20,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,
-0x30,0x5c,0x78,0x38,0x39,0x32,0x30,0x30,
-0x30,0x34,0x30,0x30,0x30,0x5c,0x78,0x38,
-0x61,0x32,0x30,0x30,0x30,0x37,0x36,0x30,
-0x60,0x6d,0x32,0x32,0x5c,0x78,0x38,0x61,
-0x33,0x30,0x30,0x30,0x37,0x36,0x30,0x5e,
-0x6d,0x33,0x32,0x63,0x30,0x71,0x63,0x31,
-0x7d,0x60,0x67,0x32,0x33,0x33,0x34,0x31,
+0x22,0x3b,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x69,0x31,0x30,0x69,0x31,0x31,0x7e,
+0x7c,0x7e,0x78,0x34,0x34,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x77,0x72,0x69,0x74,0x65,0x29,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x2e,0x69,0x6e,0x63,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x73,0x69,0x7a,
+0x65,0x6f,0x66,0x29,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x69,0x6e,0x63,0x29,0x5d,0x20,
+0x70,0x75,0x74,0x2d,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x29,0x20,0x70,0x75,0x74,0x2d,
+0x75,0x38,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
+0x7c,0x65,0x31,0x7d,0x33,0x31,0x34,0x32,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x69,0x30,0x33,0x36,0x3e,0x30,
-0x63,0x31,0x5c,0x78,0x37,0x66,0x7c,0x69,
-0x30,0x33,0x33,0x33,0x35,0x37,0x30,0x63,
-0x32,0x5c,0x78,0x37,0x66,0x33,0x31,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x69,0x31,0x30,0x69,0x31,0x31,
-0x7e,0x7c,0x7e,0x78,0x34,0x34,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x77,0x72,0x69,0x74,0x65,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x69,0x6e,0x63,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x69,
-0x7a,0x65,0x6f,0x66,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x69,0x6e,0x63,0x29,0x5d,
-0x20,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x29,0x20,0x70,0x75,0x74,
-0x2d,0x75,0x38,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x63,
-0x30,0x7c,0x65,0x31,0x7d,0x33,0x31,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x77,0x72,0x69,0x74,
-0x65,0x29,0x20,0x75,0x69,0x6e,0x74,0x38,
-0x5d,0x20,0x70,0x75,0x74,0x2d,0x75,0x38,
-0x29,0x20,0x70,0x75,0x74,0x70,0x72,0x6f,
-0x70,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
-0x30,0x30,0x30,0x72,0x33,0x63,0x30,0x71,
-0x63,0x31,0x7e,0x7c,0x5e,0x33,0x33,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x3a,0x30,0x30,0x30,0x72,0x31,
-0x7c,0x37,0x3e,0x30,0x63,0x30,0x71,0x63,
-0x31,0x33,0x30,0x33,0x31,0x35,0x33,0x30,
-0x5d,0x32,0x63,0x32,0x7c,0x5c,0x78,0x37,
-0x66,0x69,0x30,0x32,0x34,0x33,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x69,
-0x32,0x30,0x69,0x31,0x30,0x7c,0x33,0x33,
-0x32,0x7c,0x6f,0x30,0x30,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x70,0x75,0x74,
-0x21,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x74,0x61,0x62,0x6c,0x65,0x29,0x20,
+0x69,0x6f,0x2e,0x77,0x72,0x69,0x74,0x65,
+0x29,0x20,0x75,0x69,0x6e,0x74,0x38,0x5d,
+0x20,0x70,0x75,0x74,0x2d,0x75,0x38,0x29,
+0x20,0x70,0x75,0x74,0x70,0x72,0x6f,0x70,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x33,0x63,0x30,0x71,0x63,
+0x31,0x7e,0x7c,0x5e,0x33,0x33,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3a,0x30,0x30,0x30,0x72,0x31,0x7c,
+0x37,0x3e,0x30,0x63,0x30,0x71,0x63,0x31,
+0x33,0x30,0x33,0x31,0x35,0x33,0x30,0x5d,
+0x32,0x63,0x32,0x7c,0x5c,0x78,0x37,0x66,
+0x69,0x30,0x32,0x34,0x33,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x69,0x32,
+0x30,0x69,0x31,0x30,0x7c,0x33,0x33,0x32,
+0x7c,0x6f,0x30,0x30,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x70,0x75,0x74,0x21,
 0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x67,0x65,0x74,0x29,0x5d,0x20,0x23,0x39,
-0x23,0x29,0x20,0x71,0x75,0x6f,0x74,0x65,
-0x2d,0x76,0x61,0x6c,0x75,0x65,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x7c,0x33,0x31,0x36,
-0x34,0x30,0x7c,0x3b,0x63,0x31,0x7c,0x4c,
-0x32,0x3b,0x22,0x20,0x5b,0x73,0x65,0x6c,
-0x66,0x2d,0x65,0x76,0x61,0x6c,0x75,0x61,
-0x74,0x69,0x6e,0x67,0x3f,0x20,0x71,0x75,
-0x6f,0x74,0x65,0x5d,0x20,0x71,0x75,0x6f,
-0x74,0x65,0x2d,0x76,0x61,0x6c,0x75,0x65,
-0x29,0x20,0x71,0x75,0x6f,0x74,0x69,0x65,
-0x6e,0x74,0x20,0x23,0x2e,0x64,0x69,0x76,
-0x30,0x20,0x72,0x61,0x6e,0x64,0x6f,0x6d,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x33,
-0x31,0x36,0x3c,0x30,0x65,0x31,0x63,0x32,
-0x33,0x30,0x7c,0x34,0x32,0x3b,0x63,0x33,
-0x33,0x30,0x7c,0x54,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x69,0x6e,0x74,
-0x65,0x67,0x65,0x72,0x3f,0x29,0x20,0x6d,
-0x6f,0x64,0x20,0x23,0x66,0x6e,0x28,0x72,
-0x61,0x6e,0x64,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x72,0x61,0x6e,0x64,0x2e,0x64,0x6f,
-0x75,0x62,0x6c,0x65,0x29,0x5d,0x20,0x72,
-0x61,0x6e,0x64,0x6f,0x6d,0x29,0x20,0x72,
-0x61,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x3f,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x69,0x6e,0x74,0x65,0x67,0x65,0x72,
-0x3f,0x29,0x5d,0x20,0x72,0x61,0x74,0x69,
-0x6f,0x6e,0x61,0x6c,0x3f,0x29,0x20,0x72,
-0x65,0x61,0x64,0x2d,0x61,0x6c,0x6c,0x20,
+0x74,0x61,0x62,0x6c,0x65,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x70,0x75,0x74,0x21,0x29,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x67,
+0x65,0x74,0x29,0x5d,0x20,0x23,0x39,0x23,
+0x29,0x20,0x71,0x75,0x6f,0x74,0x65,0x2d,
+0x76,0x61,0x6c,0x75,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x7c,0x33,0x31,0x36,0x34,
+0x30,0x7c,0x3b,0x63,0x31,0x7c,0x4c,0x32,
+0x3b,0x22,0x20,0x5b,0x73,0x65,0x6c,0x66,
+0x2d,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,
+0x69,0x6e,0x67,0x3f,0x20,0x71,0x75,0x6f,
+0x74,0x65,0x5d,0x20,0x71,0x75,0x6f,0x74,
+0x65,0x2d,0x76,0x61,0x6c,0x75,0x65,0x29,
+0x20,0x71,0x75,0x6f,0x74,0x69,0x65,0x6e,
+0x74,0x20,0x23,0x2e,0x64,0x69,0x76,0x30,
+0x20,0x72,0x61,0x6e,0x64,0x6f,0x6d,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x63,0x31,0x7c,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x72,0x65,
-0x61,0x64,0x2d,0x61,0x6c,0x6c,0x2d,0x6f,
-0x66,0x20,0x23,0x66,0x6e,0x28,0x72,0x65,
-0x61,0x64,0x29,0x5d,0x20,0x72,0x65,0x61,
-0x64,0x2d,0x61,0x6c,0x6c,0x29,0x20,0x72,
-0x65,0x61,0x64,0x2d,0x61,0x6c,0x6c,0x2d,
-0x6f,0x66,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
-0x71,0x5d,0x33,0x31,0x5f,0x7c,0x7d,0x33,
-0x31,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
-0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x32,
-0x63,0x30,0x69,0x31,0x31,0x33,0x31,0x36,
-0x38,0x30,0x65,0x31,0x7c,0x34,0x31,0x3b,
-0x7e,0x7d,0x7c,0x4b,0x69,0x31,0x30,0x69,
-0x31,0x31,0x33,0x31,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x65,0x6f,0x66,0x3f,0x29,0x20,0x72,
-0x65,0x76,0x65,0x72,0x73,0x65,0x21,0x5d,
-0x29,0x5d,0x29,0x5d,0x20,0x72,0x65,0x61,
+0x30,0x72,0x31,0x63,0x30,0x7c,0x33,0x31,
+0x36,0x3c,0x30,0x65,0x31,0x63,0x32,0x33,
+0x30,0x7c,0x34,0x32,0x3b,0x63,0x33,0x33,
+0x30,0x7c,0x54,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x69,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x3f,0x29,0x20,0x6d,0x6f,
+0x64,0x20,0x23,0x66,0x6e,0x28,0x72,0x61,
+0x6e,0x64,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x72,0x61,0x6e,0x64,0x2e,0x64,0x6f,0x75,
+0x62,0x6c,0x65,0x29,0x5d,0x20,0x72,0x61,
+0x6e,0x64,0x6f,0x6d,0x29,0x20,0x72,0x61,
+0x74,0x69,0x6f,0x6e,0x61,0x6c,0x3f,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x7c,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x69,0x6e,0x74,0x65,0x67,0x65,0x72,0x3f,
+0x29,0x5d,0x20,0x72,0x61,0x74,0x69,0x6f,
+0x6e,0x61,0x6c,0x3f,0x29,0x20,0x72,0x65,
+0x61,0x64,0x2d,0x61,0x6c,0x6c,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x63,0x31,0x7c,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x72,0x65,0x61,
 0x64,0x2d,0x61,0x6c,0x6c,0x2d,0x6f,0x66,
-0x29,0x20,0x72,0x65,0x61,0x64,0x2d,0x63,
-0x68,0x61,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x5c,0x78,0x38,
-0x39,0x30,0x30,0x30,0x30,0x31,0x30,0x30,
-0x30,0x5c,0x78,0x38,0x61,0x30,0x30,0x30,
-0x30,0x37,0x37,0x30,0x65,0x30,0x6d,0x30,
-0x32,0x63,0x31,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x2a,0x69,0x6e,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
-0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
-0x67,0x65,0x74,0x63,0x29,0x5d,0x20,0x72,
-0x65,0x61,0x64,0x2d,0x63,0x68,0x61,0x72,
-0x29,0x20,0x72,0x65,0x61,0x64,0x2d,0x6c,
-0x69,0x6e,0x65,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x5c,0x78,0x38,
-0x39,0x30,0x30,0x30,0x30,0x31,0x30,0x30,
-0x30,0x5c,0x78,0x38,0x61,0x30,0x30,0x30,
-0x30,0x37,0x37,0x30,0x65,0x30,0x6d,0x30,
-0x32,0x63,0x31,0x65,0x32,0x33,0x31,0x32,
-0x63,0x33,0x7c,0x33,0x31,0x32,0x65,0x34,
-0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,
-0x69,0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,
-0x72,0x65,0x61,0x6d,0x2a,0x20,0x23,0x66,
-0x6e,0x28,0x69,0x6f,0x2e,0x66,0x6c,0x75,
-0x73,0x68,0x29,0x20,0x2a,0x6f,0x75,0x74,
-0x70,0x75,0x74,0x2d,0x73,0x74,0x72,0x65,
-0x61,0x6d,0x2a,0x20,0x23,0x66,0x6e,0x28,
-0x69,0x6f,0x2e,0x64,0x69,0x73,0x63,0x61,
-0x72,0x64,0x62,0x75,0x66,0x66,0x65,0x72,
-0x29,0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,
-0x64,0x6c,0x69,0x6e,0x65,0x5d,0x20,0x72,
-0x65,0x61,0x64,0x2d,0x6c,0x69,0x6e,0x65,
-0x29,0x20,0x72,0x65,0x61,0x6c,0x3f,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x44,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x72,0x65,0x61,0x6c,0x3f,
-0x29,0x20,0x72,0x65,0x64,0x20,0x31,0x20,
-0x72,0x65,0x66,0x2d,0x69,0x6e,0x74,0x31,
-0x36,0x2d,0x4c,0x45,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x32,
-0x65,0x30,0x63,0x31,0x7c,0x7d,0x60,0x77,
-0x5b,0x60,0x33,0x32,0x63,0x31,0x7c,0x7d,
-0x61,0x77,0x5b,0x62,0x38,0x33,0x32,0x77,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x69,0x6e,
-0x74,0x31,0x36,0x20,0x23,0x66,0x6e,0x28,
-0x61,0x73,0x68,0x29,0x5d,0x20,0x72,0x65,
-0x66,0x2d,0x69,0x6e,0x74,0x31,0x36,0x2d,
-0x4c,0x45,0x29,0x20,0x72,0x65,0x66,0x2d,
-0x69,0x6e,0x74,0x33,0x32,0x2d,0x4c,0x45,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3d,0x30,
-0x30,0x30,0x72,0x32,0x65,0x30,0x63,0x31,
-0x7c,0x7d,0x60,0x77,0x5b,0x60,0x33,0x32,
-0x63,0x31,0x7c,0x7d,0x61,0x77,0x5b,0x62,
-0x38,0x33,0x32,0x63,0x31,0x7c,0x7d,0x62,
-0x32,0x77,0x5b,0x62,0x40,0x33,0x32,0x63,
-0x31,0x7c,0x7d,0x62,0x33,0x77,0x5b,0x62,
-0x48,0x33,0x32,0x52,0x34,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x69,0x6e,0x74,0x33,0x32,
-0x20,0x23,0x66,0x6e,0x28,0x61,0x73,0x68,
-0x29,0x5d,0x20,0x72,0x65,0x66,0x2d,0x69,
-0x6e,0x74,0x33,0x32,0x2d,0x4c,0x45,0x29,
-0x20,0x72,0x65,0x6d,0x61,0x69,0x6e,0x64,
-0x65,0x72,0x20,0x23,0x31,0x30,0x23,0x20,
-0x72,0x65,0x6d,0x70,0x72,0x6f,0x70,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
-0x30,0x72,0x32,0x63,0x30,0x71,0x63,0x31,
-0x7e,0x7c,0x5e,0x33,0x33,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x31,0x7c,0x31,
-0x36,0x44,0x30,0x32,0x63,0x30,0x7c,0x5c,
-0x78,0x37,0x66,0x33,0x32,0x31,0x36,0x39,
-0x30,0x32,0x63,0x31,0x7c,0x5c,0x78,0x37,
-0x66,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x68,0x61,0x73,0x3f,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x64,0x65,0x6c,
-0x21,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x67,0x65,0x74,0x29,0x5d,0x20,0x23,
-0x39,0x23,0x29,0x20,0x72,0x65,0x70,0x6c,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x30,0x63,0x30,0x5d,0x5d,
+0x20,0x23,0x66,0x6e,0x28,0x72,0x65,0x61,
+0x64,0x29,0x5d,0x20,0x72,0x65,0x61,0x64,
+0x2d,0x61,0x6c,0x6c,0x29,0x20,0x72,0x65,
+0x61,0x64,0x2d,0x61,0x6c,0x6c,0x2d,0x6f,
+0x66,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x32,0x63,0x30,0x71,
+0x5d,0x33,0x31,0x5f,0x7c,0x7d,0x33,0x31,
 0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
 0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x6d,0x30,0x32,0x63,0x31,
-0x71,0x6d,0x31,0x32,0x7d,0x33,0x30,0x32,
-0x63,0x32,0x34,0x30,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
-0x30,0x72,0x30,0x63,0x30,0x65,0x31,0x65,
-0x32,0x65,0x33,0x65,0x34,0x65,0x35,0x33,
-0x31,0x33,0x32,0x63,0x36,0x65,0x32,0x33,
-0x30,0x63,0x37,0x33,0x34,0x33,0x31,0x32,
-0x63,0x38,0x65,0x39,0x33,0x31,0x32,0x63,
-0x3a,0x63,0x3b,0x63,0x3c,0x74,0x34,0x31,
+0x31,0x63,0x30,0x71,0x6d,0x30,0x32,0x7c,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x29,
-0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,
-0x61,0x70,0x70,0x65,0x6e,0x64,0x20,0x73,
-0x67,0x72,0x20,0x62,0x6f,0x6c,0x64,0x20,
-0x66,0x67,0x20,0x63,0x79,0x61,0x6e,0x20,
-0x22,0x75,0x70,0x3e,0x22,0x20,0x22,0x20,
-0x22,0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x66,0x6c,0x75,0x73,0x68,0x29,0x20,
-0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
+0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x63,
+0x30,0x69,0x31,0x31,0x33,0x31,0x36,0x38,
+0x30,0x65,0x31,0x7c,0x34,0x31,0x3b,0x7e,
+0x7d,0x7c,0x4b,0x69,0x31,0x30,0x69,0x31,
+0x31,0x33,0x31,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x65,0x6f,0x66,0x3f,0x29,0x20,0x72,0x65,
+0x76,0x65,0x72,0x73,0x65,0x21,0x5d,0x29,
+0x5d,0x29,0x5d,0x20,0x72,0x65,0x61,0x64,
+0x2d,0x61,0x6c,0x6c,0x2d,0x6f,0x66,0x29,
+0x20,0x72,0x65,0x61,0x64,0x2d,0x63,0x68,
+0x61,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x5c,0x78,0x38,0x39,
+0x30,0x30,0x30,0x30,0x31,0x30,0x30,0x30,
+0x5c,0x78,0x38,0x61,0x30,0x30,0x30,0x30,
+0x37,0x37,0x30,0x65,0x30,0x6d,0x30,0x32,
+0x63,0x31,0x7c,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x2a,0x69,0x6e,0x70,0x75,0x74,0x2d,
 0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,
+0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x67,
+0x65,0x74,0x63,0x29,0x5d,0x20,0x72,0x65,
+0x61,0x64,0x2d,0x63,0x68,0x61,0x72,0x29,
+0x20,0x72,0x65,0x61,0x64,0x2d,0x6c,0x69,
+0x6e,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x5c,0x78,0x38,0x39,
+0x30,0x30,0x30,0x30,0x31,0x30,0x30,0x30,
+0x5c,0x78,0x38,0x61,0x30,0x30,0x30,0x30,
+0x37,0x37,0x30,0x65,0x30,0x6d,0x30,0x32,
+0x63,0x31,0x65,0x32,0x33,0x31,0x32,0x63,
+0x33,0x7c,0x33,0x31,0x32,0x65,0x34,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
+0x65,0x61,0x6d,0x2a,0x20,0x23,0x66,0x6e,
+0x28,0x69,0x6f,0x2e,0x66,0x6c,0x75,0x73,
+0x68,0x29,0x20,0x2a,0x6f,0x75,0x74,0x70,
+0x75,0x74,0x2d,0x73,0x74,0x72,0x65,0x61,
+0x6d,0x2a,0x20,0x23,0x66,0x6e,0x28,0x69,
+0x6f,0x2e,0x64,0x69,0x73,0x63,0x61,0x72,
+0x64,0x62,0x75,0x66,0x66,0x65,0x72,0x29,
+0x20,0x69,0x6f,0x2e,0x72,0x65,0x61,0x64,
+0x6c,0x69,0x6e,0x65,0x5d,0x20,0x72,0x65,
+0x61,0x64,0x2d,0x6c,0x69,0x6e,0x65,0x29,
+0x20,0x72,0x65,0x61,0x6c,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x44,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x72,0x65,0x61,0x6c,0x3f,0x29,
+0x20,0x72,0x65,0x64,0x20,0x31,0x20,0x72,
+0x65,0x66,0x2d,0x69,0x6e,0x74,0x31,0x36,
+0x2d,0x4c,0x45,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3b,0x30,0x30,0x30,0x72,0x32,0x65,
+0x30,0x63,0x31,0x7c,0x7d,0x60,0x77,0x5b,
+0x60,0x33,0x32,0x63,0x31,0x7c,0x7d,0x61,
+0x77,0x5b,0x62,0x38,0x33,0x32,0x77,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x69,0x6e,0x74,
+0x31,0x36,0x20,0x23,0x66,0x6e,0x28,0x61,
+0x73,0x68,0x29,0x5d,0x20,0x72,0x65,0x66,
+0x2d,0x69,0x6e,0x74,0x31,0x36,0x2d,0x4c,
+0x45,0x29,0x20,0x72,0x65,0x66,0x2d,0x69,
+0x6e,0x74,0x33,0x32,0x2d,0x4c,0x45,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3d,0x30,0x30,
+0x30,0x72,0x32,0x65,0x30,0x63,0x31,0x7c,
+0x7d,0x60,0x77,0x5b,0x60,0x33,0x32,0x63,
+0x31,0x7c,0x7d,0x61,0x77,0x5b,0x62,0x38,
+0x33,0x32,0x63,0x31,0x7c,0x7d,0x62,0x32,
+0x77,0x5b,0x62,0x40,0x33,0x32,0x63,0x31,
+0x7c,0x7d,0x62,0x33,0x77,0x5b,0x62,0x48,
+0x33,0x32,0x52,0x34,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x69,0x6e,0x74,0x33,0x32,0x20,
+0x23,0x66,0x6e,0x28,0x61,0x73,0x68,0x29,
+0x5d,0x20,0x72,0x65,0x66,0x2d,0x69,0x6e,
+0x74,0x33,0x32,0x2d,0x4c,0x45,0x29,0x20,
+0x72,0x65,0x6d,0x61,0x69,0x6e,0x64,0x65,
+0x72,0x20,0x23,0x31,0x30,0x23,0x20,0x72,
+0x65,0x6d,0x70,0x72,0x6f,0x70,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
+0x72,0x32,0x63,0x30,0x71,0x63,0x31,0x7e,
+0x7c,0x5e,0x33,0x33,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x31,0x36,
+0x44,0x30,0x32,0x63,0x30,0x7c,0x5c,0x78,
+0x37,0x66,0x33,0x32,0x31,0x36,0x39,0x30,
+0x32,0x63,0x31,0x7c,0x5c,0x78,0x37,0x66,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x68,0x61,0x73,0x3f,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x64,0x65,0x6c,0x21,
+0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x67,0x65,0x74,0x29,0x5d,0x20,0x23,0x39,
+0x23,0x29,0x20,0x72,0x65,0x70,0x6c,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x65,0x31,0x33,
-0x31,0x40,0x31,0x36,0x3a,0x30,0x32,0x63,
-0x32,0x71,0x5e,0x5e,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,
-0x2e,0x65,0x6f,0x66,0x3f,0x29,0x20,0x2a,
-0x69,0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,
-0x72,0x65,0x61,0x6d,0x2a,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x63,0x31,0x71,0x74,
-0x32,0x65,0x32,0x7e,0x7c,0x4c,0x31,0x33,
-0x32,0x32,0x63,0x33,0x7e,0x3d,0x31,0x37,
-0x37,0x30,0x32,0x63,0x34,0x7e,0x3d,0x36,
-0x40,0x30,0x63,0x35,0x33,0x30,0x32,0x63,
-0x36,0x63,0x37,0x33,0x31,0x35,0x33,0x30,
-0x5e,0x32,0x5d,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x30,0x65,0x30,0x69,0x31,0x30,0x33,
-0x31,0x6f,0x30,0x30,0x32,0x63,0x31,0x7e,
-0x33,0x31,0x32,0x7e,0x6b,0x32,0x3b,0x22,
-0x20,0x5b,0x6c,0x6f,0x61,0x64,0x2d,0x70,
-0x72,0x6f,0x63,0x65,0x73,0x73,0x20,0x23,
-0x66,0x6e,0x28,0x77,0x72,0x69,0x74,0x65,
-0x6c,0x6e,0x29,0x20,0x74,0x68,0x61,0x74,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x7c,0x6f,
-0x30,0x31,0x32,0x65,0x30,0x7c,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x74,0x6f,0x70,0x2d,
-0x6c,0x65,0x76,0x65,0x6c,0x2d,0x65,0x78,
-0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,
-0x68,0x61,0x6e,0x64,0x6c,0x65,0x72,0x5d,
-0x29,0x20,0x68,0x69,0x73,0x74,0x6f,0x72,
-0x79,0x2d,0x70,0x75,0x73,0x68,0x20,0x68,
-0x65,0x6c,0x70,0x20,0x65,0x78,0x69,0x74,
-0x20,0x23,0x66,0x6e,0x28,0x6e,0x65,0x77,
-0x6c,0x69,0x6e,0x65,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x6c,0x6e,0x29,0x20,0x22,0x54,0x79,
-0x70,0x65,0x20,0x28,0x68,0x65,0x6c,0x70,
-0x29,0x20,0x66,0x6f,0x72,0x20,0x68,0x65,
-0x6c,0x70,0x20,0x6f,0x72,0x20,0x28,0x65,
-0x78,0x69,0x74,0x29,0x20,0x74,0x6f,0x20,
-0x65,0x78,0x69,0x74,0x2e,0x22,0x5d,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x36,0x30,0x30,0x30,0x72,0x30,0x63,0x30,
-0x34,0x30,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x72,0x65,0x61,0x64,0x29,0x5d,
+0x30,0x72,0x30,0x63,0x30,0x5d,0x5d,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x6d,0x30,0x32,0x63,0x31,0x71,
+0x6d,0x31,0x32,0x7d,0x33,0x30,0x32,0x63,
+0x32,0x34,0x30,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
+0x72,0x30,0x63,0x30,0x65,0x31,0x65,0x32,
+0x65,0x33,0x65,0x34,0x65,0x35,0x33,0x31,
+0x33,0x32,0x63,0x36,0x65,0x32,0x33,0x30,
+0x63,0x37,0x33,0x34,0x33,0x31,0x32,0x63,
+0x38,0x65,0x39,0x33,0x31,0x32,0x63,0x3a,
+0x63,0x3b,0x63,0x3c,0x74,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x64,
+0x69,0x73,0x70,0x6c,0x61,0x79,0x29,0x20,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x61,
+0x70,0x70,0x65,0x6e,0x64,0x20,0x73,0x67,
+0x72,0x20,0x62,0x6f,0x6c,0x64,0x20,0x66,
+0x67,0x20,0x63,0x79,0x61,0x6e,0x20,0x22,
+0x75,0x70,0x3e,0x22,0x20,0x22,0x20,0x22,
+0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x66,0x6c,0x75,0x73,0x68,0x29,0x20,0x2a,
+0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x73,
+0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x65,0x31,0x33,0x31,
+0x40,0x31,0x36,0x3a,0x30,0x32,0x63,0x32,
+0x71,0x5e,0x5e,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x65,0x6f,0x66,0x3f,0x29,0x20,0x2a,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
+0x65,0x61,0x6d,0x2a,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x71,0x63,0x31,0x71,0x74,0x32,
+0x65,0x32,0x7e,0x7c,0x4c,0x31,0x33,0x32,
+0x32,0x63,0x33,0x7e,0x3d,0x31,0x37,0x37,
+0x30,0x32,0x63,0x34,0x7e,0x3d,0x36,0x40,
+0x30,0x63,0x35,0x33,0x30,0x32,0x63,0x36,
+0x63,0x37,0x33,0x31,0x35,0x33,0x30,0x5e,
+0x32,0x5d,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x30,0x65,0x30,0x69,0x31,0x30,0x33,0x31,
+0x6f,0x30,0x30,0x32,0x63,0x31,0x7e,0x33,
+0x31,0x32,0x7e,0x6b,0x32,0x3b,0x22,0x20,
+0x5b,0x6c,0x6f,0x61,0x64,0x2d,0x70,0x72,
+0x6f,0x63,0x65,0x73,0x73,0x20,0x23,0x66,
+0x6e,0x28,0x77,0x72,0x69,0x74,0x65,0x6c,
+0x6e,0x29,0x20,0x74,0x68,0x61,0x74,0x5d,
 0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x65,
-0x31,0x33,0x31,0x32,0x63,0x32,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x64,0x69,0x73,0x63,
-0x61,0x72,0x64,0x62,0x75,0x66,0x66,0x65,
-0x72,0x29,0x20,0x2a,0x69,0x6e,0x70,0x75,
-0x74,0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,
-0x2a,0x20,0x23,0x66,0x6e,0x28,0x72,0x61,
-0x69,0x73,0x65,0x29,0x5d,0x29,0x5d,0x20,
-0x70,0x72,0x6f,0x6d,0x70,0x74,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x30,0x63,0x30,0x71,0x63,0x31,
-0x74,0x36,0x36,0x30,0x5c,0x78,0x37,0x66,
-0x34,0x30,0x3b,0x5e,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x30,0x7e,0x34,0x30,0x3b,0x22,
-0x20,0x5b,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x65,0x30,0x7c,0x33,0x31,0x32,0x5d,0x3b,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x6f,0x30,
+0x31,0x32,0x65,0x30,0x7c,0x34,0x31,0x3b,
 0x22,0x20,0x5b,0x74,0x6f,0x70,0x2d,0x6c,
 0x65,0x76,0x65,0x6c,0x2d,0x65,0x78,0x63,
 0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x68,
 0x61,0x6e,0x64,0x6c,0x65,0x72,0x5d,0x29,
-0x5d,0x20,0x72,0x65,0x70,0x6c,0x6f,0x6f,
-0x70,0x29,0x20,0x23,0x66,0x6e,0x28,0x6e,
-0x65,0x77,0x6c,0x69,0x6e,0x65,0x29,0x5d,
-0x29,0x5d,0x20,0x72,0x65,0x70,0x6c,0x29,
+0x20,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,
+0x2d,0x70,0x75,0x73,0x68,0x20,0x68,0x65,
+0x6c,0x70,0x20,0x65,0x78,0x69,0x74,0x20,
+0x23,0x66,0x6e,0x28,0x6e,0x65,0x77,0x6c,
+0x69,0x6e,0x65,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
+0x6c,0x6e,0x29,0x20,0x22,0x54,0x79,0x70,
+0x65,0x20,0x28,0x68,0x65,0x6c,0x70,0x29,
+0x20,0x66,0x6f,0x72,0x20,0x68,0x65,0x6c,
+0x70,0x20,0x6f,0x72,0x20,0x28,0x65,0x78,
+0x69,0x74,0x29,0x20,0x74,0x6f,0x20,0x65,
+0x78,0x69,0x74,0x2e,0x22,0x5d,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x36,
+0x30,0x30,0x30,0x72,0x30,0x63,0x30,0x34,
+0x30,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x72,0x65,0x61,0x64,0x29,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x65,0x31,
+0x33,0x31,0x32,0x63,0x32,0x7c,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x69,0x6f,0x2e,0x64,0x69,0x73,0x63,0x61,
+0x72,0x64,0x62,0x75,0x66,0x66,0x65,0x72,
+0x29,0x20,0x2a,0x69,0x6e,0x70,0x75,0x74,
+0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
+0x20,0x23,0x66,0x6e,0x28,0x72,0x61,0x69,
+0x73,0x65,0x29,0x5d,0x29,0x5d,0x20,0x70,
+0x72,0x6f,0x6d,0x70,0x74,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x30,0x63,0x30,0x71,0x63,0x31,0x74,
+0x36,0x36,0x30,0x5c,0x78,0x37,0x66,0x34,
+0x30,0x3b,0x5e,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x30,0x7e,0x34,0x30,0x3b,0x22,0x20,
+0x5b,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x7c,0x33,0x31,0x32,0x5d,0x3b,0x22,
+0x20,0x5b,0x74,0x6f,0x70,0x2d,0x6c,0x65,
+0x76,0x65,0x6c,0x2d,0x65,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x2d,0x68,0x61,
+0x6e,0x64,0x6c,0x65,0x72,0x5d,0x29,0x5d,
+0x20,0x72,0x65,0x70,0x6c,0x6f,0x6f,0x70,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x6e,0x65,
+0x77,0x6c,0x69,0x6e,0x65,0x29,0x5d,0x29,
+0x5d,0x20,0x72,0x65,0x70,0x6c,0x29,0x20,
+0x72,0x65,0x76,0x61,0x70,0x70,0x65,0x6e,
+0x64,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x32,0x65,0x30,0x7d,
+0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,0x72,
+0x65,0x76,0x65,0x72,0x73,0x65,0x2d,0x5d,
 0x20,0x72,0x65,0x76,0x61,0x70,0x70,0x65,
-0x6e,0x64,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x32,0x65,0x30,
-0x7d,0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x2d,
-0x5d,0x20,0x72,0x65,0x76,0x61,0x70,0x70,
-0x65,0x6e,0x64,0x29,0x20,0x72,0x65,0x76,
-0x65,0x72,0x73,0x65,0x20,0x23,0x66,0x6e,
+0x6e,0x64,0x29,0x20,0x72,0x65,0x76,0x65,
+0x72,0x73,0x65,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x5f,0x7c,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x72,0x65,0x76,0x65,0x72,0x73,0x65,
+0x2d,0x5d,0x20,0x72,0x65,0x76,0x65,0x72,
+0x73,0x65,0x29,0x20,0x72,0x65,0x76,0x65,
+0x72,0x73,0x65,0x21,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
 0x65,0x30,0x5f,0x7c,0x34,0x32,0x3b,0x22,
 0x20,0x5b,0x72,0x65,0x76,0x65,0x72,0x73,
-0x65,0x2d,0x5d,0x20,0x72,0x65,0x76,0x65,
-0x72,0x73,0x65,0x29,0x20,0x72,0x65,0x76,
-0x65,0x72,0x73,0x65,0x21,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x65,0x30,0x5f,0x7c,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x72,0x65,0x76,0x65,0x72,
-0x73,0x65,0x21,0x2d,0x5d,0x20,0x72,0x65,
-0x76,0x65,0x72,0x73,0x65,0x21,0x29,0x20,
-0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x21,
-0x2d,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
-0x30,0x30,0x30,0x72,0x32,0x5d,0x7d,0x46,
-0x36,0x42,0x30,0x32,0x7d,0x4e,0x7d,0x7c,
-0x7d,0x6d,0x30,0x32,0x50,0x32,0x6d,0x31,
-0x35,0x5c,0x78,0x31,0x64,0x2f,0x32,0x7c,
-0x3b,0x22,0x20,0x5b,0x5d,0x20,0x72,0x65,
-0x76,0x65,0x72,0x73,0x65,0x21,0x2d,0x29,
-0x20,0x72,0x65,0x76,0x65,0x72,0x73,0x65,
-0x2d,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x32,0x7d,0x5c,0x78,
-0x38,0x35,0x34,0x30,0x7c,0x3b,0x65,0x30,
-0x7d,0x4d,0x7c,0x4b,0x7d,0x4e,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x72,0x65,0x76,0x65,
-0x72,0x73,0x65,0x2d,0x5d,0x20,0x72,0x65,
-0x76,0x65,0x72,0x73,0x65,0x2d,0x29,0x20,
-0x73,0x65,0x6c,0x66,0x2d,0x65,0x76,0x61,
-0x6c,0x75,0x61,0x74,0x69,0x6e,0x67,0x3f,
+0x65,0x21,0x2d,0x5d,0x20,0x72,0x65,0x76,
+0x65,0x72,0x73,0x65,0x21,0x29,0x20,0x72,
+0x65,0x76,0x65,0x72,0x73,0x65,0x21,0x2d,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x32,0x5d,0x7d,0x46,0x36,
+0x42,0x30,0x32,0x7d,0x4e,0x7d,0x7c,0x7d,
+0x6d,0x30,0x32,0x50,0x32,0x6d,0x31,0x35,
+0x5c,0x78,0x31,0x64,0x2f,0x32,0x7c,0x3b,
+0x22,0x20,0x5b,0x5d,0x20,0x72,0x65,0x76,
+0x65,0x72,0x73,0x65,0x21,0x2d,0x29,0x20,
+0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x2d,
 0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x3f,0x31,0x36,
-0x36,0x30,0x32,0x7c,0x43,0x40,0x31,0x37,
-0x4b,0x30,0x32,0x63,0x30,0x7c,0x33,0x31,
-0x31,0x36,0x41,0x30,0x32,0x7c,0x43,0x31,
-0x36,0x3a,0x30,0x32,0x7c,0x63,0x31,0x7c,
-0x33,0x31,0x3c,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x63,0x6f,0x6e,0x73,0x74,
-0x61,0x6e,0x74,0x3f,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,
-0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x29,0x5d,0x20,0x73,0x65,0x6c,0x66,
-0x2d,0x65,0x76,0x61,0x6c,0x75,0x61,0x74,
-0x69,0x6e,0x67,0x3f,0x29,0x20,0x73,0x65,
-0x70,0x61,0x72,0x61,0x74,0x65,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x71,0x5d,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x3a,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x6d,0x30,0x32,0x7c,0x7e,0x5c,0x78,
-0x37,0x66,0x5f,0x4c,0x31,0x5f,0x4c,0x31,
-0x34,0x34,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
-0x34,0x63,0x30,0x67,0x32,0x67,0x33,0x4b,
-0x5d,0x7d,0x46,0x36,0x5a,0x30,0x32,0x7c,
-0x7d,0x4d,0x33,0x31,0x36,0x3f,0x30,0x67,
-0x32,0x7d,0x4d,0x5f,0x4b,0x50,0x4e,0x6d,
-0x32,0x35,0x3c,0x30,0x67,0x33,0x7d,0x4d,
-0x5f,0x4b,0x50,0x4e,0x6d,0x33,0x32,0x7d,
-0x4e,0x6d,0x31,0x35,0x5c,0x78,0x30,0x35,
-0x2f,0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x30,0x30,0x72,0x32,0x7d,0x5c,0x78,0x38,
+0x35,0x34,0x30,0x7c,0x3b,0x65,0x30,0x7d,
+0x4d,0x7c,0x4b,0x7d,0x4e,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x72,0x65,0x76,0x65,0x72,
+0x73,0x65,0x2d,0x5d,0x20,0x72,0x65,0x76,
+0x65,0x72,0x73,0x65,0x2d,0x29,0x20,0x73,
+0x65,0x6c,0x66,0x2d,0x65,0x76,0x61,0x6c,
+0x75,0x61,0x74,0x69,0x6e,0x67,0x3f,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x65,0x30,0x7c,0x4d,0x4e,
-0x7c,0x4e,0x4e,0x34,0x32,0x3b,0x22,0x20,
-0x5b,0x76,0x61,0x6c,0x75,0x65,0x73,0x5d,
-0x29,0x5d,0x20,0x73,0x65,0x70,0x61,0x72,
-0x61,0x74,0x65,0x2d,0x29,0x5d,0x29,0x5d,
-0x20,0x73,0x65,0x70,0x61,0x72,0x61,0x74,
-0x65,0x29,0x20,0x73,0x65,0x74,0x2d,0x73,
-0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x76,0x61,
-0x6c,0x75,0x65,0x21,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x32,
-0x63,0x30,0x7c,0x7d,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x73,0x65,
-0x74,0x2d,0x74,0x6f,0x70,0x2d,0x6c,0x65,
-0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x21,0x29,0x5d,0x20,0x73,0x65,0x74,
-0x2d,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,
-0x76,0x61,0x6c,0x75,0x65,0x21,0x29,0x20,
-0x73,0x65,0x74,0x2d,0x73,0x79,0x6e,0x74,
-0x61,0x78,0x21,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x63,
-0x30,0x65,0x31,0x7c,0x7d,0x34,0x33,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x70,
-0x75,0x74,0x21,0x29,0x20,0x2a,0x73,0x79,
-0x6e,0x74,0x61,0x78,0x2d,0x65,0x6e,0x76,
-0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,
-0x2a,0x5d,0x20,0x73,0x65,0x74,0x2d,0x73,
-0x79,0x6e,0x74,0x61,0x78,0x21,0x29,0x20,
-0x73,0x67,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x73,0x30,0x63,
-0x30,0x71,0x65,0x31,0x33,0x30,0x34,0x31,
+0x30,0x72,0x31,0x7c,0x3f,0x31,0x36,0x36,
+0x30,0x32,0x7c,0x43,0x40,0x31,0x37,0x4b,
+0x30,0x32,0x63,0x30,0x7c,0x33,0x31,0x31,
+0x36,0x41,0x30,0x32,0x7c,0x43,0x31,0x36,
+0x3a,0x30,0x32,0x7c,0x63,0x31,0x7c,0x33,
+0x31,0x3c,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x63,0x6f,0x6e,0x73,0x74,0x61,
+0x6e,0x74,0x3f,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,
+0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,
+0x29,0x5d,0x20,0x73,0x65,0x6c,0x66,0x2d,
+0x65,0x76,0x61,0x6c,0x75,0x61,0x74,0x69,
+0x6e,0x67,0x3f,0x29,0x20,0x73,0x65,0x70,
+0x61,0x72,0x61,0x74,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x32,0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x3a,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x6d,0x30,0x32,0x7c,0x7e,0x5c,0x78,0x37,
+0x66,0x5f,0x4c,0x31,0x5f,0x4c,0x31,0x34,
+0x34,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x34,
+0x63,0x30,0x67,0x32,0x67,0x33,0x4b,0x5d,
+0x7d,0x46,0x36,0x5a,0x30,0x32,0x7c,0x7d,
+0x4d,0x33,0x31,0x36,0x3f,0x30,0x67,0x32,
+0x7d,0x4d,0x5f,0x4b,0x50,0x4e,0x6d,0x32,
+0x35,0x3c,0x30,0x67,0x33,0x7d,0x4d,0x5f,
+0x4b,0x50,0x4e,0x6d,0x33,0x32,0x7d,0x4e,
+0x6d,0x31,0x35,0x5c,0x78,0x30,0x35,0x2f,
+0x32,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x65,0x30,0x7c,0x4d,0x4e,0x7c,
+0x4e,0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x76,0x61,0x6c,0x75,0x65,0x73,0x5d,0x29,
+0x5d,0x20,0x73,0x65,0x70,0x61,0x72,0x61,
+0x74,0x65,0x2d,0x29,0x5d,0x29,0x5d,0x20,
+0x73,0x65,0x70,0x61,0x72,0x61,0x74,0x65,
+0x29,0x20,0x73,0x65,0x74,0x2d,0x73,0x79,
+0x6d,0x62,0x6f,0x6c,0x2d,0x76,0x61,0x6c,
+0x75,0x65,0x21,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x32,0x63,
+0x30,0x7c,0x7d,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x73,0x65,0x74,
+0x2d,0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,
+0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,
+0x21,0x29,0x5d,0x20,0x73,0x65,0x74,0x2d,
+0x73,0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x76,
+0x61,0x6c,0x75,0x65,0x21,0x29,0x20,0x73,
+0x65,0x74,0x2d,0x73,0x79,0x6e,0x74,0x61,
+0x78,0x21,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
+0x65,0x31,0x7c,0x7d,0x34,0x33,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x70,0x75,
+0x74,0x21,0x29,0x20,0x2a,0x73,0x79,0x6e,
+0x74,0x61,0x78,0x2d,0x65,0x6e,0x76,0x69,
+0x72,0x6f,0x6e,0x6d,0x65,0x6e,0x74,0x2a,
+0x5d,0x20,0x73,0x65,0x74,0x2d,0x73,0x79,
+0x6e,0x74,0x61,0x78,0x21,0x29,0x20,0x73,
+0x67,0x72,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x73,0x30,0x63,0x30,
+0x71,0x65,0x31,0x33,0x30,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x63,0x31,0x7c,0x33,0x32,0x32,0x7e,0x5c,
+0x78,0x38,0x35,0x36,0x30,0x5e,0x35,0x3b,
+0x30,0x63,0x32,0x71,0x5d,0x33,0x31,0x7e,
+0x33,0x31,0x32,0x63,0x30,0x63,0x33,0x7c,
+0x33,0x32,0x32,0x65,0x34,0x7c,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x63,0x31,0x7c,0x33,0x32,0x32,0x7e,
-0x5c,0x78,0x38,0x35,0x36,0x30,0x5e,0x35,
-0x3b,0x30,0x63,0x32,0x71,0x5d,0x33,0x31,
-0x7e,0x33,0x31,0x32,0x63,0x30,0x63,0x33,
-0x7c,0x33,0x32,0x32,0x65,0x34,0x7c,0x34,
+0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x29,
+0x20,0x22,0x5c,0x65,0x5b,0x22,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x36,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x71,0x6d,0x30,0x32,
+0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x7c,0x4d,0x69,0x31,0x30,0x33,
+0x32,0x32,0x63,0x31,0x71,0x7c,0x4e,0x34,
 0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
 0x28,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-0x29,0x20,0x22,0x5c,0x65,0x5b,0x22,0x20,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x5c,0x78,
+0x38,0x35,0x34,0x30,0x5e,0x3b,0x63,0x30,
+0x63,0x31,0x69,0x32,0x30,0x33,0x32,0x32,
+0x69,0x31,0x30,0x7c,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x64,0x69,
+0x73,0x70,0x6c,0x61,0x79,0x29,0x20,0x23,
+0x5c,0x3b,0x5d,0x29,0x5d,0x29,0x5d,0x29,
+0x20,0x22,0x6d,0x22,0x20,0x67,0x65,0x74,
+0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x5d,0x29,
+0x20,0x6f,0x70,0x65,0x6e,0x2d,0x6f,0x75,
+0x74,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x5d,0x20,0x73,0x67,0x72,
+0x29,0x20,0x73,0x68,0x65,0x6c,0x6c,0x2d,
+0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x71,0x6d,0x30,
-0x32,0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x7c,0x4d,0x69,0x31,0x30,
-0x33,0x32,0x32,0x63,0x31,0x71,0x7c,0x4e,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x31,0x7c,0x5c,
-0x78,0x38,0x35,0x34,0x30,0x5e,0x3b,0x63,
-0x30,0x63,0x31,0x69,0x32,0x30,0x33,0x32,
-0x32,0x69,0x31,0x30,0x7c,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x64,
-0x69,0x73,0x70,0x6c,0x61,0x79,0x29,0x20,
-0x23,0x5c,0x3b,0x5d,0x29,0x5d,0x29,0x5d,
-0x29,0x20,0x22,0x6d,0x22,0x20,0x67,0x65,
-0x74,0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,0x5d,
-0x29,0x20,0x6f,0x70,0x65,0x6e,0x2d,0x6f,
-0x75,0x74,0x70,0x75,0x74,0x2d,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x5d,0x20,0x73,0x67,
-0x72,0x29,0x20,0x73,0x68,0x65,0x6c,0x6c,
-0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
-0x30,0x30,0x72,0x31,0x61,0x3b,0x22,0x20,
-0x5b,0x5d,0x20,0x73,0x68,0x65,0x6c,0x6c,
-0x2d,0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,
-0x29,0x20,0x73,0x69,0x6d,0x70,0x6c,0x65,
-0x2d,0x73,0x6f,0x72,0x74,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x41,0x31,0x37,0x36,0x30,0x32,
-0x7c,0x4e,0x41,0x36,0x34,0x30,0x7c,0x3b,
-0x63,0x30,0x71,0x7c,0x4d,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x38,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x63,0x31,0x71,0x63,0x32,0x71,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x63,0x61,0x6c,0x6c,
-0x2d,0x77,0x69,0x74,0x68,0x2d,0x76,0x61,
-0x6c,0x75,0x65,0x73,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x30,
-0x65,0x30,0x63,0x31,0x71,0x69,0x31,0x30,
-0x4e,0x34,0x32,0x3b,0x22,0x20,0x5b,0x73,
-0x65,0x70,0x61,0x72,0x61,0x74,0x65,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x7e,0x58,0x3b,0x22,
-0x20,0x5b,0x5d,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x65,0x31,0x7c,0x33,
-0x31,0x7e,0x4c,0x31,0x65,0x31,0x7d,0x33,
-0x31,0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,
-0x29,0x20,0x73,0x69,0x6d,0x70,0x6c,0x65,
-0x2d,0x73,0x6f,0x72,0x74,0x5d,0x29,0x5d,
-0x29,0x5d,0x20,0x73,0x69,0x6d,0x70,0x6c,
-0x65,0x2d,0x73,0x6f,0x72,0x74,0x29,0x20,
+0x30,0x72,0x31,0x61,0x3b,0x22,0x20,0x5b,
+0x5d,0x20,0x73,0x68,0x65,0x6c,0x6c,0x2d,
+0x63,0x6f,0x6d,0x6d,0x61,0x6e,0x64,0x29,
+0x20,0x73,0x69,0x6d,0x70,0x6c,0x65,0x2d,
 0x73,0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x39,0x30,0x30,0x30,0x5c,0x78,
-0x38,0x39,0x31,0x30,0x30,0x30,0x33,0x30,
-0x30,0x30,0x5c,0x78,0x38,0x61,0x31,0x30,
-0x30,0x30,0x37,0x37,0x30,0x63,0x30,0x6d,
-0x31,0x32,0x5c,0x78,0x38,0x61,0x32,0x30,
-0x30,0x30,0x37,0x37,0x30,0x65,0x31,0x6d,
-0x32,0x32,0x63,0x32,0x71,0x5d,0x33,0x31,
-0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x2e,0x3c,0x20,0x69,0x64,0x65,0x6e,0x74,
-0x69,0x74,0x79,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x36,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x6d,0x30,0x32,0x7c,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x41,0x31,
-0x37,0x36,0x30,0x32,0x7c,0x4e,0x41,0x36,
-0x34,0x30,0x7c,0x3b,0x63,0x30,0x71,0x7c,
-0x4d,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x65,0x30,0x63,0x31,0x71,0x63,
-0x32,0x71,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x63,0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,
-0x68,0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
-0x30,0x30,0x72,0x30,0x65,0x30,0x63,0x31,
-0x71,0x69,0x31,0x30,0x4e,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x73,0x65,0x70,0x61,0x72,
-0x61,0x74,0x65,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x69,
-0x33,0x31,0x69,0x33,0x32,0x7c,0x33,0x31,
-0x69,0x33,0x32,0x7e,0x33,0x31,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x32,0x63,0x30,0x69,0x32,
-0x30,0x7c,0x33,0x31,0x7e,0x4c,0x31,0x69,
-0x32,0x30,0x7d,0x33,0x31,0x34,0x33,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x6e,
-0x63,0x6f,0x6e,0x63,0x29,0x5d,0x29,0x5d,
-0x29,0x5d,0x29,0x5d,0x29,0x5d,0x20,0x73,
-0x6f,0x72,0x74,0x29,0x20,0x73,0x70,0x6c,
-0x69,0x63,0x65,0x2d,0x66,0x6f,0x72,0x6d,
-0x3f,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x7c,0x46,0x31,
-0x36,0x58,0x30,0x32,0x7c,0x4d,0x63,0x30,
-0x3c,0x31,0x37,0x4e,0x30,0x32,0x7c,0x4d,
-0x63,0x31,0x3c,0x31,0x37,0x44,0x30,0x32,
-0x7c,0x4d,0x63,0x32,0x3c,0x31,0x36,0x3a,
-0x30,0x32,0x65,0x33,0x7c,0x62,0x32,0x33,
-0x32,0x31,0x37,0x37,0x30,0x32,0x7c,0x63,
-0x32,0x3c,0x3b,0x22,0x20,0x5b,0x75,0x6e,
-0x71,0x75,0x6f,0x74,0x65,0x2d,0x73,0x70,
-0x6c,0x69,0x63,0x69,0x6e,0x67,0x20,0x75,
-0x6e,0x71,0x75,0x6f,0x74,0x65,0x2d,0x6e,
-0x73,0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,
-0x20,0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,
-0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3e,
-0x5d,0x20,0x73,0x70,0x6c,0x69,0x63,0x65,
-0x2d,0x66,0x6f,0x72,0x6d,0x3f,0x29,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x3e,
-0x6c,0x69,0x73,0x74,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x5d,0x34,0x31,0x3b,0x22,
+0x7c,0x41,0x31,0x37,0x36,0x30,0x32,0x7c,
+0x4e,0x41,0x36,0x34,0x30,0x7c,0x3b,0x63,
+0x30,0x71,0x7c,0x4d,0x34,0x31,0x3b,0x22,
 0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x6d,0x30,0x32,0x7c,0x63,0x31,0x7e,0x33,
-0x31,0x5f,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x63,
+0x31,0x71,0x63,0x32,0x71,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x63,0x61,0x6c,0x6c,0x2d,
+0x77,0x69,0x74,0x68,0x2d,0x76,0x61,0x6c,
+0x75,0x65,0x73,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x38,0x30,0x30,0x30,0x72,0x30,0x65,
+0x30,0x63,0x31,0x71,0x69,0x31,0x30,0x4e,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x73,0x65,
+0x70,0x61,0x72,0x61,0x74,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x7e,0x58,0x3b,0x22,0x20,
+0x5b,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,0x72,
+0x32,0x63,0x30,0x65,0x31,0x7c,0x33,0x31,
+0x7e,0x4c,0x31,0x65,0x31,0x7d,0x33,0x31,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x6e,0x63,0x6f,0x6e,0x63,0x29,
+0x20,0x73,0x69,0x6d,0x70,0x6c,0x65,0x2d,
+0x73,0x6f,0x72,0x74,0x5d,0x29,0x5d,0x29,
+0x5d,0x20,0x73,0x69,0x6d,0x70,0x6c,0x65,
+0x2d,0x73,0x6f,0x72,0x74,0x29,0x20,0x73,
+0x6f,0x72,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x39,0x30,0x30,0x30,0x5c,0x78,0x38,
+0x39,0x31,0x30,0x30,0x30,0x33,0x30,0x30,
+0x30,0x5c,0x78,0x38,0x61,0x31,0x30,0x30,
+0x30,0x37,0x37,0x30,0x63,0x30,0x6d,0x31,
+0x32,0x5c,0x78,0x38,0x61,0x32,0x30,0x30,
+0x30,0x37,0x37,0x30,0x65,0x31,0x6d,0x32,
+0x32,0x63,0x32,0x71,0x5d,0x33,0x31,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x2e,
+0x3c,0x20,0x69,0x64,0x65,0x6e,0x74,0x69,
+0x74,0x79,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x36,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x6d,0x30,0x32,0x7c,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x41,0x31,0x37,
+0x36,0x30,0x32,0x7c,0x4e,0x41,0x36,0x34,
+0x30,0x7c,0x3b,0x63,0x30,0x71,0x7c,0x4d,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x65,0x30,0x63,0x31,0x71,0x63,0x32,
+0x71,0x34,0x32,0x3b,0x22,0x20,0x5b,0x63,
+0x61,0x6c,0x6c,0x2d,0x77,0x69,0x74,0x68,
+0x2d,0x76,0x61,0x6c,0x75,0x65,0x73,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x30,0x65,0x30,0x63,0x31,0x71,
+0x69,0x31,0x30,0x4e,0x34,0x32,0x3b,0x22,
+0x20,0x5b,0x73,0x65,0x70,0x61,0x72,0x61,
+0x74,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x39,0x30,0x30,0x30,0x72,0x31,0x69,0x33,
+0x31,0x69,0x33,0x32,0x7c,0x33,0x31,0x69,
+0x33,0x32,0x7e,0x33,0x31,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x5d,0x29,0x5d,0x29,0x20,
 0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
-0x30,0x72,0x32,0x7c,0x60,0x57,0x36,0x34,
-0x30,0x7d,0x3b,0x63,0x30,0x69,0x31,0x30,
-0x7c,0x33,0x32,0x6d,0x30,0x32,0x7e,0x7c,
-0x63,0x31,0x69,0x31,0x30,0x7c,0x33,0x32,
-0x7d,0x4b,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x30,0x72,0x32,0x63,0x30,0x69,0x32,0x30,
+0x7c,0x33,0x31,0x7e,0x4c,0x31,0x69,0x32,
+0x30,0x7d,0x33,0x31,0x34,0x33,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x6e,0x63,
+0x6f,0x6e,0x63,0x29,0x5d,0x29,0x5d,0x29,
+0x5d,0x29,0x5d,0x29,0x5d,0x20,0x73,0x6f,
+0x72,0x74,0x29,0x20,0x73,0x70,0x6c,0x69,
+0x63,0x65,0x2d,0x66,0x6f,0x72,0x6d,0x3f,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x46,0x31,0x36,
+0x58,0x30,0x32,0x7c,0x4d,0x63,0x30,0x3c,
+0x31,0x37,0x4e,0x30,0x32,0x7c,0x4d,0x63,
+0x31,0x3c,0x31,0x37,0x44,0x30,0x32,0x7c,
+0x4d,0x63,0x32,0x3c,0x31,0x36,0x3a,0x30,
+0x32,0x65,0x33,0x7c,0x62,0x32,0x33,0x32,
+0x31,0x37,0x37,0x30,0x32,0x7c,0x63,0x32,
+0x3c,0x3b,0x22,0x20,0x5b,0x75,0x6e,0x71,
+0x75,0x6f,0x74,0x65,0x2d,0x73,0x70,0x6c,
+0x69,0x63,0x69,0x6e,0x67,0x20,0x75,0x6e,
+0x71,0x75,0x6f,0x74,0x65,0x2d,0x6e,0x73,
+0x70,0x6c,0x69,0x63,0x69,0x6e,0x67,0x20,
+0x75,0x6e,0x71,0x75,0x6f,0x74,0x65,0x20,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x3e,0x5d,
+0x20,0x73,0x70,0x6c,0x69,0x63,0x65,0x2d,
+0x66,0x6f,0x72,0x6d,0x3f,0x29,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2d,0x3e,0x6c,
+0x69,0x73,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x5d,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x6d,
+0x30,0x32,0x7c,0x63,0x31,0x7e,0x33,0x31,
+0x5f,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
+0x72,0x32,0x7c,0x60,0x57,0x36,0x34,0x30,
+0x7d,0x3b,0x63,0x30,0x69,0x31,0x30,0x7c,
+0x33,0x32,0x6d,0x30,0x32,0x7e,0x7c,0x63,
+0x31,0x69,0x31,0x30,0x7c,0x33,0x32,0x7d,
+0x4b,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x64,0x65,0x63,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x63,0x68,0x61,0x72,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x69,
+0x7a,0x65,0x6f,0x66,0x29,0x5d,0x29,0x5d,
+0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,
+0x3e,0x6c,0x69,0x73,0x74,0x29,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2d,0x3e,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x20,0x23,0x66,
+0x6e,0x28,0x73,0x79,0x6d,0x62,0x6f,0x6c,
+0x29,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x2d,0x61,0x70,0x70,0x65,0x6e,0x64,0x20,
 0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x64,0x65,0x63,0x29,0x20,
+0x6e,0x67,0x29,0x20,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2d,0x63,0x6f,0x70,0x79,0x20,
+0x23,0x66,0x6e,0x28,0x63,0x6f,0x70,0x79,
+0x29,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x2d,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,
 0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x63,0x68,0x61,0x72,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
-0x69,0x7a,0x65,0x6f,0x66,0x29,0x5d,0x29,
-0x5d,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x2d,0x3e,0x6c,0x69,0x73,0x74,0x29,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x3e,
-0x73,0x79,0x6d,0x62,0x6f,0x6c,0x20,0x23,
-0x66,0x6e,0x28,0x73,0x79,0x6d,0x62,0x6f,
-0x6c,0x29,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2d,0x61,0x70,0x70,0x65,0x6e,0x64,
-0x20,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x29,0x20,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2d,0x63,0x6f,0x70,0x79,
-0x20,0x23,0x66,0x6e,0x28,0x63,0x6f,0x70,
-0x79,0x29,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2d,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x20,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2e,0x63,0x6f,0x75,0x6e,
-0x74,0x29,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2d,0x72,0x65,0x66,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x7c,0x63,0x31,0x7c,0x60,
-0x7d,0x33,0x33,0x34,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2e,0x63,0x68,0x61,0x72,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x69,0x6e,0x63,
-0x29,0x5d,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2d,0x72,0x65,0x66,0x29,0x20,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2e,0x6a,0x6f,
-0x69,0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x32,0x7c,0x5c,
-0x78,0x38,0x35,0x35,0x30,0x63,0x30,0x3b,
-0x63,0x31,0x71,0x63,0x32,0x33,0x30,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x22,0x22,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x7c,0x7e,0x4d,
-0x33,0x32,0x32,0x65,0x31,0x63,0x32,0x71,
-0x7e,0x4e,0x33,0x32,0x32,0x63,0x33,0x7c,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x69,0x6f,0x2e,0x77,0x72,0x69,
-0x74,0x65,0x29,0x20,0x66,0x6f,0x72,0x2d,
-0x65,0x61,0x63,0x68,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x7e,0x69,0x31,0x31,0x33,0x32,
-0x32,0x63,0x30,0x7e,0x7c,0x34,0x32,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x77,0x72,0x69,0x74,0x65,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x74,0x6f,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x21,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x62,0x75,0x66,0x66,0x65,
-0x72,0x29,0x5d,0x20,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x6a,0x6f,0x69,0x6e,0x29,
-0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
-0x6c,0x70,0x61,0x64,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x33,
-0x63,0x30,0x65,0x31,0x67,0x32,0x7d,0x63,
-0x32,0x7c,0x33,0x31,0x78,0x33,0x32,0x7c,
-0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x6e,0x67,0x2e,0x63,0x6f,0x75,0x6e,0x74,
 0x29,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x2e,0x72,0x65,0x70,0x20,0x23,0x66,0x6e,
-0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
-0x63,0x6f,0x75,0x6e,0x74,0x29,0x5d,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x6c,
-0x70,0x61,0x64,0x29,0x20,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2e,0x6d,0x61,0x70,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x32,0x63,0x30,0x71,0x63,0x31,
-0x33,0x30,0x63,0x32,0x7d,0x33,0x31,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x32,
-0x63,0x30,0x71,0x60,0x33,0x31,0x32,0x63,
-0x31,0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
-0x30,0x72,0x31,0x5d,0x7c,0x5c,0x78,0x37,
-0x66,0x58,0x36,0x53,0x30,0x32,0x63,0x30,
-0x7e,0x69,0x31,0x30,0x63,0x31,0x69,0x31,
-0x31,0x7c,0x33,0x32,0x33,0x31,0x33,0x32,
-0x32,0x63,0x32,0x69,0x31,0x31,0x7c,0x33,
-0x32,0x6d,0x30,0x35,0x5c,0x76,0x2f,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x70,0x75,0x74,0x63,0x29,0x20,
+0x2d,0x72,0x65,0x66,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x3b,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x7c,0x63,0x31,0x7c,0x60,0x7d,
+0x33,0x33,0x34,0x32,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
 0x6e,0x67,0x2e,0x63,0x68,0x61,0x72,0x29,
 0x20,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
 0x69,0x6e,0x67,0x2e,0x69,0x6e,0x63,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x74,0x6f,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x21,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x62,0x75,0x66,0x66,0x65,
-0x72,0x29,0x20,0x23,0x66,0x6e,0x28,0x6c,
-0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x6d,
-0x61,0x70,0x29,0x20,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x72,0x65,0x70,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x32,0x7d,0x62,0x34,0x58,0x36,0x60,
-0x30,0x65,0x30,0x7d,0x60,0x33,0x32,0x36,
-0x35,0x30,0x63,0x31,0x3b,0x7d,0x61,0x57,
-0x36,0x38,0x30,0x63,0x32,0x7c,0x34,0x31,
-0x3b,0x7d,0x62,0x32,0x57,0x36,0x39,0x30,
-0x63,0x32,0x7c,0x7c,0x34,0x32,0x3b,0x63,
-0x32,0x7c,0x7c,0x7c,0x34,0x33,0x3b,0x65,
-0x33,0x7d,0x33,0x31,0x36,0x40,0x30,0x63,
-0x32,0x7c,0x65,0x34,0x7c,0x7d,0x61,0x78,
-0x33,0x32,0x34,0x32,0x3b,0x65,0x34,0x63,
-0x32,0x7c,0x7c,0x33,0x32,0x7d,0x62,0x32,
-0x55,0x32,0x34,0x32,0x3b,0x22,0x20,0x5b,
-0x3c,0x3d,0x20,0x22,0x22,0x20,0x23,0x66,
-0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x29,0x20,0x6f,0x64,0x64,0x3f,0x20,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2e,0x72,0x65,
-0x70,0x5d,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2e,0x72,0x65,0x70,0x29,0x20,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2e,0x72,0x70,
-0x61,0x64,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3c,0x30,0x30,0x30,0x72,0x33,0x63,0x30,
-0x7c,0x65,0x31,0x67,0x32,0x7d,0x63,0x32,
-0x7c,0x33,0x31,0x78,0x33,0x32,0x34,0x32,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x29,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x72,
-0x65,0x70,0x20,0x23,0x66,0x6e,0x28,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x2e,0x63,0x6f,
-0x75,0x6e,0x74,0x29,0x5d,0x20,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x72,0x70,0x61,
-0x64,0x29,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2e,0x74,0x61,0x69,0x6c,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x7c,0x63,0x31,0x7c,
-0x60,0x7d,0x33,0x33,0x34,0x32,0x3b,0x22,
+0x5d,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x2d,0x72,0x65,0x66,0x29,0x20,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x2e,0x6a,0x6f,0x69,
+0x6e,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x32,0x7c,0x5c,0x78,
+0x38,0x35,0x35,0x30,0x63,0x30,0x3b,0x63,
+0x31,0x71,0x63,0x32,0x33,0x30,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x22,0x22,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x7c,0x7e,0x4d,0x33,
+0x32,0x32,0x65,0x31,0x63,0x32,0x71,0x7e,
+0x4e,0x33,0x32,0x32,0x63,0x33,0x7c,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,
+0x62,0x75,0x69,0x6c,0x64,0x65,0x72,0x2d,
+0x61,0x70,0x70,0x65,0x6e,0x64,0x21,0x29,
+0x20,0x66,0x6f,0x72,0x2d,0x65,0x61,0x63,
+0x68,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7e,
+0x69,0x31,0x31,0x7c,0x34,0x33,0x3b,0x22,
 0x20,0x5b,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x73,0x75,0x62,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x69,0x6e,0x63,
-0x29,0x5d,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x2e,0x74,0x61,0x69,0x6c,0x29,0x20,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x74,
-0x72,0x69,0x6d,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x38,0x30,0x30,0x30,0x72,0x33,0x63,
-0x30,0x71,0x5d,0x5d,0x34,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x32,0x63,0x30,0x71,
-0x6d,0x30,0x32,0x63,0x31,0x71,0x6d,0x31,
-0x32,0x63,0x32,0x71,0x63,0x33,0x7e,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,0x30,
-0x72,0x34,0x67,0x32,0x67,0x33,0x58,0x31,
-0x36,0x3f,0x30,0x32,0x63,0x30,0x7d,0x63,
-0x31,0x7c,0x67,0x32,0x33,0x32,0x33,0x32,
-0x36,0x41,0x30,0x7e,0x7c,0x7d,0x63,0x32,
-0x7c,0x67,0x32,0x33,0x32,0x67,0x33,0x34,
-0x34,0x3b,0x67,0x32,0x3b,0x22,0x20,0x5b,
+0x72,0x69,0x6e,0x67,0x2d,0x62,0x75,0x69,
+0x6c,0x64,0x65,0x72,0x2d,0x61,0x70,0x70,
+0x65,0x6e,0x64,0x21,0x29,0x5d,0x29,0x20,
 0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x2e,0x66,0x69,0x6e,0x64,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
-0x69,0x6e,0x67,0x2e,0x63,0x68,0x61,0x72,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x69,0x6e,0x63,
-0x29,0x5d,0x20,0x74,0x72,0x69,0x6d,0x2d,
-0x73,0x74,0x61,0x72,0x74,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,
-0x72,0x33,0x65,0x30,0x67,0x32,0x60,0x33,
-0x32,0x31,0x36,0x44,0x30,0x32,0x63,0x31,
-0x7d,0x63,0x32,0x7c,0x63,0x33,0x7c,0x67,
-0x32,0x33,0x32,0x33,0x32,0x33,0x32,0x36,
-0x3f,0x30,0x5c,0x78,0x37,0x66,0x7c,0x7d,
-0x63,0x33,0x7c,0x67,0x32,0x33,0x32,0x34,
-0x33,0x3b,0x67,0x32,0x3b,0x22,0x20,0x5b,
-0x3e,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x66,0x69,0x6e,
-0x64,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
+0x6e,0x67,0x2d,0x62,0x75,0x69,0x6c,0x64,
+0x65,0x72,0x2d,0x3e,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x2d,0x62,0x75,0x69,0x6c,0x64,0x65,0x72,
+0x29,0x5d,0x20,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x6a,0x6f,0x69,0x6e,0x29,0x20,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x6c,
+0x70,0x61,0x64,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3b,0x30,0x30,0x30,0x72,0x33,0x63,
+0x30,0x65,0x31,0x67,0x32,0x7d,0x63,0x32,
+0x7c,0x33,0x31,0x78,0x33,0x32,0x7c,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x29,
+0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+0x72,0x65,0x70,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x63,
+0x6f,0x75,0x6e,0x74,0x29,0x5d,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x6c,0x70,
+0x61,0x64,0x29,0x20,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2e,0x6d,0x61,0x70,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x32,0x63,0x30,0x71,0x63,0x31,0x63,
+0x32,0x7d,0x33,0x31,0x33,0x31,0x63,0x33,
+0x7d,0x33,0x31,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x32,0x63,0x30,0x71,0x60,
+0x33,0x31,0x32,0x63,0x31,0x7c,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3b,0x30,0x30,0x30,0x72,0x31,0x5d,
+0x7c,0x5c,0x78,0x37,0x66,0x58,0x36,0x53,
+0x30,0x32,0x63,0x30,0x7e,0x69,0x31,0x30,
+0x63,0x31,0x69,0x31,0x31,0x7c,0x33,0x32,
+0x33,0x31,0x33,0x32,0x32,0x63,0x32,0x69,
+0x31,0x31,0x7c,0x33,0x32,0x6d,0x30,0x35,
+0x5c,0x76,0x2f,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2d,0x62,0x75,0x69,0x6c,0x64,0x65,
+0x72,0x2d,0x61,0x70,0x70,0x65,0x6e,0x64,
+0x21,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
 0x74,0x72,0x69,0x6e,0x67,0x2e,0x63,0x68,
 0x61,0x72,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x64,
-0x65,0x63,0x29,0x5d,0x20,0x74,0x72,0x69,
-0x6d,0x2d,0x65,0x6e,0x64,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x69,0x31,0x30,0x7e,
-0x69,0x31,0x30,0x69,0x31,0x31,0x60,0x7c,
-0x33,0x34,0x5c,0x78,0x37,0x66,0x69,0x31,
-0x30,0x69,0x31,0x32,0x7c,0x33,0x33,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
-0x73,0x75,0x62,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
-0x68,0x29,0x5d,0x29,0x5d,0x20,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x2e,0x74,0x72,0x69,
-0x6d,0x29,0x20,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x3c,0x3d,0x3f,0x20,0x23,0x30,0x23,
-0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x3c,
-0x3f,0x20,0x23,0x2e,0x3c,0x20,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x3d,0x3f,0x20,0x23,
-0x2e,0x65,0x71,0x76,0x3f,0x20,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x3e,0x3d,0x3f,0x20,
-0x23,0x31,0x23,0x20,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x3e,0x3f,0x20,0x23,0x32,0x23,
-0x20,0x73,0x75,0x62,0x73,0x74,0x72,0x69,
-0x6e,0x67,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x3c,0x30,0x30,0x30,0x72,0x33,0x63,0x30,
-0x7c,0x63,0x31,0x7c,0x60,0x7d,0x33,0x33,
-0x63,0x31,0x7c,0x60,0x67,0x32,0x33,0x33,
-0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x2e,0x73,0x75,0x62,0x29,0x20,0x23,0x66,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x69,
+0x6e,0x63,0x29,0x5d,0x29,0x20,0x23,0x66,
 0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x2e,0x69,0x6e,0x63,0x29,0x5d,0x20,0x73,
-0x75,0x62,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
+0x2d,0x62,0x75,0x69,0x6c,0x64,0x65,0x72,
 0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2d,0x62,
+0x75,0x69,0x6c,0x64,0x65,0x72,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x73,0x69,0x7a,0x65,
+0x6f,0x66,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x5d,
+0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+0x6d,0x61,0x70,0x29,0x20,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x2e,0x72,0x65,0x70,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
+0x30,0x72,0x32,0x7d,0x62,0x34,0x58,0x36,
+0x60,0x30,0x65,0x30,0x7d,0x60,0x33,0x32,
+0x36,0x35,0x30,0x63,0x31,0x3b,0x7d,0x61,
+0x57,0x36,0x38,0x30,0x63,0x32,0x7c,0x34,
+0x31,0x3b,0x7d,0x62,0x32,0x57,0x36,0x39,
+0x30,0x63,0x32,0x7c,0x7c,0x34,0x32,0x3b,
+0x63,0x32,0x7c,0x7c,0x7c,0x34,0x33,0x3b,
+0x65,0x33,0x7d,0x33,0x31,0x36,0x40,0x30,
+0x63,0x32,0x7c,0x65,0x34,0x7c,0x7d,0x61,
+0x78,0x33,0x32,0x34,0x32,0x3b,0x65,0x34,
+0x63,0x32,0x7c,0x7c,0x33,0x32,0x7d,0x62,
+0x32,0x55,0x32,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x3c,0x3d,0x20,0x22,0x22,0x20,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x29,0x20,0x6f,0x64,0x64,0x3f,0x20,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x72,
+0x65,0x70,0x5d,0x20,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2e,0x72,0x65,0x70,0x29,0x20,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x72,
+0x70,0x61,0x64,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3c,0x30,0x30,0x30,0x72,0x33,0x63,
+0x30,0x7c,0x65,0x31,0x67,0x32,0x7d,0x63,
+0x32,0x7c,0x33,0x31,0x78,0x33,0x32,0x34,
+0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
 0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x29,
-0x5d,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-0x2d,0x73,0x79,0x6e,0x74,0x61,0x78,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x65,0x31,0x7c,
-0x5e,0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x67,0x65,0x74,0x29,0x20,
-0x2a,0x73,0x79,0x6e,0x74,0x61,0x78,0x2d,
-0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,
-0x65,0x6e,0x74,0x2a,0x5d,0x20,0x73,0x79,
-0x6d,0x62,0x6f,0x6c,0x2d,0x73,0x79,0x6e,
-0x74,0x61,0x78,0x29,0x20,0x73,0x79,0x6d,
-0x62,0x6f,0x6c,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+0x72,0x65,0x70,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x63,
+0x6f,0x75,0x6e,0x74,0x29,0x5d,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x72,0x70,
+0x61,0x64,0x29,0x20,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2e,0x74,0x61,0x69,0x6c,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
+0x30,0x72,0x32,0x63,0x30,0x7c,0x63,0x31,
+0x7c,0x60,0x7d,0x33,0x33,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x73,0x75,
+0x62,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x69,0x6e,
+0x63,0x29,0x5d,0x20,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x2e,0x74,0x61,0x69,0x6c,0x29,
+0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+0x74,0x72,0x69,0x6d,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x33,
+0x63,0x30,0x71,0x5d,0x5d,0x34,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
+0x71,0x6d,0x30,0x32,0x63,0x31,0x71,0x6d,
+0x31,0x32,0x63,0x32,0x71,0x63,0x33,0x7e,
+0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x3b,0x30,0x30,
+0x30,0x72,0x34,0x67,0x32,0x67,0x33,0x58,
+0x31,0x36,0x3f,0x30,0x32,0x63,0x30,0x7d,
+0x63,0x31,0x7c,0x67,0x32,0x33,0x32,0x33,
+0x32,0x36,0x41,0x30,0x7e,0x7c,0x7d,0x63,
+0x32,0x7c,0x67,0x32,0x33,0x32,0x67,0x33,
+0x34,0x34,0x3b,0x67,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x2e,0x66,0x69,0x6e,0x64,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
+0x72,0x69,0x6e,0x67,0x2e,0x63,0x68,0x61,
+0x72,0x29,0x20,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x69,0x6e,
+0x63,0x29,0x5d,0x20,0x74,0x72,0x69,0x6d,
+0x2d,0x73,0x74,0x61,0x72,0x74,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,
+0x30,0x72,0x33,0x65,0x30,0x67,0x32,0x60,
+0x33,0x32,0x31,0x36,0x44,0x30,0x32,0x63,
+0x31,0x7d,0x63,0x32,0x7c,0x63,0x33,0x7c,
+0x67,0x32,0x33,0x32,0x33,0x32,0x33,0x32,
+0x36,0x3f,0x30,0x5c,0x78,0x37,0x66,0x7c,
+0x7d,0x63,0x33,0x7c,0x67,0x32,0x33,0x32,
+0x34,0x33,0x3b,0x67,0x32,0x3b,0x22,0x20,
+0x5b,0x3e,0x20,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x66,0x69,
+0x6e,0x64,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,0x63,
+0x68,0x61,0x72,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x73,0x74,0x72,0x69,0x6e,0x67,0x2e,
+0x64,0x65,0x63,0x29,0x5d,0x20,0x74,0x72,
+0x69,0x6d,0x2d,0x65,0x6e,0x64,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x3c,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x69,0x31,0x30,
+0x7e,0x69,0x31,0x30,0x69,0x31,0x31,0x60,
+0x7c,0x33,0x34,0x5c,0x78,0x37,0x66,0x69,
+0x31,0x30,0x69,0x31,0x32,0x7c,0x33,0x33,
+0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x2e,0x73,0x75,0x62,0x29,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,
+0x74,0x68,0x29,0x5d,0x29,0x5d,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x2e,0x74,0x72,
+0x69,0x6d,0x29,0x20,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x3c,0x3d,0x3f,0x20,0x23,0x30,
+0x23,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x3c,0x3f,0x20,0x23,0x2e,0x3c,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x3d,0x3f,0x20,
+0x23,0x2e,0x65,0x71,0x76,0x3f,0x20,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x3e,0x3d,0x3f,
+0x20,0x23,0x31,0x23,0x20,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x3e,0x3f,0x20,0x23,0x32,
+0x23,0x20,0x73,0x75,0x62,0x73,0x74,0x72,
+0x69,0x6e,0x67,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x3c,0x30,0x30,0x30,0x72,0x33,0x63,
+0x30,0x7c,0x63,0x31,0x7c,0x60,0x7d,0x33,
+0x33,0x63,0x31,0x7c,0x60,0x67,0x32,0x33,
+0x33,0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x73,0x75,0x62,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x2e,0x69,0x6e,0x63,0x29,0x5d,0x20,
+0x73,0x75,0x62,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
 0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x7c,
 0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,
-0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x29,0x5d,0x20,0x73,0x79,0x6d,0x62,
-0x6f,0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,
-0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,
-0x3d,0x3f,0x20,0x23,0x2e,0x65,0x71,0x3f,
-0x20,0x73,0x79,0x73,0x74,0x65,0x6d,0x2d,
-0x69,0x6d,0x61,0x67,0x65,0x2d,0x3e,0x62,
-0x75,0x66,0x66,0x65,0x72,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x30,0x63,0x30,0x63,0x31,0x33,0x30,0x63,
-0x32,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,0x67,
+0x29,0x5d,0x20,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x2d,0x3e,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x2d,0x73,0x79,0x6e,0x74,0x61,0x78,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x65,0x31,
+0x7c,0x5e,0x34,0x33,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x67,0x65,0x74,0x29,
+0x20,0x2a,0x73,0x79,0x6e,0x74,0x61,0x78,
+0x2d,0x65,0x6e,0x76,0x69,0x72,0x6f,0x6e,
+0x6d,0x65,0x6e,0x74,0x2a,0x5d,0x20,0x73,
+0x79,0x6d,0x62,0x6f,0x6c,0x2d,0x73,0x79,
+0x6e,0x74,0x61,0x78,0x29,0x20,0x73,0x79,
+0x6d,0x62,0x6f,0x6c,0x2d,0x76,0x61,0x6c,
+0x75,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,
+0x65,0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,
+0x75,0x65,0x29,0x5d,0x20,0x73,0x79,0x6d,
+0x62,0x6f,0x6c,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x29,0x20,0x73,0x79,0x6d,0x62,0x6f,
+0x6c,0x3d,0x3f,0x20,0x23,0x2e,0x65,0x71,
+0x3f,0x20,0x73,0x79,0x73,0x74,0x65,0x6d,
+0x2d,0x69,0x6d,0x61,0x67,0x65,0x2d,0x3e,
+0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x32,0x63,0x30,0x71,0x65,0x31,0x65,
-0x32,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
+0x72,0x30,0x63,0x30,0x63,0x31,0x33,0x30,
+0x63,0x32,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
+0x30,0x72,0x32,0x63,0x30,0x71,0x65,0x31,
+0x65,0x32,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x32,0x5d,0x6b,0x30,0x32,0x5d,
+0x6b,0x31,0x32,0x63,0x32,0x71,0x63,0x33,
+0x71,0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,
+0x70,0x72,0x69,0x6e,0x74,0x2d,0x70,0x72,
+0x65,0x74,0x74,0x79,0x2a,0x20,0x2a,0x70,
+0x72,0x69,0x6e,0x74,0x2d,0x72,0x65,0x61,
+0x64,0x61,0x62,0x6c,0x79,0x2a,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x32,0x5d,0x6b,0x30,0x32,0x5d,0x6b,
-0x31,0x32,0x63,0x32,0x71,0x63,0x33,0x71,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,0x70,
+0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x71,
+0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x30,0x63,0x30,0x71,0x65,
+0x31,0x63,0x32,0x71,0x65,0x33,0x63,0x34,
+0x33,0x30,0x33,0x31,0x33,0x32,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x3d,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x63,0x31,0x63,0x32,0x63,0x33,0x7c,
+0x63,0x32,0x63,0x34,0x7c,0x33,0x32,0x33,
+0x33,0x51,0x32,0x69,0x32,0x30,0x33,0x32,
+0x32,0x63,0x35,0x69,0x32,0x30,0x60,0x33,
+0x32,0x32,0x69,0x32,0x30,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x77,0x72,0x69,
+0x74,0x65,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6e,0x63,0x6f,0x6e,0x63,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,
+0x23,0x2e,0x6c,0x69,0x73,0x74,0x20,0x23,
+0x66,0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,
+0x65,0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,
+0x75,0x65,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x69,0x6f,0x2e,0x73,0x65,0x65,0x6b,0x29,
+0x5d,0x29,0x20,0x66,0x69,0x6c,0x74,0x65,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x31,0x7c,0x45,0x31,
+0x36,0x77,0x30,0x32,0x63,0x30,0x7c,0x33,
+0x31,0x40,0x31,0x36,0x6c,0x30,0x32,0x63,
+0x31,0x7c,0x33,0x31,0x47,0x40,0x31,0x37,
+0x43,0x30,0x32,0x63,0x32,0x7c,0x33,0x31,
+0x63,0x32,0x63,0x31,0x7c,0x33,0x31,0x33,
+0x31,0x3e,0x40,0x31,0x36,0x4b,0x30,0x32,
+0x63,0x33,0x7c,0x69,0x32,0x31,0x33,0x32,
+0x40,0x31,0x36,0x3d,0x30,0x32,0x63,0x34,
+0x63,0x31,0x7c,0x33,0x31,0x33,0x31,0x40,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,
+0x3f,0x29,0x20,0x23,0x66,0x6e,0x28,0x74,
+0x6f,0x70,0x2d,0x6c,0x65,0x76,0x65,0x6c,
+0x2d,0x76,0x61,0x6c,0x75,0x65,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x6d,0x65,0x6d,0x71,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x69,0x6f,0x73,0x74,0x72,0x65,
+0x61,0x6d,0x3f,0x29,0x5d,0x29,0x20,0x73,
+0x69,0x6d,0x70,0x6c,0x65,0x2d,0x73,0x6f,
+0x72,0x74,0x20,0x23,0x66,0x6e,0x28,0x65,
+0x6e,0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,
+0x6e,0x74,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x7e,0x33,0x30,0x32,0x63,0x30,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x72,0x61,0x69,0x73,0x65,0x29,
+0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x30,
+0x7e,0x6b,0x30,0x32,0x5c,0x78,0x37,0x66,
+0x6b,0x31,0x3b,0x22,0x20,0x5b,0x2a,0x70,
 0x72,0x69,0x6e,0x74,0x2d,0x70,0x72,0x65,
 0x74,0x74,0x79,0x2a,0x20,0x2a,0x70,0x72,
 0x69,0x6e,0x74,0x2d,0x72,0x65,0x61,0x64,
-0x61,0x62,0x6c,0x79,0x2a,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x63,0x31,0x71,0x74,
-0x7c,0x33,0x30,0x32,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
-0x30,0x72,0x30,0x63,0x30,0x71,0x65,0x31,
-0x63,0x32,0x71,0x65,0x33,0x63,0x34,0x33,
-0x30,0x33,0x31,0x33,0x32,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x3d,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x63,0x31,0x63,0x32,0x63,0x33,0x7c,0x63,
-0x32,0x63,0x34,0x7c,0x33,0x32,0x33,0x33,
-0x51,0x32,0x69,0x32,0x30,0x33,0x32,0x32,
-0x63,0x35,0x69,0x32,0x30,0x60,0x33,0x32,
-0x32,0x69,0x32,0x30,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x77,0x72,0x69,0x74,
-0x65,0x29,0x20,0x23,0x66,0x6e,0x28,0x6e,
-0x63,0x6f,0x6e,0x63,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x6d,0x61,0x70,0x29,0x20,0x23,
-0x2e,0x6c,0x69,0x73,0x74,0x20,0x23,0x66,
-0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,
-0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
-0x65,0x29,0x20,0x23,0x66,0x6e,0x28,0x69,
-0x6f,0x2e,0x73,0x65,0x65,0x6b,0x29,0x5d,
-0x29,0x20,0x66,0x69,0x6c,0x74,0x65,0x72,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x31,0x7c,0x45,0x31,0x36,
-0x77,0x30,0x32,0x63,0x30,0x7c,0x33,0x31,
-0x40,0x31,0x36,0x6c,0x30,0x32,0x63,0x31,
-0x7c,0x33,0x31,0x47,0x40,0x31,0x37,0x43,
-0x30,0x32,0x63,0x32,0x7c,0x33,0x31,0x63,
-0x32,0x63,0x31,0x7c,0x33,0x31,0x33,0x31,
-0x3e,0x40,0x31,0x36,0x4b,0x30,0x32,0x63,
-0x33,0x7c,0x69,0x32,0x31,0x33,0x32,0x40,
-0x31,0x36,0x3d,0x30,0x32,0x63,0x34,0x63,
-0x31,0x7c,0x33,0x31,0x33,0x31,0x40,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x63,
-0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x3f,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x74,0x6f,
-0x70,0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2d,
-0x76,0x61,0x6c,0x75,0x65,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x29,0x20,0x23,0x66,0x6e,0x28,0x6d,
-0x65,0x6d,0x71,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x73,0x74,0x72,0x65,0x61,
-0x6d,0x3f,0x29,0x5d,0x29,0x20,0x73,0x69,
-0x6d,0x70,0x6c,0x65,0x2d,0x73,0x6f,0x72,
-0x74,0x20,0x23,0x66,0x6e,0x28,0x65,0x6e,
-0x76,0x69,0x72,0x6f,0x6e,0x6d,0x65,0x6e,
-0x74,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x7e,0x33,0x30,0x32,0x63,0x30,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x72,0x61,0x69,0x73,0x65,0x29,0x5d,
-0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x36,0x30,0x30,0x30,0x72,0x30,0x7e,
-0x6b,0x30,0x32,0x5c,0x78,0x37,0x66,0x6b,
-0x31,0x3b,0x22,0x20,0x5b,0x2a,0x70,0x72,
-0x69,0x6e,0x74,0x2d,0x70,0x72,0x65,0x74,
-0x74,0x79,0x2a,0x20,0x2a,0x70,0x72,0x69,
-0x6e,0x74,0x2d,0x72,0x65,0x61,0x64,0x61,
-0x62,0x6c,0x79,0x2a,0x5d,0x29,0x5d,0x29,
+0x61,0x62,0x6c,0x79,0x2a,0x5d,0x29,0x5d,
+0x29,0x20,0x2a,0x70,0x72,0x69,0x6e,0x74,
+0x2d,0x70,0x72,0x65,0x74,0x74,0x79,0x2a,
 0x20,0x2a,0x70,0x72,0x69,0x6e,0x74,0x2d,
-0x70,0x72,0x65,0x74,0x74,0x79,0x2a,0x20,
-0x2a,0x70,0x72,0x69,0x6e,0x74,0x2d,0x72,
-0x65,0x61,0x64,0x61,0x62,0x6c,0x79,0x2a,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x62,
-0x75,0x66,0x66,0x65,0x72,0x29,0x20,0x28,
-0x2a,0x6c,0x69,0x6e,0x65,0x66,0x65,0x65,
-0x64,0x2a,0x20,0x2a,0x64,0x69,0x72,0x65,
-0x63,0x74,0x6f,0x72,0x79,0x2d,0x73,0x65,
-0x70,0x61,0x72,0x61,0x74,0x6f,0x72,0x2a,
-0x20,0x2a,0x61,0x72,0x67,0x76,0x2a,0x20,
-0x74,0x68,0x61,0x74,0x20,0x2a,0x70,0x72,
-0x69,0x6e,0x74,0x2d,0x70,0x72,0x65,0x74,
-0x74,0x79,0x2a,0x20,0x2a,0x70,0x72,0x69,
-0x6e,0x74,0x2d,0x77,0x69,0x64,0x74,0x68,
+0x72,0x65,0x61,0x64,0x61,0x62,0x6c,0x79,
+0x2a,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x62,0x75,0x66,0x66,0x65,0x72,0x29,0x20,
+0x28,0x2a,0x6c,0x69,0x6e,0x65,0x66,0x65,
+0x65,0x64,0x2a,0x20,0x2a,0x64,0x69,0x72,
+0x65,0x63,0x74,0x6f,0x72,0x79,0x2d,0x73,
+0x65,0x70,0x61,0x72,0x61,0x74,0x6f,0x72,
+0x2a,0x20,0x2a,0x61,0x72,0x67,0x76,0x2a,
+0x20,0x74,0x68,0x61,0x74,0x20,0x2a,0x70,
+0x72,0x69,0x6e,0x74,0x2d,0x70,0x72,0x65,
+0x74,0x74,0x79,0x2a,0x20,0x2a,0x70,0x72,
+0x69,0x6e,0x74,0x2d,0x77,0x69,0x64,0x74,
+0x68,0x2a,0x20,0x2a,0x70,0x72,0x69,0x6e,
+0x74,0x2d,0x72,0x65,0x61,0x64,0x61,0x62,
+0x6c,0x79,0x2a,0x20,0x2a,0x70,0x72,0x69,
+0x6e,0x74,0x2d,0x6c,0x65,0x76,0x65,0x6c,
 0x2a,0x20,0x2a,0x70,0x72,0x69,0x6e,0x74,
-0x2d,0x72,0x65,0x61,0x64,0x61,0x62,0x6c,
-0x79,0x2a,0x20,0x2a,0x70,0x72,0x69,0x6e,
-0x74,0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2a,
-0x20,0x2a,0x70,0x72,0x69,0x6e,0x74,0x2d,
-0x6c,0x65,0x6e,0x67,0x74,0x68,0x2a,0x20,
-0x2a,0x6f,0x73,0x2d,0x6e,0x61,0x6d,0x65,
-0x2a,0x29,0x5d,0x20,0x73,0x79,0x73,0x74,
-0x65,0x6d,0x2d,0x69,0x6d,0x61,0x67,0x65,
-0x2d,0x3e,0x62,0x75,0x66,0x66,0x65,0x72,
-0x29,0x20,0x74,0x61,0x62,0x6c,0x65,0x2d,
-0x72,0x65,0x66,0x20,0x23,0x66,0x6e,0x28,
-0x67,0x65,0x74,0x29,0x20,0x74,0x61,0x62,
-0x6c,0x65,0x2d,0x73,0x65,0x74,0x21,0x20,
+0x2d,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2a,
+0x20,0x2a,0x6f,0x73,0x2d,0x6e,0x61,0x6d,
+0x65,0x2a,0x29,0x5d,0x20,0x73,0x79,0x73,
+0x74,0x65,0x6d,0x2d,0x69,0x6d,0x61,0x67,
+0x65,0x2d,0x3e,0x62,0x75,0x66,0x66,0x65,
+0x72,0x29,0x20,0x74,0x61,0x62,0x6c,0x65,
+0x2d,0x72,0x65,0x66,0x20,0x23,0x66,0x6e,
+0x28,0x67,0x65,0x74,0x29,0x20,0x74,0x61,
+0x62,0x6c,0x65,0x2d,0x73,0x65,0x74,0x21,
+0x20,0x23,0x66,0x6e,0x28,0x70,0x75,0x74,
+0x21,0x29,0x20,0x74,0x61,0x62,0x6c,0x65,
+0x2e,0x63,0x6c,0x6f,0x6e,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x33,
+0x30,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x31,0x63,0x30,0x63,0x31,0x71,0x5f,
+0x7e,0x33,0x33,0x32,0x7c,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x74,0x61,0x62,
+0x6c,0x65,0x2e,0x66,0x6f,0x6c,0x64,0x6c,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x33,0x63,0x30,0x7e,
+0x7c,0x7d,0x34,0x33,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x70,0x75,0x74,0x21,
-0x29,0x20,0x74,0x61,0x62,0x6c,0x65,0x2e,
-0x63,0x6c,0x6f,0x6e,0x65,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x71,0x63,0x31,0x33,0x30,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x63,0x31,0x71,0x5f,0x7e,
-0x33,0x33,0x32,0x7c,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,
-0x65,0x2e,0x66,0x6f,0x6c,0x64,0x6c,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x33,0x63,0x30,0x7e,0x7c,
-0x7d,0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x70,0x75,0x74,0x21,0x29,
-0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x74,0x61,0x62,0x6c,0x65,0x29,0x5d,
-0x20,0x74,0x61,0x62,0x6c,0x65,0x2e,0x63,
-0x6c,0x6f,0x6e,0x65,0x29,0x20,0x74,0x61,
-0x62,0x6c,0x65,0x2e,0x66,0x6f,0x72,0x65,
-0x61,0x63,0x68,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x39,0x30,0x30,0x30,0x72,0x32,0x63,
-0x30,0x63,0x31,0x71,0x5f,0x7d,0x34,0x33,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x74,0x61,0x62,0x6c,0x65,0x2e,0x66,0x6f,
-0x6c,0x64,0x6c,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x33,
-0x7e,0x7c,0x7d,0x33,0x32,0x32,0x5d,0x3b,
-0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,0x74,
+0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,0x29,
+0x5d,0x20,0x74,0x61,0x62,0x6c,0x65,0x2e,
+0x63,0x6c,0x6f,0x6e,0x65,0x29,0x20,0x74,
 0x61,0x62,0x6c,0x65,0x2e,0x66,0x6f,0x72,
-0x65,0x61,0x63,0x68,0x29,0x20,0x74,0x61,
-0x62,0x6c,0x65,0x2e,0x69,0x6e,0x76,0x65,
-0x72,0x74,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x37,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x71,0x63,0x31,0x33,0x30,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
-0x63,0x31,0x71,0x5f,0x7e,0x33,0x33,0x32,
-0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x65,0x61,0x63,0x68,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x39,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x63,0x31,0x71,0x5f,0x7d,0x34,
+0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
 0x28,0x74,0x61,0x62,0x6c,0x65,0x2e,0x66,
 0x6f,0x6c,0x64,0x6c,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x33,0x63,0x30,0x7e,0x7d,0x7c,0x34,0x33,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x33,0x7e,0x7c,0x7d,0x33,0x32,0x32,0x5d,
+0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,
+0x74,0x61,0x62,0x6c,0x65,0x2e,0x66,0x6f,
+0x72,0x65,0x61,0x63,0x68,0x29,0x20,0x74,
+0x61,0x62,0x6c,0x65,0x2e,0x69,0x6e,0x76,
+0x65,0x72,0x74,0x20,0x23,0x66,0x6e,0x28,
+0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x71,0x63,0x31,0x33,0x30,0x34,0x31,
 0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x70,0x75,0x74,0x21,0x29,0x5d,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x74,0x61,
-0x62,0x6c,0x65,0x29,0x5d,0x20,0x74,0x61,
-0x62,0x6c,0x65,0x2e,0x69,0x6e,0x76,0x65,
-0x72,0x74,0x29,0x20,0x74,0x61,0x62,0x6c,
-0x65,0x2e,0x6b,0x65,0x79,0x73,0x20,0x23,
+0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x63,
+0x30,0x63,0x31,0x71,0x5f,0x7e,0x33,0x33,
+0x32,0x7c,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,0x2e,
+0x66,0x6f,0x6c,0x64,0x6c,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x33,0x63,0x30,0x7e,0x7d,0x7c,0x34,
+0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x70,0x75,0x74,0x21,0x29,0x5d,0x29,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x74,
+0x61,0x62,0x6c,0x65,0x29,0x5d,0x20,0x74,
+0x61,0x62,0x6c,0x65,0x2e,0x69,0x6e,0x76,
+0x65,0x72,0x74,0x29,0x20,0x74,0x61,0x62,
+0x6c,0x65,0x2e,0x6b,0x65,0x79,0x73,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x39,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x63,0x31,0x5f,
+0x7c,0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,
+0x2e,0x66,0x6f,0x6c,0x64,0x6c,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x33,0x7c,0x67,0x32,0x4b,0x3b,
+0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,0x74,
+0x61,0x62,0x6c,0x65,0x2e,0x6b,0x65,0x79,
+0x73,0x29,0x20,0x74,0x61,0x62,0x6c,0x65,
+0x2e,0x70,0x61,0x69,0x72,0x73,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
 0x72,0x31,0x63,0x30,0x63,0x31,0x5f,0x7c,
 0x34,0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,
 0x6e,0x28,0x74,0x61,0x62,0x6c,0x65,0x2e,
 0x66,0x6f,0x6c,0x64,0x6c,0x29,0x20,0x23,
 0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x33,0x7c,0x67,0x32,0x4b,0x3b,0x22,
-0x20,0x5b,0x5d,0x29,0x5d,0x20,0x74,0x61,
-0x62,0x6c,0x65,0x2e,0x6b,0x65,0x79,0x73,
-0x29,0x20,0x74,0x61,0x62,0x6c,0x65,0x2e,
-0x70,0x61,0x69,0x72,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x31,0x63,0x30,0x63,0x31,0x5f,0x7c,0x34,
-0x33,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x74,0x61,0x62,0x6c,0x65,0x2e,0x66,
-0x6f,0x6c,0x64,0x6c,0x29,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x33,0x7c,0x7d,0x4b,0x67,0x32,0x4b,0x3b,
-0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,0x74,
-0x61,0x62,0x6c,0x65,0x2e,0x70,0x61,0x69,
-0x72,0x73,0x29,0x20,0x74,0x61,0x62,0x6c,
-0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x73,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x63,0x31,
-0x5f,0x7c,0x34,0x33,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x74,0x61,0x62,0x6c,
-0x65,0x2e,0x66,0x6f,0x6c,0x64,0x6c,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x33,0x7d,0x67,0x32,0x4b,
+0x72,0x33,0x7c,0x7d,0x4b,0x67,0x32,0x4b,
 0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x20,
-0x74,0x61,0x62,0x6c,0x65,0x2e,0x76,0x61,
-0x6c,0x75,0x65,0x73,0x29,0x20,0x74,0x6f,
-0x2d,0x70,0x72,0x6f,0x70,0x65,0x72,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x31,0x7c,0x5c,0x78,0x38,0x35,
-0x34,0x30,0x7c,0x3b,0x7c,0x3f,0x36,0x36,
-0x30,0x7c,0x4c,0x31,0x3b,0x7c,0x4d,0x65,
-0x30,0x7c,0x4e,0x33,0x31,0x4b,0x3b,0x22,
-0x20,0x5b,0x74,0x6f,0x2d,0x70,0x72,0x6f,
-0x70,0x65,0x72,0x5d,0x20,0x74,0x6f,0x2d,
-0x70,0x72,0x6f,0x70,0x65,0x72,0x29,0x20,
-0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,0x65,
-0x6c,0x2d,0x65,0x78,0x63,0x65,0x70,0x74,
-0x69,0x6f,0x6e,0x2d,0x68,0x61,0x6e,0x64,
-0x6c,0x65,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x65,0x31,0x34,0x31,0x3b,0x22,
+0x74,0x61,0x62,0x6c,0x65,0x2e,0x70,0x61,
+0x69,0x72,0x73,0x29,0x20,0x74,0x61,0x62,
+0x6c,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,
+0x73,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x63,
+0x31,0x5f,0x7c,0x34,0x33,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x74,0x61,0x62,
+0x6c,0x65,0x2e,0x66,0x6f,0x6c,0x64,0x6c,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x33,0x7d,0x67,0x32,
+0x4b,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,
+0x20,0x74,0x61,0x62,0x6c,0x65,0x2e,0x76,
+0x61,0x6c,0x75,0x65,0x73,0x29,0x20,0x74,
+0x6f,0x2d,0x70,0x72,0x6f,0x70,0x65,0x72,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x31,0x7c,0x5c,0x78,0x38,
+0x35,0x34,0x30,0x7c,0x3b,0x7c,0x3f,0x36,
+0x36,0x30,0x7c,0x4c,0x31,0x3b,0x7c,0x4d,
+0x65,0x30,0x7c,0x4e,0x33,0x31,0x4b,0x3b,
+0x22,0x20,0x5b,0x74,0x6f,0x2d,0x70,0x72,
+0x6f,0x70,0x65,0x72,0x5d,0x20,0x74,0x6f,
+0x2d,0x70,0x72,0x6f,0x70,0x65,0x72,0x29,
+0x20,0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,
+0x65,0x6c,0x2d,0x65,0x78,0x63,0x65,0x70,
+0x74,0x69,0x6f,0x6e,0x2d,0x68,0x61,0x6e,
+0x64,0x6c,0x65,0x72,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x63,0x30,0x71,0x65,0x31,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
+0x6b,0x31,0x32,0x63,0x32,0x71,0x63,0x33,
+0x71,0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,
+0x73,0x74,0x64,0x65,0x72,0x72,0x2a,0x20,
+0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,
+0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x30,0x72,0x31,0x63,0x30,0x71,0x63,0x31,
+0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,
 0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x6b,
-0x31,0x32,0x63,0x32,0x71,0x63,0x33,0x71,
-0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,0x73,
-0x74,0x64,0x65,0x72,0x72,0x2a,0x20,0x2a,
-0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x73,
-0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,0x23,
-0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x71,
-0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x30,0x65,0x30,0x69,0x32,
-0x30,0x33,0x31,0x32,0x65,0x31,0x63,0x32,
-0x33,0x30,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x70,0x72,0x69,0x6e,0x74,0x2d,0x65,0x78,
-0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,
-0x70,0x72,0x69,0x6e,0x74,0x2d,0x73,0x74,
-0x61,0x63,0x6b,0x2d,0x74,0x72,0x61,0x63,
-0x65,0x20,0x23,0x66,0x6e,0x28,0x73,0x74,
-0x61,0x63,0x6b,0x74,0x72,0x61,0x63,0x65,
+0x30,0x30,0x30,0x72,0x30,0x65,0x30,0x69,
+0x32,0x30,0x33,0x31,0x32,0x65,0x31,0x63,
+0x32,0x33,0x30,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x70,0x72,0x69,0x6e,0x74,0x2d,0x65,
+0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
+0x20,0x70,0x72,0x69,0x6e,0x74,0x2d,0x73,
+0x74,0x61,0x63,0x6b,0x2d,0x74,0x72,0x61,
+0x63,0x65,0x20,0x23,0x66,0x6e,0x28,0x73,
+0x74,0x61,0x63,0x6b,0x74,0x72,0x61,0x63,
+0x65,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
+0x7e,0x33,0x30,0x32,0x63,0x30,0x7c,0x34,
+0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x72,0x61,0x69,0x73,0x65,0x29,0x5d,
 0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x7e,
-0x33,0x30,0x32,0x63,0x30,0x7c,0x34,0x31,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x72,0x61,0x69,0x73,0x65,0x29,0x5d,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
-0x36,0x30,0x30,0x30,0x72,0x30,0x7e,0x6b,
-0x30,0x3b,0x22,0x20,0x5b,0x2a,0x6f,0x75,
-0x74,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
-0x65,0x61,0x6d,0x2a,0x5d,0x29,0x5d,0x29,
-0x20,0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,
-0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
-0x5d,0x20,0x74,0x6f,0x70,0x2d,0x6c,0x65,
-0x76,0x65,0x6c,0x2d,0x65,0x78,0x63,0x65,
-0x70,0x74,0x69,0x6f,0x6e,0x2d,0x68,0x61,
-0x6e,0x64,0x6c,0x65,0x72,0x29,0x20,0x74,
-0x72,0x61,0x63,0x65,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x63,0x31,0x7c,0x33,0x31,
-0x33,0x31,0x32,0x63,0x32,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
-0x31,0x33,0x30,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x3f,0x30,
-0x30,0x30,0x72,0x31,0x65,0x30,0x7e,0x33,
-0x31,0x37,0x61,0x30,0x63,0x31,0x69,0x31,
-0x30,0x65,0x32,0x63,0x33,0x7c,0x63,0x34,
-0x63,0x35,0x63,0x36,0x63,0x37,0x69,0x31,
-0x30,0x4c,0x32,0x7c,0x4c,0x33,0x4c,0x32,
-0x63,0x38,0x63,0x37,0x7e,0x4c,0x32,0x7c,
-0x4c,0x33,0x4c,0x33,0x4c,0x33,0x33,0x31,
-0x34,0x32,0x3b,0x5d,0x3b,0x22,0x20,0x5b,
-0x74,0x72,0x61,0x63,0x65,0x64,0x3f,0x20,
-0x23,0x66,0x6e,0x28,0x73,0x65,0x74,0x2d,
-0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,0x65,
-0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,0x21,
-0x29,0x20,0x65,0x76,0x61,0x6c,0x20,0x6c,
-0x61,0x6d,0x62,0x64,0x61,0x20,0x62,0x65,
-0x67,0x69,0x6e,0x20,0x77,0x72,0x69,0x74,
-0x65,0x6c,0x6e,0x20,0x63,0x6f,0x6e,0x73,
-0x20,0x71,0x75,0x6f,0x74,0x65,0x20,0x61,
-0x70,0x70,0x6c,0x79,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x67,0x65,0x6e,0x73,0x79,
-0x6d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,
-0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,
-0x29,0x20,0x6f,0x6b,0x5d,0x20,0x74,0x72,
-0x61,0x63,0x65,0x29,0x20,0x74,0x72,0x61,
-0x63,0x65,0x64,0x3f,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x65,0x30,0x7c,0x33,0x31,0x31,0x36,0x3e,
-0x30,0x32,0x63,0x31,0x7c,0x33,0x31,0x63,
-0x31,0x7e,0x33,0x31,0x3e,0x3b,0x22,0x20,
-0x5b,0x63,0x6c,0x6f,0x73,0x75,0x72,0x65,
-0x3f,0x20,0x23,0x66,0x6e,0x28,0x66,0x75,
-0x6e,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x63,
-0x6f,0x64,0x65,0x29,0x5d,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x73,0x30,0x63,0x30,0x63,0x31,0x7c,0x4b,
-0x33,0x31,0x32,0x63,0x32,0x7c,0x76,0x32,
-0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
-0x77,0x72,0x69,0x74,0x65,0x6c,0x6e,0x29,
-0x20,0x78,0x20,0x23,0x2e,0x61,0x70,0x70,
-0x6c,0x79,0x5d,0x29,0x20,0x28,0x29,0x5d,
-0x29,0x20,0x75,0x6e,0x74,0x72,0x61,0x63,
-0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
+0x22,0x36,0x30,0x30,0x30,0x72,0x30,0x7e,
+0x6b,0x30,0x3b,0x22,0x20,0x5b,0x2a,0x6f,
+0x75,0x74,0x70,0x75,0x74,0x2d,0x73,0x74,
+0x72,0x65,0x61,0x6d,0x2a,0x5d,0x29,0x5d,
+0x29,0x20,0x2a,0x6f,0x75,0x74,0x70,0x75,
+0x74,0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,
+0x2a,0x5d,0x20,0x74,0x6f,0x70,0x2d,0x6c,
+0x65,0x76,0x65,0x6c,0x2d,0x65,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,0x68,
+0x61,0x6e,0x64,0x6c,0x65,0x72,0x29,0x20,
+0x74,0x72,0x61,0x63,0x65,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x63,0x31,0x7c,0x33,
+0x31,0x33,0x31,0x32,0x63,0x32,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
 0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
-0x63,0x31,0x7c,0x33,0x31,0x34,0x31,0x3b,
-0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
-0x39,0x30,0x30,0x30,0x72,0x31,0x65,0x30,
-0x7c,0x33,0x31,0x36,0x40,0x30,0x63,0x31,
-0x7e,0x63,0x32,0x7c,0x33,0x31,0x62,0x32,
-0x5b,0x34,0x32,0x3b,0x5d,0x3b,0x22,0x20,
+0x63,0x31,0x33,0x30,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3f,
+0x30,0x30,0x30,0x72,0x31,0x65,0x30,0x7e,
+0x33,0x31,0x37,0x61,0x30,0x63,0x31,0x69,
+0x31,0x30,0x65,0x32,0x63,0x33,0x7c,0x63,
+0x34,0x63,0x35,0x63,0x36,0x63,0x37,0x69,
+0x31,0x30,0x4c,0x32,0x7c,0x4c,0x33,0x4c,
+0x32,0x63,0x38,0x63,0x37,0x7e,0x4c,0x32,
+0x7c,0x4c,0x33,0x4c,0x33,0x4c,0x33,0x33,
+0x31,0x34,0x32,0x3b,0x5d,0x3b,0x22,0x20,
 0x5b,0x74,0x72,0x61,0x63,0x65,0x64,0x3f,
 0x20,0x23,0x66,0x6e,0x28,0x73,0x65,0x74,
 0x2d,0x74,0x6f,0x70,0x2d,0x6c,0x65,0x76,
 0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,0x65,
-0x21,0x29,0x20,0x23,0x66,0x6e,0x28,0x66,
-0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x3a,
-0x76,0x61,0x6c,0x73,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x74,0x6f,0x70,0x2d,
-0x6c,0x65,0x76,0x65,0x6c,0x2d,0x76,0x61,
-0x6c,0x75,0x65,0x29,0x5d,0x20,0x75,0x6e,
-0x74,0x72,0x61,0x63,0x65,0x29,0x20,0x76,
-0x61,0x6c,0x75,0x65,0x73,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x73,
-0x30,0x7c,0x46,0x31,0x36,0x36,0x30,0x32,
-0x7c,0x4e,0x41,0x36,0x35,0x30,0x7c,0x4d,
-0x3b,0x7e,0x7c,0x4b,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x23,0x31,0x31,0x23,0x29,0x20,
-0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x3e,
-0x6c,0x69,0x73,0x74,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x38,0x30,0x30,0x30,0x72,0x31,
-0x63,0x30,0x71,0x63,0x31,0x7c,0x33,0x31,
-0x5f,0x34,0x32,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,0x30,
-0x72,0x32,0x61,0x7c,0x63,0x30,0x71,0x75,
-0x32,0x7d,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x21,0x29,0x20,0x65,0x76,0x61,0x6c,0x20,
+0x6c,0x61,0x6d,0x62,0x64,0x61,0x20,0x62,
+0x65,0x67,0x69,0x6e,0x20,0x77,0x72,0x69,
+0x74,0x65,0x6c,0x6e,0x20,0x63,0x6f,0x6e,
+0x73,0x20,0x71,0x75,0x6f,0x74,0x65,0x20,
+0x61,0x70,0x70,0x6c,0x79,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x67,0x65,0x6e,0x73,
+0x79,0x6d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x74,0x6f,0x70,0x2d,0x6c,0x65,
+0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x29,0x20,0x6f,0x6b,0x5d,0x20,0x74,
+0x72,0x61,0x63,0x65,0x29,0x20,0x74,0x72,
+0x61,0x63,0x65,0x64,0x3f,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x31,0x69,0x31,0x30,0x7e,0x7c,0x78,0x5b,
-0x5c,0x78,0x37,0x66,0x4b,0x6f,0x30,0x31,
-0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,
-0x67,0x74,0x68,0x29,0x5d,0x20,0x76,0x65,
-0x63,0x74,0x6f,0x72,0x2d,0x3e,0x6c,0x69,
-0x73,0x74,0x29,0x20,0x76,0x65,0x63,0x74,
-0x6f,0x72,0x2d,0x66,0x69,0x6c,0x6c,0x21,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x32,0x60,0x63,0x30,0x7c,
-0x33,0x31,0x61,0x78,0x63,0x31,0x71,0x75,
-0x32,0x5d,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x38,
-0x30,0x30,0x30,0x72,0x31,0x7e,0x7c,0x5c,
-0x78,0x37,0x66,0x5c,0x5c,0x3b,0x22,0x20,
-0x5b,0x5d,0x29,0x5d,0x20,0x76,0x65,0x63,
-0x74,0x6f,0x72,0x2d,0x66,0x69,0x6c,0x6c,
-0x21,0x29,0x20,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x2d,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,
-0x67,0x74,0x68,0x29,0x20,0x76,0x65,0x63,
-0x74,0x6f,0x72,0x2d,0x6d,0x61,0x70,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
-0x30,0x72,0x32,0x65,0x30,0x7c,0x7d,0x34,
-0x32,0x3b,0x22,0x20,0x5b,0x76,0x65,0x63,
-0x74,0x6f,0x72,0x2e,0x6d,0x61,0x70,0x5d,
+0x31,0x65,0x30,0x7c,0x33,0x31,0x31,0x36,
+0x3e,0x30,0x32,0x63,0x31,0x7c,0x33,0x31,
+0x63,0x31,0x7e,0x33,0x31,0x3e,0x3b,0x22,
+0x20,0x5b,0x63,0x6c,0x6f,0x73,0x75,0x72,
+0x65,0x3f,0x20,0x23,0x66,0x6e,0x28,0x66,
+0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x3a,
+0x63,0x6f,0x64,0x65,0x29,0x5d,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
+0x30,0x73,0x30,0x63,0x30,0x63,0x31,0x7c,
+0x4b,0x33,0x31,0x32,0x63,0x32,0x7c,0x76,
+0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
+0x28,0x77,0x72,0x69,0x74,0x65,0x6c,0x6e,
+0x29,0x20,0x78,0x20,0x23,0x2e,0x61,0x70,
+0x70,0x6c,0x79,0x5d,0x29,0x20,0x28,0x29,
+0x5d,0x29,0x20,0x75,0x6e,0x74,0x72,0x61,
+0x63,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x63,0x30,
+0x71,0x63,0x31,0x7c,0x33,0x31,0x34,0x31,
+0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,
+0x22,0x39,0x30,0x30,0x30,0x72,0x31,0x65,
+0x30,0x7c,0x33,0x31,0x36,0x40,0x30,0x63,
+0x31,0x7e,0x63,0x32,0x7c,0x33,0x31,0x62,
+0x32,0x5b,0x34,0x32,0x3b,0x5d,0x3b,0x22,
+0x20,0x5b,0x74,0x72,0x61,0x63,0x65,0x64,
+0x3f,0x20,0x23,0x66,0x6e,0x28,0x73,0x65,
+0x74,0x2d,0x74,0x6f,0x70,0x2d,0x6c,0x65,
+0x76,0x65,0x6c,0x2d,0x76,0x61,0x6c,0x75,
+0x65,0x21,0x29,0x20,0x23,0x66,0x6e,0x28,
+0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+0x3a,0x76,0x61,0x6c,0x73,0x29,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x74,0x6f,0x70,
+0x2d,0x6c,0x65,0x76,0x65,0x6c,0x2d,0x76,
+0x61,0x6c,0x75,0x65,0x29,0x5d,0x20,0x75,
+0x6e,0x74,0x72,0x61,0x63,0x65,0x29,0x20,
+0x76,0x61,0x6c,0x75,0x65,0x73,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x73,0x30,0x7c,0x46,0x31,0x36,0x36,0x30,
+0x32,0x7c,0x4e,0x41,0x36,0x35,0x30,0x7c,
+0x4d,0x3b,0x7e,0x7c,0x4b,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x23,0x31,0x31,0x23,0x29,
 0x20,0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,
-0x6d,0x61,0x70,0x29,0x20,0x76,0x65,0x63,
-0x74,0x6f,0x72,0x2d,0x72,0x65,0x66,0x20,
-0x23,0x2e,0x61,0x72,0x65,0x66,0x20,0x76,
-0x65,0x63,0x74,0x6f,0x72,0x2d,0x73,0x65,
-0x74,0x21,0x20,0x23,0x2e,0x61,0x73,0x65,
-0x74,0x21,0x20,0x76,0x65,0x63,0x74,0x6f,
-0x72,0x2e,0x6d,0x61,0x70,0x20,0x23,0x66,
+0x3e,0x6c,0x69,0x73,0x74,0x20,0x23,0x66,
 0x6e,0x28,0x22,0x38,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x63,0x31,0x7d,0x33,
-0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
-0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
-0x72,0x31,0x63,0x30,0x71,0x63,0x31,0x7c,
-0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x31,0x63,0x30,0x71,0x63,0x31,0x7c,0x33,
+0x31,0x5f,0x34,0x32,0x3b,0x22,0x20,0x5b,
 0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,0x30,
-0x30,0x72,0x31,0x60,0x7e,0x61,0x78,0x63,
-0x30,0x71,0x75,0x32,0x7c,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
-0x30,0x30,0x72,0x31,0x7e,0x7c,0x69,0x32,
-0x30,0x69,0x32,0x31,0x7c,0x5b,0x33,0x31,
-0x5c,0x5c,0x3b,0x22,0x20,0x5b,0x5d,0x29,
-0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x76,
-0x65,0x63,0x74,0x6f,0x72,0x2e,0x61,0x6c,
-0x6c,0x6f,0x63,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
-0x68,0x29,0x5d,0x20,0x76,0x65,0x63,0x74,
-0x6f,0x72,0x2e,0x6d,0x61,0x70,0x29,0x20,
-0x76,0x6f,0x69,0x64,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x30,
-0x5d,0x3b,0x22,0x20,0x5b,0x5d,0x20,0x76,
-0x6f,0x69,0x64,0x29,0x20,0x77,0x68,0x69,
-0x74,0x65,0x20,0x37,0x20,0x77,0x69,0x74,
-0x68,0x2d,0x65,0x78,0x63,0x65,0x70,0x74,
-0x69,0x6f,0x6e,0x2d,0x63,0x61,0x74,0x63,
-0x68,0x65,0x72,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x32,0x63,
-0x30,0x71,0x63,0x31,0x71,0x74,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x30,0x5c,0x78,0x37,
-0x66,0x34,0x30,0x3b,0x22,0x20,0x5b,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x7e,0x7c,0x34,
+0x30,0x72,0x32,0x61,0x7c,0x63,0x30,0x71,
+0x75,0x32,0x7d,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x31,0x69,0x31,0x30,0x7e,0x7c,0x78,
+0x5b,0x5c,0x78,0x37,0x66,0x4b,0x6f,0x30,
 0x31,0x3b,0x22,0x20,0x5b,0x5d,0x29,0x5d,
-0x20,0x77,0x69,0x74,0x68,0x2d,0x65,0x78,
-0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x2d,
-0x63,0x61,0x74,0x63,0x68,0x65,0x72,0x29,
-0x20,0x77,0x69,0x74,0x68,0x2d,0x69,0x6e,
-0x70,0x75,0x74,0x2d,0x66,0x72,0x6f,0x6d,
-0x2d,0x66,0x69,0x6c,0x65,0x20,0x23,0x66,
-0x6e,0x28,0x22,0x39,0x30,0x30,0x30,0x72,
-0x32,0x63,0x30,0x71,0x63,0x31,0x7c,0x63,
-0x32,0x33,0x32,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
-0x31,0x71,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x29,0x5d,0x20,0x76,
+0x65,0x63,0x74,0x6f,0x72,0x2d,0x3e,0x6c,
+0x69,0x73,0x74,0x29,0x20,0x76,0x65,0x63,
+0x74,0x6f,0x72,0x2d,0x66,0x69,0x6c,0x6c,
+0x21,0x20,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x32,0x60,0x63,0x30,
+0x7c,0x33,0x31,0x61,0x78,0x63,0x31,0x71,
+0x75,0x32,0x5d,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x38,0x30,0x30,0x30,0x72,0x31,0x7e,0x7c,
+0x5c,0x78,0x37,0x66,0x5c,0x5c,0x3b,0x22,
+0x20,0x5b,0x5d,0x29,0x5d,0x20,0x76,0x65,
+0x63,0x74,0x6f,0x72,0x2d,0x66,0x69,0x6c,
+0x6c,0x21,0x29,0x20,0x76,0x65,0x63,0x74,
+0x6f,0x72,0x2d,0x6c,0x65,0x6e,0x67,0x74,
+0x68,0x20,0x23,0x66,0x6e,0x28,0x6c,0x65,
+0x6e,0x67,0x74,0x68,0x29,0x20,0x76,0x65,
+0x63,0x74,0x6f,0x72,0x2d,0x6d,0x61,0x70,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x38,0x30,
+0x30,0x30,0x72,0x32,0x65,0x30,0x7c,0x7d,
+0x34,0x32,0x3b,0x22,0x20,0x5b,0x76,0x65,
+0x63,0x74,0x6f,0x72,0x2e,0x6d,0x61,0x70,
+0x5d,0x20,0x76,0x65,0x63,0x74,0x6f,0x72,
+0x2d,0x6d,0x61,0x70,0x29,0x20,0x76,0x65,
+0x63,0x74,0x6f,0x72,0x2d,0x72,0x65,0x66,
+0x20,0x23,0x2e,0x61,0x72,0x65,0x66,0x20,
+0x76,0x65,0x63,0x74,0x6f,0x72,0x2d,0x73,
+0x65,0x74,0x21,0x20,0x23,0x2e,0x61,0x73,
+0x65,0x74,0x21,0x20,0x76,0x65,0x63,0x74,
+0x6f,0x72,0x2e,0x6d,0x61,0x70,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x38,0x30,0x30,0x30,
+0x72,0x32,0x63,0x30,0x71,0x63,0x31,0x7d,
+0x33,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x38,0x30,0x30,
 0x30,0x72,0x31,0x63,0x30,0x71,0x63,0x31,
-0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x30,0x63,0x30,0x71,
-0x65,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x69,0x31,0x30,0x6b,0x30,
-0x32,0x63,0x31,0x71,0x63,0x32,0x71,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x2a,0x69,0x6e,
-0x70,0x75,0x74,0x2d,0x73,0x74,0x72,0x65,
-0x61,0x6d,0x2a,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x31,0x63,
-0x30,0x71,0x63,0x31,0x71,0x74,0x7c,0x33,
-0x30,0x32,0x3b,0x22,0x20,0x5b,0x23,0x66,
-0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
-0x30,0x69,0x34,0x31,0x34,0x30,0x3b,0x22,
-0x20,0x5b,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x7e,0x33,0x30,0x32,0x63,0x30,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x72,0x61,0x69,0x73,0x65,0x29,0x5d,
+0x7c,0x33,0x31,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,0x30,
+0x30,0x30,0x72,0x31,0x60,0x7e,0x61,0x78,
+0x63,0x30,0x71,0x75,0x32,0x7c,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x3a,
+0x30,0x30,0x30,0x72,0x31,0x7e,0x7c,0x69,
+0x32,0x30,0x69,0x32,0x31,0x7c,0x5b,0x33,
+0x31,0x5c,0x5c,0x3b,0x22,0x20,0x5b,0x5d,
 0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x36,0x30,0x30,0x30,0x72,0x30,0x7e,
-0x6b,0x30,0x3b,0x22,0x20,0x5b,0x2a,0x69,
-0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
-0x65,0x61,0x6d,0x2a,0x5d,0x29,0x5d,0x29,
-0x20,0x2a,0x69,0x6e,0x70,0x75,0x74,0x2d,
-0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x31,0x7e,0x33,0x30,
-0x32,0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x72,0x61,
-0x69,0x73,0x65,0x29,0x5d,0x29,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x30,0x63,0x30,0x7e,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,0x73,
-0x65,0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,
-0x66,0x6e,0x28,0x66,0x69,0x6c,0x65,0x29,
-0x20,0x3a,0x72,0x65,0x61,0x64,0x5d,0x20,
-0x77,0x69,0x74,0x68,0x2d,0x69,0x6e,0x70,
-0x75,0x74,0x2d,0x66,0x72,0x6f,0x6d,0x2d,
-0x66,0x69,0x6c,0x65,0x29,0x20,0x77,0x69,
-0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,0x75,
-0x74,0x2d,0x74,0x6f,0x2d,0x66,0x69,0x6c,
-0x65,0x20,0x23,0x66,0x6e,0x28,0x22,0x3b,
-0x30,0x30,0x30,0x72,0x32,0x63,0x30,0x71,
-0x63,0x31,0x7c,0x63,0x32,0x63,0x33,0x63,
-0x34,0x33,0x34,0x34,0x31,0x3b,0x22,0x20,
+0x76,0x65,0x63,0x74,0x6f,0x72,0x2e,0x61,
+0x6c,0x6c,0x6f,0x63,0x29,0x5d,0x29,0x20,
+0x23,0x66,0x6e,0x28,0x6c,0x65,0x6e,0x67,
+0x74,0x68,0x29,0x5d,0x20,0x76,0x65,0x63,
+0x74,0x6f,0x72,0x2e,0x6d,0x61,0x70,0x29,
+0x20,0x76,0x6f,0x69,0x64,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x30,0x5d,0x3b,0x22,0x20,0x5b,0x5d,0x20,
+0x76,0x6f,0x69,0x64,0x29,0x20,0x77,0x68,
+0x69,0x74,0x65,0x20,0x37,0x20,0x77,0x69,
+0x74,0x68,0x2d,0x65,0x78,0x63,0x65,0x70,
+0x74,0x69,0x6f,0x6e,0x2d,0x63,0x61,0x74,
+0x63,0x68,0x65,0x72,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x32,
+0x63,0x30,0x71,0x63,0x31,0x71,0x74,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x36,0x30,0x30,0x30,0x72,0x30,0x5c,0x78,
+0x37,0x66,0x34,0x30,0x3b,0x22,0x20,0x5b,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x7e,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x5d,0x29,
+0x5d,0x20,0x77,0x69,0x74,0x68,0x2d,0x65,
+0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
+0x2d,0x63,0x61,0x74,0x63,0x68,0x65,0x72,
+0x29,0x20,0x77,0x69,0x74,0x68,0x2d,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x66,0x72,0x6f,
+0x6d,0x2d,0x66,0x69,0x6c,0x65,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x39,0x30,0x30,0x30,
+0x72,0x32,0x63,0x30,0x71,0x63,0x31,0x7c,
+0x63,0x32,0x33,0x32,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x63,0x31,0x71,0x34,0x31,0x3b,0x22,0x20,
 0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
 0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
-0x31,0x71,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x71,0x63,0x31,
-0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
-0x30,0x30,0x30,0x72,0x30,0x63,0x30,0x71,
-0x65,0x31,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x69,0x31,0x30,0x6b,0x30,
-0x32,0x63,0x31,0x71,0x63,0x32,0x71,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x2a,0x6f,0x75,
-0x74,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
+0x31,0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x30,0x63,0x30,
+0x71,0x65,0x31,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x69,0x31,0x30,0x6b,
+0x30,0x32,0x63,0x31,0x71,0x63,0x32,0x71,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,0x69,
+0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,0x72,
 0x65,0x61,0x6d,0x2a,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
 0x63,0x30,0x71,0x63,0x31,0x71,0x74,0x7c,
@@ -6165,85 +6130,138 @@ unsigned char boot_image[] = {
 0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
 0x28,0x22,0x36,0x30,0x30,0x30,0x72,0x30,
 0x7e,0x6b,0x30,0x3b,0x22,0x20,0x5b,0x2a,
-0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x73,
-0x74,0x72,0x65,0x61,0x6d,0x2a,0x5d,0x29,
-0x5d,0x29,0x20,0x2a,0x6f,0x75,0x74,0x70,
-0x75,0x74,0x2d,0x73,0x74,0x72,0x65,0x61,
-0x6d,0x2a,0x5d,0x29,0x20,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x7e,0x33,0x30,0x32,0x63,0x30,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x72,0x61,0x69,0x73,0x65,0x29,0x5d,
-0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,
-0x22,0x37,0x30,0x30,0x30,0x72,0x30,0x63,
-0x30,0x7e,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x63,
-0x6c,0x6f,0x73,0x65,0x29,0x5d,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x66,0x69,
-0x6c,0x65,0x29,0x20,0x3a,0x77,0x72,0x69,
-0x74,0x65,0x20,0x3a,0x63,0x72,0x65,0x61,
-0x74,0x65,0x20,0x3a,0x74,0x72,0x75,0x6e,
-0x63,0x61,0x74,0x65,0x5d,0x20,0x77,0x69,
-0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,0x75,
-0x74,0x2d,0x74,0x6f,0x2d,0x66,0x69,0x6c,
-0x65,0x29,0x20,0x77,0x69,0x74,0x68,0x2d,
-0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x74,
-0x6f,0x2d,0x73,0x74,0x72,0x69,0x6e,0x67,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x32,0x63,0x30,0x71,0x63,
-0x31,0x33,0x30,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x65,
-0x31,0x33,0x31,0x32,0x63,0x32,0x7c,0x34,
-0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,0x6e,
-0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x31,
-0x7e,0x6b,0x30,0x32,0x63,0x31,0x71,0x63,
-0x32,0x71,0x34,0x31,0x3b,0x22,0x20,0x5b,
-0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
-0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x37,0x30,0x30,
-0x30,0x72,0x31,0x63,0x30,0x71,0x63,0x31,
-0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,0x22,
-0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x36,
-0x30,0x30,0x30,0x72,0x30,0x69,0x33,0x31,
-0x34,0x30,0x3b,0x22,0x20,0x5b,0x5d,0x29,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
-0x30,0x30,0x72,0x31,0x7e,0x33,0x30,0x32,
-0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,0x20,
-0x5b,0x23,0x66,0x6e,0x28,0x72,0x61,0x69,
+0x69,0x6e,0x70,0x75,0x74,0x2d,0x73,0x74,
+0x72,0x65,0x61,0x6d,0x2a,0x5d,0x29,0x5d,
+0x29,0x20,0x2a,0x69,0x6e,0x70,0x75,0x74,
+0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x31,0x7e,0x33,
+0x30,0x32,0x63,0x30,0x7c,0x34,0x31,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x72,
+0x61,0x69,0x73,0x65,0x29,0x5d,0x29,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x30,0x63,0x30,0x7e,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x69,0x6f,0x2e,0x63,0x6c,0x6f,
 0x73,0x65,0x29,0x5d,0x29,0x5d,0x29,0x20,
-0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
-0x30,0x72,0x30,0x7e,0x6b,0x30,0x3b,0x22,
-0x20,0x5b,0x2a,0x6f,0x75,0x74,0x70,0x75,
-0x74,0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,
-0x2a,0x5d,0x29,0x5d,0x29,0x20,0x2a,0x6f,
+0x23,0x66,0x6e,0x28,0x66,0x69,0x6c,0x65,
+0x29,0x20,0x3a,0x72,0x65,0x61,0x64,0x5d,
+0x20,0x77,0x69,0x74,0x68,0x2d,0x69,0x6e,
+0x70,0x75,0x74,0x2d,0x66,0x72,0x6f,0x6d,
+0x2d,0x66,0x69,0x6c,0x65,0x29,0x20,0x77,
+0x69,0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,
+0x75,0x74,0x2d,0x74,0x6f,0x2d,0x66,0x69,
+0x6c,0x65,0x20,0x23,0x66,0x6e,0x28,0x22,
+0x3b,0x30,0x30,0x30,0x72,0x32,0x63,0x30,
+0x71,0x63,0x31,0x7c,0x63,0x32,0x63,0x33,
+0x63,0x34,0x33,0x34,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x63,0x31,0x71,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
+0x31,0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x37,0x30,0x30,0x30,0x72,0x30,0x63,0x30,
+0x71,0x65,0x31,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x69,0x31,0x30,0x6b,
+0x30,0x32,0x63,0x31,0x71,0x63,0x32,0x71,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x2a,0x6f,
 0x75,0x74,0x70,0x75,0x74,0x2d,0x73,0x74,
 0x72,0x65,0x61,0x6d,0x2a,0x20,0x23,0x66,
-0x6e,0x28,0x69,0x6f,0x2e,0x74,0x6f,0x73,
-0x74,0x72,0x69,0x6e,0x67,0x21,0x29,0x5d,
-0x29,0x20,0x23,0x66,0x6e,0x28,0x62,0x75,
-0x66,0x66,0x65,0x72,0x29,0x5d,0x20,0x77,
-0x69,0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,
-0x75,0x74,0x2d,0x74,0x6f,0x2d,0x73,0x74,
-0x72,0x69,0x6e,0x67,0x29,0x20,0x77,0x72,
-0x69,0x74,0x65,0x2d,0x63,0x68,0x61,0x72,
-0x20,0x23,0x66,0x6e,0x28,0x22,0x39,0x30,
-0x30,0x30,0x5c,0x78,0x38,0x39,0x31,0x30,
-0x30,0x30,0x32,0x30,0x30,0x30,0x5c,0x78,
-0x38,0x61,0x31,0x30,0x30,0x30,0x37,0x37,
-0x30,0x65,0x30,0x6d,0x31,0x32,0x63,0x31,
-0x7d,0x7c,0x34,0x32,0x3b,0x22,0x20,0x5b,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x63,0x30,0x71,0x63,0x31,0x71,0x74,
+0x7c,0x33,0x30,0x32,0x3b,0x22,0x20,0x5b,
+0x23,0x66,0x6e,0x28,0x22,0x36,0x30,0x30,
+0x30,0x72,0x30,0x69,0x34,0x31,0x34,0x30,
+0x3b,0x22,0x20,0x5b,0x5d,0x29,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x7e,0x33,0x30,0x32,0x63,0x30,
+0x7c,0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,
+0x66,0x6e,0x28,0x72,0x61,0x69,0x73,0x65,
+0x29,0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x36,0x30,0x30,0x30,0x72,
+0x30,0x7e,0x6b,0x30,0x3b,0x22,0x20,0x5b,
 0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
-0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,
-0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,0x70,
-0x75,0x74,0x63,0x29,0x5d,0x20,0x77,0x72,
-0x69,0x74,0x65,0x2d,0x63,0x68,0x61,0x72,
-0x29,0x20,0x77,0x72,0x69,0x74,0x65,0x2d,
+0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,0x5d,
+0x29,0x5d,0x29,0x20,0x2a,0x6f,0x75,0x74,
+0x70,0x75,0x74,0x2d,0x73,0x74,0x72,0x65,
+0x61,0x6d,0x2a,0x5d,0x29,0x20,0x23,0x66,
+0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
+0x31,0x7e,0x33,0x30,0x32,0x63,0x30,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
+0x6e,0x28,0x72,0x61,0x69,0x73,0x65,0x29,
+0x5d,0x29,0x5d,0x29,0x20,0x23,0x66,0x6e,
+0x28,0x22,0x37,0x30,0x30,0x30,0x72,0x30,
+0x63,0x30,0x7e,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x63,0x6c,0x6f,0x73,0x65,0x29,0x5d,0x29,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x66,
+0x69,0x6c,0x65,0x29,0x20,0x3a,0x77,0x72,
+0x69,0x74,0x65,0x20,0x3a,0x63,0x72,0x65,
+0x61,0x74,0x65,0x20,0x3a,0x74,0x72,0x75,
+0x6e,0x63,0x61,0x74,0x65,0x5d,0x20,0x77,
+0x69,0x74,0x68,0x2d,0x6f,0x75,0x74,0x70,
+0x75,0x74,0x2d,0x74,0x6f,0x2d,0x66,0x69,
+0x6c,0x65,0x29,0x20,0x77,0x69,0x74,0x68,
+0x2d,0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,
 0x74,0x6f,0x2d,0x73,0x74,0x72,0x69,0x6e,
-0x67,0x20,0x23,0x31,0x32,0x23,0x20,0x79,
-0x65,0x6c,0x6c,0x6f,0x77,0x20,0x33,0x20,
-0x7a,0x65,0x72,0x6f,0x3f,0x20,0x23,0x66,
+0x67,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x32,0x63,0x30,0x71,
+0x63,0x31,0x33,0x30,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x63,0x30,0x71,
+0x65,0x31,0x33,0x31,0x32,0x63,0x32,0x7c,
+0x34,0x31,0x3b,0x22,0x20,0x5b,0x23,0x66,
 0x6e,0x28,0x22,0x37,0x30,0x30,0x30,0x72,
-0x31,0x7c,0x60,0x57,0x3b,0x22,0x20,0x5b,
-0x5d,0x20,0x7a,0x65,0x72,0x6f,0x3f,0x29,
-0x29};
+0x31,0x7e,0x6b,0x30,0x32,0x63,0x31,0x71,
+0x63,0x32,0x71,0x34,0x31,0x3b,0x22,0x20,
+0x5b,0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,
+0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x37,0x30,
+0x30,0x30,0x72,0x31,0x63,0x30,0x71,0x63,
+0x31,0x71,0x74,0x7c,0x33,0x30,0x32,0x3b,
+0x22,0x20,0x5b,0x23,0x66,0x6e,0x28,0x22,
+0x36,0x30,0x30,0x30,0x72,0x30,0x69,0x33,
+0x31,0x34,0x30,0x3b,0x22,0x20,0x5b,0x5d,
+0x29,0x20,0x23,0x66,0x6e,0x28,0x22,0x37,
+0x30,0x30,0x30,0x72,0x31,0x7e,0x33,0x30,
+0x32,0x63,0x30,0x7c,0x34,0x31,0x3b,0x22,
+0x20,0x5b,0x23,0x66,0x6e,0x28,0x72,0x61,
+0x69,0x73,0x65,0x29,0x5d,0x29,0x5d,0x29,
+0x20,0x23,0x66,0x6e,0x28,0x22,0x36,0x30,
+0x30,0x30,0x72,0x30,0x7e,0x6b,0x30,0x3b,
+0x22,0x20,0x5b,0x2a,0x6f,0x75,0x74,0x70,
+0x75,0x74,0x2d,0x73,0x74,0x72,0x65,0x61,
+0x6d,0x2a,0x5d,0x29,0x5d,0x29,0x20,0x2a,
+0x6f,0x75,0x74,0x70,0x75,0x74,0x2d,0x73,
+0x74,0x72,0x65,0x61,0x6d,0x2a,0x20,0x23,
+0x66,0x6e,0x28,0x69,0x6f,0x2e,0x74,0x6f,
+0x73,0x74,0x72,0x69,0x6e,0x67,0x21,0x29,
+0x5d,0x29,0x20,0x23,0x66,0x6e,0x28,0x62,
+0x75,0x66,0x66,0x65,0x72,0x29,0x5d,0x20,
+0x77,0x69,0x74,0x68,0x2d,0x6f,0x75,0x74,
+0x70,0x75,0x74,0x2d,0x74,0x6f,0x2d,0x73,
+0x74,0x72,0x69,0x6e,0x67,0x29,0x20,0x77,
+0x72,0x69,0x74,0x65,0x2d,0x63,0x68,0x61,
+0x72,0x20,0x23,0x66,0x6e,0x28,0x22,0x39,
+0x30,0x30,0x30,0x5c,0x78,0x38,0x39,0x31,
+0x30,0x30,0x30,0x32,0x30,0x30,0x30,0x5c,
+0x78,0x38,0x61,0x31,0x30,0x30,0x30,0x37,
+0x37,0x30,0x65,0x30,0x6d,0x31,0x32,0x63,
+0x31,0x7d,0x7c,0x34,0x32,0x3b,0x22,0x20,
+0x5b,0x2a,0x6f,0x75,0x74,0x70,0x75,0x74,
+0x2d,0x73,0x74,0x72,0x65,0x61,0x6d,0x2a,
+0x20,0x23,0x66,0x6e,0x28,0x69,0x6f,0x2e,
+0x70,0x75,0x74,0x63,0x29,0x5d,0x20,0x77,
+0x72,0x69,0x74,0x65,0x2d,0x63,0x68,0x61,
+0x72,0x29,0x20,0x77,0x72,0x69,0x74,0x65,
+0x2d,0x74,0x6f,0x2d,0x73,0x74,0x72,0x69,
+0x6e,0x67,0x20,0x23,0x31,0x32,0x23,0x20,
+0x79,0x65,0x6c,0x6c,0x6f,0x77,0x20,0x33,
+0x20,0x7a,0x65,0x72,0x6f,0x3f,0x20,0x23,
+0x66,0x6e,0x28,0x22,0x37,0x30,0x30,0x30,
+0x72,0x31,0x7c,0x60,0x57,0x3b,0x22,0x20,
+0x5b,0x5d,0x20,0x7a,0x65,0x72,0x6f,0x3f,
+0x29,0x29};
@@ -725,13 +725,13 @@
                 (trim-end   s at-end   L))))
 
 (define (string.map f s)
-  (let ((b (buffer))
+  (let ((b (string-builder (sizeof s)))
         (n (length s)))
     (let ((i 0))
       (while (< i n)
-             (begin (io.putc b (f (string.char s i)))
+             (begin (string-builder-append! b (f (string.char s i)))
                     (set! i (string.inc s i)))))
-    (io.tostring! b)))
+    (string-builder->string b)))
 
 (define (string.rep s k)
   (cond ((< k 4)
@@ -754,12 +754,11 @@
 
 (define (string.join strlist sep)
   (if (null? strlist) ""
-      (let ((b (buffer)))
-        (io.write b (car strlist))
-        (for-each (lambda (s) (begin (io.write b sep)
-                                     (io.write b s)))
+      (let ((b (string-builder)))
+        (string-builder-append! b (car strlist))
+        (for-each (lambda (s) (string-builder-append! b sep s))
                   (cdr strlist))
-        (io.tostring! b))))
+        (string-builder->string b))))
 
 ; toplevel -------------------------------------------------------------------
 
@@ -35,3 +35,189 @@
 (time (set! *output* (compile-ish *input*)))
 (assert (equal? *output* (load "rpasses-out.scm")))
 (path.cwd "..")
+
+(display "string-ref: ")
+(set! s (string.rep "abcdefghiλ" 1000000))
+(time (let ((n (string-length s)))
+        (do ((i 0 (+ i 1))) ((= i n)) (string-ref s i))))
+
+(import (upscheme 2019 unstable))
+
+(define (echo-bench nclients rounds)
+  (let* ((loop (make-event-loop))
+         (listener (tcp-listen 0))
+         (port (socket-port listener))
+         (clients (map-int (lambda (i)
+                             (cons (tcp-connect "127.0.0.1" port) rounds))
+                           nclients))
+         (live nclients))
+    (event-loop-add! loop listener 'read)
+    (for-each (lambda (c)
+                (event-loop-add! loop (car c) 'read)
+                (io.write (car c) "ping\n")
+                (io.flush (car c)))
+              clients)
+    (while (> live 0)
+      (for-each
+       (lambda (ev)
+         (let* ((s (car ev))
+                (c (assq s clients)))
+           (cond ((eq? s listener)
+                  (let ((a (tcp-accept listener)))
+                    (if a (event-loop-add! loop a 'read))))
+                 (c
+                  (io.readsome s)
+                  (set-cdr! c (- (cdr c) 1))
+                  (if (> (cdr c) 0)
+                      (begin (io.write s "ping\n")
+                             (io.flush s))
+                      (begin (event-loop-remove! loop s)
+                             (io.close s)
+                             (set! live (- live 1)))))
+                 (else
+                  (let ((data (io.readsome s)))
+                    (if (eof-object? data)
+                        (begin (event-loop-remove! loop s)
+                               (io.close s))
+                        (begin (io.write s data)
+                               (io.flush s))))))))
+       (wait-events loop 5)))
+    (io.close listener)))
+
+(display "tcp echo (100 clients x 200): ")
+(time (echo-bench 100 200))
+
+(display "io.copy (2 GiB file): ")
+(let ((src "/tmp/upscheme-perf-copy.src")
+      (dst "/tmp/upscheme-perf-copy.dst")
+      (block (string.rep "0123456789abcdef" 65536)))
+  (let ((o (file src :write :create :truncate)))
+    (dotimes (i 2048) (io.write o block))
+    (io.close o))
+  (let ((i (file src))
+        (o (file dst :write :create :truncate)))
+    (assert (= (time (io.copy o i)) (* 2048 (sizeof block))))
+    (io.close i)
+    (io.close o))
+  (io.close (file src :write :truncate))
+  (io.close (file dst :write :truncate)))
+
+(display "1000 open files x 20: ")
+(time (dotimes (i 20)
+        (for-each io.close
+                  (map-int (lambda (j)
+                             (let ((f (file "perf.scm")))
+                               (io.readline f)
+                               f))
+                           1000))))
+
+(let ((rec (list "id=" "12345" " payload=" (string.rep "x" 60000) "\n")))
+  (display "io.write 20000 records: ")
+  (let ((o (file "/dev/null" :write)))
+    (time (dotimes (i 20000) (for-each (lambda (s) (io.write o s)) rec)))
+    (io.close o))
+  (display "io.writev 20000 records: ")
+  (let ((o (file "/dev/null" :write)))
+    (time (dotimes (i 20000) (io.writev o rec)))
+    (io.close o)))
+
+(let ((log "/tmp/upscheme-perf-lines.log")
+      (line "2019-11-02 12:00:00 GET /index.html 200 1234 0.001\n"))
+  (let ((o (file log :write :create :truncate)))
+    (dotimes (i 20000) (io.writev o (list line line line line line
+                                          line line line line line)))
+    (io.close o))
+  (display "io.readline 200000 lines: ")
+  (let ((f (file log)))
+    (time (let loop ((n 0))
+            (if (eof-object? (io.readline f)) n (loop (+ n 1)))))
+    (io.close f))
+  (display "for-each-line 200000 lines: ")
+  (let ((f (file log)))
+    (assert (= (time (for-each-line (lambda (line) #t) f)) 200000))
+    (io.close f))
+  (io.close (file log :write :truncate)))
+
+(let ((z "/tmp/upscheme-perf.lz4")
+      (block (string (io.readall (file "unittest.scm"))
+                     (io.readall (file "perf.scm")))))
+  (display "lz4 compress 128 MiB: ")
+  (let ((o (file z :write :create :truncate :lz4))
+        (n (div (* 128 1024 1024) (sizeof block))))
+    (time (dotimes (i n) (io.write o block)))
+    (io.close o)
+    (display "lz4 decompress 128 MiB: ")
+    (let ((i (file z :lz4))
+          (null (file "/dev/null" :write)))
+      (assert (= (time (io.copy null i)) (* n (sizeof block))))
+      (io.close i)
+      (io.close null)))
+  (io.close (file z :write :truncate)))
+
+(let ((heap (map-int (lambda (i) (cons i i)) 3000000)))
+  (display "spawn-process 200 x true, big heap: ")
+  (time (dotimes (i 200)
+          (process-wait (vector-ref (spawn-process '("true")) 0))))
+  (length heap))
+
+(let ((root "/tmp/upscheme-perf-walk"))
+  (define (scan dir)
+    (let ((h (open-directory dir)))
+      (let loop ((n 0))
+        (let ((name (read-directory h)))
+          (if (eof-object? name)
+              (begin (close-directory h) n)
+              (let ((path (string dir "/" name)))
+                (loop (+ n 1 (if (file-exists? (string path "/."))
+                                 (scan path)
+                                 0)))))))))
+  (spawn (list "rm" "-rf" root))
+  (dotimes (i 1000)
+    (let ((dir (string root "/d" (div i 10) "/e" (mod i 10))))
+      (spawn (list "mkdir" "-p" dir))
+      (dotimes (j 1000)
+        (io.close (file (string dir "/f" j) :write :create)))))
+  (display "read-directory 1M files, no stat: ")
+  (assert (= (time (scan root)) 1001100))
+  (display "walk-directory 1M files: ")
+  (assert (= (time (walk-directory (lambda (path type size mtime) #t) root))
+             1001100))
+  (display "walk-directory 1M files, 4 threads: ")
+  (assert (= (time (walk-directory (lambda (path type size mtime) #t)
+                                   root 4))
+             1001100))
+  (spawn (list "rm" "-rf" root)))
+
+(let* ((rx (udp-listen 0))
+       (tx (udp-connect "127.0.0.1" (socket-port rx)))
+       (run (lambda (batch)
+              (let ((out (make-datagram-slab batch 64))
+                    (in (make-datagram-slab batch 64))
+                    (n (div 1000000 batch)))
+                (dotimes (i batch)
+                  (datagram-set! out i (string.rep "x" 64)))
+                (time (dotimes (i n)
+                        (udp-send! tx out)
+                        (let loop ((got 0))
+                          (if (< got batch)
+                              (loop (+ got (udp-receive! rx in)))))))))))
+  (display "udp 1M datagrams, one per syscall: ")
+  (run 1)
+  (display "udp 1M datagrams, 64 per syscall: ")
+  (run 64)
+  (io.close tx)
+  (io.close rx))
+
+(define (gc-tree d)
+  (if (= d 0) (vector 1 2) (cons (gc-tree (- d 1)) (gc-tree (- d 1)))))
+(display "gc with a 2M-node live tree: ")
+(let ((keep (gc-tree 20)))
+  (time (dotimes (i 30) (gc-tree 16)))
+  (assert (pair? keep)))
+(display "gc with 20 live 100k-element vectors: ")
+(let ((keep (map-int (lambda (i) (make-vector 100000 i)) 20)))
+  (time (dotimes (i 30) (gc-tree 16)))
+  (assert (= (vector-ref (car keep) 0) 0)))
+(display "gc pauses (count p50 p90 p99 p99.9 max, usec): ")
+(write (gc-pause-percentiles))
+(newline)
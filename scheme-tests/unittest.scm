@@ -301,5 +301,513 @@
 
 (assert-fail (eval '(set! (car (cons 1 2)) 3)))
 
+(assert (equal? (string.find "abcabcabd" "abcabd") 3))
+(assert (equal? (string.find "aaaaaaaaab" "aab") 7))
+(assert (equal? (string.find "abcabc" "abc" 1) 3))
+(assert (equal? (string.find "abc" "") 0))
+(assert (equal? (string.find "abc" "abcd") #f))
+(assert (equal? (string.find "aλb" #\λ) 1))
+(assert (equal? (string-search-all "abababa" "aba") '(0 4)))
+(assert (equal? (string-search-all "xyz" "q") '()))
+(let ((s (string-searcher "needle")))
+  (assert (string-searcher? s))
+  (assert (equal? (string.find "haystack with a needle" s) 16))
+  (assert (equal? (string-search-all "needleneedle" s 1) '(6))))
+
+(let ((s (string.rep "aλ€😀" 200)))
+  (assert (= (string-length s) 800))
+  (assert (= (string.count s 10) 796))
+  (assert (eqv? (string-ref s 401) #\λ))
+  (assert (eqv? (string-ref s 799) #\😀))
+  (assert (equal? (substring s 398 402) "€😀aλ"))
+  (assert (= (string.dec s (sizeof s) 797) 6))
+  (assert-fail (string.inc s 0 801))
+  (assert-fail (string.dec s (sizeof s) 801)))
+
+; UTF-8 around the 16- and 32-byte blocks of the vector kernels
+(define (bytes . l) (apply string (map (lambda (b) (array 'byte b)) l)))
+(define (recode s) (string.encode (string.decode s)))
+(for-each
+ (lambda (k)
+   (let ((a (string.rep "a" k)))
+     (assert (string.isutf8 (string a "λb")))
+     (assert (= (string.count (string a "λb")) (+ k 2)))
+     (assert (equal? (recode (string a "λb")) (string a "λb")))
+     (assert (string.isutf8 (string a "😀")))
+     (assert (= (string.count (string a "😀") 1) k))
+     ;; cut short by the end of the string
+     (assert (not (string.isutf8 (string a (bytes #xce)))))
+     (assert (not (string.isutf8 (string a (bytes #xf0 #x9f #x98)))))
+     (assert (= (string.count (string a (bytes #xce))) (+ k 1)))
+     (assert (equal? (recode (string a (bytes #xce))) (string a "�")))
+     ;; a stray continuation byte isn't counted, but decodes to U+FFFD
+     (assert (not (string.isutf8 (string a (bytes #x80) "b"))))
+     (assert (= (string.count (string a (bytes #x80) "b")) (+ k 1)))
+     (assert (equal? (recode (string a (bytes #x80) "b"))
+                     (string a "�b")))
+     ;; overlong
+     (assert (not (string.isutf8 (string a (bytes #xc0 #xaf) "b"))))))
+ '(14 15 16 17 30 31 32 33))
+(let ((s (string.rep "λ" 5000)))
+  (assert (= (string.count s) 5000))
+  (assert (= (string.count (string "a" s) 1) 5000))
+  (assert (= (length (string.decode s)) 5000))
+  (assert (string.isutf8 s)))
+
+(assert (equal? (string "ab" #\λ "" "cd") "abλcd"))
+(assert (equal? (string "a" 1 'b) "a1b"))
+(let ((b (string-builder)))
+  (assert (string-builder? b))
+  (string-builder-append! b "foo" #\- "bar")
+  (assert (= (string-builder-length b) 7))
+  (assert (equal? (string-builder->string b) "foo-bar"))
+  (assert (= (string-builder-length b) 0))
+  (dotimes (i 1000) (string-builder-append! b "xyz"))
+  (assert (equal? (string-builder->string b) (string.rep "xyz" 1000)))
+  (assert-fail (string-builder-append! b 'sym)))
+;; a size hint too big to allocate is a memory-error, not a hang
+(assert-fail (string-builder 18446744073709551615) memory-error)
+(assert-fail (string-builder #x4000000000000000) memory-error)
+(assert (equal? (string.join '("a" "b" "c") ", ") "a, b, c"))
+(assert (equal? (string.map char-upcase "abc") "ABC"))
+
+(let ((m (file "unittest.scm" :read :mmap))
+      (f (file "unittest.scm" :read)))
+  (assert (equal? (io.readline m) (io.readline f)))
+  (assert (eqv? (io.getc m) (io.getc f)))
+  (assert (equal? (io.readall m) (io.readall f)))
+  (assert (io.eof? m))
+  (io.seek m 0)
+  (assert (equal? (io.readline m)
+                  "(define-macro (assert-fail expr . what)\n"))
+  (io.close m)
+  (io.close f))
+
+(let ((small (file "unittest.scm" :read 16))
+      (f (file "unittest.scm")))
+  (assert (equal? (io.readline small) (io.readline f)))
+  (assert (equal? (io.readall small) (io.readall f)))
+  (io.close small)
+  (io.close f))
+(assert-fail (file "unittest.scm" :read 0) arg-error)
+(assert-fail (file "unittest.scm" :read #x4000000000000) memory-error)
+
+(let ((b (buffer 1000)))
+  (dotimes (i 100) (io.write b "0123456789"))
+  (assert (equal? (io.tostring! b) (string.rep "0123456789" 100))))
+
+(let ((b (buffer)))
+  (assert (= 6 (io.writev b (list "ab" "" (array 'uint8 99 100) "λ"))))
+  (assert (= 2 (io.writev b (vector "e" "f"))))
+  (assert-fail (io.writev b (list "g" #\h)))
+  (assert-fail (io.writev b (list "g" b)) arg-error)
+  (assert (equal? (io.tostring! b) "abcdλef")))
+
+(let* ((long (string.rep "x" 1000))
+       (it (io.lines (open-input-string
+                      (string-append "ab\n\n" long "\nλ")))))
+  (assert (equal? (io.nextline it) "ab"))
+  (assert (equal? (io.nextline it) ""))
+  (assert (equal? (io.nextline it) long))
+  (let ((line (io.nextline it)))
+    (assert (equal? line "λ"))
+    (assert (eof-object? (io.nextline it)))
+    (assert (equal? line "λ"))))
+
+(let ((f (file "unittest.scm"))
+      (g (file "unittest.scm"))
+      (kept '()))
+  (assert (= (for-each-line
+              (lambda (line)
+                (let ((expected (io.readline g)))
+                  (assert (equal? (string-append line "\n") expected)))
+                (set! kept (cons line kept)))
+              f)
+             (length kept)))
+  (assert (eof-object? (io.readline g)))
+  (assert (> (length kept) 100))
+  (assert (equal? (car kept) "#t"))
+  ;; each line is a string of its own
+  (assert (equal? (car (last-pair kept))
+                  "(define-macro (assert-fail expr . what)")))
+
+(import (upscheme 2019 unstable))
+
+(let ((s (open-input-string "a,\"b,\"\"c\"\"\",\r\n1,2.5,x\n\nz\tw")))
+  (assert (equal? (read-csv-row s) #("a" "b,\"c\"" "")))
+  (assert (equal? (read-csv-row s #\, '(number number symbol))
+                  (vector 1 2.5 'x)))
+  (assert (equal? (read-csv-row s) #()))
+  (assert (equal? (read-csv-row s #\tab) #("z" "w")))
+  (assert (eof-object? (read-csv-row s))))
+
+(let ((rows '()))
+  (assert (= 2 (csv-for-each (lambda (row) (set! rows (cons row rows)))
+                             (open-input-string "1\t\"x\ny\"\n2\t\n")
+                             #\tab #(number))))
+  (assert (equal? rows '(#(2 "") #(1 "x\ny")))))
+
+;; input that ends inside a quoted field is an error, not a short field
+(let ((s (open-input-string "a,\"bc\nd")))
+  (assert-fail (read-csv-row s) parse-error))
+(assert-fail (csv-for-each (lambda (row) #t) (open-input-string "\"x\"\"")
+                           #\,)
+             parse-error)
+
+(let* ((loop (make-event-loop))
+       (l (tcp-listen 0))
+       (c (tcp-connect "127.0.0.1" (socket-port l))))
+  (event-loop-add! loop l 'read)
+  (assert (equal? (wait-events loop 5) (list (list l 'read))))
+  (let ((a (tcp-accept l)))
+    (assert (not (tcp-accept l)))
+    (event-loop-add! loop a)
+    (assert (null? (wait-events loop 0)))
+    (io.write c "ping\n")
+    (io.flush c)
+    (assert (equal? (wait-events loop 5) (list (list a 'read))))
+    (assert (equal? (io.readsome a) "ping\n"))
+    (event-loop-add! loop c '(read write))
+    (assert (equal? (wait-events loop 0) (list (list c 'write))))
+    (assert (event-loop-remove! loop c))
+    (assert (not (event-loop-remove! loop c)))
+    (io.close c)
+    (assert (equal? (wait-events loop 5) (list (list a 'read))))
+    (assert (eof-object? (io.readsome a)))
+    ;; streams closed while still added
+    (let ((c (tcp-connect "127.0.0.1" (socket-port l))))
+      (event-loop-add! loop c)
+      (io.close c)
+      (assert (event-loop-remove! loop c))
+      (assert (not (event-loop-remove! loop c))))
+    (let ((c (tcp-connect "127.0.0.1" (socket-port l))))
+      (event-loop-add! loop c)
+      (io.close c)
+      (let ((c2 (tcp-connect "127.0.0.1" (socket-port l))))
+        (event-loop-add! loop c2 'write)
+        (assert (member (list c2 'write) (wait-events loop 0)))
+        (assert (event-loop-remove! loop c2))
+        (io.close c2)))
+    (io.close a)
+    (io.close l)))
+
+(let* ((l (tcp-listen 0))
+       (c (tcp-connect "127.0.0.1" (socket-port l)))
+       (a (tcp-accept l))
+       (big (string.rep "0123456789" 1000))
+       (pieces (list "<" big "," big "," "x" big ">")))
+  (io.write c "head")
+  (assert (= (io.writev c pieces) (+ 5 (* 3 (sizeof big)))))
+  (io.close c)
+  (assert (equal? (io.readall a) (apply string "head" pieces)))
+  (io.close a)
+  (io.close l))
+
+(let* ((l (tcp-listen 0))
+       (c (tcp-connect "127.0.0.1" (socket-port l)))
+       (a (tcp-accept l))
+       (f (file "unittest.scm")))
+  (io.readline f)
+  (let* ((n (io.copy c f 100))
+         (m (io.copy c f)))
+    (assert (= n 100))
+    (io.close c)
+    (io.seek f 0)
+    (io.readline f)
+    (let ((rest (io.readall f)))
+      (assert (= (+ n m) (sizeof rest)))
+      (assert (equal? (io.readall a) rest))))
+  (io.close a)
+  (io.close l))
+
+;; child processes with piped stdio, alone and in a pipeline
+(let* ((p (spawn-process '("sh" "-c" "tr a-z A-Z; echo oops >&2; exit 3")
+                         'pipe 'pipe 'pipe))
+       (in (vector-ref p 1)))
+  (io.write in "hello\n")
+  (io.close in)
+  (assert (equal? (io.readall (vector-ref p 2)) "HELLO\n"))
+  (assert (equal? (io.readall (vector-ref p 3)) "oops\n"))
+  (assert (= (process-wait (vector-ref p 0)) 3)))
+
+(let* ((p (spawn-pipeline '(("printf" "b\\na\\nc\\n")
+                            ("sort")
+                            ("head" "-n" "2"))
+                          #f 'pipe))
+       (pids (vector-ref p 0)))
+  (assert (= (length pids) 3))
+  (assert (not (vector-ref p 1)))
+  (assert (equal? (io.readall (vector-ref p 2)) "a\nb\n"))
+  (let loop ((pids pids))
+    (if (pair? pids)
+        (let ((done (process-wait-any pids)))
+          (assert (= (cdr done) 0))
+          (loop (filter (lambda (pid) (not (= pid (car done)))) pids))))))
+
+;; process-wait-any reaps only the children it is asked about
+(let ((quick (vector-ref (spawn-process '("sh" "-c" "exit 4")) 0))
+      (slow (vector-ref (spawn-process '("sh" "-c" "sleep 0.2; exit 5")) 0)))
+  (assert (not (process-wait-any (list slow) #t)))
+  (assert (equal? (process-wait-any (list slow)) (cons slow 5)))
+  (assert (= (process-wait quick) 4)))
+(assert-fail (process-wait-any '(0)) type-error)
+
+(let ((p (spawn-process '("sh" "-c" "sleep 5"))))
+  (assert (not (process-wait (vector-ref p 0) #t)))
+  (assert (= 0 (spawn (list "kill" (number->string (vector-ref p 0))))))
+  (assert (= (process-wait (vector-ref p 0)) (+ 128 15))))
+
+(assert-fail (spawn-process '("/nonexistent/program")))
+
+;; lz4 round trips through a file; the writer's output must be smaller
+;; and the reader must take concatenated frames
+(let* ((z (let ((p (spawn-process '("mktemp") #f 'pipe)))
+             (process-wait (vector-ref p 0))
+             (io.nextline (io.lines (vector-ref p 2)))))
+       (text (io.readall (file "unittest.scm")))
+       (runs (string.rep "abcdefgh" 100000))
+       (noise (let ((b (buffer)))
+                (dotimes (i 100000) (io.write b (array 'uint8 (random 256))))
+                (io.tostring! b)))
+       (all (string text runs noise)))
+  (let ((o (file z :write :create :truncate :lz4)))
+    (io.write o text)
+    (io.write o runs)
+    (io.write o noise)
+    (io.close o))
+  (assert (< (sizeof (io.readall (file z))) (- (sizeof all) (sizeof runs))))
+  (let ((i (file z :lz4)))
+    (assert (equal? (io.read i 'uint8 100)
+                    (io.read (file "unittest.scm") 'uint8 100)))
+    (assert (= (io.pos i) 100))
+    (assert (not (io.seek i 0)))
+    (io.close i))
+  (assert (equal? (io.readall (file z :lz4)) all))
+  (let ((o (file z :append :lz4)))
+    (io.write o "tail")
+    (io.close o))
+  (assert (equal? (io.readall (file z :lz4)) (string all "tail")))
+  (io.close (file z :write :truncate :lz4))
+  (assert (eof-object? (io.readall (file z :lz4))))
+  ;; damaged or foreign data is an error, not an early end
+  (let ((o (file z :write :truncate :lz4)))
+    (io.write o text)
+    (io.close o))
+  (let* ((raw (io.readall (file z)))
+         (k (div0 (sizeof raw) 2))
+         (o (file z :write :truncate)))
+    (io.write o raw 0 k)
+    (io.write o (array 'uint8 (logxor (aref raw k) 1)))
+    (io.write o raw (+ k 1) (- (sizeof raw) k 1))
+    (io.close o))
+  (let ((i (file z :lz4)))
+    (assert-fail (io.readall i) io-error)
+    (assert-fail (io.read i 'uint8 1) io-error))
+  (let ((o (file z :write :truncate)))
+    (io.write o "not lz4 at all")
+    (io.close o))
+  (assert-fail (io.readall (file z :lz4)) io-error)
+  (spawn (list "rm" "-f" z)))
+
+;; directory walks see the whole tree with types and sizes, with or
+;; without worker threads, and don't follow symlinks
+(let ((d "/tmp/upscheme-unittest-walk"))
+  (spawn (list "rm" "-rf" d))
+  (assert (= 0 (spawn (list "mkdir" "-p"
+                            (string d "/a/b/c") (string d "/e")))))
+  (let ((o (file (string d "/a/b/x") :write :create)))
+    (io.write o "hello")
+    (io.close o))
+  (io.close (file (string d "/a/y") :write :create))
+  (assert (= 0 (spawn (list "ln" "-s" "a" (string d "/l")))))
+  (let ((expected
+         `((,(string d "/a") directory) (,(string d "/a/b") directory)
+           (,(string d "/a/b/c") directory) (,(string d "/a/b/x") regular 5)
+           (,(string d "/a/y") regular 0) (,(string d "/e") directory)
+           (,(string d "/l") symlink)))
+        (walk (lambda (threads)
+                (let ((found '()))
+                  (assert (= 7 (walk-directory
+                                (lambda (path type size mtime)
+                                  (assert (integer? mtime))
+                                  (set! found
+                                        (cons (if (eq? type 'regular)
+                                                  (list path type size)
+                                                  (list path type))
+                                              found)))
+                                d threads)))
+                  (sort found string<? car)))))
+    (assert (equal? (walk #f) expected))
+    (assert (equal? (walk 4) expected))
+    (let* ((w (open-directory-walker (string d "/") 2))
+           (entries (let loop ((acc '()))
+                      (let ((batch (read-directory-walker w)))
+                        (if (eof-object? batch)
+                            acc
+                            (loop (append (vector->list batch) acc)))))))
+      (assert (= 7 (length entries)))
+      (let ((x (assoc (string d "/a/b/x") (map vector->list entries))))
+        (assert (equal? (list-head x 3)
+                        (list (string d "/a/b/x") 'regular 5))))
+      (close-directory-walker w)
+      (assert (eof-object? (read-directory-walker w))))
+    (let ((w (open-directory-walker d 3)))
+      (close-directory-walker w)))
+  (assert-fail (walk-directory (lambda args #t) (string d "/none")))
+  (spawn (list "rm" "-rf" d)))
+
+;; datagrams go through slabs a batch at a time
+(let* ((rx (udp-listen 0))
+       (tx (udp-connect "127.0.0.1" (socket-port rx)))
+       (out (make-datagram-slab 4 16))
+       (in (make-datagram-slab 8 16)))
+  (datagram-set! out 0 "hello")
+  (datagram-set! out 1 "")
+  (datagram-set! out 2 (array 'uint8 1 2 3))
+  (assert (= (datagram-count out) 3))
+  (assert-fail (datagram-set! out 3 (string.rep "x" 17)))
+  (assert-fail (datagram-set! out 4 "x") bounds-error)
+  (assert-fail (udp-send! out out))
+  (assert (= (udp-send! tx out) 3))
+  (assert (= (udp-send! tx out 1) 1))
+  (assert (= (let loop ((n 0))
+               (if (< n 4) (loop (+ n (udp-receive! rx in))) n))
+             4))
+  (assert (equal? (datagram-ref in (- (datagram-count in) 1)) "hello"))
+  (let ((src (datagram-source in 0)))
+    (assert (equal? (car src) "127.0.0.1"))
+    (assert (= (cdr src) (socket-port tx))))
+  ;; only the datagrams of the last receive can be read back
+  (assert (= (udp-send! tx out 1) 1))
+  (assert (= (udp-receive! rx in) 1))
+  (assert (equal? (datagram-ref in 0) "hello"))
+  (assert-fail (datagram-ref in 1) bounds-error)
+  (assert-fail (datagram-source in 1) bounds-error)
+  ;; a listening socket replies to where each datagram came from, or to
+  ;; an address given with datagram-set!
+  (datagram-set! in 0 "pong")
+  (assert (= (udp-send! rx in) 1))
+  (assert (= (udp-receive! tx out) 1))
+  (assert (equal? (datagram-ref out 0) "pong"))
+  (let ((back (udp-listen 0)))
+    (datagram-set! in 0 "again" (cons "127.0.0.1" (socket-port back)))
+    (assert (= (udp-send! rx in) 1))
+    (assert (= (udp-receive! back out) 1))
+    (assert (equal? (datagram-ref out 0) "again"))
+    (assert (equal? (cdr (datagram-source out 0)) (socket-port rx)))
+    (io.close back))
+  (assert-fail (datagram-set! in 0 "x" 'nowhere))
+  (io.close tx)
+  (io.close rx))
+
+;; pause times are counted whichever collector runs; the data survives
+(let ((keep (map-int (lambda (i) (vector i (list i))) 50000)))
+  (dotimes (i 20) (map-int list 10000))
+  (assert (= (apply + (map (lambda (v) (car (vector-ref v 1))) keep))
+             (* 25000 49999)))
+  (let ((p (gc-pause-percentiles)))
+    (assert (= (vector-length p) 6))
+    (assert (> (vector-ref p 0) 0))
+    (dotimes (i 4)
+      (assert (<= (vector-ref p (+ i 1)) (vector-ref p (+ i 2)))))))
+
+;; the collector tests below read one gc-stats entry at a time, and
+;; make garbage until something has happened, or for 2000 rounds
+(define (gc-stat k) (cdr (assq k (gc-stats))))
+(define (churn-until done?)
+  (let loop ((i 0))
+    (if (and (not (done?)) (< i 2000))
+        (begin (map-int list 10000)
+               (loop (+ i 1)))
+        i)))
+
+;; gc-stats adds up what the collector has done
+(let* ((n (gc-stat 'collections))
+       (bytes (gc-stat 'bytes-allocated))
+       (i (churn-until (lambda () (> (gc-stat 'collections) n)))))
+  (assert (> (- (gc-stat 'bytes-allocated) bytes) (* i 10000 2 8)))
+  (let ((s (gc-stats)))
+    (assert (<= (cdr (assq 'heap-used s)) (cdr (assq 'heap-size s))))
+    (assert (= (apply + (map cdr (cdr (assq 'pause-histogram s))))
+               (cdr (assq 'collections s))))))
+
+;; the heap grows for a spike of live data and shrinks back after it
+(let* ((spike (map-int identity 500000))
+       (peak (gc-stat 'heap-size)))
+  (set! spike #f)
+  (churn-until (lambda () (< (gc-stat 'heap-size) peak)))
+  (assert (< (gc-stat 'heap-size) peak)))
+
+;; and never past -:maxheap, raising memory-error instead
+(let ((max (gc-stat 'heap-max)))
+  (if (> max 0)
+      (assert (eq? 'memory-error
+                   (car (trycatch (make-vector max 0) (lambda (e) e)))))))
+
+;; big vectors live outside the heap: they keep their contents across
+;; collections, print with cycles found and go away when dropped
+(let* ((big (make-vector 100000 #f))
+       (n (gc-stat 'collections)))
+  (dotimes (i 100000) (vector-set! big i (list i)))
+  (churn-until (lambda () (>= (gc-stat 'collections) (+ n 3))))
+  (dotimes (i 100000) (assert (equal? (vector-ref big i) (list i))))
+  (vector-set! big 0 big)
+  (let ((s (open-output-string)))
+    (write big s)
+    (assert (equal? (substring (get-output-string s) 0 8) "#0=[#0# ")))
+  (if (> (gc-stat 'large-bytes) 0)  ; not with -:gc=incremental
+      (let ((before (gc-stat 'large-bytes)))
+        (set! big #f)
+        (churn-until (lambda () (< (gc-stat 'large-bytes) before)))
+        (assert (< (gc-stat 'large-bytes) before)))))
+
+;; collection doesn't recurse on nesting, however deep
+(let* ((deep (lambda (n make)
+               (let loop ((i 0) (x '()))
+                 (if (= i n) x (loop (+ i 1) (make x i))))))
+       (cars (deep 1000000 cons))
+       (vecs (deep 100000 vector))
+       (t (table))
+       (n (gc-stat 'collections)))
+  (put! t 'self t)
+  (churn-until (lambda () (>= (gc-stat 'collections) (+ n 2))))
+  (assert (= (let loop ((x cars) (d 0))
+               (if (pair? x) (loop (car x) (+ d 1)) d))
+             1000000))
+  (assert (= (vector-ref (vector-ref vecs 0) 1) 99998))
+  (assert (eq? (get t 'self) t)))
+
+;; the heap profiler charges pairs to the function that made them, and
+;; sees them die
+(define (profiled-list n)
+  (if (= n 0) '() (cons n (profiled-list (- n 1)))))
+(let ((site (lambda ()
+              (let loop ((p (heap-profile)))
+                (cond ((null? p) #f)
+                      ((and (eq? (list-ref (car p) 3) 'pair)
+                            (pair? (list-ref (car p) 4))
+                            (eq? (caar (list-ref (car p) 4)) 'profiled-list))
+                       (car p))
+                      (else (loop (cdr p))))))))
+  (heap-profile-start 1024)
+  (let ((keep (profiled-list 10000)))
+    (heap-profile-stop)
+    (assert (>= (car (site)) (* 5000 16)))
+    (assert (= (cadr (site)) (car (site))))
+    (set! keep #f))
+  (churn-until (lambda () (= (cadr (site)) 0)))
+  (assert (= (cadr (site)) 0))
+  (let ((s (open-output-string)))
+    (heap-profile-write s)
+    (assert (> (length (get-output-string s)) 0))))
+
+; heap census and snapshot
+(let ((keep (map-int (lambda (i) (cons i i)) 5000)))
+  (assert (>= (cadr (assq 'pair (heap-census))) 10000))
+  (let ((s (open-output-string)))
+    (heap-snapshot s)
+    (assert (equal? (substring (get-output-string s) 0 8) "UPSHEAP1")))
+  (assert (= (length keep) 5000)))
+
 (display "all tests pass\n")
 #t
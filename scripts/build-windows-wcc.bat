@@ -20,18 +20,21 @@ wcc386 -q -wx ..\c\hashing.c
 wcc386 -q -wx ..\c\htable.c
 wcc386 -q -wx ..\c\int2str.c
 wcc386 -q -wx ..\c\ios.c
+wcc386 -q -wx ..\c\ios_lz4.c
 wcc386 -q -wx ..\c\iostream.c
 wcc386 -q -wx ..\c\libraries.c
 wcc386 -q -wx ..\c\lltinit.c
+wcc386 -q -wx ..\c\memsearch.c
 wcc386 -q -wx ..\c\os_windows.c
 wcc386 -q -wx ..\c\ptrhash.c
 wcc386 -q -wx ..\c\random.c
 wcc386 -q -wx ..\c\string.c
 wcc386 -q -wx ..\c\table.c
+wcc386 -q -wx ..\c\text_csv.c
 wcc386 -q -wx ..\c\text_ini.c
 wcc386 -q -wx ..\c\time_windows.c
 wcc386 -q -wx ..\c\utf8.c
 
 wcc386 -q -wx ..\c\main.c
 
-wlink op q name upscheme file algo_color, bitvector-ops, bitvector, buf, builtins, dump, env_windows, equalhash, flisp, hashing, htable, int2str, ios, iostream, libraries, lltinit, os_windows, ptrhash, random, string, table, time_windows, text_ini, utf8, main
+wlink op q name upscheme file algo_color, bitvector-ops, bitvector, buf, builtins, dump, env_windows, equalhash, flisp, hashing, htable, int2str, ios, ios_lz4, iostream, libraries, lltinit, memsearch, os_windows, ptrhash, random, string, table, time_windows, text_csv, text_ini, utf8, main
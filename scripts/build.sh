@@ -23,27 +23,32 @@ o_files="$o_files env_unix.o"
 o_files="$o_files equalhash.o"
 o_files="$o_files flisp.o"
 o_files="$o_files main.o"
+o_files="$o_files memsearch.o"
 o_files="$o_files hashing.o"
 o_files="$o_files htable.o"
 o_files="$o_files int2str.o"
 o_files="$o_files ios.o"
+o_files="$o_files ios_lz4.o"
 o_files="$o_files iostream.o"
 o_files="$o_files libraries.o"
 o_files="$o_files lltinit.o"
 o_files="$o_files os_$os.o"
 o_files="$o_files os_unix.o"
+o_files="$o_files os_unix_events.o"
 o_files="$o_files os_unix_process.o"
+o_files="$o_files os_unix_walk.o"
 o_files="$o_files ptrhash.o"
 o_files="$o_files random.o"
 o_files="$o_files socket.o"
 o_files="$o_files string.o"
 o_files="$o_files table.o"
+o_files="$o_files text_csv.o"
 o_files="$o_files text_ini.o"
 o_files="$o_files time_unix.o"
 o_files="$o_files utf8.o"
 o_files="$o_files util.o"
 default_cflags="-Wall -Werror -Wextra -O2 -D NDEBUG -D USE_COMPUTED_GOTO -std=gnu99 -Wno-strict-aliasing"
-default_lflags="-lm"
+default_lflags="-lm -lpthread"
 case "$os" in
 darwin)
     default_cc="clang"
@@ -142,18 +147,23 @@ $CC $CFLAGS -c ../c/hashing.c
 $CC $CFLAGS -c ../c/htable.c
 $CC $CFLAGS -c ../c/int2str.c
 $CC $CFLAGS -c ../c/ios.c
+$CC $CFLAGS -c ../c/ios_lz4.c
 $CC $CFLAGS -c ../c/iostream.c
 $CC $CFLAGS -c ../c/libraries.c
 $CC $CFLAGS -c ../c/lltinit.c
 $CC $CFLAGS -c ../c/main.c
+$CC $CFLAGS -c ../c/memsearch.c
 $CC $CFLAGS -c ../c/os_"$os".c
 $CC $CFLAGS -c ../c/os_unix.c
+$CC $CFLAGS -c ../c/os_unix_events.c
 $CC $CFLAGS -c ../c/os_unix_process.c
+$CC $CFLAGS -c ../c/os_unix_walk.c
 $CC $CFLAGS -c ../c/ptrhash.c
 $CC $CFLAGS -c ../c/random.c
 $CC $CFLAGS -c ../c/socket.c
 $CC $CFLAGS -c ../c/string.c
 $CC $CFLAGS -c ../c/table.c
+$CC $CFLAGS -c ../c/text_csv.c
 $CC $CFLAGS -c ../c/text_ini.c
 $CC $CFLAGS -c ../c/time_unix.c
 $CC $CFLAGS -c ../c/utf8.c
@@ -202,3 +212,8 @@ echo "Entering directory '$PWD'"
 set -x
 
 ../"$builddir"/upscheme unittest.scm
+../"$builddir"/upscheme -:gc=compact unittest.scm
+../"$builddir"/upscheme -:gc=parallel,gcthreads=4 unittest.scm
+../"$builddir"/upscheme -:gc=incremental,gcpause=100 unittest.scm
+../"$builddir"/upscheme -:gc=incremental,maxheap=64m unittest.scm
+../"$builddir"/upscheme -:heap=64k,maxheap=64m,heapgrow=1.5,heapfill=50 unittest.scm